@@ -0,0 +1,177 @@
+#include "hamoopi_assets.h"
+#include <stdio.h>
+#include <sys/stat.h>
+#include <map>
+#include <string>
+#include <utility>
+
+#define FNV_PRIME 0x100000001b3ull
+
+struct AssetKey {
+    int kind;
+    std::string path;  // Resolved
+    uint64_t hash;     // Content hash
+
+    bool operator<(const AssetKey& o) const
+    {
+        if (kind != o.kind)
+            return kind < o.kind;
+        if (hash != o.hash)
+            return hash < o.hash;
+        return path < o.path;
+    }
+};
+
+typedef struct {
+    void* data;
+    hamoopi_asset_free_fn free_fn;
+    int refs;
+} AssetEntry;
+
+// What a bitmap file looked like when it was last hashed
+typedef struct {
+    long long size;
+    time_t mtime;
+    uint64_t hash;
+} FileStamp;
+
+static std::map<AssetKey, AssetEntry> assets;
+static std::map<const void*, AssetKey> asset_keys;
+static std::map<std::string, FileStamp> bitmap_stamps;  // By resolved path
+
+static uint64_t fnv_byte(uint64_t hash, unsigned char b)
+{
+    return (hash ^ b) * FNV_PRIME;
+}
+
+bool hamoopi_asset_hash_file(const char* path, uint64_t* hash)
+{
+    FILE* fp = fopen(path, "rb");
+    if (!fp)
+    {
+        // Stands in for the length; no file is 2^64 - 1 bytes long
+        for (int i = 0; i < 8; i++)
+            *hash = fnv_byte(*hash, 0xff);
+        return false;
+    }
+
+    uint64_t h = *hash;
+    uint64_t length = 0;
+    unsigned char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+    {
+        for (size_t i = 0; i < n; i++)
+            h = fnv_byte(h, buf[i]);
+        length += n;
+    }
+    fclose(fp);
+
+    // The length ends each file, so "ab" + "" and "a" + "b" differ
+    for (int i = 0; i < 8; i++)
+        h = fnv_byte(h, (unsigned char)(length >> (i * 8)));
+    *hash = h;
+    return true;
+}
+
+void* hamoopi_asset_acquire(const char* path, uint64_t hash, int kind,
+                            hamoopi_asset_decode_fn decode, hamoopi_asset_free_fn free_fn, void* ctx)
+{
+    char resolved[1024];
+    canonicalize_filename(resolved, path, sizeof(resolved));
+
+    AssetKey key;
+    key.kind = kind;
+    key.path = resolved;
+    key.hash = hash;
+    std::map<AssetKey, AssetEntry>::iterator it = assets.find(key);
+    if (it != assets.end())
+    {
+        it->second.refs++;
+        return it->second.data;
+    }
+
+    void* data = decode(ctx);
+    if (!data)
+        return NULL;
+
+    AssetEntry entry;
+    entry.data = data;
+    entry.free_fn = free_fn;
+    entry.refs = 1;
+    assets[key] = entry;
+    asset_keys[data] = key;
+    return data;
+}
+
+static void* decode_bitmap(void* ctx)
+{
+    return load_bitmap((const char*)ctx, NULL);
+}
+
+static void free_bitmap(void* data)
+{
+    destroy_bitmap((BITMAP*)data);
+}
+
+BITMAP* hamoopi_asset_bitmap(const char* path)
+{
+    char resolved[1024];
+    canonicalize_filename(resolved, path, sizeof(resolved));
+
+    struct stat st;
+    if (stat(resolved, &st) != 0)
+        return NULL;
+
+    // The last hash of this path holds while its size and time match, so
+    // a file already cached is not read again
+    uint64_t hash = HAMOOPI_ASSET_HASH_SEED;
+    std::map<std::string, FileStamp>::iterator s = bitmap_stamps.find(resolved);
+    if (s != bitmap_stamps.end() && s->second.size == (long long)st.st_size && s->second.mtime == st.st_mtime)
+    {
+        hash = s->second.hash;
+    }
+    else
+    {
+        if (!hamoopi_asset_hash_file(resolved, &hash))
+            return NULL;
+        FileStamp stamp;
+        stamp.size = (long long)st.st_size;
+        stamp.mtime = st.st_mtime;
+        stamp.hash = hash;
+        bitmap_stamps[resolved] = stamp;
+    }
+    return (BITMAP*)hamoopi_asset_acquire(resolved, hash, HAMOOPI_ASSET_KIND_BITMAP,
+                                          decode_bitmap, free_bitmap, resolved);
+}
+
+void hamoopi_asset_release(const void* data)
+{
+    if (!data)
+        return;
+
+    std::map<const void*, AssetKey>::iterator k = asset_keys.find(data);
+    if (k == asset_keys.end())
+        return;
+    std::map<AssetKey, AssetEntry>::iterator it = assets.find(k->second);
+    if (--it->second.refs > 0)
+        return;
+
+    // Forget the stamp too, unless the file has changed and a newer copy
+    // took it over
+    if (it->first.kind == HAMOOPI_ASSET_KIND_BITMAP)
+    {
+        std::map<std::string, FileStamp>::iterator s = bitmap_stamps.find(it->first.path);
+        if (s != bitmap_stamps.end() && s->second.hash == it->first.hash)
+            bitmap_stamps.erase(s);
+    }
+
+    it->second.free_fn(it->second.data);
+    assets.erase(it);
+    asset_keys.erase(k);
+}
+
+int hamoopi_asset_count(void)
+{
+    return (int)assets.size();
+}
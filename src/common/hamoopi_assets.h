@@ -0,0 +1,55 @@
+#ifndef HAMOOPI_ASSETS_H
+#define HAMOOPI_ASSETS_H
+
+#include <allegro.h>
+#include <stdint.h>
+
+// Cache of decoded assets shared by the standalone game and the libretro
+// core.
+//
+// Every asset is keyed by its resolved path plus a hash of the bytes it
+// was decoded from. Acquiring a path whose bytes are already cached hands
+// back the copy already in memory and takes a reference on it; the copy
+// is freed when its last reference is released. Character slots that all
+// point at the same folder therefore share one set of frames, and a
+// mirror match costs the memory of one character. A file changed on disk
+// hashes differently and is decoded again next to the old copy.
+//
+// hamoopi_asset_bitmap only reads a file to hash it when the path is new
+// to the cache or its size or modification time changed, so a cache hit
+// costs a stat.
+//
+// Acquire and release from one thread.
+
+// Seed for a fresh content hash
+#define HAMOOPI_ASSET_HASH_SEED 0xcbf29ce484222325ull
+
+// Folds the file's bytes and length into *hash, so several files can be
+// chained into one key. A file that cannot be read folds in a marker
+// instead, keeping "missing" apart from "empty", and returns false.
+bool hamoopi_asset_hash_file(const char* path, uint64_t* hash);
+
+// Kind used by hamoopi_asset_bitmap
+#define HAMOOPI_ASSET_KIND_BITMAP 0
+
+typedef void* (*hamoopi_asset_decode_fn)(void* ctx);
+typedef void (*hamoopi_asset_free_fn)(void* data);
+
+// Object decoded by decode(ctx) for path (resolved here) and content hash,
+// or the one already decoded for them. kind keeps different decoders of
+// the same bytes apart.
+// Returns NULL when decode fails; failures are not cached.
+void* hamoopi_asset_acquire(const char* path, uint64_t hash, int kind,
+                            hamoopi_asset_decode_fn decode, hamoopi_asset_free_fn free_fn, void* ctx);
+
+// load_bitmap through the cache; NULL when the file is missing or cannot
+// be decoded
+BITMAP* hamoopi_asset_bitmap(const char* path);
+
+// Drops one reference taken by either function above
+void hamoopi_asset_release(const void* data);
+
+// Decoded assets currently held
+int hamoopi_asset_count(void);
+
+#endif /* HAMOOPI_ASSETS_H */
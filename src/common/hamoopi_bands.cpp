@@ -0,0 +1,168 @@
+#include "hamoopi_bands.h"
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+// Stripes thinner than this cost more in wake-ups than they save
+#define HAMOOPI_BANDS_MIN_ROWS 16
+
+struct hamoopi_bands_pool {
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake;   // Workers: new run or quit
+    std::condition_variable done;   // Caller: last worker finished
+    unsigned run = 0;               // Bumped for every run
+    int pending = 0;                // Workers still busy with this run
+    bool quit = false;
+
+    // Current run
+    hamoopi_band_fn fn = nullptr;
+    void* ctx = nullptr;
+    int rows = 0;
+    int stripes = 0;
+};
+
+static void band_rows(int rows, int stripes, int i, int* y0, int* y1)
+{
+    *y0 = (int)((long long)rows * i / stripes);
+    *y1 = (int)((long long)rows * (i + 1) / stripes);
+}
+
+static int stripe_count(const hamoopi_bands_t* b, int rows)
+{
+    int stripes = b->count;
+    if (stripes > rows / HAMOOPI_BANDS_MIN_ROWS)
+        stripes = rows / HAMOOPI_BANDS_MIN_ROWS;
+    return stripes;
+}
+
+// Worker i always takes stripe i; the caller is stripe 0
+static void band_worker(hamoopi_bands_pool* p, int index)
+{
+    unsigned seen = 0;
+    for (;;)
+    {
+        hamoopi_band_fn fn;
+        void* ctx;
+        int rows, stripes;
+        {
+            std::unique_lock<std::mutex> lock(p->mutex);
+            while (!p->quit && p->run == seen)
+                p->wake.wait(lock);
+            if (p->quit)
+                return;
+            seen = p->run;
+            fn = p->fn;
+            ctx = p->ctx;
+            rows = p->rows;
+            stripes = p->stripes;
+        }
+
+        if (index < stripes)
+        {
+            int y0, y1;
+            band_rows(rows, stripes, index, &y0, &y1);
+            fn(ctx, y0, y1);
+        }
+
+        std::lock_guard<std::mutex> lock(p->mutex);
+        if (--p->pending == 0)
+            p->done.notify_one();
+    }
+}
+
+void hamoopi_bands_init(hamoopi_bands_t* b, int threads)
+{
+    b->count = 1;
+    b->pool = NULL;
+
+    if (threads <= 0)
+        threads = (int)std::thread::hardware_concurrency();
+    if (threads <= 1)
+        return;
+
+    hamoopi_bands_pool* p = new (std::nothrow) hamoopi_bands_pool;
+    if (!p)
+        return;
+
+    try
+    {
+        for (int i = 1; i < threads; i++)
+            p->threads.push_back(std::thread(band_worker, p, i));
+    }
+    catch (const std::system_error&)
+    {
+        // Keep the workers that did start
+    }
+
+    if (p->threads.empty())
+    {
+        delete p;
+        return;
+    }
+    b->count = (int)p->threads.size() + 1;
+    b->pool = p;
+}
+
+void hamoopi_bands_free(hamoopi_bands_t* b)
+{
+    hamoopi_bands_pool* p = b->pool;
+    if (p)
+    {
+        {
+            std::lock_guard<std::mutex> lock(p->mutex);
+            p->quit = true;
+        }
+        p->wake.notify_all();
+        for (size_t i = 0; i < p->threads.size(); i++)
+            p->threads[i].join();
+        delete p;
+    }
+    b->count = 1;
+    b->pool = NULL;
+}
+
+void hamoopi_bands_run(hamoopi_bands_t* b, int rows, hamoopi_band_fn fn, void* ctx)
+{
+    if (rows <= 0)
+        return;
+
+    int stripes = stripe_count(b, rows);
+    hamoopi_bands_pool* p = b->pool;
+    if (!p || stripes <= 1)
+    {
+        fn(ctx, 0, rows);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(p->mutex);
+        p->fn = fn;
+        p->ctx = ctx;
+        p->rows = rows;
+        p->stripes = stripes;
+        p->pending = (int)p->threads.size();
+        p->run++;
+    }
+    p->wake.notify_all();
+
+    int y0, y1;
+    band_rows(rows, stripes, 0, &y0, &y1);
+    fn(ctx, y0, y1);
+
+    std::unique_lock<std::mutex> lock(p->mutex);
+    while (p->pending > 0)
+        p->done.wait(lock);
+}
+
+int hamoopi_bands_stripe(const hamoopi_bands_t* b, int rows, int y0)
+{
+    int stripes = stripe_count(b, rows);
+    if (!b->pool || stripes <= 1)
+        return 0;
+    // Inverse of band_rows: stripes < rows, so rounding up lands on i
+    return (int)(((long long)y0 * stripes + rows - 1) / rows);
+}
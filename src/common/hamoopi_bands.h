@@ -0,0 +1,32 @@
+#ifndef HAMOOPI_BANDS_H
+#define HAMOOPI_BANDS_H
+
+// Fixed pool of threads that split full-surface work into horizontal bands.
+//
+// hamoopi_bands_run cuts rows [0, rows) into one stripe per thread and
+// calls fn(ctx, y0, y1) for each stripe; the calling thread takes the
+// first one and returns once all of them are done. Stripes never share a
+// row, so a kernel that only writes its own rows needs no locking.
+// Surfaces too small to be worth splitting run on the caller alone.
+
+typedef void (*hamoopi_band_fn)(void* ctx, int y0, int y1);
+
+typedef struct hamoopi_bands_pool hamoopi_bands_pool;
+
+typedef struct {
+    int count;                 // Stripes per run, caller included
+    hamoopi_bands_pool* pool;  // Worker threads, NULL when count is 1
+} hamoopi_bands_t;
+
+// threads <= 0 uses one per core. Falls back to running everything on the
+// caller (count 1) when threads cannot be started.
+void hamoopi_bands_init(hamoopi_bands_t* b, int threads);
+void hamoopi_bands_free(hamoopi_bands_t* b);
+
+void hamoopi_bands_run(hamoopi_bands_t* b, int rows, hamoopi_band_fn fn, void* ctx);
+
+// Index (0 to count - 1) of the stripe that starts at row y0 in a run over
+// rows, for kernels that keep scratch space per stripe
+int hamoopi_bands_stripe(const hamoopi_bands_t* b, int rows, int y0);
+
+#endif /* HAMOOPI_BANDS_H */
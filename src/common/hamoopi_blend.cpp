@@ -0,0 +1,392 @@
+#include "hamoopi_blend.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#define HAMOOPI_BLEND_X86 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define HAMOOPI_BLEND_NEON 1
+#endif
+
+// SIMD kernels are compiled for their instruction set individually, so
+// the rest of the build keeps its baseline flags
+#if defined(__GNUC__) || defined(__clang__)
+#define BLEND_TARGET(isa) __attribute__((target(isa)))
+#else
+#define BLEND_TARGET(isa)
+#endif
+
+// Blend weight 0..256 from a set_trans_blender style alpha
+static unsigned blend_weight(int alpha)
+{
+    if (alpha <= 0)
+        return 0;
+    if (alpha >= 255)
+        return 256;
+    return (unsigned)alpha + 1;
+}
+
+// ---------------------------------------------------------------------------
+// C reference. Alpha/green and red/blue travel in separate 16-bit lanes of
+// one word; s * n + d * (256 - n) never exceeds 0xFF00, so lanes stay apart.
+// ---------------------------------------------------------------------------
+
+static inline uint32_t blend_pixel(uint32_t s, uint32_t d, unsigned n)
+{
+    unsigned in = 256 - n;
+    uint32_t rb = (((s & 0x00FF00FF) * n + (d & 0x00FF00FF) * in) >> 8) & 0x00FF00FF;
+    uint32_t ag = (((s >> 8) & 0x00FF00FF) * n + ((d >> 8) & 0x00FF00FF) * in) & 0xFF00FF00;
+    return rb | ag;
+}
+
+static inline uint32_t add_pixel(uint32_t s, uint32_t d, unsigned n)
+{
+    uint32_t out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        unsigned c = ((d >> shift) & 0xFF) + ((((s >> shift) & 0xFF) * n) >> 8);
+        out |= (uint32_t)(c > 255 ? 255 : c) << shift;
+    }
+    return out;
+}
+
+static void fill_c(uint32_t* dst, int w, uint32_t color, unsigned n)
+{
+    for (int x = 0; x < w; x++)
+        dst[x] = blend_pixel(color, dst[x], n);
+}
+
+static void sprite_c(uint32_t* dst, const uint32_t* src, int w, uint32_t mask, unsigned n)
+{
+    for (int x = 0; x < w; x++)
+    {
+        if (src[x] != mask)
+            dst[x] = blend_pixel(src[x], dst[x], n);
+    }
+}
+
+static void add_c(uint32_t* dst, const uint32_t* src, int w, uint32_t mask, unsigned n)
+{
+    for (int x = 0; x < w; x++)
+    {
+        if (src[x] != mask)
+            dst[x] = add_pixel(src[x], dst[x], n);
+    }
+}
+
+#if defined(HAMOOPI_BLEND_X86)
+
+// ---------------------------------------------------------------------------
+// SSE2: 4 pixels, channels widened to 16 bits
+// ---------------------------------------------------------------------------
+
+BLEND_TARGET("sse2")
+static inline __m128i lerp_sse2(__m128i s, __m128i d, __m128i vn, __m128i vin)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), vn),
+                               _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), vin));
+    __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), vn),
+                               _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), vin));
+    return _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+}
+
+BLEND_TARGET("sse2")
+static void fill_sse2(uint32_t* dst, int w, uint32_t color, unsigned n)
+{
+    const __m128i s = _mm_set1_epi32((int)color);
+    const __m128i vn = _mm_set1_epi16((short)n);
+    const __m128i vin = _mm_set1_epi16((short)(256 - n));
+    int x = 0;
+    for (; x + 4 <= w; x += 4)
+    {
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + x));
+        _mm_storeu_si128((__m128i*)(dst + x), lerp_sse2(s, d, vn, vin));
+    }
+    fill_c(dst + x, w - x, color, n);
+}
+
+BLEND_TARGET("sse2")
+static void sprite_sse2(uint32_t* dst, const uint32_t* src, int w, uint32_t mask, unsigned n)
+{
+    const __m128i vmask = _mm_set1_epi32((int)mask);
+    const __m128i vn = _mm_set1_epi16((short)n);
+    const __m128i vin = _mm_set1_epi16((short)(256 - n));
+    int x = 0;
+    for (; x + 4 <= w; x += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i*)(src + x));
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + x));
+        __m128i keep = _mm_cmpeq_epi32(s, vmask);
+        __m128i b = lerp_sse2(s, d, vn, vin);
+        _mm_storeu_si128((__m128i*)(dst + x), _mm_or_si128(_mm_and_si128(keep, d), _mm_andnot_si128(keep, b)));
+    }
+    sprite_c(dst + x, src + x, w - x, mask, n);
+}
+
+BLEND_TARGET("sse2")
+static void add_sse2(uint32_t* dst, const uint32_t* src, int w, uint32_t mask, unsigned n)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i vmask = _mm_set1_epi32((int)mask);
+    const __m128i vn = _mm_set1_epi16((short)n);
+    int x = 0;
+    for (; x + 4 <= w; x += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i*)(src + x));
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + x));
+        __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), vn), 8);
+        __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), vn), 8);
+        __m128i sum = _mm_adds_epu8(d, _mm_packus_epi16(lo, hi));
+        __m128i keep = _mm_cmpeq_epi32(s, vmask);
+        _mm_storeu_si128((__m128i*)(dst + x), _mm_or_si128(_mm_and_si128(keep, d), _mm_andnot_si128(keep, sum)));
+    }
+    add_c(dst + x, src + x, w - x, mask, n);
+}
+
+// ---------------------------------------------------------------------------
+// AVX2: the same in 8 pixel registers. Unpack and pack both work inside
+// each 128-bit lane, so pixel order is preserved.
+// ---------------------------------------------------------------------------
+
+BLEND_TARGET("avx2")
+static inline __m256i lerp_avx2(__m256i s, __m256i d, __m256i vn, __m256i vin)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), vn),
+                                  _mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), vin));
+    __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), vn),
+                                  _mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), vin));
+    return _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+}
+
+BLEND_TARGET("avx2")
+static void fill_avx2(uint32_t* dst, int w, uint32_t color, unsigned n)
+{
+    const __m256i s = _mm256_set1_epi32((int)color);
+    const __m256i vn = _mm256_set1_epi16((short)n);
+    const __m256i vin = _mm256_set1_epi16((short)(256 - n));
+    int x = 0;
+    for (; x + 8 <= w; x += 8)
+    {
+        __m256i d = _mm256_loadu_si256((const __m256i*)(dst + x));
+        _mm256_storeu_si256((__m256i*)(dst + x), lerp_avx2(s, d, vn, vin));
+    }
+    fill_c(dst + x, w - x, color, n);
+}
+
+BLEND_TARGET("avx2")
+static void sprite_avx2(uint32_t* dst, const uint32_t* src, int w, uint32_t mask, unsigned n)
+{
+    const __m256i vmask = _mm256_set1_epi32((int)mask);
+    const __m256i vn = _mm256_set1_epi16((short)n);
+    const __m256i vin = _mm256_set1_epi16((short)(256 - n));
+    int x = 0;
+    for (; x + 8 <= w; x += 8)
+    {
+        __m256i s = _mm256_loadu_si256((const __m256i*)(src + x));
+        __m256i d = _mm256_loadu_si256((const __m256i*)(dst + x));
+        __m256i keep = _mm256_cmpeq_epi32(s, vmask);
+        _mm256_storeu_si256((__m256i*)(dst + x), _mm256_blendv_epi8(lerp_avx2(s, d, vn, vin), d, keep));
+    }
+    sprite_c(dst + x, src + x, w - x, mask, n);
+}
+
+BLEND_TARGET("avx2")
+static void add_avx2(uint32_t* dst, const uint32_t* src, int w, uint32_t mask, unsigned n)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i vmask = _mm256_set1_epi32((int)mask);
+    const __m256i vn = _mm256_set1_epi16((short)n);
+    int x = 0;
+    for (; x + 8 <= w; x += 8)
+    {
+        __m256i s = _mm256_loadu_si256((const __m256i*)(src + x));
+        __m256i d = _mm256_loadu_si256((const __m256i*)(dst + x));
+        __m256i lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), vn), 8);
+        __m256i hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), vn), 8);
+        __m256i sum = _mm256_adds_epu8(d, _mm256_packus_epi16(lo, hi));
+        __m256i keep = _mm256_cmpeq_epi32(s, vmask);
+        _mm256_storeu_si256((__m256i*)(dst + x), _mm256_blendv_epi8(sum, d, keep));
+    }
+    add_c(dst + x, src + x, w - x, mask, n);
+}
+
+#elif defined(HAMOOPI_BLEND_NEON)
+
+// ---------------------------------------------------------------------------
+// NEON: 4 pixels. Weights reach 256, so products are taken in 16 bits.
+// ---------------------------------------------------------------------------
+
+static inline uint8x16_t lerp_neon(uint8x16_t s, uint8x16_t d, uint16x8_t vn, uint16x8_t vin)
+{
+    uint16x8_t lo = vaddq_u16(vmulq_u16(vmovl_u8(vget_low_u8(s)), vn), vmulq_u16(vmovl_u8(vget_low_u8(d)), vin));
+    uint16x8_t hi = vaddq_u16(vmulq_u16(vmovl_u8(vget_high_u8(s)), vn), vmulq_u16(vmovl_u8(vget_high_u8(d)), vin));
+    return vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+}
+
+static void fill_neon(uint32_t* dst, int w, uint32_t color, unsigned n)
+{
+    const uint8x16_t s = vreinterpretq_u8_u32(vdupq_n_u32(color));
+    const uint16x8_t vn = vdupq_n_u16((uint16_t)n);
+    const uint16x8_t vin = vdupq_n_u16((uint16_t)(256 - n));
+    int x = 0;
+    for (; x + 4 <= w; x += 4)
+    {
+        uint8x16_t d = vreinterpretq_u8_u32(vld1q_u32(dst + x));
+        vst1q_u32(dst + x, vreinterpretq_u32_u8(lerp_neon(s, d, vn, vin)));
+    }
+    fill_c(dst + x, w - x, color, n);
+}
+
+static void sprite_neon(uint32_t* dst, const uint32_t* src, int w, uint32_t mask, unsigned n)
+{
+    const uint32x4_t vmask = vdupq_n_u32(mask);
+    const uint16x8_t vn = vdupq_n_u16((uint16_t)n);
+    const uint16x8_t vin = vdupq_n_u16((uint16_t)(256 - n));
+    int x = 0;
+    for (; x + 4 <= w; x += 4)
+    {
+        uint32x4_t s = vld1q_u32(src + x);
+        uint32x4_t d = vld1q_u32(dst + x);
+        uint32x4_t b = vreinterpretq_u32_u8(lerp_neon(vreinterpretq_u8_u32(s), vreinterpretq_u8_u32(d), vn, vin));
+        vst1q_u32(dst + x, vbslq_u32(vceqq_u32(s, vmask), d, b));
+    }
+    sprite_c(dst + x, src + x, w - x, mask, n);
+}
+
+static void add_neon(uint32_t* dst, const uint32_t* src, int w, uint32_t mask, unsigned n)
+{
+    const uint32x4_t vmask = vdupq_n_u32(mask);
+    const uint16x8_t vn = vdupq_n_u16((uint16_t)n);
+    int x = 0;
+    for (; x + 4 <= w; x += 4)
+    {
+        uint32x4_t s = vld1q_u32(src + x);
+        uint32x4_t d = vld1q_u32(dst + x);
+        uint8x16_t s8 = vreinterpretq_u8_u32(s);
+        uint8x8_t lo = vshrn_n_u16(vmulq_u16(vmovl_u8(vget_low_u8(s8)), vn), 8);
+        uint8x8_t hi = vshrn_n_u16(vmulq_u16(vmovl_u8(vget_high_u8(s8)), vn), 8);
+        uint32x4_t sum = vreinterpretq_u32_u8(vqaddq_u8(vreinterpretq_u8_u32(d), vcombine_u8(lo, hi)));
+        vst1q_u32(dst + x, vbslq_u32(vceqq_u32(s, vmask), d, sum));
+    }
+    add_c(dst + x, src + x, w - x, mask, n);
+}
+
+#endif
+
+// ---------------------------------------------------------------------------
+// Dispatch
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    const char* name;
+    void (*fill)(uint32_t* dst, int w, uint32_t color, unsigned n);
+    void (*sprite)(uint32_t* dst, const uint32_t* src, int w, uint32_t mask, unsigned n);
+    void (*add)(uint32_t* dst, const uint32_t* src, int w, uint32_t mask, unsigned n);
+} blend_kernels;
+
+static const blend_kernels kernels_c = { "c", fill_c, sprite_c, add_c };
+#if defined(HAMOOPI_BLEND_X86)
+static const blend_kernels kernels_sse2 = { "sse2", fill_sse2, sprite_sse2, add_sse2 };
+static const blend_kernels kernels_avx2 = { "avx2", fill_avx2, sprite_avx2, add_avx2 };
+#elif defined(HAMOOPI_BLEND_NEON)
+static const blend_kernels kernels_neon = { "neon", fill_neon, sprite_neon, add_neon };
+#endif
+
+#if defined(HAMOOPI_BLEND_X86)
+static void cpu_features(bool* sse2, bool* avx2)
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int max_leaf = info[0];
+    __cpuid(info, 1);
+    *sse2 = (info[3] & (1 << 26)) != 0;
+    // AVX state must also be enabled by the OS (OSXSAVE + XGETBV)
+    bool avx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+    *avx2 = false;
+    if (avx && max_leaf >= 7)
+    {
+        __cpuidex(info, 7, 0);
+        *avx2 = (info[1] & (1 << 5)) != 0;
+    }
+#else
+    __builtin_cpu_init();
+    *sse2 = __builtin_cpu_supports("sse2") != 0;
+    *avx2 = __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+#endif
+
+static const blend_kernels* pick_kernels(void)
+{
+#if defined(HAMOOPI_BLEND_X86)
+    bool sse2, avx2;
+    cpu_features(&sse2, &avx2);
+    if (avx2)
+        return &kernels_avx2;
+    if (sse2)
+        return &kernels_sse2;
+#elif defined(HAMOOPI_BLEND_NEON)
+    return &kernels_neon;
+#endif
+    return &kernels_c;
+}
+
+// Resolved once, while the program (or core) is loaded, before any thread
+// can draw
+static const blend_kernels* const kernels = pick_kernels();
+
+void hamoopi_blend_fill(uint32_t* dst, int w, uint32_t color, int alpha)
+{
+    unsigned n = blend_weight(alpha);
+    if (!dst || w <= 0 || n == 0)
+        return;
+    kernels->fill(dst, w, color, n);
+}
+
+void hamoopi_blend_darken(uint32_t* dst, int w, int alpha)
+{
+    hamoopi_blend_fill(dst, w, 0, alpha);
+}
+
+void hamoopi_blend_sprite(uint32_t* dst, const uint32_t* src, int w, uint32_t mask, int alpha)
+{
+    unsigned n = blend_weight(alpha);
+    if (!dst || !src || w <= 0 || n == 0)
+        return;
+    kernels->sprite(dst, src, w, mask, n);
+}
+
+void hamoopi_blend_add(uint32_t* dst, const uint32_t* src, int w, uint32_t mask, int alpha)
+{
+    unsigned n = blend_weight(alpha);
+    if (!dst || !src || w <= 0 || n == 0)
+        return;
+    kernels->add(dst, src, w, mask, n);
+}
+
+void hamoopi_blend_fill_rect(uint32_t* dst, size_t dst_pitch, int w, int h, uint32_t color, int alpha)
+{
+    for (int y = 0; y < h; y++)
+        hamoopi_blend_fill((uint32_t*)((uint8_t*)dst + (size_t)y * dst_pitch), w, color, alpha);
+}
+
+void hamoopi_blend_sprite_rect(uint32_t* dst, size_t dst_pitch, const uint32_t* src, size_t src_pitch,
+                               int w, int h, uint32_t mask, int alpha)
+{
+    for (int y = 0; y < h; y++)
+    {
+        hamoopi_blend_sprite((uint32_t*)((uint8_t*)dst + (size_t)y * dst_pitch),
+                             (const uint32_t*)((const uint8_t*)src + (size_t)y * src_pitch), w, mask, alpha);
+    }
+}
+
+const char* hamoopi_blend_isa(void)
+{
+    return kernels->name;
+}
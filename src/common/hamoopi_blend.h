@@ -0,0 +1,39 @@
+#ifndef HAMOOPI_BLEND_H
+#define HAMOOPI_BLEND_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Constant-alpha blending kernels shared by the standalone game and the
+// libretro core, replacing Allegro's per-pixel blender callbacks for
+// fades, shadows and translucent overlays on 32bpp XRGB8888 rows.
+//
+// alpha is 0..255 as in set_trans_blender: 0 keeps the destination, 255
+// gives the source. Every channel is blended as
+//   d = (s * n + d * (256 - n)) >> 8,  n = alpha + (alpha > 0)
+// and every implementation (C, SSE2, AVX2, NEON) gives the same bits. The
+// fastest one the CPU supports is picked once, at startup.
+
+// Every pixel blended toward color
+void hamoopi_blend_fill(uint32_t* dst, int w, uint32_t color, int alpha);
+
+// Every pixel blended toward black (fades)
+void hamoopi_blend_darken(uint32_t* dst, int w, int alpha);
+
+// src blended over dst, skipping pixels equal to mask; alpha 255 is a
+// plain masked copy
+void hamoopi_blend_sprite(uint32_t* dst, const uint32_t* src, int w, uint32_t mask, int alpha);
+
+// src scaled by alpha and added to dst, saturating at 255, skipping
+// pixels equal to mask
+void hamoopi_blend_add(uint32_t* dst, const uint32_t* src, int w, uint32_t mask, int alpha);
+
+// Rectangle versions: dst points at the first pixel, pitches in bytes
+void hamoopi_blend_fill_rect(uint32_t* dst, size_t dst_pitch, int w, int h, uint32_t color, int alpha);
+void hamoopi_blend_sprite_rect(uint32_t* dst, size_t dst_pitch, const uint32_t* src, size_t src_pitch,
+                               int w, int h, uint32_t mask, int alpha);
+
+// "avx2", "sse2", "neon" or "c"
+const char* hamoopi_blend_isa(void);
+
+#endif /* HAMOOPI_BLEND_H */
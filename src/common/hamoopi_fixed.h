@@ -0,0 +1,64 @@
+#ifndef HAMOOPI_FIXED_H
+#define HAMOOPI_FIXED_H
+
+#include <stdint.h>
+
+// 16.16 fixed point scalar for deterministic simulation.
+//
+// Positions, speeds, gravity and collision boxes use hamoopi_sim_t. By
+// default that is a plain float; building with HAMOOPI_FIXED_POINT switches
+// it to hamoopi_fixed, whose arithmetic is integer only and therefore
+// bit-exact across compilers, optimization levels and CPUs (replays,
+// lockstep netplay, FPU-less targets).
+//
+// Any arithmetic value converts implicitly, so literals like 0.5f and
+// config values read with atof() work unchanged; they are rounded to the
+// nearest 1/65536 once. Converting back out (drawing) needs an explicit
+// (int) or (float) cast, which keeps stray float math out of the
+// simulation.
+
+struct hamoopi_fixed {
+    int32_t raw;
+
+    hamoopi_fixed() = default;
+    constexpr hamoopi_fixed(double v)
+        : raw((int32_t)(v * 65536.0 + (v < 0 ? -0.5 : 0.5))) {}
+
+    static hamoopi_fixed from_raw(int32_t r) { hamoopi_fixed f; f.raw = r; return f; }
+
+    // Truncates toward zero, like a float to int cast
+    explicit operator int() const { return raw >= 0 ? raw >> 16 : -((-raw) >> 16); }
+    explicit operator float() const { return (float)raw / 65536.0f; }
+
+    hamoopi_fixed operator-() const { return from_raw(-raw); }
+    hamoopi_fixed& operator+=(hamoopi_fixed o) { raw += o.raw; return *this; }
+    hamoopi_fixed& operator-=(hamoopi_fixed o) { raw -= o.raw; return *this; }
+    hamoopi_fixed& operator*=(hamoopi_fixed o) { raw = (int32_t)(((int64_t)raw * o.raw) >> 16); return *this; }
+    hamoopi_fixed& operator/=(hamoopi_fixed o) { raw = (int32_t)(((int64_t)raw << 16) / o.raw); return *this; }
+};
+
+static inline hamoopi_fixed operator+(hamoopi_fixed a, hamoopi_fixed b) { return a += b; }
+static inline hamoopi_fixed operator-(hamoopi_fixed a, hamoopi_fixed b) { return a -= b; }
+static inline hamoopi_fixed operator*(hamoopi_fixed a, hamoopi_fixed b) { return a *= b; }
+static inline hamoopi_fixed operator/(hamoopi_fixed a, hamoopi_fixed b) { return a /= b; }
+static inline bool operator==(hamoopi_fixed a, hamoopi_fixed b) { return a.raw == b.raw; }
+static inline bool operator!=(hamoopi_fixed a, hamoopi_fixed b) { return a.raw != b.raw; }
+static inline bool operator<(hamoopi_fixed a, hamoopi_fixed b)  { return a.raw < b.raw; }
+static inline bool operator>(hamoopi_fixed a, hamoopi_fixed b)  { return a.raw > b.raw; }
+static inline bool operator<=(hamoopi_fixed a, hamoopi_fixed b) { return a.raw <= b.raw; }
+static inline bool operator>=(hamoopi_fixed a, hamoopi_fixed b) { return a.raw >= b.raw; }
+
+static inline hamoopi_fixed hamoopi_abs(hamoopi_fixed v) { return v.raw < 0 ? -v : v; }
+static inline float hamoopi_abs(float v) { return v < 0 ? -v : v; }
+
+#ifdef HAMOOPI_FIXED_POINT
+typedef hamoopi_fixed hamoopi_sim_t;
+#else
+typedef float hamoopi_sim_t;
+#endif
+
+// An int position moved by v, truncated toward zero like "int += float"
+// (the standalone game keeps its fighters on int positions)
+static inline int hamoopi_sim_add(int pos, hamoopi_sim_t v) { return (int)(pos + v); }
+
+#endif /* HAMOOPI_FIXED_H */
@@ -0,0 +1,22 @@
+#include "hamoopi_input.h"
+
+void hamoopi_input_update(hamoopi_input_t* in, uint32_t held)
+{
+    in->previous = in->held;
+    in->held = held;
+}
+
+void hamoopi_input_clear(hamoopi_input_t* in)
+{
+    in->held = 0;
+    in->previous = 0;
+}
+
+uint32_t hamoopi_input_from_keys(const volatile char* keys, int* const* scancodes, int count)
+{
+    uint32_t held = 0;
+    for (int i = 0; i < count; i++)
+        if (keys[*scancodes[i]])
+            held |= 1u << i;
+    return held;
+}
@@ -0,0 +1,43 @@
+#ifndef HAMOOPI_INPUT_H
+#define HAMOOPI_INPUT_H
+
+#include <stdint.h>
+
+// Per-frame input state shared by the standalone game and the libretro core.
+// A device (a pad, the system keys, the mouse) is a word of button bits,
+// kept for this frame and the previous one. Edges are two bitwise ops:
+//   pressed  = held & ~previous
+//   released = previous & ~held
+
+typedef struct {
+    uint32_t held;
+    uint32_t previous;
+} hamoopi_input_t;
+
+// Start a new frame with the buttons currently down
+void hamoopi_input_update(hamoopi_input_t* in, uint32_t held);
+void hamoopi_input_clear(hamoopi_input_t* in);
+
+// Bit n set when keys[*scancodes[n]] is down (Allegro key[] and the
+// configurable scancode variables)
+uint32_t hamoopi_input_from_keys(const volatile char* keys, int* const* scancodes, int count);
+
+// Whole-device masks
+static inline uint32_t hamoopi_input_pressed_mask(const hamoopi_input_t* in)  { return in->held & ~in->previous; }
+static inline uint32_t hamoopi_input_hold_mask(const hamoopi_input_t* in)     { return in->held & in->previous; }
+static inline uint32_t hamoopi_input_released_mask(const hamoopi_input_t* in) { return in->previous & ~in->held; }
+
+// Single buttons, 0 or 1
+static inline int hamoopi_input_down(const hamoopi_input_t* in, int bit)     { return (int)((in->held >> bit) & 1u); }
+static inline int hamoopi_input_pressed(const hamoopi_input_t* in, int bit)  { return (int)((hamoopi_input_pressed_mask(in) >> bit) & 1u); }
+static inline int hamoopi_input_hold(const hamoopi_input_t* in, int bit)     { return (int)((hamoopi_input_hold_mask(in) >> bit) & 1u); }
+static inline int hamoopi_input_released(const hamoopi_input_t* in, int bit) { return (int)((hamoopi_input_released_mask(in) >> bit) & 1u); }
+
+// 0 = up, 1 = pressed this frame, 2 = held, 3 = released this frame
+static inline int hamoopi_input_status(const hamoopi_input_t* in, int bit)
+{
+    static const int status[4] = { 0, 1, 3, 2 };  // index: held | previous << 1
+    return status[((in->held >> bit) & 1u) | (((in->previous >> bit) & 1u) << 1)];
+}
+
+#endif /* HAMOOPI_INPUT_H */
@@ -0,0 +1,278 @@
+#include "hamoopi_loader.h"
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+enum { SLOT_QUEUED = 0, SLOT_TAKEN, SLOT_READY, SLOT_HANDED };
+
+typedef struct {
+    int state;
+    bool on_caller;  // Decoded by the caller when handed over
+    void* data;
+} LoadSlot;
+
+struct hamoopi_loader_pool {
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable ready;   // Caller: an entry finished
+    std::condition_variable idle;    // Caller: no worker is decoding
+    std::condition_variable resume;  // Workers: the caller stopped decoding
+    std::vector<LoadSlot> slots;
+    const hamoopi_load_entry* entries = nullptr;
+    int next = 0;                    // No queued entry before this one
+    int handed = 0;
+    int decoding = 0;                // Workers inside an Allegro loader
+    bool caller_decoding = false;
+};
+
+static void* decode_entry(const hamoopi_load_entry* e)
+{
+    switch (e->kind)
+    {
+    case HAMOOPI_LOAD_BITMAP: return load_bitmap(e->path, NULL);
+    case HAMOOPI_LOAD_FONT:   return load_font(e->path, NULL, NULL);
+    case HAMOOPI_LOAD_SAMPLE: return load_sample(e->path);
+    case HAMOOPI_LOAD_MIDI:   return load_midi(e->path);
+    }
+    return NULL;
+}
+
+static void store_entry(const hamoopi_load_entry* e, void* data)
+{
+    switch (e->kind)
+    {
+    case HAMOOPI_LOAD_BITMAP: *(BITMAP**)e->dest = (BITMAP*)data; break;
+    case HAMOOPI_LOAD_FONT:   *(FONT**)e->dest = (FONT*)data; break;
+    case HAMOOPI_LOAD_SAMPLE: *(SAMPLE**)e->dest = (SAMPLE*)data; break;
+    case HAMOOPI_LOAD_MIDI:   *(MIDI**)e->dest = (MIDI*)data; break;
+    }
+    if (!data && e->error)
+        *e->error = 1;
+    if (e->present)
+        *e->present = data ? 1 : 0;
+}
+
+static bool has_extension(const char* path, const char* ext)
+{
+    const char* dot = strrchr(path, '.');
+    if (!dot || strlen(dot) != strlen(ext))
+        return false;
+    for (int i = 0; dot[i]; i++)
+        if (tolower((unsigned char)dot[i]) != ext[i])
+            return false;
+    return true;
+}
+
+// WAVs, MIDIs and 24-bit PCX files (8 bits x 3 planes) only allocate and
+// convert between truecolor formats; a missing file simply fails
+static bool worker_may_decode(const hamoopi_load_entry* e)
+{
+    if (e->kind == HAMOOPI_LOAD_SAMPLE || e->kind == HAMOOPI_LOAD_MIDI)
+        return true;
+    if (e->kind != HAMOOPI_LOAD_BITMAP || !has_extension(e->path, ".pcx"))
+        return false;
+
+    FILE* fp = fopen(e->path, "rb");
+    if (!fp)
+        return true;
+    unsigned char header[128];
+    size_t n = fread(header, 1, sizeof(header), fp);
+    fclose(fp);
+    return n == sizeof(header) && header[0] == 10 && header[3] == 8 && header[65] == 3;
+}
+
+// Pulls the file into the OS cache for the caller to decode
+static void read_ahead(const char* path)
+{
+    FILE* fp = fopen(path, "rb");
+    if (!fp)
+        return;
+    char buf[16384];
+    while (fread(buf, 1, sizeof(buf), fp) == sizeof(buf)) {}
+    fclose(fp);
+}
+
+static void load_worker(hamoopi_loader_pool* p)
+{
+    int count = (int)p->slots.size();
+    for (;;)
+    {
+        int i;
+        {
+            std::lock_guard<std::mutex> lock(p->mutex);
+            while (p->next < count && p->slots[p->next].state != SLOT_QUEUED)
+                p->next++;
+            if (p->next >= count)
+                return;
+            i = p->next++;
+            p->slots[i].state = SLOT_TAKEN;
+        }
+
+        const hamoopi_load_entry* e = &p->entries[i];
+        bool on_caller = !worker_may_decode(e);
+        void* data = NULL;
+        if (on_caller)
+        {
+            read_ahead(e->path);
+        }
+        else
+        {
+            {
+                std::unique_lock<std::mutex> lock(p->mutex);
+                while (p->caller_decoding)
+                    p->resume.wait(lock);
+                p->decoding++;
+            }
+            data = decode_entry(e);
+            std::lock_guard<std::mutex> lock(p->mutex);
+            if (--p->decoding == 0)
+                p->idle.notify_one();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(p->mutex);
+            p->slots[i].data = data;
+            p->slots[i].on_caller = on_caller;
+            p->slots[i].state = SLOT_READY;
+        }
+        p->ready.notify_all();
+    }
+}
+
+// Decodes on the caller with every worker kept out of Allegro's loaders
+static void* decode_alone(hamoopi_loader_pool* p, const hamoopi_load_entry* e)
+{
+    {
+        std::unique_lock<std::mutex> lock(p->mutex);
+        p->caller_decoding = true;
+        while (p->decoding > 0)
+            p->idle.wait(lock);
+    }
+    void* data = decode_entry(e);
+    {
+        std::lock_guard<std::mutex> lock(p->mutex);
+        p->caller_decoding = false;
+    }
+    p->resume.notify_all();
+    return data;
+}
+
+// Slot i must be ready
+static void hand_over(hamoopi_loader_t* l, int i)
+{
+    hamoopi_loader_pool* p = l->pool;
+    LoadSlot* s = &p->slots[i];
+    const hamoopi_load_entry* e = &l->entries[i];
+
+    store_entry(e, s->on_caller ? decode_alone(p, e) : s->data);
+
+    std::lock_guard<std::mutex> lock(p->mutex);
+    s->state = SLOT_HANDED;
+    p->handed++;
+}
+
+void hamoopi_loader_start(hamoopi_loader_t* l, const hamoopi_load_entry* entries, int count, int threads)
+{
+    l->entries = entries;
+    l->count = count;
+    l->pool = NULL;
+
+    hamoopi_loader_pool* p = new (std::nothrow) hamoopi_loader_pool;
+    if (!p)
+    {
+        for (int i = 0; i < count; i++)
+            store_entry(&entries[i], decode_entry(&entries[i]));
+        return;
+    }
+    p->entries = entries;
+    p->slots.resize(count);
+    for (int i = 0; i < count; i++)
+    {
+        p->slots[i].state = SLOT_QUEUED;
+        p->slots[i].on_caller = false;
+        p->slots[i].data = NULL;
+    }
+    l->pool = p;
+
+    if (threads <= 0)
+        threads = (int)std::thread::hardware_concurrency();
+    if (threads > count)
+        threads = count;
+    try
+    {
+        for (int i = 0; i < threads; i++)
+            p->threads.push_back(std::thread(load_worker, p));
+    }
+    catch (const std::system_error&)
+    {
+        // The caller loads whatever no worker takes
+    }
+}
+
+bool hamoopi_loader_poll(hamoopi_loader_t* l)
+{
+    hamoopi_loader_pool* p = l->pool;
+    if (!p)
+        return true;
+
+    for (int i = 0; i < l->count; i++)
+    {
+        int state;
+        {
+            std::lock_guard<std::mutex> lock(p->mutex);
+            state = p->slots[i].state;
+        }
+        if (state == SLOT_READY)
+            hand_over(l, i);
+    }
+
+    std::lock_guard<std::mutex> lock(p->mutex);
+    return p->handed == l->count;
+}
+
+void hamoopi_loader_wait(hamoopi_loader_t* l, int count)
+{
+    hamoopi_loader_pool* p = l->pool;
+    if (!p)
+        return;
+    if (count > l->count)
+        count = l->count;
+
+    for (int i = 0; i < count; i++)
+    {
+        {
+            std::unique_lock<std::mutex> lock(p->mutex);
+            LoadSlot* s = &p->slots[i];
+            if (s->state == SLOT_HANDED)
+                continue;
+            if (s->state == SLOT_QUEUED)
+            {
+                // Not taken yet: load it here rather than wait for a worker
+                s->on_caller = true;
+                s->state = SLOT_READY;
+            }
+            while (s->state != SLOT_READY)
+                p->ready.wait(lock);
+        }
+        hand_over(l, i);
+    }
+}
+
+void hamoopi_loader_finish(hamoopi_loader_t* l)
+{
+    hamoopi_loader_pool* p = l->pool;
+    if (!p)
+        return;
+
+    hamoopi_loader_wait(l, l->count);
+    for (size_t i = 0; i < p->threads.size(); i++)
+        p->threads[i].join();
+    delete p;
+    l->pool = NULL;
+}
@@ -0,0 +1,59 @@
+#ifndef HAMOOPI_LOADER_H
+#define HAMOOPI_LOADER_H
+
+#include <allegro.h>
+
+// Manifest-driven asset loader: bitmaps, fonts, samples and MIDIs are
+// decoded on a pool of threads while the caller keeps running.
+//
+// Workers take entries in manifest order, so whatever is needed first
+// goes at the top. Finished entries are handed over on the calling
+// thread by hamoopi_loader_poll, _wait and _finish, which store the
+// result in *dest and set the entry's flags; until then *dest keeps its
+// old value.
+//
+// Allegro's loaders are not thread-safe in general. Workers only decode
+// truecolor PCX files, WAVs and MIDIs, which just allocate and convert
+// between truecolor formats. Fonts and paletted or non-PCX images go
+// through Allegro's global colour conversion and palette, so workers only
+// read them ahead and the caller decodes them while no worker is decoding.
+
+enum {
+    HAMOOPI_LOAD_BITMAP = 0,
+    HAMOOPI_LOAD_FONT,
+    HAMOOPI_LOAD_SAMPLE,
+    HAMOOPI_LOAD_MIDI
+};
+
+typedef struct {
+    const char* path;
+    int kind;      // HAMOOPI_LOAD_*
+    void* dest;    // BITMAP**, FONT**, SAMPLE** or MIDI**, by kind
+    int* error;    // Set to 1 when the file does not load (may be NULL)
+    int* present;  // 1 when the file loaded, 0 when not (may be NULL)
+} hamoopi_load_entry;
+
+typedef struct hamoopi_loader_pool hamoopi_loader_pool;
+
+typedef struct {
+    const hamoopi_load_entry* entries;
+    int count;
+    hamoopi_loader_pool* pool;  // NULL once finished
+} hamoopi_loader_t;
+
+// entries must stay valid until hamoopi_loader_finish. threads <= 0 uses
+// one per core; when no thread starts, entries load on the caller as
+// they are waited for.
+void hamoopi_loader_start(hamoopi_loader_t* l, const hamoopi_load_entry* entries, int count, int threads);
+
+// Hands over whatever has finished; true once every entry has been
+bool hamoopi_loader_poll(hamoopi_loader_t* l);
+
+// Blocks until the first count entries are handed over, loading any
+// that no worker has taken yet
+void hamoopi_loader_wait(hamoopi_loader_t* l, int count);
+
+// Hands over every entry and stops the threads
+void hamoopi_loader_finish(hamoopi_loader_t* l);
+
+#endif /* HAMOOPI_LOADER_H */
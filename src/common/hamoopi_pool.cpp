@@ -0,0 +1,138 @@
+#include "hamoopi_pool.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define POOL_ARRAYS(X) \
+    X(x, hamoopi_sim_t) X(y, hamoopi_sim_t) X(vx, hamoopi_sim_t) X(vy, hamoopi_sim_t) \
+    X(type, int) X(owner, int) X(frame, int) X(frame_time, int) \
+    X(frames, int) X(timer, int) X(life, int) X(param, int) \
+    X(handle, int) X(slot, int) X(free_next, int)
+
+int hamoopi_pool_init(hamoopi_pool_t* p, int capacity)
+{
+    memset(p, 0, sizeof(*p));
+    if (capacity <= 0)
+        return 0;
+
+#define ALLOC(name, t) p->name = (t*)calloc(capacity, sizeof(t)); if (!p->name) { hamoopi_pool_free(p); return 0; }
+    POOL_ARRAYS(ALLOC)
+#undef ALLOC
+
+    p->capacity = capacity;
+    hamoopi_pool_clear(p);
+    return 1;
+}
+
+void hamoopi_pool_free(hamoopi_pool_t* p)
+{
+#define FREE(name, t) free(p->name);
+    POOL_ARRAYS(FREE)
+#undef FREE
+    memset(p, 0, sizeof(*p));
+}
+
+void hamoopi_pool_clear(hamoopi_pool_t* p)
+{
+    p->count = 0;
+    for (int i = 0; i < p->capacity; i++)
+    {
+        p->slot[i] = -1;
+        p->free_next[i] = i + 1 < p->capacity ? i + 1 : -1;
+    }
+    p->free_head = p->capacity > 0 ? 0 : -1;
+}
+
+int hamoopi_pool_spawn(hamoopi_pool_t* p)
+{
+    if (p->count >= p->capacity || p->free_head < 0)
+        return -1;
+
+    int h = p->free_head;
+    p->free_head = p->free_next[h];
+
+    int i = p->count++;
+    p->x[i] = p->y[i] = p->vx[i] = p->vy[i] = 0.0f;
+    p->type[i] = p->owner[i] = p->frame[i] = p->frame_time[i] = 0;
+    p->frames[i] = p->timer[i] = p->life[i] = p->param[i] = 0;
+    p->handle[i] = h;
+    p->slot[h] = i;
+    return i;
+}
+
+void hamoopi_pool_remove(hamoopi_pool_t* p, int i)
+{
+    if (i < 0 || i >= p->count)
+        return;
+
+    int h = p->handle[i];
+    p->slot[h] = -1;
+    p->free_next[h] = p->free_head;
+    p->free_head = h;
+
+    int last = --p->count;
+    if (i != last)
+    {
+        p->x[i] = p->x[last];
+        p->y[i] = p->y[last];
+        p->vx[i] = p->vx[last];
+        p->vy[i] = p->vy[last];
+        p->type[i] = p->type[last];
+        p->owner[i] = p->owner[last];
+        p->frame[i] = p->frame[last];
+        p->frame_time[i] = p->frame_time[last];
+        p->frames[i] = p->frames[last];
+        p->timer[i] = p->timer[last];
+        p->life[i] = p->life[last];
+        p->param[i] = p->param[last];
+        p->handle[i] = p->handle[last];
+        p->slot[p->handle[i]] = i;
+    }
+}
+
+int hamoopi_pool_find(const hamoopi_pool_t* p, int handle)
+{
+    if (handle < 0 || handle >= p->capacity)
+        return -1;
+    return p->slot[handle];
+}
+
+void hamoopi_pool_integrate(hamoopi_pool_t* p)
+{
+    int n = p->count;
+    hamoopi_sim_t* x = p->x;
+    hamoopi_sim_t* y = p->y;
+    const hamoopi_sim_t* vx = p->vx;
+    const hamoopi_sim_t* vy = p->vy;
+    int* life = p->life;
+
+    for (int i = 0; i < n; i++)
+    {
+        x[i] += vx[i];
+        y[i] += vy[i];
+        life[i]--;
+    }
+
+    for (int i = 0; i < p->count; )
+    {
+        if (p->life[i] <= 0)
+            hamoopi_pool_remove(p, i);
+        else
+            i++;
+    }
+}
+
+void hamoopi_pool_animate(hamoopi_pool_t* p, int now)
+{
+    for (int i = 0; i < p->count; )
+    {
+        if (now > p->timer[i] + p->frame_time[i])
+        {
+            p->frame[i]++;
+            p->timer[i] = now;
+        }
+        if (p->frame[i] > p->frames[i])
+            hamoopi_pool_remove(p, i);
+        else
+            i++;
+    }
+}
@@ -0,0 +1,63 @@
+#ifndef HAMOOPI_POOL_H
+#define HAMOOPI_POOL_H
+
+#include "hamoopi_fixed.h"
+
+// Entity pool shared by the standalone game and the libretro core, used
+// for projectiles and hit sparks.
+//
+// Components are stored as separate arrays (structure of arrays) and the
+// live entities are always packed in [0, count), so update and draw
+// kernels are plain loops over a few arrays. Spawning appends at count
+// and removing moves the last entity into the hole, both O(1). Each
+// entity also gets a handle that stays valid while it lives; free
+// handles are kept on a free list.
+
+typedef struct {
+    int capacity;
+    int count;
+
+    // Components, indexed by dense slot
+    hamoopi_sim_t* x;
+    hamoopi_sim_t* y;
+    hamoopi_sim_t* vx;
+    hamoopi_sim_t* vy;
+    int* type;
+    int* owner;
+    int* frame;        // Animation frame
+    int* frame_time;   // Ticks per animation frame
+    int* frames;       // Last animation frame
+    int* timer;        // Tick the current frame started
+    int* life;         // Remaining ticks (integrate kernel)
+    int* param;        // Type specific (damage, alignment...)
+
+    // Handles
+    int* handle;       // Dense slot -> handle
+    int* slot;         // Handle -> dense slot, -1 when free
+    int* free_next;    // Next free handle
+    int free_head;
+} hamoopi_pool_t;
+
+// Returns 0 when the arrays cannot be allocated
+int hamoopi_pool_init(hamoopi_pool_t* p, int capacity);
+void hamoopi_pool_free(hamoopi_pool_t* p);
+void hamoopi_pool_clear(hamoopi_pool_t* p);
+
+// Dense slot of a new, zeroed entity, or -1 when the pool is full
+int hamoopi_pool_spawn(hamoopi_pool_t* p);
+
+// Swap-remove. When iterating, do not advance past a removed slot: it
+// now holds the entity that was last.
+void hamoopi_pool_remove(hamoopi_pool_t* p, int slot);
+
+// Dense slot of a handle, -1 if it has been removed
+int hamoopi_pool_find(const hamoopi_pool_t* p, int handle);
+
+// Kernels
+// x += vx, y += vy and life--; removes entities whose life ran out
+void hamoopi_pool_integrate(hamoopi_pool_t* p);
+// Advances frame once now > timer + frame_time; removes entities that
+// play past their last frame
+void hamoopi_pool_animate(hamoopi_pool_t* p, int now);
+
+#endif /* HAMOOPI_POOL_H */
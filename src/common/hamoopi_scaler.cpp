@@ -0,0 +1,467 @@
+#include "hamoopi_scaler.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HAMOOPI_SCALER_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define HAMOOPI_SCALER_NEON 1
+#endif
+
+#define ROW(base, pitch, y) ((uint32_t*)((uint8_t*)(base) + (size_t)(y) * (pitch)))
+#define CROW(base, pitch, y) ((const uint32_t*)((const uint8_t*)(base) + (size_t)(y) * (pitch)))
+
+void hamoopi_scaler_init(hamoopi_scaler_t* s)
+{
+    memset(s, 0, sizeof(*s));
+}
+
+void hamoopi_scaler_free(hamoopi_scaler_t* s)
+{
+    free(s->near_col);
+    free(s->near_row);
+    free(s->lin_col0);
+    free(s->lin_col1);
+    free(s->lin_colw);
+    free(s->lin_row0);
+    free(s->lin_row1);
+    free(s->lin_roww);
+    memset(s, 0, sizeof(*s));
+}
+
+int hamoopi_scale_filter_from_name(const char* name)
+{
+    if (!name)
+        return HAMOOPI_SCALE_NEAREST;
+    if (strcmp(name, "bilinear") == 0)
+        return HAMOOPI_SCALE_BILINEAR;
+    if (strcmp(name, "scale2x") == 0)
+        return HAMOOPI_SCALE_SCALE2X;
+    return HAMOOPI_SCALE_NEAREST;
+}
+
+// Sample position of destination pixel i in source space, 16.16 fixed point,
+// pixel centres aligned
+static void build_axis(int in, int out, int* near_map, int* lin0, int* lin1, uint8_t* linw)
+{
+    for (int i = 0; i < out; i++)
+    {
+        near_map[i] = (int)(((int64_t)(2 * i + 1) * in) / (2 * out));
+
+        int64_t pos = (((int64_t)(2 * i + 1) * in) << 16) / (2 * out) - 32768;
+        if (pos < 0)
+            pos = 0;
+        int p0 = (int)(pos >> 16);
+        int w  = (int)((pos >> 8) & 0xFF);
+        if (p0 >= in - 1)
+        {
+            p0 = in - 1;
+            w = 0;
+        }
+        lin0[i] = p0;
+        lin1[i] = p0 + 1 < in ? p0 + 1 : p0;
+        linw[i] = (uint8_t)w;
+    }
+}
+
+static bool maps_ready(const hamoopi_scaler_t* s, int in_w, int in_h, int out_w, int out_h)
+{
+    return s->near_col && s->in_w == in_w && s->in_h == in_h && s->out_w == out_w && s->out_h == out_h;
+}
+
+static bool build_maps(hamoopi_scaler_t* s, int in_w, int in_h, int out_w, int out_h)
+{
+    if (maps_ready(s, in_w, in_h, out_w, out_h))
+        return true;
+
+    s->near_col = (int*)realloc(s->near_col, out_w * sizeof(int));
+    s->lin_col0 = (int*)realloc(s->lin_col0, out_w * sizeof(int));
+    s->lin_col1 = (int*)realloc(s->lin_col1, out_w * sizeof(int));
+    s->lin_colw = (uint8_t*)realloc(s->lin_colw, out_w);
+    s->near_row = (int*)realloc(s->near_row, out_h * sizeof(int));
+    s->lin_row0 = (int*)realloc(s->lin_row0, out_h * sizeof(int));
+    s->lin_row1 = (int*)realloc(s->lin_row1, out_h * sizeof(int));
+    s->lin_roww = (uint8_t*)realloc(s->lin_roww, out_h);
+    if (!s->near_col || !s->lin_col0 || !s->lin_col1 || !s->lin_colw ||
+        !s->near_row || !s->lin_row0 || !s->lin_row1 || !s->lin_roww)
+    {
+        hamoopi_scaler_free(s);
+        return false;
+    }
+
+    build_axis(in_w, out_w, s->near_col, s->lin_col0, s->lin_col1, s->lin_colw);
+    build_axis(in_h, out_h, s->near_row, s->lin_row0, s->lin_row1, s->lin_roww);
+
+    s->in_w = in_w;
+    s->in_h = in_h;
+    s->out_w = out_w;
+    s->out_h = out_h;
+    return true;
+}
+
+// Each source pixel written twice
+static void double_row(const uint32_t* src, uint32_t* dst, int w)
+{
+    int x = 0;
+#if defined(HAMOOPI_SCALER_SSE2)
+    for (; x + 4 <= w; x += 4)
+    {
+        __m128i p = _mm_loadu_si128((const __m128i*)(src + x));
+        _mm_storeu_si128((__m128i*)(dst + 2 * x), _mm_unpacklo_epi32(p, p));
+        _mm_storeu_si128((__m128i*)(dst + 2 * x + 4), _mm_unpackhi_epi32(p, p));
+    }
+#elif defined(HAMOOPI_SCALER_NEON)
+    for (; x + 4 <= w; x += 4)
+    {
+        uint32x4_t p = vld1q_u32(src + x);
+        uint32x4x2_t z = vzipq_u32(p, p);
+        vst1q_u32(dst + 2 * x, z.val[0]);
+        vst1q_u32(dst + 2 * x + 4, z.val[1]);
+    }
+#endif
+    for (; x < w; x++)
+    {
+        dst[2 * x] = src[x];
+        dst[2 * x + 1] = src[x];
+    }
+}
+
+enum {
+    MODE_INTEGER,          // Exact multiple, nearest
+    MODE_NEAREST,
+    MODE_BILINEAR,
+    MODE_SCALE2X,          // Exactly 2x
+    MODE_SCALE2X_NEAREST   // Scale2x to 2x, then nearest to the output
+};
+
+static int scale_mode(int filter, int src_w, int src_h, int dst_w, int dst_h)
+{
+    // Scale2x only makes sense when the output is at least twice the input;
+    // below that it degrades to nearest
+    if (filter == HAMOOPI_SCALE_SCALE2X && dst_w >= src_w * 2 && dst_h >= src_h * 2)
+        return dst_w == src_w * 2 && dst_h == src_h * 2 ? MODE_SCALE2X : MODE_SCALE2X_NEAREST;
+    if (filter == HAMOOPI_SCALE_BILINEAR && (dst_w != src_w || dst_h != src_h))
+        return MODE_BILINEAR;
+    if (dst_w % src_w == 0 && dst_h % src_h == 0)
+        return MODE_INTEGER;
+    return MODE_NEAREST;
+}
+
+// Output is an exact multiple of the input: replicate pixels, then whole rows
+static void scale_integer(const uint32_t* src, int src_w, size_t src_pitch,
+                          uint32_t* dst, int kx, int ky, size_t dst_pitch, int y0, int y1)
+{
+    int dst_w = src_w * kx;
+    for (int y = y0; y < y1; y++)
+    {
+        uint32_t* d = ROW(dst, dst_pitch, y);
+        if (y > y0 && y % ky != 0)
+        {
+            memcpy(d, ROW(dst, dst_pitch, y - 1), dst_w * sizeof(uint32_t));
+            continue;
+        }
+
+        const uint32_t* s = CROW(src, src_pitch, y / ky);
+        if (kx == 1)
+            memcpy(d, s, src_w * sizeof(uint32_t));
+        else if (kx == 2)
+            double_row(s, d, src_w);
+        else
+        {
+            uint32_t* o = d;
+            for (int x = 0; x < src_w; x++)
+            {
+                uint32_t p = s[x];
+                for (int k = 0; k < kx; k++)
+                    *o++ = p;
+            }
+        }
+    }
+}
+
+static void scale_nearest(const hamoopi_scaler_t* s,
+                          const uint32_t* src, size_t src_pitch,
+                          uint32_t* dst, int dst_w, size_t dst_pitch, int y0, int y1)
+{
+    const int* cols = s->near_col;
+    for (int y = y0; y < y1; y++)
+    {
+        uint32_t* d = ROW(dst, dst_pitch, y);
+        int sy = s->near_row[y];
+        // Rows sampling the same source row are plain copies
+        if (y > y0 && s->near_row[y - 1] == sy)
+        {
+            memcpy(d, ROW(dst, dst_pitch, y - 1), dst_w * sizeof(uint32_t));
+            continue;
+        }
+        const uint32_t* r = CROW(src, src_pitch, sy);
+        for (int x = 0; x < dst_w; x++)
+            d[x] = r[cols[x]];
+    }
+}
+
+// a*(256-w) + b*w, red/blue and green handled in parallel lanes of one word
+static inline uint32_t lerp_pixel(uint32_t a, uint32_t b, unsigned w)
+{
+    unsigned iw = 256 - w;
+    uint32_t rb = (((a & 0xFF00FF) * iw + (b & 0xFF00FF) * w) >> 8) & 0xFF00FF;
+    uint32_t g  = (((a & 0x00FF00) * iw + (b & 0x00FF00) * w) >> 8) & 0x00FF00;
+    return rb | g;
+}
+
+// Vertical pass of the bilinear filter, contiguous so it vectorizes. The
+// X byte comes out 0 on every path, as lerp_pixel writes it.
+static void lerp_rows(const uint32_t* a, const uint32_t* b, uint32_t* out, int w, unsigned wb)
+{
+    int x = 0;
+#if defined(HAMOOPI_SCALER_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rgb = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i fa = _mm_set1_epi16((short)(256 - wb));
+    const __m128i fb = _mm_set1_epi16((short)wb);
+    for (; x + 4 <= w; x += 4)
+    {
+        __m128i pa = _mm_loadu_si128((const __m128i*)(a + x));
+        __m128i pb = _mm_loadu_si128((const __m128i*)(b + x));
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(pa, zero), fa),
+                                   _mm_mullo_epi16(_mm_unpacklo_epi8(pb, zero), fb));
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(pa, zero), fa),
+                                   _mm_mullo_epi16(_mm_unpackhi_epi8(pb, zero), fb));
+        lo = _mm_srli_epi16(lo, 8);
+        hi = _mm_srli_epi16(hi, 8);
+        _mm_storeu_si128((__m128i*)(out + x), _mm_and_si128(_mm_packus_epi16(lo, hi), rgb));
+    }
+#elif defined(HAMOOPI_SCALER_NEON)
+    // wb is 1..255 here, so both weights fit in a byte
+    const uint8x8_t fa = vdup_n_u8((uint8_t)(256 - wb));
+    const uint8x8_t fb = vdup_n_u8((uint8_t)wb);
+    const uint32x2_t rgb = vdup_n_u32(0x00FFFFFF);
+    for (; x + 2 <= w; x += 2)
+    {
+        uint8x8_t pa = vreinterpret_u8_u32(vld1_u32(a + x));
+        uint8x8_t pb = vreinterpret_u8_u32(vld1_u32(b + x));
+        uint16x8_t acc = vmlal_u8(vmull_u8(pa, fa), pb, fb);
+        vst1_u32(out + x, vand_u32(vreinterpret_u32_u8(vshrn_n_u16(acc, 8)), rgb));
+    }
+#endif
+    for (; x < w; x++)
+        out[x] = lerp_pixel(a[x], b[x], wb);
+}
+
+static void scale_bilinear(const hamoopi_scaler_t* s,
+                           const uint32_t* src, int src_w, size_t src_pitch,
+                           uint32_t* dst, int dst_w, size_t dst_pitch, int y0, int y1)
+{
+    // Vertically interpolated source row, one per call so bands do not share it
+    uint32_t* tmp = (uint32_t*)malloc(src_w * sizeof(uint32_t));
+    if (!tmp)
+        return;
+
+    const int* c0 = s->lin_col0;
+    const int* c1 = s->lin_col1;
+    const uint8_t* cw = s->lin_colw;
+    for (int y = y0; y < y1; y++)
+    {
+        uint32_t* d = ROW(dst, dst_pitch, y);
+        if (y > y0 && s->lin_row0[y] == s->lin_row0[y - 1] && s->lin_roww[y] == s->lin_roww[y - 1])
+        {
+            memcpy(d, ROW(dst, dst_pitch, y - 1), dst_w * sizeof(uint32_t));
+            continue;
+        }
+
+        const uint32_t* r = CROW(src, src_pitch, s->lin_row0[y]);
+        unsigned wy = s->lin_roww[y];
+        if (wy != 0)
+        {
+            lerp_rows(r, CROW(src, src_pitch, s->lin_row1[y]), tmp, src_w, wy);
+            r = tmp;
+        }
+
+        for (int x = 0; x < dst_w; x++)
+            d[x] = lerp_pixel(r[c0[x]], r[c1[x]], cw[x]);
+    }
+    free(tmp);
+}
+
+// AdvMAME2x / Scale2x: each pixel becomes a 2x2 block, corners follow edges.
+// Writes the top (half 0) or bottom (half 1) output row of source row y.
+static void scale2x_row(const uint32_t* src, int src_w, int src_h, size_t src_pitch,
+                        int y, int half, uint32_t* d)
+{
+    const uint32_t* rb = CROW(src, src_pitch, y > 0 ? y - 1 : y);
+    const uint32_t* re = CROW(src, src_pitch, y);
+    const uint32_t* rh = CROW(src, src_pitch, y < src_h - 1 ? y + 1 : y);
+
+    for (int x = 0; x < src_w; x++)
+    {
+        int xl = x > 0 ? x - 1 : x;
+        int xr = x < src_w - 1 ? x + 1 : x;
+        uint32_t B = rb[x], D = re[xl], E = re[x], F = re[xr], H = rh[x];
+
+        if (B != H && D != F)
+        {
+            // Vertical neighbour on this half's side
+            uint32_t V = half ? H : B;
+            d[2 * x]     = D == V ? D : E;
+            d[2 * x + 1] = V == F ? F : E;
+        }
+        else
+        {
+            d[2 * x] = d[2 * x + 1] = E;
+        }
+    }
+}
+
+static void scale2x(const uint32_t* src, int src_w, int src_h, size_t src_pitch,
+                    uint32_t* dst, size_t dst_pitch, int y0, int y1)
+{
+    for (int y = y0; y < y1; y++)
+        scale2x_row(src, src_w, src_h, src_pitch, y / 2, y & 1, ROW(dst, dst_pitch, y));
+}
+
+// Scale2x rows are built one at a time and sampled with the nearest maps of
+// the 2x image, so no intermediate frame is kept
+static void scale2x_nearest(const hamoopi_scaler_t* s,
+                            const uint32_t* src, int src_w, int src_h, size_t src_pitch,
+                            uint32_t* dst, int dst_w, size_t dst_pitch, int y0, int y1)
+{
+    uint32_t* tmp = (uint32_t*)malloc((size_t)src_w * 2 * sizeof(uint32_t));
+    if (!tmp)
+        return;
+
+    const int* cols = s->near_col;
+    for (int y = y0; y < y1; y++)
+    {
+        uint32_t* d = ROW(dst, dst_pitch, y);
+        int ty = s->near_row[y];
+        if (y > y0 && s->near_row[y - 1] == ty)
+        {
+            memcpy(d, ROW(dst, dst_pitch, y - 1), dst_w * sizeof(uint32_t));
+            continue;
+        }
+        scale2x_row(src, src_w, src_h, src_pitch, ty / 2, ty & 1, tmp);
+        for (int x = 0; x < dst_w; x++)
+            d[x] = tmp[cols[x]];
+    }
+    free(tmp);
+}
+
+int hamoopi_scale_prepare(hamoopi_scaler_t* s, int filter, int src_w, int src_h, int dst_w, int dst_h)
+{
+    if (!s || src_w <= 0 || src_h <= 0 || dst_w <= 0 || dst_h <= 0)
+        return 0;
+
+    switch (scale_mode(filter, src_w, src_h, dst_w, dst_h))
+    {
+    case MODE_NEAREST:
+    case MODE_BILINEAR:
+        return build_maps(s, src_w, src_h, dst_w, dst_h);
+    case MODE_SCALE2X_NEAREST:
+        return build_maps(s, src_w * 2, src_h * 2, dst_w, dst_h);
+    default:
+        return 1;
+    }
+}
+
+void hamoopi_scale_rows(const hamoopi_scaler_t* s, int filter,
+                        const uint32_t* src, int src_w, int src_h, size_t src_pitch,
+                        uint32_t* dst, int dst_w, int dst_h, size_t dst_pitch,
+                        int y0, int y1)
+{
+    if (!s || !src || !dst || src_w <= 0 || src_h <= 0 || dst_w <= 0 || dst_h <= 0)
+        return;
+    if (y0 < 0)
+        y0 = 0;
+    if (y1 > dst_h)
+        y1 = dst_h;
+    if (y0 >= y1)
+        return;
+
+    switch (scale_mode(filter, src_w, src_h, dst_w, dst_h))
+    {
+    case MODE_INTEGER:
+        scale_integer(src, src_w, src_pitch, dst, dst_w / src_w, dst_h / src_h, dst_pitch, y0, y1);
+        break;
+    case MODE_NEAREST:
+        if (maps_ready(s, src_w, src_h, dst_w, dst_h))
+            scale_nearest(s, src, src_pitch, dst, dst_w, dst_pitch, y0, y1);
+        break;
+    case MODE_BILINEAR:
+        if (maps_ready(s, src_w, src_h, dst_w, dst_h))
+            scale_bilinear(s, src, src_w, src_pitch, dst, dst_w, dst_pitch, y0, y1);
+        break;
+    case MODE_SCALE2X:
+        scale2x(src, src_w, src_h, src_pitch, dst, dst_pitch, y0, y1);
+        break;
+    case MODE_SCALE2X_NEAREST:
+        if (maps_ready(s, src_w * 2, src_h * 2, dst_w, dst_h))
+            scale2x_nearest(s, src, src_w, src_h, src_pitch, dst, dst_w, dst_pitch, y0, y1);
+        break;
+    }
+}
+
+static inline uint16_t pack_pixel(uint32_t p)
+{
+    return (uint16_t)(((p >> 8) & 0xF800) | ((p >> 5) & 0x07E0) | ((p >> 3) & 0x001F));
+}
+
+static void pack_row(const uint32_t* src, uint16_t* dst, int w)
+{
+    int x = 0;
+#if defined(HAMOOPI_SCALER_SSE2)
+    const __m128i mr = _mm_set1_epi32(0xF800);
+    const __m128i mg = _mm_set1_epi32(0x07E0);
+    const __m128i mb = _mm_set1_epi32(0x001F);
+    for (; x + 8 <= w; x += 8)
+    {
+        __m128i p0 = _mm_loadu_si128((const __m128i*)(src + x));
+        __m128i p1 = _mm_loadu_si128((const __m128i*)(src + x + 4));
+        __m128i v0 = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(p0, 8), mr),
+                                               _mm_and_si128(_mm_srli_epi32(p0, 5), mg)),
+                                  _mm_and_si128(_mm_srli_epi32(p0, 3), mb));
+        __m128i v1 = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(p1, 8), mr),
+                                               _mm_and_si128(_mm_srli_epi32(p1, 5), mg)),
+                                  _mm_and_si128(_mm_srli_epi32(p1, 3), mb));
+        // Sign-extend so the signed saturating pack keeps all 16 bits
+        v0 = _mm_srai_epi32(_mm_slli_epi32(v0, 16), 16);
+        v1 = _mm_srai_epi32(_mm_slli_epi32(v1, 16), 16);
+        _mm_storeu_si128((__m128i*)(dst + x), _mm_packs_epi32(v0, v1));
+    }
+#elif defined(HAMOOPI_SCALER_NEON)
+    const uint32x4_t mr = vdupq_n_u32(0xF800);
+    const uint32x4_t mg = vdupq_n_u32(0x07E0);
+    const uint32x4_t mb = vdupq_n_u32(0x001F);
+    for (; x + 4 <= w; x += 4)
+    {
+        uint32x4_t p = vld1q_u32(src + x);
+        uint32x4_t v = vorrq_u32(vorrq_u32(vandq_u32(vshrq_n_u32(p, 8), mr),
+                                           vandq_u32(vshrq_n_u32(p, 5), mg)),
+                                 vandq_u32(vshrq_n_u32(p, 3), mb));
+        vst1_u16(dst + x, vmovn_u32(v));
+    }
+#endif
+    for (; x < w; x++)
+        dst[x] = pack_pixel(src[x]);
+}
+
+void hamoopi_pack_rgb565(const uint32_t* src, size_t src_pitch,
+                         uint16_t* dst, size_t dst_pitch, int w, int h)
+{
+    for (int y = 0; y < h; y++)
+    {
+        pack_row(src, dst, w);
+        src = (const uint32_t*)((const uint8_t*)src + src_pitch);
+        dst = (uint16_t*)((uint8_t*)dst + dst_pitch);
+    }
+}
+
+void hamoopi_scale(hamoopi_scaler_t* s, int filter,
+                   const uint32_t* src, int src_w, int src_h, size_t src_pitch,
+                   uint32_t* dst, int dst_w, int dst_h, size_t dst_pitch)
+{
+    if (!hamoopi_scale_prepare(s, filter, src_w, src_h, dst_w, dst_h))
+        return;
+    hamoopi_scale_rows(s, filter, src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, 0, dst_h);
+}
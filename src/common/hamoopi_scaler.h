@@ -0,0 +1,65 @@
+#ifndef HAMOOPI_SCALER_H
+#define HAMOOPI_SCALER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Output scaler shared by the standalone game and the libretro core.
+// Works on 32bpp XRGB8888 rows (Allegro memory bitmaps / libretro frames).
+// Column and row maps are rebuilt only when the source or destination
+// size changes, so scaling a steady stream of frames does no divisions.
+// Every filter can produce any range of destination rows on its own, so
+// the output can be split into bands scaled on different threads.
+
+typedef enum {
+    HAMOOPI_SCALE_NEAREST  = 0,
+    HAMOOPI_SCALE_BILINEAR = 1,
+    HAMOOPI_SCALE_SCALE2X  = 2
+} hamoopi_scale_filter_t;
+
+typedef struct {
+    // Geometry the maps were built for
+    int in_w, in_h;
+    int out_w, out_h;
+
+    // Nearest: source column/row per destination column/row
+    int* near_col;
+    int* near_row;
+
+    // Bilinear: left/top sample, right/bottom sample and 8-bit weight
+    int* lin_col0;
+    int* lin_col1;
+    uint8_t* lin_colw;
+    int* lin_row0;
+    int* lin_row1;
+    uint8_t* lin_roww;
+
+} hamoopi_scaler_t;
+
+void hamoopi_scaler_init(hamoopi_scaler_t* s);
+void hamoopi_scaler_free(hamoopi_scaler_t* s);
+
+// Scale src into dst. Pitches are in bytes.
+void hamoopi_scale(hamoopi_scaler_t* s, int filter,
+                   const uint32_t* src, int src_w, int src_h, size_t src_pitch,
+                   uint32_t* dst, int dst_w, int dst_h, size_t dst_pitch);
+
+// Banded scaling: hamoopi_scale_prepare builds the maps for a geometry
+// (returns 0 when out of memory), then hamoopi_scale_rows writes only the
+// destination rows [y0, y1). Once prepared, calls for disjoint row ranges
+// may run concurrently.
+int hamoopi_scale_prepare(hamoopi_scaler_t* s, int filter, int src_w, int src_h, int dst_w, int dst_h);
+void hamoopi_scale_rows(const hamoopi_scaler_t* s, int filter,
+                        const uint32_t* src, int src_w, int src_h, size_t src_pitch,
+                        uint32_t* dst, int dst_w, int dst_h, size_t dst_pitch,
+                        int y0, int y1);
+
+// XRGB8888 to RGB565 for 16-bit frontends, truncating each channel (no
+// dither). Pitches are in bytes.
+void hamoopi_pack_rgb565(const uint32_t* src, size_t src_pitch,
+                         uint16_t* dst, size_t dst_pitch, int w, int h);
+
+// "nearest", "bilinear" or "scale2x" (anything else is nearest)
+int hamoopi_scale_filter_from_name(const char* name);
+
+#endif /* HAMOOPI_SCALER_H */
@@ -0,0 +1,168 @@
+#include "hamoopi_stages.h"
+#include "hamoopi_loader.h"
+#include <list>
+#include <string>
+
+typedef struct {
+    std::string path;
+    BITMAP* image;
+    size_t bytes;
+    int refs;
+} StageEntry;
+
+static std::list<StageEntry> stages;   // Most recently used first
+static size_t stage_bytes = 0;
+static size_t stage_budget = 8 << 20;  // Until the game sets its own
+
+// The one prefetch that may be in flight
+static hamoopi_loader_t prefetch_loader;
+static hamoopi_load_entry prefetch_entry;
+static std::string prefetch_path;
+static BITMAP* prefetch_image = NULL;
+static bool prefetching = false;
+
+static size_t image_bytes(BITMAP* bmp)
+{
+    return (size_t)bmp->w * bmp->h * ((bitmap_color_depth(bmp) + 7) / 8);
+}
+
+static std::list<StageEntry>::iterator find_stage(const std::string& path)
+{
+    std::list<StageEntry>::iterator it;
+    for (it = stages.begin(); it != stages.end(); ++it)
+        if (it->path == path)
+            break;
+    return it;
+}
+
+// Frees the oldest stages not held until the cache fits, keeping the newest
+static void trim_to_budget(void)
+{
+    std::list<StageEntry>::iterator it = stages.end();
+    while (stage_bytes > stage_budget && it != stages.begin())
+    {
+        --it;
+        if (it == stages.begin())
+            break;
+        if (it->refs > 0)
+            continue;
+        destroy_bitmap(it->image);
+        stage_bytes -= it->bytes;
+        it = stages.erase(it);
+    }
+}
+
+static void insert_stage(const std::string& path, BITMAP* image)
+{
+    StageEntry entry;
+    entry.path = path;
+    entry.image = image;
+    entry.bytes = image_bytes(image);
+    entry.refs = 0;
+    stages.push_front(entry);
+    stage_bytes += entry.bytes;
+    trim_to_budget();
+}
+
+static void finish_prefetch(void)
+{
+    if (!prefetching)
+        return;
+    hamoopi_loader_finish(&prefetch_loader);
+    prefetching = false;
+    if (prefetch_image)
+        insert_stage(prefetch_path, prefetch_image);
+    prefetch_image = NULL;
+}
+
+void hamoopi_stages_set_budget(size_t bytes)
+{
+    stage_budget = bytes;
+    trim_to_budget();
+}
+
+void hamoopi_stage_prefetch(const char* path)
+{
+    if (prefetching && prefetch_path == path)
+        return;
+    finish_prefetch();
+
+    std::list<StageEntry>::iterator it = find_stage(path);
+    if (it != stages.end())
+    {
+        stages.splice(stages.begin(), stages, it);
+        return;
+    }
+
+    prefetch_path = path;
+    prefetch_entry.path = prefetch_path.c_str();
+    prefetch_entry.kind = HAMOOPI_LOAD_BITMAP;
+    prefetch_entry.dest = &prefetch_image;
+    prefetch_entry.error = NULL;
+    prefetch_entry.present = NULL;
+    hamoopi_loader_start(&prefetch_loader, &prefetch_entry, 1, 1);
+    prefetching = true;
+}
+
+BITMAP* hamoopi_stage_acquire(const char* path)
+{
+    if (prefetching && prefetch_path == path)
+        finish_prefetch();
+
+    std::list<StageEntry>::iterator it = find_stage(path);
+    if (it == stages.end())
+    {
+        BITMAP* image = load_bitmap(path, NULL);
+        if (!image)
+            return NULL;
+        insert_stage(path, image);
+        it = stages.begin();
+    }
+    else
+    {
+        stages.splice(stages.begin(), stages, it);
+    }
+    it->refs++;
+    return it->image;
+}
+
+void hamoopi_stage_release(BITMAP* bmp)
+{
+    if (!bmp)
+        return;
+
+    std::list<StageEntry>::iterator it;
+    for (it = stages.begin(); it != stages.end(); ++it)
+    {
+        if (it->image == bmp)
+        {
+            if (it->refs > 0)
+                it->refs--;
+            break;
+        }
+    }
+    trim_to_budget();
+}
+
+void hamoopi_stages_clear(void)
+{
+    finish_prefetch();
+
+    std::list<StageEntry>::iterator it = stages.begin();
+    while (it != stages.end())
+    {
+        if (it->refs > 0)
+        {
+            ++it;
+            continue;
+        }
+        destroy_bitmap(it->image);
+        stage_bytes -= it->bytes;
+        it = stages.erase(it);
+    }
+}
+
+size_t hamoopi_stages_bytes(void)
+{
+    return stage_bytes;
+}
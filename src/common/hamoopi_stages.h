@@ -0,0 +1,40 @@
+#ifndef HAMOOPI_STAGES_H
+#define HAMOOPI_STAGES_H
+
+#include <allegro.h>
+#include <stddef.h>
+
+// Stage images loaded when a match needs them, shared by the standalone
+// game and the libretro core.
+//
+// Nothing is decoded up front. A stage is loaded the first time it is
+// acquired, or earlier on a worker thread when it is prefetched. Stages
+// stay cached after release, most recently used first, and the oldest
+// ones are freed once the cache holds more than its byte budget. Acquired
+// stages and the newest one are never freed, so the budget may be exceeded
+// by a stage that does not fit in it alone.
+//
+// Call from one thread. A prefetch decodes on a hamoopi_loader worker
+// under the same rules (see hamoopi_loader.h).
+
+// Bytes the cache may hold; shrinking it frees stages straight away
+void hamoopi_stages_set_budget(size_t bytes);
+
+// Starts decoding path in the background unless it is already cached.
+// A prefetch still in flight for another path is finished first.
+void hamoopi_stage_prefetch(const char* path);
+
+// The stage image for path, waiting for its prefetch or loading it now.
+// Held until released; NULL when the file cannot be loaded.
+BITMAP* hamoopi_stage_acquire(const char* path);
+
+// Gives back a stage from hamoopi_stage_acquire; it stays cached
+void hamoopi_stage_release(BITMAP* bmp);
+
+// Finishes any prefetch and frees every stage not held
+void hamoopi_stages_clear(void);
+
+// Bytes of decoded stages currently held
+size_t hamoopi_stages_bytes(void);
+
+#endif /* HAMOOPI_STAGES_H */
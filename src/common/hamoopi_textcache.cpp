@@ -0,0 +1,231 @@
+#include "hamoopi_textcache.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#define TEXT_CACHE_BUCKETS 512
+#define TEXT_CACHE_MAX_LEN 128
+
+enum { ALIGN_LEFT = 0, ALIGN_CENTRE, ALIGN_RIGHT };
+
+typedef struct {
+    RLE_SPRITE* sprite;     // NULL for strings with no visible pixels
+    const FONT* font;
+    int color;
+    int depth;
+    uint32_t hash;
+    int w;                  // text_length() of the string
+    char text[TEXT_CACHE_MAX_LEN];
+    bool used;
+    int bucket_next;        // hash chain
+    int lru_prev, lru_next; // most recently used at lru_head
+} TextCacheEntry;
+
+static TextCacheEntry entries[HAMOOPI_TEXT_CACHE_SIZE];
+static int buckets[TEXT_CACHE_BUCKETS];
+static int lru_head = -1;
+static int lru_tail = -1;
+static bool cache_ready = false;
+
+static void cache_init(void)
+{
+    for (int i = 0; i < TEXT_CACHE_BUCKETS; i++)
+        buckets[i] = -1;
+
+    // Every slot starts on the LRU list, unused slots at the tail
+    for (int i = 0; i < HAMOOPI_TEXT_CACHE_SIZE; i++)
+    {
+        memset(&entries[i], 0, sizeof(entries[i]));
+        entries[i].bucket_next = -1;
+        entries[i].lru_prev = i - 1;
+        entries[i].lru_next = i + 1 < HAMOOPI_TEXT_CACHE_SIZE ? i + 1 : -1;
+    }
+    lru_head = 0;
+    lru_tail = HAMOOPI_TEXT_CACHE_SIZE - 1;
+    cache_ready = true;
+}
+
+static uint32_t text_hash(const FONT* f, int color, int depth, const char* s)
+{
+    uint32_t h = 2166136261u;
+    for (; *s; s++)
+        h = (h ^ (uint8_t)*s) * 16777619u;
+    h ^= (uint32_t)(uintptr_t)f * 2654435761u;
+    h ^= (uint32_t)color * 40503u;
+    h ^= (uint32_t)depth;
+    return h;
+}
+
+static void lru_unlink(int i)
+{
+    TextCacheEntry* e = &entries[i];
+    if (e->lru_prev >= 0) entries[e->lru_prev].lru_next = e->lru_next;
+    else lru_head = e->lru_next;
+    if (e->lru_next >= 0) entries[e->lru_next].lru_prev = e->lru_prev;
+    else lru_tail = e->lru_prev;
+}
+
+static void lru_push_front(int i)
+{
+    entries[i].lru_prev = -1;
+    entries[i].lru_next = lru_head;
+    if (lru_head >= 0) entries[lru_head].lru_prev = i;
+    lru_head = i;
+    if (lru_tail < 0) lru_tail = i;
+}
+
+static void bucket_remove(int i)
+{
+    int* link = &buckets[entries[i].hash % TEXT_CACHE_BUCKETS];
+    while (*link >= 0)
+    {
+        if (*link == i)
+        {
+            *link = entries[i].bucket_next;
+            break;
+        }
+        link = &entries[*link].bucket_next;
+    }
+    entries[i].bucket_next = -1;
+}
+
+static void release_entry(int i)
+{
+    TextCacheEntry* e = &entries[i];
+    if (!e->used)
+        return;
+    bucket_remove(i);
+    if (e->sprite)
+        destroy_rle_sprite(e->sprite);
+    e->sprite = NULL;
+    e->used = false;
+}
+
+void hamoopi_text_cache_clear(void)
+{
+    if (!cache_ready)
+        return;
+    for (int i = 0; i < HAMOOPI_TEXT_CACHE_SIZE; i++)
+        release_entry(i);
+    cache_init();
+}
+
+// Find or rasterize the string; NULL when it cannot be cached
+static TextCacheEntry* cache_lookup(const FONT* f, const char* s, int color, int depth)
+{
+    if (!cache_ready)
+        cache_init();
+
+    uint32_t h = text_hash(f, color, depth, s);
+    for (int i = buckets[h % TEXT_CACHE_BUCKETS]; i >= 0; i = entries[i].bucket_next)
+    {
+        TextCacheEntry* e = &entries[i];
+        if (e->hash == h && e->font == f && e->color == color && e->depth == depth &&
+            strcmp(e->text, s) == 0)
+        {
+            if (lru_head != i)
+            {
+                lru_unlink(i);
+                lru_push_front(i);
+            }
+            return e;
+        }
+    }
+
+    // Miss: recycle the least recently used slot
+    int w = text_length(f, s);
+    int th = text_height(f);
+    BITMAP* tmp = NULL;
+    if (w > 0 && th > 0)
+    {
+        tmp = create_bitmap_ex(depth, w, th);
+        if (!tmp)
+            return NULL;
+        clear_to_color(tmp, bitmap_mask_color(tmp));
+        textout_ex(tmp, f, s, 0, 0, color, -1);
+    }
+
+    int slot = lru_tail;
+    release_entry(slot);
+    TextCacheEntry* e = &entries[slot];
+    e->sprite = tmp ? get_rle_sprite(tmp) : NULL;
+    e->font = f;
+    e->color = color;
+    e->depth = depth;
+    e->hash = h;
+    e->w = w;
+    strcpy(e->text, s);
+    e->used = true;
+    e->bucket_next = buckets[h % TEXT_CACHE_BUCKETS];
+    buckets[h % TEXT_CACHE_BUCKETS] = slot;
+    lru_unlink(slot);
+    lru_push_front(slot);
+
+    if (tmp)
+        destroy_bitmap(tmp);
+    return e;
+}
+
+static void cached_textout(BITMAP* bmp, const FONT* f, const char* s, int x, int y, int color, int bg, int align)
+{
+    if (!bmp || !f || !s)
+        return;
+
+    if (bg == -1 && strlen(s) < TEXT_CACHE_MAX_LEN)
+    {
+        TextCacheEntry* e = cache_lookup(f, s, color, bitmap_color_depth(bmp));
+        if (e)
+        {
+            if (align == ALIGN_CENTRE) x -= e->w / 2;
+            else if (align == ALIGN_RIGHT) x -= e->w;
+            if (e->sprite)
+                draw_rle_sprite(bmp, e->sprite, x, y);
+            return;
+        }
+    }
+
+    if (align == ALIGN_CENTRE) textout_centre_ex(bmp, f, s, x, y, color, bg);
+    else if (align == ALIGN_RIGHT) textout_right_ex(bmp, f, s, x, y, color, bg);
+    else textout_ex(bmp, f, s, x, y, color, bg);
+}
+
+void textout_cache_ex(BITMAP* bmp, const FONT* f, const char* s, int x, int y, int color, int bg)
+{
+    cached_textout(bmp, f, s, x, y, color, bg, ALIGN_LEFT);
+}
+
+void textout_centre_cache_ex(BITMAP* bmp, const FONT* f, const char* s, int x, int y, int color, int bg)
+{
+    cached_textout(bmp, f, s, x, y, color, bg, ALIGN_CENTRE);
+}
+
+void textout_right_cache_ex(BITMAP* bmp, const FONT* f, const char* s, int x, int y, int color, int bg)
+{
+    cached_textout(bmp, f, s, x, y, color, bg, ALIGN_RIGHT);
+}
+
+#define FORMAT_TEXT(buf, format)                  \
+    char buf[512];                                \
+    va_list args;                                 \
+    va_start(args, format);                       \
+    vsnprintf(buf, sizeof(buf), format, args);    \
+    va_end(args)
+
+void textprintf_cache_ex(BITMAP* bmp, const FONT* f, int x, int y, int color, int bg, const char* format, ...)
+{
+    FORMAT_TEXT(buf, format);
+    cached_textout(bmp, f, buf, x, y, color, bg, ALIGN_LEFT);
+}
+
+void textprintf_centre_cache_ex(BITMAP* bmp, const FONT* f, int x, int y, int color, int bg, const char* format, ...)
+{
+    FORMAT_TEXT(buf, format);
+    cached_textout(bmp, f, buf, x, y, color, bg, ALIGN_CENTRE);
+}
+
+void textprintf_right_cache_ex(BITMAP* bmp, const FONT* f, int x, int y, int color, int bg, const char* format, ...)
+{
+    FORMAT_TEXT(buf, format);
+    cached_textout(bmp, f, buf, x, y, color, bg, ALIGN_RIGHT);
+}
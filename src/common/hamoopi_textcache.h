@@ -0,0 +1,27 @@
+#ifndef HAMOOPI_TEXTCACHE_H
+#define HAMOOPI_TEXTCACHE_H
+
+#include <allegro.h>
+
+// Cached text renderer shared by the standalone game and the libretro core.
+// Each (font, colour, colour depth, string) is rasterized once into an RLE
+// sprite and kept in a small LRU, so static menu text costs one sprite draw
+// per line instead of a glyph-by-glyph textout every frame.
+//
+// The functions mirror Allegro's textout/textprintf family. Opaque
+// backgrounds (bg != -1) are passed straight to Allegro.
+
+#define HAMOOPI_TEXT_CACHE_SIZE 256
+
+void textout_cache_ex(BITMAP* bmp, const FONT* f, const char* s, int x, int y, int color, int bg);
+void textout_centre_cache_ex(BITMAP* bmp, const FONT* f, const char* s, int x, int y, int color, int bg);
+void textout_right_cache_ex(BITMAP* bmp, const FONT* f, const char* s, int x, int y, int color, int bg);
+
+void textprintf_cache_ex(BITMAP* bmp, const FONT* f, int x, int y, int color, int bg, const char* format, ...);
+void textprintf_centre_cache_ex(BITMAP* bmp, const FONT* f, int x, int y, int color, int bg, const char* format, ...);
+void textprintf_right_cache_ex(BITMAP* bmp, const FONT* f, int x, int y, int color, int bg, const char* format, ...);
+
+// Drop every cached string (e.g. before destroying the fonts)
+void hamoopi_text_cache_clear(void);
+
+#endif /* HAMOOPI_TEXTCACHE_H */
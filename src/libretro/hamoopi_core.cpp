@@ -1,10 +1,22 @@
 #include "hamoopi_core.h"
 #include "libretro.h"
+#include "hamoopi_textcache.h"
+#include "hamoopi_pool.h"
+#include "hamoopi_input.h"
+#include "hamoopi_fixed.h"
+#include "hamoopi_blend.h"
+#include "hamoopi_assets.h"
+#include "hamoopi_stages.h"
 #include <allegro.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
 
 // Global state variables
 static BITMAP* screen_buffer = NULL;
@@ -13,13 +25,19 @@ static bool initialized = false;
 static bool running = false;
 static int frame_count = 0;
 
-// Input state for two players
-hamoopi_input_t hamoopi_input[2] = {};
+// Input, one button word per player (bit n = RETRO_DEVICE_ID_JOYPAD_n).
+// hamoopi_set_input() latches the next word; each simulated frame
+// advances the shared input state once, from the copy in sim_input taken
+// when the frame is started.
+#define BTN(id) (1u << RETRO_DEVICE_ID_JOYPAD_##id)
+static uint32_t input_latched[2];
+static uint32_t sim_input[2];
+static hamoopi_input_t input[2];
 
 // Collision box types
 typedef struct {
-    float x, y;     // World position (absolute coordinates)
-    float w, h;     // Width and height
+    hamoopi_sim_t x, y;     // World position (absolute coordinates)
+    hamoopi_sim_t w, h;     // Width and height
 } CollisionBox;
 
 // Sprite animation system
@@ -38,13 +56,67 @@ typedef struct {
     bool loaded;
 } SpriteSet;
 
-// Sprite cache for all characters
+// Sprite cache for all characters. The frames themselves come from the
+// asset cache, so slots using the same character folder share them.
 static SpriteSet character_sprites[4];  // One for each character (FIRE, WATER, EARTH, WIND)
 static bool sprites_loaded = false;
 static bool use_sprite_animations = true;  // Can be toggled with SELECT + START
 
+// Core options (see hamoopi_set_options)
+static hamoopi_options_t core_options = { HAMOOPI_BG_ANIMATED, false, HAMOOPI_AUDIO_HIGH, true, false, false, false, false, 8 };
+static bool render_enabled = true;  // false on frames dropped by frame-skip
+
+// Render resolution (option low_res). The drawing code works in 640x480
+// coordinates; RES() maps a coordinate or length onto the render buffers,
+// which are 320x240 in low-res mode. Text keeps its font size and is only
+// moved; sprites are drawn at half size.
+static int render_shift = 0;        // 0: 640x480, 1: 320x240
+#define RES(v) ((int)(v) >> render_shift)
+#define RES_STEP (1 << render_shift) // Per-pixel loops skip what RES() merges
+
+// Keep text that no longer fits at 320x240 on screen
+static int res_text_x(BITMAP* bmp, const FONT* f, const char* s, int left)
+{
+    int w = text_length(f, s);
+    if (left + w > bmp->w)
+        left = bmp->w - w;
+    return left < 0 ? 0 : left;
+}
+
+static void res_textout(BITMAP* bmp, const FONT* f, const char* s, int x, int y, int color, int bg)
+{
+    x = RES(x);
+    if (render_shift)
+        x = res_text_x(bmp, f, s, x);
+    textout_cache_ex(bmp, f, s, x, RES(y), color, bg);
+}
+
+static void res_textout_centre(BITMAP* bmp, const FONT* f, const char* s, int x, int y, int color, int bg)
+{
+    x = RES(x);
+    if (render_shift)
+    {
+        int w = text_length(f, s);
+        x = res_text_x(bmp, f, s, x - w / 2) + w / 2;
+    }
+    textout_centre_cache_ex(bmp, f, s, x, RES(y), color, bg);
+}
+
+static void res_sprite(BITMAP* dest, BITMAP* sprite, int x, int y)
+{
+    if (render_shift)
+        stretch_sprite(dest, sprite, RES(x), RES(y), RES(sprite->w), RES(sprite->h));
+    else
+        draw_sprite(dest, sprite, x, y);
+}
+
+// Performance overlay: average of the last PERF_HISTORY frame times
+#define PERF_HISTORY 30
+static int64_t perf_usec[PERF_HISTORY];
+static int perf_index = 0;
+
 // INI-based character configuration system
-#define MAX_CHAR_ANIMATIONS 50
+#define MAX_CHAR_ANIMATIONS 100
 #define MAX_COLLISION_BOXES 10
 
 typedef struct {
@@ -52,8 +124,8 @@ typedef struct {
     int xalign, yalign;    // Sprite alignment points
     int frame_times[MAX_ANIM_FRAMES];  // Frame timing for each frame
     int frame_count;       // Number of frames in animation
-    float hspeed, vspeed;  // Horizontal/vertical speed during animation
-    float gravity;         // Gravity applied during animation
+    hamoopi_sim_t hspeed, vspeed;  // Horizontal/vertical speed during animation
+    hamoopi_sim_t gravity;         // Gravity applied during animation
 } AnimationConfig;
 
 typedef struct {
@@ -65,30 +137,90 @@ typedef struct {
     int hitbox_count;
 } CollisionBoxConfig;
 
+#define MAX_SPECIAL_MOVES 10
+#define MAX_SPECIAL_COMMANDS 10
+
 typedef struct {
     char name[64];
-    int command_sequence[10];  // Button/direction commands
+    int state_id;              // Section number (700, 710, ...)
+    int command_sequence[MAX_SPECIAL_COMMANDS];  // Numpad directions, 6 = toward the opponent
     int command_count;
     int damage;
     int type;  // 0=projectile, 1=melee, 2=buff
+    bool throw_fireball;       // ThrowFireball key present
+    int throw_frame;           // ThrowFireball: animation frame that releases it
+    int fireball_x, fireball_y;  // [x01] LocalPosX/LocalPosY
+    hamoopi_sim_t fireball_speed;        // [x01] HSpeed
+    // [x00_NN] velocity changes per animation frame
+    hamoopi_sim_t frame_hspeed[MAX_ANIM_FRAMES];
+    hamoopi_sim_t frame_vspeed[MAX_ANIM_FRAMES];
+    unsigned char frame_flags[MAX_ANIM_FRAMES];  // SPECIAL_FRAME_*
 } SpecialMoveConfig;
 
+#define SPECIAL_FRAME_HSPEED 0x01
+#define SPECIAL_FRAME_VSPEED 0x02
+
+// Special move bytecode, compiled once per character (see
+// compile_special_program) and run by special_vm_run.
+// Registers are simulation scalars; jumps are absolute and only go forward.
+enum SpecialOp {
+    SOP_END = 0,   // Stop the program
+    SOP_LOAD,      // r[a] = imm
+    SOP_SELF,      // r[a] = player field b (SF_*)
+    SOP_OPP,       // r[a] = opponent field b (SF_*)
+    SOP_ADD,       // r[a] = r[b] + r[c]
+    SOP_SUB,       // r[a] = r[b] - r[c]
+    SOP_MUL,       // r[a] = r[b] * r[c]
+    SOP_ABS,       // r[a] = |r[b]|
+    SOP_JGE,       // if (r[a] >= r[b]) pc = c
+    SOP_JZ,        // if (r[a] == 0) pc = c
+    SOP_SOUND,     // play_sound(a)
+    SOP_SPAWN,     // Projectile type a at (r0, r1) moving (r2, r3), imm damage
+    SOP_HEAL,      // health += imm, up to 100
+    SOP_HIT,       // Opponent takes imm damage, BLOCKED_DAMAGE when blocking
+    SOP_SETVX,     // vx = imm * facing
+    SOP_SETVY,     // vy = imm, leaves the ground when negative
+    SOP_DASH,      // Dash for imm frames
+    SOP_WAIT       // Resume imm frames later
+};
+
+// Player fields readable with SOP_SELF / SOP_OPP
+enum { SF_X = 0, SF_Y, SF_FACING, SF_ON_GROUND, SF_HEALTH };
+
+#define SPECIAL_REGS 8
+#define SPECIAL_MAX_CODE 96
+
+typedef struct {
+    unsigned char op, a, b, c;
+    hamoopi_sim_t imm;
+} SpecialInstr;
+
+typedef struct {
+    SpecialInstr code[SPECIAL_MAX_CODE];
+    int length;
+} SpecialProgram;
+
 typedef struct {
     AnimationConfig animations[MAX_CHAR_ANIMATIONS];
     int animation_count;
     CollisionBoxConfig collision_boxes[100];
     int collision_box_count;
-    SpecialMoveConfig special_moves[10];
+    SpecialMoveConfig special_moves[MAX_SPECIAL_MOVES];
     int special_move_count;
     bool loaded;
 } CharacterConfig;
 
-static CharacterConfig character_configs[4];  // One for each character
+// Parsed INI data comes from the asset cache and is shared between slots
+// using the same character folder. The special button runs the slot's
+// element built-in, so every slot keeps its own programs.
+static const CharacterConfig* character_configs[4];  // One for each character
+static SpecialProgram special_programs[4];           // Run by the special button
+static SpecialProgram command_programs[4][MAX_SPECIAL_MOVES];  // special.ini moves, by command + attack
 
 // Game state
 typedef struct {
-    float x, y;
-    float vx, vy;
+    hamoopi_sim_t x, y;
+    hamoopi_sim_t vx, vy;
     int health;
     int state; // 0=idle, 1=walk, 2=jump, 3=attack, 4=hit, 5=crouch, 6=crouch_attack
     int anim_frame;
@@ -102,29 +234,26 @@ typedef struct {
     bool is_dashing; // For WIND character dash attack
     int dash_timer; // Duration of dash
     int attack_frame; // Current frame of attack animation
+    int command_dir[MAX_SPECIAL_COMMANDS];  // Directions entered for special.ini commands, newest first
+    int command_time[MAX_SPECIAL_COMMANDS]; // Frames since each was entered
 } Player;
 
+static Player players[2];
+
 // Projectile system for special moves
-typedef struct {
-    bool active;
-    float x, y;
-    float vx, vy;
-    int owner; // 0=P1, 1=P2
-    int type; // Character-specific projectile type
-    int lifetime;
-    CollisionBox hitbox; // Projectile hitbox
-} Projectile;
-
-#define MAX_PROJECTILES 4
-static Projectile projectiles[MAX_PROJECTILES];
+// Pool components: owner 0=P1/1=P2, type is the character-specific
+// projectile type, life the remaining frames and param the damage.
+#define MAX_PROJECTILES 256
+#define PROJECTILE_LIFETIME 180  // 3 seconds max
+static hamoopi_pool_t projectiles;
 
 // Helper function to find collision boxes from loaded INI data
-static CollisionBoxConfig* find_collision_box_config(int char_id, int state_id, int frame)
+static const CollisionBoxConfig* find_collision_box_config(int char_id, int state_id, int frame)
 {
-    if (char_id < 0 || char_id >= 4 || !character_configs[char_id].loaded)
+    if (char_id < 0 || char_id >= 4 || !character_configs[char_id] || !character_configs[char_id]->loaded)
         return NULL;
     
-    CharacterConfig* config = &character_configs[char_id];
+    const CharacterConfig* config = character_configs[char_id];
     for (int i = 0; i < config->collision_box_count; i++)
     {
         if (config->collision_boxes[i].state_id == state_id && 
@@ -138,7 +267,7 @@ static CollisionBoxConfig* find_collision_box_config(int char_id, int state_id,
 
 // Collision box definitions
 // Body collision box (for pushing)
-static CollisionBox get_body_box(Player* p)
+static CollisionBox compute_body_box(const Player* p)
 {
     CollisionBox box;
     box.x = p->x - 15;
@@ -149,7 +278,7 @@ static CollisionBox get_body_box(Player* p)
 }
 
 // Hurtbox (vulnerable area) - now loads from chbox.ini
-static CollisionBox get_hurtbox(Player* p)
+static CollisionBox compute_hurtbox(const Player* p)
 {
     CollisionBox box;
     
@@ -163,7 +292,7 @@ static CollisionBox get_hurtbox(Player* p)
     else if (p->is_blocking && p->is_crouching) state_id = 208;  // Crouch block
     
     // Try to load from INI data
-    CollisionBoxConfig* config = find_collision_box_config(p->character_id, state_id, p->anim_frame);
+    const CollisionBoxConfig* config = find_collision_box_config(p->character_id, state_id, p->anim_frame);
     if (config && config->hurtbox_count > 0)
     {
         // Use first hurtbox from INI, adjusted for player position and facing
@@ -212,8 +341,11 @@ static CollisionBox get_hurtbox(Player* p)
     return box;
 }
 
+// Inside the attack's active window, from the fighter state table
+static bool attack_active(const Player* p);
+
 // Hitbox (attacking area) - now loads from chbox.ini
-static CollisionBox get_hitbox(Player* p)
+static CollisionBox compute_hitbox(const Player* p)
 {
     CollisionBox box;
     
@@ -232,8 +364,8 @@ static CollisionBox get_hitbox(Player* p)
     int state_id = (p->state == 3) ? 151 : 201;  // Attack or crouch attack
     
     // Try to load from INI data
-    CollisionBoxConfig* config = find_collision_box_config(p->character_id, state_id, p->anim_frame);
-    if (config && config->hitbox_count > 0 && p->attack_frame >= 2 && p->attack_frame <= 6)
+    const CollisionBoxConfig* config = find_collision_box_config(p->character_id, state_id, p->anim_frame);
+    if (config && config->hitbox_count > 0 && attack_active(p))
     {
         // Use first hitbox from INI, adjusted for player position and facing
         CollisionBox ini_box = config->hitboxes[0];
@@ -254,7 +386,7 @@ static CollisionBox get_hitbox(Player* p)
     }
     
     // Fallback to hardcoded values if INI not found
-    if (p->state == 3 && p->attack_frame >= 2 && p->attack_frame <= 6)
+    if (p->state == 3 && attack_active(p))
     {
         // Active attack frames
         if (p->facing > 0)
@@ -272,7 +404,7 @@ static CollisionBox get_hitbox(Player* p)
             box.h = 20;
         }
     }
-    else if (p->state == 6 && p->attack_frame >= 2 && p->attack_frame <= 6)
+    else if (p->state == 6 && attack_active(p))
     {
         // Crouch attack hitbox
         if (p->facing > 0)
@@ -302,7 +434,7 @@ static CollisionBox get_hitbox(Player* p)
 }
 
 // Clash/Priority box (for attack clashing)
-static CollisionBox get_clash_box(Player* p)
+static CollisionBox compute_clash_box(const Player* p)
 {
     CollisionBox box;
     // Clash box is active during attack startup and active frames
@@ -342,15 +474,77 @@ static bool boxes_overlap(CollisionBox a, CollisionBox b)
             a.y + a.h > b.y);
 }
 
-// Debug visualization for hitboxes
+// Collision snapshot
+// Attack hooks, body pushing, clashes, projectiles and the debug draw all
+// read a fighter's boxes from here. The boxes are rebuilt only when a field
+// they depend on has changed, so each fighter normally goes through the
+// state_id mapping and chbox lookup once per frame however often it is
+// queried.
+typedef struct {
+    CollisionBox body, hurt, hit, clash;
+    // Player fields the boxes were built from
+    hamoopi_sim_t x, y;
+    int state, anim_frame, attack_frame, facing, character_id;
+    bool is_blocking, is_crouching;
+    bool valid;
+} CollisionSnapshot;
+
+static CollisionSnapshot collision_snapshot[2];
+
+static bool snapshot_current(const CollisionSnapshot* s, const Player* p)
+{
+    return s->valid && s->x == p->x && s->y == p->y &&
+           s->state == p->state && s->anim_frame == p->anim_frame &&
+           s->attack_frame == p->attack_frame && s->facing == p->facing &&
+           s->character_id == p->character_id &&
+           s->is_blocking == p->is_blocking && s->is_crouching == p->is_crouching;
+}
+
+static const CollisionSnapshot* fighter_boxes(const Player* p)
+{
+    CollisionSnapshot* s = &collision_snapshot[p - players];
+    if (snapshot_current(s, p))
+        return s;
+    
+    s->body = compute_body_box(p);
+    s->hurt = compute_hurtbox(p);
+    s->hit = compute_hitbox(p);
+    s->clash = compute_clash_box(p);
+    s->x = p->x;
+    s->y = p->y;
+    s->state = p->state;
+    s->anim_frame = p->anim_frame;
+    s->attack_frame = p->attack_frame;
+    s->facing = p->facing;
+    s->character_id = p->character_id;
+    s->is_blocking = p->is_blocking;
+    s->is_crouching = p->is_crouching;
+    s->valid = true;
+    return s;
+}
+
+// Snapshot stage: bring both fighters up to date once they have moved
+static void update_collision_snapshot(void)
+{
+    fighter_boxes(&players[0]);
+    fighter_boxes(&players[1]);
+}
+
+static void invalidate_collision_snapshot(void)
+{
+    memset(collision_snapshot, 0, sizeof(collision_snapshot));
+}
+
+// Debug visualization for hitboxes; drawn when the presented frame has
+// show_debug_boxes set
 static bool show_debug_boxes = false;
 
 static void draw_debug_box(BITMAP* dest, CollisionBox box, int color)
 {
-    if (show_debug_boxes && box.w > 0 && box.h > 0)
+    if (box.w > 0 && box.h > 0)
     {
-        rect(dest, (int)box.x, (int)box.y, 
-             (int)(box.x + box.w), (int)(box.y + box.h), color);
+        rect(dest, RES((int)box.x), RES((int)box.y), 
+             RES((int)(box.x + box.w)), RES((int)(box.y + box.h)), color);
     }
 }
 
@@ -369,7 +563,7 @@ static void load_animation(SpriteSet* sprites, int state_id, const char* char_na
         snprintf(filename, sizeof(filename), "data/chars/%s/%03d_%02d.pcx", char_name, state_id, frame);
         
         // Try to load the sprite
-        BITMAP* sprite = load_bitmap(filename, NULL);
+        BITMAP* sprite = hamoopi_asset_bitmap(filename);
         if (sprite)
         {
             anim->frames[anim->frame_count] = sprite;
@@ -486,7 +680,7 @@ static Animation* get_animation(SpriteSet* sprites, int state_id)
     return NULL;
 }
 
-static BITMAP* get_sprite_frame(Player* p)
+static BITMAP* get_sprite_frame(const Player* p)
 {
     if (!sprites_loaded)
     {
@@ -621,7 +815,7 @@ static void cleanup_sprite_system()
                 {
                     if (anim->frames[k])
                     {
-                        destroy_bitmap(anim->frames[k]);
+                        hamoopi_asset_release(anim->frames[k]);
                         anim->frames[k] = NULL;
                     }
                 }
@@ -633,7 +827,6 @@ static void cleanup_sprite_system()
     sprites_loaded = false;
 }
 
-static Player players[2];
 static int game_mode = 0; // 0=title, 1=character_select, 2=fight, 3=winner
 
 // Round system (best of 3)
@@ -648,14 +841,6 @@ static int p2_cursor = 1;
 static bool p1_ready = false;
 static bool p2_ready = false;
 
-// Input tracking for character selection
-static bool p1_left_pressed = false;
-static bool p1_right_pressed = false;
-static bool p1_a_pressed = false;
-static bool p2_left_pressed = false;
-static bool p2_right_pressed = false;
-static bool p2_a_pressed = false;
-
 // Character system constants
 #define NUM_CHARACTERS 4
 
@@ -665,6 +850,9 @@ static bool p2_a_pressed = false;
 #define BLOCKING_SPEED_MULTIPLIER 0.5f
 #define BLOCKING_COLOR_DIVISOR 2
 #define ATTACK_DAMAGE_FRAME 2  // Frame on which damage is actually applied
+#define ATTACK_ACTIVE_END 6    // Last frame with an active hitbox
+#define ATTACK_LENGTH 10       // Attack lasts 10 frames
+#define ATTACK_COOLDOWN 15     // ~0.25 seconds between attacks
 
 // Special move constants
 #define SPECIAL_MOVE_COOLDOWN 180  // 3 seconds @ 60 FPS
@@ -677,6 +865,8 @@ static bool p2_a_pressed = false;
 #define WIND_DASH_DURATION 15  // frames
 #define WIND_DASH_HIT_RANGE 50.0f
 #define PROJECTILE_HIT_RADIUS 30.0f
+#define SPECIAL_MELEE_RANGE 60.0f  // Reach of melee specials compiled from special.ini
+#define SPECIAL_COMMAND_WINDOW 30  // Frames a whole special.ini command may take
 
 // Stage/background animation
 static int stage_animation_frame = 0;
@@ -684,7 +874,7 @@ static int stage_animation_frame = 0;
 // Background system - dynamic loading from config.ini
 #define MAX_BACKGROUNDS 4
 typedef struct {
-    BITMAP* image;  // Background image loaded from PCX
+    char image_path[256];  // 000_00.pcx, decoded when a match needs it
     int map_pos_x;  // Horizontal position from config.ini
     int map_pos_y;  // Vertical position from config.ini
     bool loaded;
@@ -695,6 +885,10 @@ static Background backgrounds[MAX_BACKGROUNDS];
 static int background_count = 0;
 static bool backgrounds_initialized = false;
 
+// Image of the stage last drawn, held from the stage cache
+static BITMAP* stage_image = NULL;
+static int stage_image_theme = -1;
+
 // Audio constants
 #define AUDIO_SAMPLE_RATE 44100
 #define AUDIO_BUFFER_SIZE 735  // ~60 FPS: 44100/60 = 735 samples per frame
@@ -710,11 +904,36 @@ enum SoundEffect {
 };
 
 // Audio state
-// Sound effect queue (simple system)
+// Sound effect queue (simple system), owned by the thread that mixes
 static enum SoundEffect sound_queue[4] = {SOUND_NONE, SOUND_NONE, SOUND_NONE, SOUND_NONE};
 static int sound_effect_timer[4] = {0, 0, 0, 0};
 static int sound_effect_duration[4] = {0, 0, 0, 0};
 
+// Sound effects on their way from the frame that started them to the
+// mixer. One producer (hamoopi_run_frame) and one consumer (whichever
+// thread mixes: retro_run, or the frontend's audio thread in async mode),
+// so the ring needs no lock. Events that do not fit are dropped.
+#define SOUND_RING_SIZE 64  // Power of two
+typedef struct {
+    uint32_t frame;          // sound_frame when it was started
+    enum SoundEffect effect;
+} SoundEvent;
+static SoundEvent sound_ring[SOUND_RING_SIZE];
+static std::atomic<unsigned> sound_ring_head(0);  // Written by the producer
+static std::atomic<unsigned> sound_ring_tail(0);  // Written by the consumer
+static uint32_t sound_frame = 0;                  // Producer: frames run so far
+
+// Mixer side: an event of frame f starts at sample mix_offset + f * 735.
+// mix_offset is moved whenever an event would start in the past or more
+// than AUDIO_MAX_LATENCY ahead, which keeps effects evenly spaced while
+// the game runs steadily and bounds the delay when it does not.
+#define AUDIO_MAX_LATENCY (4 * AUDIO_BUFFER_SIZE)
+static int64_t mix_position = 0;   // Samples mixed so far
+static int64_t mix_offset = 0;
+static int mix_margin = 0;         // Slack for audio thread jitter, async mode only
+static std::atomic<int> mix_quality(HAMOOPI_AUDIO_HIGH);
+static uint32_t mix_noise = 1;     // Noise for the mixer alone, rand() is the game's
+
 // Character colors for visual distinction
 static const int char_colors[NUM_CHARACTERS][3] = {
     {255, 100, 100},  // Red - FIRE
@@ -726,8 +945,79 @@ static const int char_colors[NUM_CHARACTERS][3] = {
 // Fonts
 static FONT* game_font = NULL;
 
-// Function to play a sound effect
+// Effects triggered by the simulation are only recorded; they start when
+// their frame is presented, on the thread that mixes the audio. No more
+// than the 4 voices can start in one frame.
+#define MAX_FRAME_SOUNDS 4
+static enum SoundEffect sim_sounds[MAX_FRAME_SOUNDS];
+static int sim_sound_count = 0;
+
+// Everything needed to draw one frame, captured by the simulation at the
+// point the frame is shown. The renderer only ever reads a RenderState,
+// never the live game state.
+typedef struct {
+    int game_mode;
+    Player players[2];
+    CollisionSnapshot boxes[2];         // game_mode 2 only
+    int projectile_count;
+    hamoopi_sim_t projectile_x[MAX_PROJECTILES];
+    hamoopi_sim_t projectile_y[MAX_PROJECTILES];
+    int projectile_type[MAX_PROJECTILES];
+    int p1_cursor, p2_cursor;
+    bool p1_ready, p2_ready;
+    int p1_rounds_won, p2_rounds_won, current_round;
+    int round_winner;                   // Round result banner: 0=none, 1=P1, 2=P2
+    int stage_animation_frame;
+    bool show_debug_boxes;
+    bool use_sprite_animations;
+    
+    // Side effects, applied once by consume_frame()
+    enum SoundEffect sounds[MAX_FRAME_SOUNDS];
+    int sound_count;
+    int load_sprites[2];                // Character sprite sets to load, -1 for none
+    int prefetch_stage;                 // Stage to start loading, -1 for none
+    bool consumed;
+} RenderState;
+
 static void play_sound(enum SoundEffect effect)
+{
+    if (sim_sound_count < MAX_FRAME_SOUNDS)
+        sim_sounds[sim_sound_count++] = effect;
+}
+
+static void sound_ring_push(uint32_t frame, enum SoundEffect effect)
+{
+    unsigned head = sound_ring_head.load(std::memory_order_relaxed);
+    if (head - sound_ring_tail.load(std::memory_order_acquire) >= SOUND_RING_SIZE)
+        return;
+    sound_ring[head & (SOUND_RING_SIZE - 1)].frame = frame;
+    sound_ring[head & (SOUND_RING_SIZE - 1)].effect = effect;
+    sound_ring_head.store(head + 1, std::memory_order_release);
+}
+
+// Oldest event not yet mixed, or NULL
+static const SoundEvent* sound_ring_peek(void)
+{
+    unsigned tail = sound_ring_tail.load(std::memory_order_relaxed);
+    if (tail == sound_ring_head.load(std::memory_order_acquire))
+        return NULL;
+    return &sound_ring[tail & (SOUND_RING_SIZE - 1)];
+}
+
+static void sound_ring_pop(void)
+{
+    unsigned tail = sound_ring_tail.load(std::memory_order_relaxed);
+    sound_ring_tail.store(tail + 1, std::memory_order_release);
+}
+
+static int mix_rand(void)
+{
+    mix_noise = mix_noise * 1103515245u + 12345u;
+    return (int)((mix_noise >> 16) & 0x7FFF);
+}
+
+// Start a sound effect on a free voice
+static void start_sound(enum SoundEffect effect)
 {
     // Find an empty slot in the sound queue
     for (int i = 0; i < 4; i++)
@@ -799,7 +1089,7 @@ static int16_t generate_sound_sample(enum SoundEffect effect, int position, int
         case SOUND_HIT:
             // Impact sound with noise
             {
-                float noise = ((float)(rand() % 1000) / 500.0f - 1.0f);
+                float noise = ((float)(mix_rand() % 1000) / 500.0f - 1.0f);
                 sample = (int16_t)(noise * amplitude * 32767.0f);
             }
             break;
@@ -807,7 +1097,7 @@ static int16_t generate_sound_sample(enum SoundEffect effect, int position, int
         case SOUND_BLOCK:
             // Metallic clang
             {
-                float freq = 800.0f + (float)(rand() % 200);
+                float freq = 800.0f + (float)(mix_rand() % 200);
                 float phase = (float)position * freq * 2.0f * 3.14159f / AUDIO_SAMPLE_RATE;
                 sample = (int16_t)(sin(phase) * amplitude * 32767.0f * 0.5f);
             }
@@ -831,10 +1121,26 @@ static int16_t generate_sound_sample(enum SoundEffect effect, int position, int
     return sample;
 }
 
-// Fill audio buffer with generated sound effects
-void hamoopi_get_audio_samples(int16_t* buffer, size_t frames)
+// Synthesize the active voices into buffer
+static void synth_samples(int16_t* buffer, size_t frames, int quality)
 {
-    for (size_t i = 0; i < frames; i++)
+    // Audio off: no synthesis, queued effects simply expire
+    if (quality == HAMOOPI_AUDIO_OFF)
+    {
+        memset(buffer, 0, frames * 2 * sizeof(int16_t));
+        for (int j = 0; j < 4; j++)
+        {
+            sound_queue[j] = SOUND_NONE;
+            sound_effect_timer[j] = 0;
+            sound_effect_duration[j] = 0;
+        }
+        return;
+    }
+    
+    // Low quality synthesizes every other sample and holds it
+    int step = (quality == HAMOOPI_AUDIO_LOW) ? 2 : 1;
+    
+    for (size_t i = 0; i < frames; i += step)
     {
         int16_t left = 0;
         int16_t right = 0;
@@ -850,7 +1156,7 @@ void hamoopi_get_audio_samples(int16_t* buffer, size_t frames)
                 left += sample;
                 right += sample;
                 
-                sound_effect_timer[j]--;
+                sound_effect_timer[j] -= step;
                 
                 if (sound_effect_timer[j] <= 0)
                 {
@@ -866,69 +1172,106 @@ void hamoopi_get_audio_samples(int16_t* buffer, size_t frames)
         if (right > 32767) right = 32767;
         if (right < -32768) right = -32768;
         
-        buffer[i * 2] = left;
-        buffer[i * 2 + 1] = right;
+        for (size_t k = i; k < i + step && k < frames; k++)
+        {
+            buffer[k * 2] = left;
+            buffer[k * 2 + 1] = right;
+        }
     }
 }
 
-// Projectile helper functions
-static void spawn_projectile(int owner, int type, float x, float y, float vx, float vy)
+// Fill audio buffer with generated sound effects, starting each queued
+// effect at its scheduled sample
+void hamoopi_get_audio_samples(int16_t* buffer, size_t frames)
 {
-    // Find an empty projectile slot
-    for (int i = 0; i < MAX_PROJECTILES; i++)
+    int quality = mix_quality.load(std::memory_order_relaxed);
+    
+    while (frames > 0)
     {
-        if (!projectiles[i].active)
+        size_t run = frames;
+        const SoundEvent* ev = sound_ring_peek();
+        if (ev)
         {
-            projectiles[i].active = true;
-            projectiles[i].owner = owner;
-            projectiles[i].type = type;
-            projectiles[i].x = x;
-            projectiles[i].y = y;
-            projectiles[i].vx = vx;
-            projectiles[i].vy = vy;
-            projectiles[i].lifetime = 180; // 3 seconds max
-            
-            // Set projectile hitbox based on type
-            projectiles[i].hitbox.x = x - 15;
-            projectiles[i].hitbox.y = y - 15;
-            projectiles[i].hitbox.w = 30;
-            projectiles[i].hitbox.h = 30;
-            break;
+            int64_t at = mix_offset + (int64_t)ev->frame * AUDIO_BUFFER_SIZE;
+            if (at < mix_position || at > mix_position + mix_margin + AUDIO_MAX_LATENCY)
+            {
+                // Late or too early: schedule from this event on
+                mix_offset += mix_position + mix_margin - at;
+                at = mix_position + mix_margin;
+            }
+            if (at == mix_position)
+            {
+                if (quality != HAMOOPI_AUDIO_OFF)
+                    start_sound(ev->effect);
+                sound_ring_pop();
+                continue;
+            }
+            if (at - mix_position < (int64_t)run)
+                run = (size_t)(at - mix_position);
         }
+        
+        synth_samples(buffer, run, quality);
+        buffer += run * 2;
+        frames -= run;
+        mix_position += run;
     }
 }
 
+void hamoopi_set_audio_async(bool async)
+{
+    mix_margin = async ? AUDIO_BUFFER_SIZE : 0;
+}
+
+// Projectile helper functions
+static CollisionBox projectile_box(hamoopi_sim_t x, hamoopi_sim_t y)
+{
+    CollisionBox box;
+    box.x = x - 15;
+    box.y = y - 15;
+    box.w = 30;
+    box.h = 30;
+    return box;
+}
+
+static CollisionBox projectile_hitbox(int i)
+{
+    return projectile_box(projectiles.x[i], projectiles.y[i]);
+}
+
+static void spawn_projectile(int owner, int type, hamoopi_sim_t x, hamoopi_sim_t y, hamoopi_sim_t vx, hamoopi_sim_t vy, int damage)
+{
+    int i = hamoopi_pool_spawn(&projectiles);
+    if (i < 0)
+        return;
+    projectiles.owner[i] = owner;
+    projectiles.type[i] = type;
+    projectiles.x[i] = x;
+    projectiles.y[i] = y;
+    projectiles.vx[i] = vx;
+    projectiles.vy[i] = vy;
+    projectiles.life[i] = PROJECTILE_LIFETIME;
+    projectiles.param[i] = damage;
+}
+
 static void update_projectiles(void)
 {
-    for (int i = 0; i < MAX_PROJECTILES; i++)
+    // Move and age every projectile, dropping the expired ones
+    hamoopi_pool_integrate(&projectiles);
+    
+    for (int i = 0; i < projectiles.count; )
     {
-        if (!projectiles[i].active) continue;
-        
-        // Update position
-        projectiles[i].x += projectiles[i].vx;
-        projectiles[i].y += projectiles[i].vy;
-        projectiles[i].lifetime--;
-        
-        // Update hitbox position
-        projectiles[i].hitbox.x = projectiles[i].x - 15;
-        projectiles[i].hitbox.y = projectiles[i].y - 15;
-        
-        // Deactivate if out of bounds or expired
-        if (projectiles[i].x < 0 || projectiles[i].x > 640 ||
-            projectiles[i].y < 0 || projectiles[i].y > 480 ||
-            projectiles[i].lifetime <= 0)
+        // Deactivate if out of bounds
+        if (projectiles.x[i] < 0 || projectiles.x[i] > 640 ||
+            projectiles.y[i] < 0 || projectiles.y[i] > 480)
         {
-            projectiles[i].active = false;
+            hamoopi_pool_remove(&projectiles, i);
             continue;
         }
         
         // Check collision with players using hitbox vs hurtbox
-        int target = (projectiles[i].owner == 0) ? 1 : 0;
-        Player* target_player = &players[target];
-        
-        CollisionBox target_hurtbox = get_hurtbox(target_player);
+        Player* target_player = &players[projectiles.owner[i] == 0 ? 1 : 0];
         
-        if (boxes_overlap(projectiles[i].hitbox, target_hurtbox) && target_player->health > 0)
+        if (boxes_overlap(projectile_hitbox(i), fighter_boxes(target_player)->hurt) && target_player->health > 0)
         {
             // Hit!
             if (target_player->is_blocking)
@@ -938,66 +1281,137 @@ static void update_projectiles(void)
             }
             else
             {
-                target_player->health -= FIRE_PROJECTILE_DAMAGE;
+                target_player->health -= projectiles.param[i];
                 play_sound(SOUND_HIT);
             }
             if (target_player->health < 0) target_player->health = 0;
-            projectiles[i].active = false;
+            hamoopi_pool_remove(&projectiles, i);
+            continue;
         }
+        i++;
     }
 }
 
-static void draw_projectiles(BITMAP* buffer)
+static void draw_projectiles(BITMAP* buffer, const RenderState* rs)
 {
-    for (int i = 0; i < MAX_PROJECTILES; i++)
+    for (int i = 0; i < rs->projectile_count; i++)
     {
-        if (!projectiles[i].active) continue;
-        
-        int x = (int)projectiles[i].x;
-        int y = (int)projectiles[i].y;
+        int x = (int)rs->projectile_x[i];
+        int y = (int)rs->projectile_y[i];
         
         // FIRE projectile - fireball
-        if (projectiles[i].type == 0)
+        if (rs->projectile_type[i] == 0)
         {
             // Draw fireball with glow effect
-            circlefill(buffer, x, y, 12, makecol(255, 100, 0));
-            circlefill(buffer, x, y, 8, makecol(255, 200, 0));
-            circle(buffer, x, y, 12, makecol(255, 150, 0));
+            circlefill(buffer, RES(x), RES(y), RES(12), makecol(255, 100, 0));
+            circlefill(buffer, RES(x), RES(y), RES(8), makecol(255, 200, 0));
+            circle(buffer, RES(x), RES(y), RES(12), makecol(255, 150, 0));
         }
         
         // Draw debug hitbox
-        draw_debug_box(buffer, projectiles[i].hitbox, makecol(255, 0, 255));
-    }
-}
-
-// Key mapping for players
-// Player 1 keys
-static int p1_up_key = KEY_W;
-static int p1_down_key = KEY_S;
-static int p1_left_key = KEY_A;
-static int p1_right_key = KEY_D;
-static int p1_bt1_key = KEY_J;
-static int p1_bt2_key = KEY_K;
-static int p1_bt3_key = KEY_L;
-static int p1_bt4_key = KEY_U;
-static int p1_bt5_key = KEY_I;
-static int p1_bt6_key = KEY_O;
-static int p1_select_key = KEY_1;
-static int p1_start_key = KEY_ENTER;
-
-// Player 2 keys
-static int p2_up_key = KEY_UP;
-static int p2_down_key = KEY_DOWN;
-static int p2_left_key = KEY_LEFT;
-static int p2_right_key = KEY_RIGHT;
-static int p2_bt1_key = KEY_1_PAD;
-static int p2_bt2_key = KEY_2_PAD;
-static int p2_bt3_key = KEY_3_PAD;
-static int p2_bt4_key = KEY_4_PAD;
-static int p2_bt5_key = KEY_5_PAD;
-static int p2_bt6_key = KEY_6_PAD;
-static int p2_select_key = KEY_7_PAD;
-static int p2_start_key = KEY_8_PAD;
+        if (rs->show_debug_boxes)
+            draw_debug_box(buffer, projectile_box(rs->projectile_x[i], rs->projectile_y[i]), makecol(255, 0, 255));
+    }
+}
+
+// Special move interpreter state, one per player
+typedef struct {
+    const SpecialProgram* program;  // NULL when no special is running
+    int pc;
+    int wait;
+    hamoopi_sim_t r[SPECIAL_REGS];
+} SpecialVM;
+
+static SpecialVM special_vm[2];
+
+static hamoopi_sim_t special_field(const Player* p, int field)
+{
+    switch (field)
+    {
+        case SF_X: return p->x;
+        case SF_Y: return p->y;
+        case SF_FACING: return (hamoopi_sim_t)p->facing;
+        case SF_ON_GROUND: return p->on_ground ? 1.0f : 0.0f;
+        case SF_HEALTH: return (hamoopi_sim_t)p->health;
+    }
+    return 0.0f;
+}
+
+// Run the player's special program until it ends or waits
+static void special_vm_run(int player_num)
+{
+    SpecialVM* vm = &special_vm[player_num];
+    if (!vm->program)
+        return;
+    if (vm->wait > 0 && --vm->wait > 0)
+        return;
+    
+    Player* p = &players[player_num];
+    Player* opponent = &players[1 - player_num];
+    hamoopi_sim_t* r = vm->r;
+    
+    while (vm->pc < vm->program->length)
+    {
+        const SpecialInstr* in = &vm->program->code[vm->pc++];
+        switch (in->op)
+        {
+            case SOP_LOAD: r[in->a] = in->imm; break;
+            case SOP_SELF: r[in->a] = special_field(p, in->b); break;
+            case SOP_OPP: r[in->a] = special_field(opponent, in->b); break;
+            case SOP_ADD: r[in->a] = r[in->b] + r[in->c]; break;
+            case SOP_SUB: r[in->a] = r[in->b] - r[in->c]; break;
+            case SOP_MUL: r[in->a] = r[in->b] * r[in->c]; break;
+            case SOP_ABS: r[in->a] = hamoopi_abs(r[in->b]); break;
+            case SOP_JGE: if (r[in->a] >= r[in->b]) vm->pc = in->c; break;
+            case SOP_JZ: if (r[in->a] == 0.0f) vm->pc = in->c; break;
+            case SOP_SOUND: play_sound((enum SoundEffect)in->a); break;
+            case SOP_SPAWN: spawn_projectile(player_num, in->a, r[0], r[1], r[2], r[3], (int)in->imm); break;
+            case SOP_HEAL:
+                p->health += (int)in->imm;
+                if (p->health > 100) p->health = 100;
+                break;
+            case SOP_HIT:
+                if (opponent->is_blocking)
+                {
+                    opponent->health -= BLOCKED_DAMAGE;
+                    play_sound(SOUND_BLOCK);
+                }
+                else
+                {
+                    opponent->health -= (int)in->imm;
+                    play_sound(SOUND_HIT);
+                }
+                if (opponent->health < 0) opponent->health = 0;
+                break;
+            case SOP_SETVX: p->vx = in->imm * p->facing; break;
+            case SOP_SETVY:
+                p->vy = in->imm;
+                if (in->imm < 0.0f) p->on_ground = false;
+                break;
+            case SOP_DASH:
+                p->is_dashing = true;
+                p->dash_timer = (int)in->imm;
+                break;
+            case SOP_WAIT:
+                vm->wait = (int)in->imm;
+                if (vm->wait > 0)
+                    return;
+                break;
+            default:
+                vm->program = NULL;
+                return;
+        }
+    }
+    vm->program = NULL;
+}
+
+static void special_vm_start(int player_num, const SpecialProgram* program)
+{
+    SpecialVM* vm = &special_vm[player_num];
+    memset(vm, 0, sizeof(*vm));
+    vm->program = program->length > 0 ? program : NULL;
+    special_vm_run(player_num);
+}
 
 // Initialize player state
 static void init_player(Player* p, int player_num)
@@ -1018,146 +1432,539 @@ static void init_player(Player* p, int player_num)
     p->is_dashing = false;
     p->dash_timer = 0;
     p->attack_frame = 0;
+    for (int i = 0; i < MAX_SPECIAL_COMMANDS; i++)
+    {
+        p->command_dir[i] = 0;
+        p->command_time[i] = SPECIAL_COMMAND_WINDOW + 1;
+    }
+    memset(&special_vm[player_num], 0, sizeof(special_vm[player_num]));
     // character_id is preserved from selection
 }
 
-// Execute special move for a player
-static void execute_special_move(Player* player, Player* opponent, int player_num)
+// Fighter state machine
+// Player.state values. The same numbering is used by the sprite and
+// collision box lookups.
+enum FighterState {
+    FS_IDLE = 0,
+    FS_WALK = 1,
+    FS_JUMP = 2,
+    FS_ATTACK = 3,
+    FS_HIT = 4,
+    FS_CROUCH = 5,
+    FS_CROUCH_ATTACK = 6,
+    FS_COUNT
+};
+
+// Per-frame input bits fed to the state machine
+enum {
+    FIN_UP = 1 << 0,
+    FIN_DOWN = 1 << 1,
+    FIN_LEFT = 1 << 2,
+    FIN_RIGHT = 1 << 3,
+    FIN_ATTACK = 1 << 4,
+    FIN_BLOCK = 1 << 5,
+    FIN_SPECIAL = 1 << 6
+};
+
+// State flags
+#define FSF_ATTACK 0x01  // Runs the attack hook; movement does not change the state
+
+typedef struct {
+    unsigned flags;
+    int length;          // Frames before returning to idle (attacks)
+    int active_start;    // First and last frame with an active hitbox
+    int active_end;
+} FighterStateDef;
+
+typedef struct {
+    FighterStateDef states[FS_COUNT];
+    // State picked from movement when no attack/block is in progress,
+    // indexed by [airborne][crouching][moving]
+    unsigned char locomotion[2][2][2];
+    // State entered when attacking, indexed by [crouching]
+    unsigned char attack_state[2];
+    int attack_cooldown;
+    hamoopi_sim_t walk_speed;
+    hamoopi_sim_t jump_velocity;
+    hamoopi_sim_t gravity;
+} FighterFSM;
+
+static FighterFSM fighter_fsm[NUM_CHARACTERS];
+static int attack_cooldown[2] = {0, 0};
+
+// char.ini animation of a state, NULL when the character has none
+static const AnimationConfig* find_state_animation(int char_id, int state_id)
+{
+    const CharacterConfig* config = character_configs[char_id];
+    if (!config || !config->loaded)
+        return NULL;
+    for (int i = 0; i < config->animation_count; i++)
+        if (config->animations[i].state_id == state_id)
+            return &config->animations[i];
+    return NULL;
+}
+
+// Attack timing from the state's animation: it lasts the sum of its
+// FrameTime_NN values and is active over the frames that have a hitbox in
+// chbox.ini. ATTACK_* stand in for whatever the character does not define.
+static void compile_attack_state(FighterStateDef* def, int char_id, int state_id)
 {
-    play_sound(SOUND_SPECIAL); // Special move sound
+    def->flags = FSF_ATTACK;
+    def->length = ATTACK_LENGTH;
+    def->active_start = ATTACK_DAMAGE_FRAME;
+    def->active_end = ATTACK_ACTIVE_END;
     
-    switch (player->character_id)
+    const AnimationConfig* anim = find_state_animation(char_id, state_id);
+    if (!anim || anim->frame_count == 0)
+        return;
+    
+    int tick = 0;
+    int first = -1, last = -1;
+    for (int f = 0; f < anim->frame_count; f++)
     {
-        case 0: // FIRE - Fireball projectile
-            spawn_projectile(player_num, 0, player->x + 30.0f * player->facing, player->y, 
-                           8.0f * player->facing, 0.0f);
-            break;
-            
-        case 1: // WATER - Healing wave
-            player->health += WATER_HEAL_AMOUNT;
-            if (player->health > 100) player->health = 100;
-            break;
-            
-        case 2: // EARTH - Ground stomp
-            {
-                float dist = fabs(player->x - opponent->x);
-                if (dist < EARTH_STOMP_RANGE && opponent->on_ground && opponent->health > 0)
-                {
-                    if (opponent->is_blocking)
-                    {
-                        opponent->health -= BLOCKED_DAMAGE;
-                        play_sound(SOUND_BLOCK);
-                    }
-                    else
-                    {
-                        opponent->health -= EARTH_STOMP_DAMAGE;
-                        play_sound(SOUND_HIT);
-                    }
-                    if (opponent->health < 0) opponent->health = 0;
-                }
-            }
-            break;
-            
-        case 3: // WIND - Dash attack
-            player->is_dashing = true;
-            player->dash_timer = WIND_DASH_DURATION;
-            // Check for dash hit
-            {
-                float dist = fabs(player->x - opponent->x);
-                if (dist < WIND_DASH_HIT_RANGE && opponent->health > 0)
-                {
-                    if (opponent->is_blocking)
-                    {
-                        opponent->health -= BLOCKED_DAMAGE;
-                        play_sound(SOUND_BLOCK);
-                    }
-                    else
-                    {
-                        opponent->health -= WIND_DASH_DAMAGE;
-                        play_sound(SOUND_HIT);
-                    }
-                    if (opponent->health < 0) opponent->health = 0;
-                }
-            }
-            break;
+        int frame_time = anim->frame_times[f] > 0 ? anim->frame_times[f] : 5;
+        const CollisionBoxConfig* boxes = find_collision_box_config(char_id, state_id, f);
+        if (boxes && boxes->hitbox_count > 0)
+        {
+            if (first < 0)
+                first = tick;
+            last = tick + frame_time - 1;
+        }
+        tick += frame_time;
     }
-    
+    def->length = tick;
+    if (first >= 0)
+    {
+        // attack_frame is already 1 on the first frame the hook sees
+        def->active_start = first > 0 ? first : 1;
+        def->active_end = last > def->active_start ? last : def->active_start;
+    }
+}
+
+// Build a character's state table from its char.ini and chbox.ini:
+// attack timing from states 151 and 201, walk speed from 420's Hspeed,
+// jump velocity and gravity from 300. The state layout is shared.
+static void compile_fighter_fsm(int char_id)
+{
+    FighterFSM* fsm = &fighter_fsm[char_id];
+    memset(fsm, 0, sizeof(*fsm));
+    
+    compile_attack_state(&fsm->states[FS_ATTACK], char_id, 151);
+    compile_attack_state(&fsm->states[FS_CROUCH_ATTACK], char_id, 201);
+    
+    for (int air = 0; air < 2; air++)
+        for (int crouch = 0; crouch < 2; crouch++)
+            for (int moving = 0; moving < 2; moving++)
+                fsm->locomotion[air][crouch][moving] =
+                    air ? FS_JUMP : crouch ? FS_CROUCH : moving ? FS_WALK : FS_IDLE;
+    
+    fsm->attack_state[0] = FS_ATTACK;
+    fsm->attack_state[1] = FS_CROUCH_ATTACK;
+    fsm->attack_cooldown = ATTACK_COOLDOWN;
+    
+    const AnimationConfig* walk = find_state_animation(char_id, 420);
+    const AnimationConfig* jump = find_state_animation(char_id, 300);
+    fsm->walk_speed = (walk && walk->hspeed > 0.0f) ? walk->hspeed : (hamoopi_sim_t)3.0f;
+    fsm->jump_velocity = (jump && jump->vspeed < 0.0f) ? jump->vspeed : (hamoopi_sim_t)-12.0f;
+    fsm->gravity = (jump && jump->gravity > 0.0f) ? jump->gravity : (hamoopi_sim_t)0.5f;
+}
+
+static bool attack_active(const Player* p)
+{
+    const FighterStateDef* def = &fighter_fsm[p->character_id].states[p->state];
+    return p->attack_frame >= def->active_start && p->attack_frame <= def->active_end;
+}
+
+static unsigned fighter_input(int player_num)
+{
+    // FIN_* bit order: attack is A, block is B and special is Y
+    static const uint32_t buttons[7] = {
+        BTN(UP), BTN(DOWN), BTN(LEFT), BTN(RIGHT), BTN(A), BTN(B), BTN(Y)
+    };
+    uint32_t held = input[player_num].held;
+    unsigned in = 0;
+    for (int b = 0; b < 7; b++)
+        in |= (held & buttons[b]) ? (1u << b) : 0u;
+    return in;
+}
+
+// Execute special move for a player
+static void execute_special_move(Player* player, Player* opponent, int player_num, const SpecialProgram* program)
+{
+    (void)opponent;
+    special_vm_start(player_num, program);
     player->special_move_cooldown = SPECIAL_MOVE_COOLDOWN;
 }
 
-// Draw a simple fighter sprite with character color
-static void draw_player(BITMAP* dest, Player* p)
+// Remember the direction held this frame as a numpad digit, 6 pointing at
+// the opponent; neutral and repeats are not recorded
+static void record_command_direction(Player* p, const Player* opponent, unsigned in)
 {
-    int x = (int)p->x;
-    int y = (int)p->y;
-    
-    // Get character color for tinting/fallback
-    int color = makecol(char_colors[p->character_id][0], 
-                        char_colors[p->character_id][1], 
-                        char_colors[p->character_id][2]);
+    unsigned forward = opponent->x >= p->x ? FIN_RIGHT : FIN_LEFT;
+    unsigned back = forward == FIN_RIGHT ? FIN_LEFT : FIN_RIGHT;
+    int dir = 5;
+    if (in & forward) dir += 1;
+    else if (in & back) dir -= 1;
+    if (in & FIN_UP) dir += 3;
+    else if (in & FIN_DOWN) dir -= 3;
+    
+    for (int i = 0; i < MAX_SPECIAL_COMMANDS; i++)
+        if (p->command_time[i] <= SPECIAL_COMMAND_WINDOW)
+            p->command_time[i]++;
+    if (dir == 5 || dir == p->command_dir[0])
+        return;
     
-    // Try to get sprite frame (only if sprite animations are enabled)
-    BITMAP* sprite = use_sprite_animations ? get_sprite_frame(p) : NULL;
+    for (int i = MAX_SPECIAL_COMMANDS - 1; i > 0; i--)
+    {
+        p->command_dir[i] = p->command_dir[i - 1];
+        p->command_time[i] = p->command_time[i - 1];
+    }
+    p->command_dir[0] = dir;
+    p->command_time[0] = 0;
+}
+
+// The special.ini move whose command was just entered, the longest one
+// when several match (6,2,3,6 over 2,3,6); -1 when none
+static int match_command_special(const Player* p)
+{
+    const CharacterConfig* config = character_configs[p->character_id];
+    if (!config)
+        return -1;
     
-    if (sprite)
+    int best = -1;
+    int best_length = 0;
+    for (int i = 0; i < config->special_move_count; i++)
     {
-        // Draw sprite
-        int sprite_x = x - (sprite->w / 2);
-        int sprite_y = y - sprite->h;
-        
-        // Draw sprite with horizontal flip for left-facing characters
-        if (p->facing < 0)
-        {
-            // Create temporary flipped bitmap
-            BITMAP* flipped = create_bitmap(sprite->w, sprite->h);
-            if (flipped)
-            {
-                clear_to_color(flipped, makecol(255, 0, 255));  // Transparent color
-                // Manually flip horizontally
-                for (int sy = 0; sy < sprite->h; sy++)
-                {
-                    for (int sx = 0; sx < sprite->w; sx++)
-                    {
-                        putpixel(flipped, sprite->w - 1 - sx, sy, getpixel(sprite, sx, sy));
-                    }
-                }
-                draw_sprite(dest, flipped, sprite_x, sprite_y);
-                destroy_bitmap(flipped);
-            }
-            else
-            {
-                // Fallback if flipped bitmap creation fails
-                draw_sprite(dest, sprite, sprite_x, sprite_y);
-            }
-        }
-        else
-        {
-            draw_sprite(dest, sprite, sprite_x, sprite_y);
-        }
+        const SpecialMoveConfig* sp = &config->special_moves[i];
+        int n = sp->command_count;
+        if (n <= best_length || command_programs[p->character_id][i].length == 0)
+            continue;
+        if (p->command_time[n - 1] > SPECIAL_COMMAND_WINDOW)
+            continue;
         
-        // Apply character color tint by drawing a semi-transparent overlay
-        // This preserves sprite details while adding character color
-        if (p->is_blocking)
+        bool match = true;
+        for (int k = 0; k < n && match; k++)
+            match = p->command_dir[k] == sp->command_sequence[n - 1 - k];
+        if (match)
         {
-            // Darker tint when blocking
-            int dark_color = makecol(char_colors[p->character_id][0] / BLOCKING_COLOR_DIVISOR, 
-                                      char_colors[p->character_id][1] / BLOCKING_COLOR_DIVISOR, 
-                                      char_colors[p->character_id][2] / BLOCKING_COLOR_DIVISOR);
-            drawing_mode(DRAW_MODE_TRANS, NULL, 0, 0);
-            set_trans_blender(0, 0, 0, 128);
-            rectfill(dest, sprite_x, sprite_y, sprite_x + sprite->w, sprite_y + sprite->h, dark_color);
-            solid_mode();
+            best = i;
+            best_length = n;
         }
-        
+    }
+    return best;
+}
+
+// Per-state update hooks, run after input has been applied
+typedef void (*FighterHook)(Player* p, Player* opponent, const FighterStateDef* def);
+
+static void fighter_hook_none(Player* p, Player* opponent, const FighterStateDef* def)
+{
+    (void)p; (void)opponent; (void)def;
+}
+
+static void fighter_hook_attack(Player* p, Player* opponent, const FighterStateDef* def)
+{
+    p->attack_frame++;
+    if (p->attack_frame >= def->length)
+    {
+        p->state = FS_IDLE;
+        p->attack_frame = 0;
+    }
+    
+    // Check hitbox collision during active frames
+    if (p->attack_frame < def->active_start || p->attack_frame > def->active_end || opponent->health <= 0)
+        return;
+    
+    // Only apply damage once per attack
+    if (boxes_overlap(fighter_boxes(p)->hit, fighter_boxes(opponent)->hurt) && p->attack_frame == def->active_start)
+    {
+        opponent->health -= opponent->is_blocking ? BLOCKED_DAMAGE : NORMAL_DAMAGE;
+        if (opponent->health < 0) opponent->health = 0;
+        play_sound(opponent->is_blocking ? SOUND_BLOCK : SOUND_HIT);
+    }
+}
+
+static const FighterHook fighter_hooks[FS_COUNT] = {
+    fighter_hook_none,    // FS_IDLE
+    fighter_hook_none,    // FS_WALK
+    fighter_hook_none,    // FS_JUMP
+    fighter_hook_attack,  // FS_ATTACK
+    fighter_hook_none,    // FS_HIT
+    fighter_hook_none,    // FS_CROUCH
+    fighter_hook_attack   // FS_CROUCH_ATTACK
+};
+
+// One fighter's input, state hook and physics for this frame
+static void fighter_update(int player_num)
+{
+    Player* p = &players[player_num];
+    Player* opponent = &players[1 - player_num];
+    const FighterFSM* fsm = &fighter_fsm[p->character_id];
+    
+    if (attack_cooldown[player_num] > 0) attack_cooldown[player_num]--;
+    
+    if (p->health <= 0)
+        return;
+    
+    unsigned in = fighter_input(player_num);
+    record_command_direction(p, opponent, in);
+    
+    // A running special owns the fighter, like the dash: no walking,
+    // jumping, blocking or attacking until its program ends
+    bool in_special = special_vm[player_num].program != NULL;
+    if (in_special)
+        in = 0;
+    
+    p->is_crouching = (in & FIN_DOWN) && p->on_ground;
+    
+    // Block sound effect (when starting to block)
+    bool was_blocking = p->is_blocking;
+    p->is_blocking = (in & FIN_BLOCK) != 0;
+    if (p->is_blocking && !was_blocking)
+        play_sound(SOUND_BLOCK);
+    
+    // Movement (slower when blocking, can't move horizontally when crouching).
+    // During a special the velocity its program set holds.
+    if (in_special)
+    {
+    }
+    else if (!p->is_crouching)
+    {
+        hamoopi_sim_t speed = fsm->walk_speed * (p->is_blocking ? BLOCKING_SPEED_MULTIPLIER : 1.0f);
+        if (in & FIN_LEFT) { p->vx = -speed; p->facing = -1; }
+        else if (in & FIN_RIGHT) { p->vx = speed; p->facing = 1; }
+        else { p->vx *= 0.8f; }
+    }
+    else
+    {
+        p->vx *= 0.8f;
+    }
+    
+    // Jump (can't jump while blocking or crouching)
+    if ((in & FIN_UP) && p->on_ground && !p->is_blocking && !p->is_crouching)
+    {
+        p->vy = fsm->jump_velocity;
+        p->on_ground = false;
+        play_sound(SOUND_JUMP);
+    }
+    
+    // Attack with cooldown (can't attack while blocking). A special.ini
+    // command entered just before turns it into that special.
+    int command_move = -1;
+    if ((in & FIN_ATTACK) && attack_cooldown[player_num] == 0 && !p->is_blocking)
+    {
+        if (p->special_move_cooldown == 0)
+            command_move = match_command_special(p);
+        if (command_move < 0)
+        {
+            play_sound(SOUND_ATTACK);
+            p->state = fsm->attack_state[p->is_crouching];
+            p->attack_frame = 0;
+        }
+        attack_cooldown[player_num] = fsm->attack_cooldown;
+    }
+    
+    fighter_hooks[p->state](p, opponent, &fsm->states[p->state]);
+    
+    // Special move (Y button / bt3)
+    if (p->special_move_cooldown > 0)
+        p->special_move_cooldown--;
+    
+    // Handle WIND dash
+    if (p->is_dashing)
+    {
+        p->dash_timer--;
+        p->vx = WIND_DASH_SPEED * p->facing;
+        if (p->dash_timer <= 0)
+            p->is_dashing = false;
+    }
+    
+    // Continue a special that is waiting for a later frame
+    special_vm_run(player_num);
+    
+    if (command_move >= 0)
+    {
+        // Command specials are thrown at the opponent from a standstill;
+        // only their [x00_NN] HSpeed moves the fighter
+        p->facing = opponent->x >= p->x ? 1 : -1;
+        p->vx = 0.0f;
+        p->command_dir[0] = 0;
+        execute_special_move(p, opponent, player_num, &command_programs[p->character_id][command_move]);
+    }
+    else if ((in & FIN_SPECIAL) && p->special_move_cooldown == 0 && !p->is_blocking)
+    {
+        execute_special_move(p, opponent, player_num, &special_programs[p->character_id]);
+    }
+    
+    // Physics
+    p->vy += fsm->gravity;
+    p->x += p->vx;
+    p->y += p->vy;
+    
+    // Collision with ground
+    if (p->y >= 350.0f)
+    {
+        p->y = 350.0f;
+        p->vy = 0.0f;
+        p->on_ground = true;
+    }
+    
+    // Boundary check
+    if (p->x < 20.0f) p->x = 20.0f;
+    if (p->x > 620.0f) p->x = 620.0f;
+}
+
+// State picked from movement once both fighters have moved
+static void fighter_resolve_state(Player* p)
+{
+    const FighterFSM* fsm = &fighter_fsm[p->character_id];
+    if (p->health <= 0 || (fsm->states[p->state].flags & FSF_ATTACK) || p->is_blocking)
+        return;
+    p->state = fsm->locomotion[!p->on_ground][p->is_crouching][hamoopi_abs(p->vx) > 0.5f];
+}
+
+static bool fighter_attacking(const Player* p)
+{
+    return (fighter_fsm[p->character_id].states[p->state].flags & FSF_ATTACK) != 0;
+}
+
+// Translucent fills through hamoopi_blend's SIMD kernels instead of
+// Allegro's per-pixel blender callback; other depths keep DRAW_MODE_TRANS.
+// Corners are inclusive, as with rectfill.
+static bool clip_span(BITMAP* dest, int y, int* x1, int* x2)
+{
+    if (y < dest->ct || y >= dest->cb)
+        return false;
+    if (*x1 < dest->cl)
+        *x1 = dest->cl;
+    if (*x2 >= dest->cr)
+        *x2 = dest->cr - 1;
+    return *x1 <= *x2;
+}
+
+static void blend_rectfill(BITMAP* dest, int x1, int y1, int x2, int y2, int color, int alpha)
+{
+    if (bitmap_color_depth(dest) != 32)
+    {
+        drawing_mode(DRAW_MODE_TRANS, NULL, 0, 0);
+        set_trans_blender(0, 0, 0, alpha);
+        rectfill(dest, x1, y1, x2, y2, color);
+        solid_mode();
+        return;
+    }
+
+    for (int y = y1; y <= y2; y++)
+    {
+        int a = x1, b = x2;
+        if (clip_span(dest, y, &a, &b))
+            hamoopi_blend_fill((uint32_t*)dest->line[y] + a, b - a + 1, (uint32_t)color, alpha);
+    }
+}
+
+static void blend_ellipsefill(BITMAP* dest, int cx, int cy, int rx, int ry, int color, int alpha)
+{
+    if (bitmap_color_depth(dest) != 32 || rx <= 0 || ry <= 0)
+    {
+        drawing_mode(DRAW_MODE_TRANS, NULL, 0, 0);
+        set_trans_blender(0, 0, 0, alpha);
+        ellipsefill(dest, cx, cy, rx, ry, color);
+        solid_mode();
+        return;
+    }
+
+    // One span per row: the widest half that stays inside the ellipse
+    long rr = (long)rx * rx * ry * ry;
+    for (int dy = -ry; dy <= ry; dy++)
+    {
+        long row = (long)dy * dy * rx * rx;
+        int half = rx;
+        while (half > 0 && (long)half * half * ry * ry + row > rr)
+            half--;
+        int a = cx - half, b = cx + half;
+        if (clip_span(dest, cy + dy, &a, &b))
+            hamoopi_blend_fill((uint32_t*)dest->line[cy + dy] + a, b - a + 1, (uint32_t)color, alpha);
+    }
+}
+
+// Draw a simple fighter sprite with character color
+static void draw_player(BITMAP* dest, const RenderState* rs, int player_num)
+{
+    const Player* p = &rs->players[player_num];
+    int x = (int)p->x;
+    int y = (int)p->y;
+    
+    // Get character color for tinting/fallback
+    int color = makecol(char_colors[p->character_id][0], 
+                        char_colors[p->character_id][1], 
+                        char_colors[p->character_id][2]);
+    
+    // Ground shadow, shrinking as the fighter rises
+    if (core_options.shadows)
+    {
+        int rx = 24 - (int)((350.0f - p->y) / 10.0f);
+        if (rx < 8) rx = 8;
+        blend_ellipsefill(dest, RES(x), RES(350), RES(rx), RES(5), makecol(0, 0, 0), 96);
+    }
+    
+    // Try to get sprite frame (only if sprite animations are enabled)
+    BITMAP* sprite = rs->use_sprite_animations ? get_sprite_frame(p) : NULL;
+    
+    if (sprite)
+    {
+        // Draw sprite
+        int sprite_x = x - (sprite->w / 2);
+        int sprite_y = y - sprite->h;
+        
+        // Draw sprite with horizontal flip for left-facing characters
+        if (p->facing < 0)
+        {
+            // Create temporary flipped bitmap
+            BITMAP* flipped = create_bitmap(sprite->w, sprite->h);
+            if (flipped)
+            {
+                clear_to_color(flipped, makecol(255, 0, 255));  // Transparent color
+                // Manually flip horizontally
+                for (int sy = 0; sy < sprite->h; sy++)
+                {
+                    for (int sx = 0; sx < sprite->w; sx++)
+                    {
+                        putpixel(flipped, sprite->w - 1 - sx, sy, getpixel(sprite, sx, sy));
+                    }
+                }
+                res_sprite(dest, flipped, sprite_x, sprite_y);
+                destroy_bitmap(flipped);
+            }
+            else
+            {
+                // Fallback if flipped bitmap creation fails
+                res_sprite(dest, sprite, sprite_x, sprite_y);
+            }
+        }
+        else
+        {
+            res_sprite(dest, sprite, sprite_x, sprite_y);
+        }
+        
+        // Apply character color tint by drawing a semi-transparent overlay
+        // This preserves sprite details while adding character color
+        if (p->is_blocking)
+        {
+            // Darker tint when blocking
+            int dark_color = makecol(char_colors[p->character_id][0] / BLOCKING_COLOR_DIVISOR, 
+                                      char_colors[p->character_id][1] / BLOCKING_COLOR_DIVISOR, 
+                                      char_colors[p->character_id][2] / BLOCKING_COLOR_DIVISOR);
+            blend_rectfill(dest, RES(sprite_x), RES(sprite_y), RES(sprite_x + sprite->w), RES(sprite_y + sprite->h), dark_color, 128);
+        }
+        
         // Draw shield in front if blocking
         if (p->is_blocking)
         {
             int shield_x = x + (p->facing * 30);
             int shield_y = y - 40;
             int shield_color = makecol(150, 150, 255);
-            circlefill(dest, shield_x, shield_y, 15, shield_color);
-            circle(dest, shield_x, shield_y, 16, makecol(255, 255, 255));
-            circle(dest, shield_x, shield_y, 17, makecol(255, 255, 255));
+            circlefill(dest, RES(shield_x), RES(shield_y), RES(15), shield_color);
+            circle(dest, RES(shield_x), RES(shield_y), RES(16), makecol(255, 255, 255));
+            circle(dest, RES(shield_x), RES(shield_y), RES(17), makecol(255, 255, 255));
         }
     }
     else
@@ -1168,30 +1975,30 @@ static void draw_player(BITMAP* dest, Player* p)
             int dark_color = makecol(char_colors[p->character_id][0] / BLOCKING_COLOR_DIVISOR, 
                                       char_colors[p->character_id][1] / BLOCKING_COLOR_DIVISOR, 
                                       char_colors[p->character_id][2] / BLOCKING_COLOR_DIVISOR);
-            rectfill(dest, x - 15, y - 50, x + 15, y, dark_color);
-            circlefill(dest, x, y - 60, 10, dark_color);
+            rectfill(dest, RES(x - 15), RES(y - 50), RES(x + 15), RES(y), dark_color);
+            circlefill(dest, RES(x), RES(y - 60), RES(10), dark_color);
             
             int shield_x = x + (p->facing * 20);
             int shield_color = makecol(150, 150, 255);
-            circlefill(dest, shield_x, y - 30, 15, shield_color);
-            circle(dest, shield_x, y - 30, 16, makecol(255, 255, 255));
-            circle(dest, shield_x, y - 30, 17, makecol(255, 255, 255));
+            circlefill(dest, RES(shield_x), RES(y - 30), RES(15), shield_color);
+            circle(dest, RES(shield_x), RES(y - 30), RES(16), makecol(255, 255, 255));
+            circle(dest, RES(shield_x), RES(y - 30), RES(17), makecol(255, 255, 255));
         }
         else
         {
-            rectfill(dest, x - 15, y - 50, x + 15, y, color);
-            circlefill(dest, x, y - 60, 10, color);
+            rectfill(dest, RES(x - 15), RES(y - 50), RES(x + 15), RES(y), color);
+            circlefill(dest, RES(x), RES(y - 60), RES(10), color);
         }
         
         int dir = p->facing;
-        line(dest, x, y - 60, x + dir * 20, y - 60, makecol(255, 255, 0));
+        line(dest, RES(x), RES(y - 60), RES(x + dir * 20), RES(y - 60), makecol(255, 255, 0));
     }
     
     // Draw health bar above player
     int bar_width = 60;
     int health_width = (p->health * bar_width) / 100;
-    rect(dest, x - 30, y - 80, x + 30, y - 75, makecol(255, 255, 255));
-    rectfill(dest, x - 30, y - 80, x - 30 + health_width, y - 75, makecol(0, 255, 0));
+    rect(dest, RES(x - 30), RES(y - 80), RES(x + 30), RES(y - 75), makecol(255, 255, 255));
+    rectfill(dest, RES(x - 30), RES(y - 80), RES(x - 30 + health_width), RES(y - 75), makecol(0, 255, 0));
     
     // Draw special effects
     if (p->is_dashing)
@@ -1200,22 +2007,26 @@ static void draw_player(BITMAP* dest, Player* p)
         for (int i = 1; i <= 3; i++)
         {
             int offset = i * 15;
-            line(dest, x - dir * offset, y - 30, x - dir * offset, y + 20, 
+            line(dest, RES(x - dir * offset), RES(y - 30), RES(x - dir * offset), RES(y + 20), 
                  makecol(200, 200, 255));
-            line(dest, x - dir * offset, y, x - dir * offset, y + 40, 
+            line(dest, RES(x - dir * offset), RES(y), RES(x - dir * offset), RES(y + 40), 
                  makecol(150, 150, 255));
         }
     }
     
     // Draw debug collision boxes if enabled
-    draw_debug_box(dest, get_body_box(p), makecol(255, 255, 0));      // Yellow for body
-    draw_debug_box(dest, get_hurtbox(p), makecol(0, 255, 0));         // Green for hurtbox
-    draw_debug_box(dest, get_hitbox(p), makecol(255, 0, 0));          // Red for hitbox
-    draw_debug_box(dest, get_clash_box(p), makecol(255, 165, 0));     // Orange for clash box
+    if (rs->show_debug_boxes)
+    {
+        const CollisionSnapshot* boxes = &rs->boxes[player_num];
+        draw_debug_box(dest, boxes->body, makecol(255, 255, 0));      // Yellow for body
+        draw_debug_box(dest, boxes->hurt, makecol(0, 255, 0));        // Green for hurtbox
+        draw_debug_box(dest, boxes->hit, makecol(255, 0, 0));         // Red for hitbox
+        draw_debug_box(dest, boxes->clash, makecol(255, 165, 0));     // Orange for clash box
+    }
 }
 
 // Draw round indicators (circles for wins)
-static void draw_round_indicators(BITMAP* dest)
+static void draw_round_indicators(BITMAP* dest, const RenderState* rs)
 {
     // P1 rounds (left side)
     int p1_x = 100;
@@ -1223,13 +2034,13 @@ static void draw_round_indicators(BITMAP* dest)
     for (int i = 0; i < 3; i++)
     {
         int x = p1_x + i * 25;
-        if (i < p1_rounds_won)
+        if (i < rs->p1_rounds_won)
         {
-            circlefill(dest, x, y, 8, makecol(255, 200, 100)); // Won rounds (filled)
+            circlefill(dest, RES(x), RES(y), RES(8), makecol(255, 200, 100)); // Won rounds (filled)
         }
         else
         {
-            circle(dest, x, y, 8, makecol(150, 150, 150)); // Unwon rounds (outline)
+            circle(dest, RES(x), RES(y), RES(8), makecol(150, 150, 150)); // Unwon rounds (outline)
         }
     }
     
@@ -1238,20 +2049,20 @@ static void draw_round_indicators(BITMAP* dest)
     for (int i = 0; i < 3; i++)
     {
         int x = p2_x - i * 25;
-        if (i < p2_rounds_won)
+        if (i < rs->p2_rounds_won)
         {
-            circlefill(dest, x, y, 8, makecol(100, 200, 255)); // Won rounds (filled)
+            circlefill(dest, RES(x), RES(y), RES(8), makecol(100, 200, 255)); // Won rounds (filled)
         }
         else
         {
-            circle(dest, x, y, 8, makecol(150, 150, 150)); // Unwon rounds (outline)
+            circle(dest, RES(x), RES(y), RES(8), makecol(150, 150, 150)); // Unwon rounds (outline)
         }
     }
     
     // Current round text
     char round_text[32];
-    sprintf(round_text, "ROUND %d", current_round);
-    textout_centre_ex(dest, font, round_text, 320, 55, makecol(255, 255, 255), -1);
+    sprintf(round_text, "ROUND %d", rs->current_round);
+    res_textout_centre(dest, font, round_text, 320, 55, makecol(255, 255, 255), -1);
 }
 
 // Draw character selection box
@@ -1262,31 +2073,32 @@ static void draw_character_box(BITMAP* dest, int char_id, int x, int y, bool sel
                         char_colors[char_id][2]);
     
     // Draw character preview
-    rectfill(dest, x, y, x + 80, y + 100, color);
+    rectfill(dest, RES(x), RES(y), RES(x + 80), RES(y + 100), color);
     
     // Draw character body in box
-    rectfill(dest, x + 25, y + 40, x + 55, y + 80, color);
-    circlefill(dest, x + 40, y + 30, 8, color);
+    rectfill(dest, RES(x + 25), RES(y + 40), RES(x + 55), RES(y + 80), color);
+    circlefill(dest, RES(x + 40), RES(y + 30), RES(8), color);
     
     // Draw selection border
     if (selected)
     {
-        rect(dest, x - 2, y - 2, x + 82, y + 102, makecol(255, 255, 255));
-        rect(dest, x - 3, y - 3, x + 83, y + 103, makecol(255, 255, 255));
+        rect(dest, RES(x - 2), RES(y - 2), RES(x + 82), RES(y + 102), makecol(255, 255, 255));
+        rect(dest, RES(x - 3), RES(y - 3), RES(x + 83), RES(y + 103), makecol(255, 255, 255));
     }
     
     // Draw ready indicator
     if (ready)
     {
-        textout_centre_ex(dest, font, "READY!", x + 40, y + 85, makecol(255, 255, 255), -1);
+        res_textout_centre(dest, font, "READY!", x + 40, y + 85, makecol(255, 255, 255), -1);
     }
     
     // Draw character name
     const char* names[] = {"FIRE", "WATER", "EARTH", "WIND"};
-    textout_centre_ex(dest, font, names[char_id], x + 40, y - 12, makecol(255, 255, 255), -1);
+    res_textout_centre(dest, font, names[char_id], x + 40, y - 12, makecol(255, 255, 255), -1);
 }
 
-// Load backgrounds from backgrounds/ directory
+// Find the backgrounds in the backgrounds/ directory. Only config.ini is
+// read here; the images go through the stage cache (hamoopi_stages.h).
 static void load_backgrounds()
 {
     if (backgrounds_initialized) return;
@@ -1316,10 +2128,9 @@ static void load_backgrounds()
         bg->map_pos_x = get_config_int("DATA", "MapPosX", 0);
         bg->map_pos_y = get_config_int("DATA", "MapPosY", 0);
         
-        // Load background image
-        bg->image = load_bitmap(image_path, NULL);
-        if (bg->image)
+        if (exists(image_path))
         {
+            snprintf(bg->image_path, sizeof(bg->image_path), "%s", image_path);
             bg->loaded = true;
             snprintf(bg->name, sizeof(bg->name), "Background%d", i);
             background_count++;
@@ -1336,21 +2147,53 @@ static void load_backgrounds()
 // Free all loaded backgrounds
 static void free_backgrounds()
 {
+    hamoopi_stage_release(stage_image);
+    stage_image = NULL;
+    stage_image_theme = -1;
+    hamoopi_stages_clear();
+    
     for (int i = 0; i < background_count; i++)
-    {
-        if (backgrounds[i].loaded && backgrounds[i].image)
-        {
-            destroy_bitmap(backgrounds[i].image);
-            backgrounds[i].image = NULL;
-            backgrounds[i].loaded = false;
-        }
-    }
+        backgrounds[i].loaded = false;
     background_count = 0;
     backgrounds_initialized = false;
 }
 
+// Image file of a stage, NULL when it is drawn procedurally
+static const char* stage_image_path(int stage_theme)
+{
+    if (core_options.bg_detail == HAMOOPI_BG_PROCEDURAL || !backgrounds_initialized ||
+        stage_theme < 0 || stage_theme >= background_count || !backgrounds[stage_theme].loaded)
+        return NULL;
+    return backgrounds[stage_theme].image_path;
+}
+
+// Start decoding a stage before the match that needs it
+static void prefetch_stage(int stage_theme)
+{
+    const char* path = stage_image_path(stage_theme);
+    if (path)
+        hamoopi_stage_prefetch(path);
+}
+
+// The image of a stage, loaded the first time it is drawn; the stage it
+// replaces stays in the cache for the next match
+static BITMAP* stage_bitmap(int stage_theme)
+{
+    const char* path = stage_image_path(stage_theme);
+    if (!path)
+        return NULL;
+    if (stage_theme != stage_image_theme)
+    {
+        BITMAP* previous = stage_image;
+        stage_image = hamoopi_stage_acquire(path);
+        hamoopi_stage_release(previous);
+        stage_image_theme = stage_theme;
+    }
+    return stage_image;
+}
+
 // INI Character Configuration Loading System
-static void load_char_ini(int char_id, const char* char_name)
+static void load_char_ini(CharacterConfig* config, const char* char_name)
 {
     char filepath[256];
     snprintf(filepath, sizeof(filepath), "data/chars/%s/char.ini", char_name);
@@ -1362,7 +2205,6 @@ static void load_char_ini(int char_id, const char* char_name)
         return;
     }
     
-    CharacterConfig* config = &character_configs[char_id];
     config->animation_count = 0;
     
     // Parse char.ini file manually (simple INI parser)
@@ -1403,6 +2245,10 @@ static void load_char_ini(int char_id, const char* char_name)
             char key[64], value[64];
             if (sscanf(start, "%[^=]=%s", key, value) == 2)
             {
+                // Trim the spaces around "key = value"
+                for (int i = (int)strlen(key) - 1; i >= 0 && (key[i] == ' ' || key[i] == '\t'); i--)
+                    key[i] = '\0';
+                
                 if (strcmp(key, "XAlign") == 0)
                     current_anim->xalign = atoi(value);
                 else if (strcmp(key, "YAlign") == 0)
@@ -1413,9 +2259,10 @@ static void load_char_ini(int char_id, const char* char_name)
                     current_anim->vspeed = atof(value);
                 else if (strcmp(key, "Gravity") == 0)
                     current_anim->gravity = atof(value);
-                else if (strncmp(key, "FrameTime_", 10) == 0)
+                else if (strncmp(key, "FrameTime_", 10) == 0 || strncmp(key, "V1_FrameTime_", 13) == 0)
                 {
-                    int frame_num = atoi(key + 10);
+                    // Specials time each strength apart; the core uses V1's
+                    int frame_num = atoi(strrchr(key, '_') + 1);
                     if (frame_num < MAX_ANIM_FRAMES)
                     {
                         current_anim->frame_times[frame_num] = atoi(value);
@@ -1432,7 +2279,7 @@ static void load_char_ini(int char_id, const char* char_name)
     fprintf(stderr, "Loaded char.ini for %s: %d animations\n", char_name, config->animation_count);
 }
 
-static void load_chbox_ini(int char_id, const char* char_name)
+static void load_chbox_ini(CharacterConfig* config, const char* char_name)
 {
     char filepath[256];
     snprintf(filepath, sizeof(filepath), "data/chars/%s/chbox.ini", char_name);
@@ -1444,7 +2291,6 @@ static void load_chbox_ini(int char_id, const char* char_name)
         return;
     }
     
-    CharacterConfig* config = &character_configs[char_id];
     config->collision_box_count = 0;
     
     char line[256];
@@ -1498,6 +2344,40 @@ static void load_chbox_ini(int char_id, const char* char_name)
                     current_box_config->hitboxes[current_box_config->hitbox_count++] = box;
                 }
             }
+            else if (sscanf(start, "%[^=]=%d", key, &x1) == 2)
+            {
+                // One corner coordinate per key, as the HAMOOPI editor
+                // writes them: HurtBox01x1, HurtBox01y1, HurtBox01x2, ...
+                bool hit = strncmp(key, "HitBox", 6) == 0;
+                if (!hit && strncmp(key, "HurtBox", 7) != 0)
+                    continue;
+                int n, corner;
+                char axis;
+                if (sscanf(key + (hit ? 6 : 7), "%2d%c%d", &n, &axis, &corner) != 3 ||
+                    n < 1 || n > MAX_COLLISION_BOXES || (axis != 'x' && axis != 'y') || (corner != 1 && corner != 2))
+                    continue;
+                
+                CollisionBox* boxes = hit ? current_box_config->hitboxes : current_box_config->hurtboxes;
+                int* count = hit ? &current_box_config->hitbox_count : &current_box_config->hurtbox_count;
+                for (; *count < n; (*count)++)
+                    memset(&boxes[*count], 0, sizeof(CollisionBox));
+                
+                // Moving one corner keeps the other where it is, whatever
+                // order the keys come in
+                CollisionBox* box = &boxes[n - 1];
+                hamoopi_sim_t* pos = axis == 'x' ? &box->x : &box->y;
+                hamoopi_sim_t* size = axis == 'x' ? &box->w : &box->h;
+                if (corner == 1)
+                {
+                    hamoopi_sim_t end = *pos + *size;
+                    *pos = x1;
+                    *size = end - *pos;
+                }
+                else
+                {
+                    *size = (hamoopi_sim_t)x1 - *pos;
+                }
+            }
         }
     }
     
@@ -1505,7 +2385,7 @@ static void load_chbox_ini(int char_id, const char* char_name)
     fprintf(stderr, "Loaded chbox.ini for %s: %d box configs\n", char_name, config->collision_box_count);
 }
 
-static void load_special_ini(int char_id, const char* char_name)
+static void load_special_ini(CharacterConfig* config, const char* char_name)
 {
     char filepath[256];
     snprintf(filepath, sizeof(filepath), "data/chars/%s/special.ini", char_name);
@@ -1517,11 +2397,12 @@ static void load_special_ini(int char_id, const char* char_name)
         return;
     }
     
-    CharacterConfig* config = &character_configs[char_id];
     config->special_move_count = 0;
     
     char line[256];
     SpecialMoveConfig* current_special = NULL;
+    int section_kind = 0;  // 0=special, 1=projectile [x01], 2=frame [x00_NN]
+    int section_frame = 0;
     
     while (pack_fgets(line, sizeof(line), fp))
     {
@@ -1529,47 +2410,105 @@ static void load_special_ini(int char_id, const char* char_name)
         while (*start == ' ' || *start == '\t') start++;
         if (*start == '\0' || *start == '\n' || *start == ';' || *start == '#') continue;
         
-        // Check for section header [NNN]
+        // Section header [NNN] or [NNN_FF]
         if (*start == '[')
         {
-            int special_id;
-            if (sscanf(start, "[%d]", &special_id) == 1)
+            int section_id, frame;
+            int fields = sscanf(start, "[%d_%d]", &section_id, &frame);
+            current_special = NULL;
+            if (fields < 1)
+                continue;
+            
+            int special_id = section_id - section_id % 10;
+            if (fields == 1 && section_id == special_id)
             {
-                if (config->special_move_count < 10)
+                if (config->special_move_count < MAX_SPECIAL_MOVES)
                 {
                     current_special = &config->special_moves[config->special_move_count++];
-                    current_special->command_count = 0;
-                    current_special->damage = 0;
-                    current_special->type = 0;
+                    memset(current_special, 0, sizeof(*current_special));
+                    current_special->state_id = special_id;
                     strcpy(current_special->name, "Special");
+                    section_kind = 0;
+                }
+                continue;
+            }
+            
+            // Projectile and per-frame sections belong to the special they follow
+            for (int i = 0; i < config->special_move_count; i++)
+            {
+                if (config->special_moves[i].state_id != special_id)
+                    continue;
+                if (fields == 2 && section_id == special_id && frame >= 0 && frame < MAX_ANIM_FRAMES)
+                {
+                    current_special = &config->special_moves[i];
+                    section_kind = 2;
+                    section_frame = frame;
+                }
+                else if (fields == 1 && section_id == special_id + 1)
+                {
+                    current_special = &config->special_moves[i];
+                    section_kind = 1;
                 }
             }
         }
         else if (current_special)
         {
             char key[64], value[128];
-            if (sscanf(start, "%[^=]=%[^\n]", key, value) == 2)
+            if (sscanf(start, "%[^=]=%[^\n]", key, value) != 2)
+                continue;
+            
+            // Trim the spaces around "key = value"
+            for (int i = (int)strlen(key) - 1; i >= 0 && (key[i] == ' ' || key[i] == '\t'); i--)
+                key[i] = '\0';
+            
+            if (section_kind == 1)
+            {
+                if (strcmp(key, "LocalPosX") == 0) current_special->fireball_x = atoi(value);
+                else if (strcmp(key, "LocalPosY") == 0) current_special->fireball_y = atoi(value);
+                else if (strcmp(key, "HSpeed") == 0) current_special->fireball_speed = atof(value);
+            }
+            else if (section_kind == 2)
             {
-                if (strcmp(key, "name") == 0)
+                if (strcmp(key, "HSpeed") == 0)
                 {
-                    strncpy(current_special->name, value, sizeof(current_special->name) - 1);
+                    current_special->frame_hspeed[section_frame] = atof(value);
+                    current_special->frame_flags[section_frame] |= SPECIAL_FRAME_HSPEED;
                 }
-                else if (strncmp(key, "c", 1) == 0 && strlen(key) > 1)
+                else if (strcmp(key, "VSpeed") == 0)
                 {
-                    // Command sequence (c1, c2, c3, ...)
-                    int cmd_num = atoi(key + 1);
-                    if (cmd_num > 0 && cmd_num <= 10)
-                    {
-                        current_special->command_sequence[cmd_num - 1] = atoi(value);
-                        if (cmd_num > current_special->command_count)
-                            current_special->command_count = cmd_num;
-                    }
+                    current_special->frame_vspeed[section_frame] = atof(value);
+                    current_special->frame_flags[section_frame] |= SPECIAL_FRAME_VSPEED;
                 }
-                else if (strcmp(key, "V1_Damage") == 0 || strcmp(key, "V2_Damage") == 0 || strcmp(key, "V3_Damage") == 0)
+            }
+            else if (strcmp(key, "name") == 0)
+            {
+                strncpy(current_special->name, value, sizeof(current_special->name) - 1);
+            }
+            else if (strcmp(key, "ThrowFireball") == 0)
+            {
+                int frame = atoi(value);
+                current_special->throw_fireball = true;
+                current_special->throw_frame = (frame >= 0 && frame < MAX_ANIM_FRAMES) ? frame : 0;
+                current_special->type = 0;
+            }
+            else if (strncmp(key, "c", 1) == 0 && strlen(key) > 1)
+            {
+                // Command sequence (c1, c2, c3, ...)
+                int cmd_num = atoi(key + 1);
+                if (cmd_num > 0 && cmd_num <= MAX_SPECIAL_COMMANDS)
                 {
-                    current_special->damage = atoi(value);
+                    current_special->command_sequence[cmd_num - 1] = atoi(value);
+                    if (cmd_num > current_special->command_count)
+                        current_special->command_count = cmd_num;
                 }
             }
+            else if (strcmp(key, "V1_Damage") == 0)
+            {
+                // The core plays the light (V1) version of every special
+                current_special->damage = atoi(value);
+                if (!current_special->throw_fireball)
+                    current_special->type = 1;
+            }
         }
     }
     
@@ -1577,152 +2516,356 @@ static void load_special_ini(int char_id, const char* char_name)
     fprintf(stderr, "Loaded special.ini for %s: %d special moves\n", char_name, config->special_move_count);
 }
 
-static void load_character_config(int char_id)
+// Special move assembler
+static void special_emit(SpecialProgram* prog, int op, int a, int b, int c, hamoopi_sim_t imm)
 {
-    const char* char_names[] = {"CharTemplate", "CharTemplate", "CharTemplate", "CharTemplate"};
-    if (char_id < 0 || char_id >= 4) return;
-    
-    character_configs[char_id].loaded = false;
-    character_configs[char_id].animation_count = 0;
-    character_configs[char_id].collision_box_count = 0;
-    character_configs[char_id].special_move_count = 0;
-    
-    load_char_ini(char_id, char_names[char_id]);
-    load_chbox_ini(char_id, char_names[char_id]);
-    load_special_ini(char_id, char_names[char_id]);
+    if (prog->length >= SPECIAL_MAX_CODE)
+        return;
+    SpecialInstr* in = &prog->code[prog->length++];
+    in->op = (unsigned char)op;
+    in->a = (unsigned char)a;
+    in->b = (unsigned char)b;
+    in->c = (unsigned char)c;
+    in->imm = imm;
 }
 
-static void init_character_configs()
+// Skips the next instructions when the opponent is out of range or KO'd;
+// returns the indices of the two jumps so the caller can patch the target
+static void special_emit_range_check(SpecialProgram* prog, hamoopi_sim_t range, int jumps[2])
 {
-    for (int i = 0; i < 4; i++)
+    special_emit(prog, SOP_SELF, 0, SF_X, 0, 0.0f);
+    special_emit(prog, SOP_OPP, 1, SF_X, 0, 0.0f);
+    special_emit(prog, SOP_SUB, 0, 0, 1, 0.0f);
+    special_emit(prog, SOP_ABS, 0, 0, 0, 0.0f);
+    special_emit(prog, SOP_LOAD, 1, 0, 0, range);
+    jumps[0] = prog->length;
+    special_emit(prog, SOP_JGE, 0, 1, 0, 0.0f);        // dist >= range
+    special_emit(prog, SOP_OPP, 2, SF_HEALTH, 0, 0.0f);
+    jumps[1] = prog->length;
+    special_emit(prog, SOP_JZ, 2, 0, 0, 0.0f);         // opponent KO'd
+}
+
+static void special_patch(SpecialProgram* prog, const int* jumps, int count)
+{
+    for (int i = 0; i < count; i++)
+        prog->code[jumps[i]].c = (unsigned char)prog->length;
+}
+
+// Projectile spawned at (x + dx * facing, y + dy) moving at speed * facing
+static void special_emit_spawn(SpecialProgram* prog, hamoopi_sim_t dx, hamoopi_sim_t dy, hamoopi_sim_t speed, int damage)
+{
+    special_emit(prog, SOP_SELF, 4, SF_FACING, 0, 0.0f);
+    special_emit(prog, SOP_SELF, 0, SF_X, 0, 0.0f);
+    special_emit(prog, SOP_LOAD, 5, 0, 0, dx);
+    special_emit(prog, SOP_MUL, 5, 5, 4, 0.0f);
+    special_emit(prog, SOP_ADD, 0, 0, 5, 0.0f);
+    special_emit(prog, SOP_SELF, 1, SF_Y, 0, 0.0f);
+    if (dy != 0.0f)
+    {
+        special_emit(prog, SOP_LOAD, 5, 0, 0, dy);
+        special_emit(prog, SOP_ADD, 1, 1, 5, 0.0f);
+    }
+    special_emit(prog, SOP_LOAD, 2, 0, 0, speed);
+    special_emit(prog, SOP_MUL, 2, 2, 4, 0.0f);
+    special_emit(prog, SOP_LOAD, 3, 0, 0, 0.0f);
+    special_emit(prog, SOP_SPAWN, 0, 0, 0, (hamoopi_sim_t)damage);
+}
+
+// Built-in specials of the demo roster
+enum { SPECIAL_FIRE = 0, SPECIAL_WATER, SPECIAL_EARTH, SPECIAL_WIND };
+
+static void assemble_builtin_special(SpecialProgram* prog, int kind)
+{
+    int jumps[2];
+    prog->length = 0;
+    special_emit(prog, SOP_SOUND, SOUND_SPECIAL, 0, 0, 0.0f);
+    
+    switch (kind)
     {
-        load_character_config(i);
+        case SPECIAL_FIRE:  // Fireball projectile
+            special_emit_spawn(prog, 30.0f, 0.0f, 8.0f, FIRE_PROJECTILE_DAMAGE);
+            break;
+            
+        case SPECIAL_WATER:  // Healing wave
+            special_emit(prog, SOP_HEAL, 0, 0, 0, WATER_HEAL_AMOUNT);
+            break;
+            
+        case SPECIAL_EARTH:  // Ground stomp, only hits a grounded opponent
+        {
+            int airborne;
+            special_emit_range_check(prog, EARTH_STOMP_RANGE, jumps);
+            special_emit(prog, SOP_OPP, 2, SF_ON_GROUND, 0, 0.0f);
+            airborne = prog->length;
+            special_emit(prog, SOP_JZ, 2, 0, 0, 0.0f);
+            special_emit(prog, SOP_HIT, 0, 0, 0, EARTH_STOMP_DAMAGE);
+            special_patch(prog, jumps, 2);
+            special_patch(prog, &airborne, 1);
+            break;
+        }
+            
+        case SPECIAL_WIND:  // Dash attack
+            special_emit(prog, SOP_DASH, 0, 0, 0, WIND_DASH_DURATION);
+            special_emit_range_check(prog, WIND_DASH_HIT_RANGE, jumps);
+            special_emit(prog, SOP_HIT, 0, 0, 0, WIND_DASH_DAMAGE);
+            special_patch(prog, jumps, 2);
+            break;
     }
+    special_emit(prog, SOP_END, 0, 0, 0, 0.0f);
 }
 
-// Draw stage background based on characters
-static void draw_stage_background(BITMAP* dest, int p1_char, int p2_char)
+// Compile one special of special.ini: melee damage (V1_Damage, on the
+// 0-1000 energy scale), a projectile ([x01]) released on the
+// ThrowFireball frame and per-frame velocity changes ([x00_NN]), timed
+// with the V1_FrameTime_NN values of char.ini.
+static void compile_special_program(const CharacterConfig* config, int move, SpecialProgram* prog)
 {
-    // Determine stage theme based on P1's character (simpler than blending two themes)
-    int stage_theme = p1_char;
+    prog->length = 0;
+    if (move < 0 || move >= config->special_move_count || config->special_moves[move].command_count == 0)
+        return;
     
-    // Animated background frame (only increments when drawing stages)
-    stage_animation_frame++;
-    if (stage_animation_frame >= 360) stage_animation_frame = 0;
+    const SpecialMoveConfig* sp = &config->special_moves[move];
+    const AnimationConfig* anim = NULL;
+    for (int i = 0; i < config->animation_count; i++)
+        if (config->animations[i].state_id == sp->state_id)
+            anim = &config->animations[i];
     
-    // Check if we have a loaded background for this stage
-    if (backgrounds_initialized && stage_theme < background_count && backgrounds[stage_theme].loaded)
+    special_emit(prog, SOP_SOUND, SOUND_SPECIAL, 0, 0, 0.0f);
+    
+    if (!sp->throw_fireball && sp->damage > 0)
     {
-        // Use dynamic background from config.ini
-        Background* bg = &backgrounds[stage_theme];
-        
-        // Draw background image at configured position
-        // Apply scrolling animation based on MapPos values
-        int draw_x = bg->map_pos_x + (stage_animation_frame / 10);
-        int draw_y = bg->map_pos_y;
-        
-        // Draw the background image (may be larger than screen)
-        blit(bg->image, dest, 0, 0, draw_x, draw_y, 640, 480);
-        
-        // Draw ground line
-        hline(dest, 0, 400, 640, makecol(100, 70, 30));
-        return;
+        int jumps[2];
+        int damage = (sp->damage + 5) / 10;
+        special_emit_range_check(prog, SPECIAL_MELEE_RANGE, jumps);
+        special_emit(prog, SOP_HIT, 0, 0, 0, damage > 0 ? damage : 1);
+        special_patch(prog, jumps, 2);
     }
     
-    // Fallback to procedural backgrounds if no custom background loaded
-    // Animation constants
-    const int CLOUD_SPACING = 120;
-    const int CLOUD_WRAP = 1280;
-    const int CLOUD_SCREEN_WIDTH = 800;
-    const int CLOUD_OFFSET = 100;
-    
-    // Sky/background layer
-    switch (stage_theme)
+    int tick = 0;        // Frames elapsed at the current point of the program
+    int frame_start = 0; // First frame of animation frame f
+    for (int f = 0; f < MAX_ANIM_FRAMES; f++)
     {
-        case 0: // FIRE stage - Volcano/Lava
+        bool throw_now = sp->throw_fireball && f == sp->throw_frame;
+        if (sp->frame_flags[f] || throw_now)
+        {
+            if (frame_start > tick)
+                special_emit(prog, SOP_WAIT, 0, 0, 0, (hamoopi_sim_t)(frame_start - tick));
+            tick = frame_start;
+            if (throw_now)
+            {
+                int damage = sp->damage > 0 ? (sp->damage + 5) / 10 : FIRE_PROJECTILE_DAMAGE;
+                special_emit_spawn(prog, (hamoopi_sim_t)sp->fireball_x, (hamoopi_sim_t)sp->fireball_y,
+                                   sp->fireball_speed != 0.0f ? sp->fireball_speed : 8.0f, damage);
+            }
+            if (sp->frame_flags[f] & SPECIAL_FRAME_HSPEED)
+                special_emit(prog, SOP_SETVX, 0, 0, 0, sp->frame_hspeed[f]);
+            if (sp->frame_flags[f] & SPECIAL_FRAME_VSPEED)
+                special_emit(prog, SOP_SETVY, 0, 0, 0, sp->frame_vspeed[f]);
+        }
+        int frame_time = (anim && f < anim->frame_count && anim->frame_times[f] > 0) ? anim->frame_times[f] : 5;
+        frame_start += frame_time;
+    }
+    special_emit(prog, SOP_END, 0, 0, 0, 0.0f);
+}
+
+// Asset cache kind for a character folder's parsed INI files
+#define ASSET_KIND_CHARACTER_CONFIG 1
+
+static void* decode_character_config(void* ctx)
+{
+    const char* char_name = (const char*)ctx;
+    CharacterConfig* config = new (std::nothrow) CharacterConfig();
+    if (!config)
+        return NULL;
+    
+    load_char_ini(config, char_name);
+    load_chbox_ini(config, char_name);
+    load_special_ini(config, char_name);
+    return config;
+}
+
+static void free_character_config(void* data)
+{
+    delete (CharacterConfig*)data;
+}
+
+static void load_character_config(int char_id)
+{
+    const char* char_names[] = {"CharTemplate", "CharTemplate", "CharTemplate", "CharTemplate"};
+    // Built-in special of each slot, run by the special button
+    const int char_specials[] = {SPECIAL_FIRE, SPECIAL_WATER, SPECIAL_EARTH, SPECIAL_WIND};
+    const char* ini_files[] = {"char.ini", "chbox.ini", "special.ini"};
+    if (char_id < 0 || char_id >= 4) return;
+    
+    hamoopi_asset_release(character_configs[char_id]);
+    character_configs[char_id] = NULL;
+    special_programs[char_id].length = 0;
+    for (int i = 0; i < MAX_SPECIAL_MOVES; i++)
+        command_programs[char_id][i].length = 0;
+    
+    // Keyed by the three INI files together
+    char path[256];
+    uint64_t hash = HAMOOPI_ASSET_HASH_SEED;
+    for (int i = 0; i < 3; i++)
+    {
+        snprintf(path, sizeof(path), "data/chars/%s/%s", char_names[char_id], ini_files[i]);
+        hamoopi_asset_hash_file(path, &hash);
+    }
+    snprintf(path, sizeof(path), "data/chars/%s", char_names[char_id]);
+    const CharacterConfig* config = (const CharacterConfig*)hamoopi_asset_acquire(
+        path, hash, ASSET_KIND_CHARACTER_CONFIG,
+        decode_character_config, free_character_config, (void*)char_names[char_id]);
+    character_configs[char_id] = config;
+    
+    assemble_builtin_special(&special_programs[char_id], char_specials[char_id]);
+    if (config)
+        for (int i = 0; i < config->special_move_count; i++)
+            compile_special_program(config, i, &command_programs[char_id][i]);
+}
+
+static void init_character_configs()
+{
+    for (int i = 0; i < 4; i++)
+    {
+        load_character_config(i);
+    }
+}
+
+static void free_character_configs()
+{
+    for (int i = 0; i < 4; i++)
+    {
+        hamoopi_asset_release(character_configs[i]);
+        character_configs[i] = NULL;
+        special_programs[i].length = 0;
+        for (int m = 0; m < MAX_SPECIAL_MOVES; m++)
+            command_programs[i][m].length = 0;
+    }
+}
+
+// Render one stage at a given animation frame
+static void render_stage_background(BITMAP* dest, int stage_theme, int anim_frame)
+{
+    // Check if we have a background image for this stage
+    BITMAP* image = stage_bitmap(stage_theme);
+    if (image)
+    {
+        // Use dynamic background from config.ini
+        Background* bg = &backgrounds[stage_theme];
+        
+        // Draw background image at configured position
+        // Apply scrolling animation based on MapPos values
+        int draw_x = bg->map_pos_x + (anim_frame / 10);
+        int draw_y = bg->map_pos_y;
+        
+        // Draw the background image (may be larger than screen)
+        if (render_shift)
+        {
+            int w = image->w < 640 ? image->w : 640;
+            int h = image->h < 480 ? image->h : 480;
+            stretch_blit(image, dest, 0, 0, w, h, RES(draw_x), RES(draw_y), RES(w), RES(h));
+        }
+        else
+            blit(image, dest, 0, 0, draw_x, draw_y, 640, 480);
+        
+        // Draw ground line
+        hline(dest, 0, RES(400), RES(640), makecol(100, 70, 30));
+        return;
+    }
+    
+    // Fallback to procedural backgrounds if no custom background loaded
+    // Animation constants
+    const int CLOUD_SPACING = 120;
+    const int CLOUD_WRAP = 1280;
+    const int CLOUD_SCREEN_WIDTH = 800;
+    const int CLOUD_OFFSET = 100;
+    
+    // Sky/background layer
+    switch (stage_theme)
+    {
+        case 0: // FIRE stage - Volcano/Lava
             {
                 // Red-orange gradient sky
-                for (int y = 0; y < 300; y++)
+                for (int y = 0; y < 300; y += RES_STEP)
                 {
                     int r = 180 + (y * 75 / 300);
                     int g = 50 + (y * 30 / 300);
                     int b = 20;
-                    hline(dest, 0, y, 640, makecol(r, g, b));
+                    hline(dest, 0, RES(y), RES(640), makecol(r, g, b));
                 }
                 
                 // Distant mountains (dark)
                 // Pre-calculate sine values for better performance
                 for (int x = 0; x < 640; x += 4)
                 {
-                    int height = 250 + (int)(20 * sin((x + stage_animation_frame) * 0.02f));
+                    int height = 250 + (int)(20 * sin((x + anim_frame) * 0.02f));
                     // Fill 4 pixels at once for performance
-                    for (int px = x; px < x + 4 && px < 640; px++)
+                    for (int px = x; px < x + 4 && px < 640; px += RES_STEP)
                     {
-                        vline(dest, px, height, 300, makecol(60, 20, 10));
+                        vline(dest, RES(px), RES(height), RES(300), makecol(60, 20, 10));
                     }
                 }
                 
                 // Lava glow effect (animated)
-                int glow = 200 + (int)(30 * sin(stage_animation_frame * 0.1f));
+                int glow = 200 + (int)(30 * sin(anim_frame * 0.1f));
                 int glow_dim = (glow > 20) ? glow - 20 : 0; // Clamp to prevent negative values
-                hline(dest, 0, 395, 640, makecol(glow, 100, 30));
-                hline(dest, 0, 396, 640, makecol(glow_dim, 80, 20));
+                hline(dest, 0, RES(395), RES(640), makecol(glow, 100, 30));
+                hline(dest, 0, RES(396), RES(640), makecol(glow_dim, 80, 20));
             }
             break;
             
         case 1: // WATER stage - Ocean/Beach
             {
                 // Blue gradient sky
-                for (int y = 0; y < 300; y++)
+                for (int y = 0; y < 300; y += RES_STEP)
                 {
                     int r = 100 + (y * 55 / 300);
                     int g = 150 + (y * 55 / 300);
                     int b = 220 - (y * 20 / 300);
-                    hline(dest, 0, y, 640, makecol(r, g, b));
+                    hline(dest, 0, RES(y), RES(640), makecol(r, g, b));
                 }
                 
                 // Ocean waves (animated)
-                for (int x = 0; x < 640; x++)
+                for (int x = 0; x < 640; x += RES_STEP)
                 {
-                    int wave1 = 200 + (int)(15 * sin((x + stage_animation_frame) * 0.03f));
-                    int wave2 = 240 + (int)(10 * sin((x + stage_animation_frame * 1.5f) * 0.04f));
+                    int wave1 = 200 + (int)(15 * sin((x + anim_frame) * 0.03f));
+                    int wave2 = 240 + (int)(10 * sin((x + anim_frame * 1.5f) * 0.04f));
                     
-                    vline(dest, x, wave1, wave2, makecol(60, 100, 180));
-                    vline(dest, x, wave2, 300, makecol(40, 80, 150));
+                    vline(dest, RES(x), RES(wave1), RES(wave2), makecol(60, 100, 180));
+                    vline(dest, RES(x), RES(wave2), RES(300), makecol(40, 80, 150));
                 }
                 
                 // Beach/sand
-                rectfill(dest, 0, 300, 640, 400, makecol(220, 200, 140));
+                rectfill(dest, 0, RES(300), RES(640), RES(400), makecol(220, 200, 140));
             }
             break;
             
         case 2: // EARTH stage - Forest
             {
                 // Green-blue sky
-                for (int y = 0; y < 300; y++)
+                for (int y = 0; y < 300; y += RES_STEP)
                 {
                     int r = 120 - (y * 20 / 300);
                     int g = 180 - (y * 30 / 300);
                     int b = 140 - (y * 40 / 300);
-                    hline(dest, 0, y, 640, makecol(r, g, b));
+                    hline(dest, 0, RES(y), RES(640), makecol(r, g, b));
                 }
                 
                 // Distant trees (dark green)
                 for (int i = 0; i < 20; i++)
                 {
-                    int x = i * 35 + ((stage_animation_frame / 2) % 35);
+                    int x = i * 35 + ((anim_frame / 2) % 35);
                     int y = 220 + (i % 3) * 10;
-                    triangle(dest, x, y, x - 15, y + 60, x + 15, y + 60, makecol(30, 80, 30));
+                    triangle(dest, RES(x), RES(y), RES(x - 15), RES(y + 60), RES(x + 15), RES(y + 60), makecol(30, 80, 30));
                 }
                 
                 // Grass ground
-                rectfill(dest, 0, 300, 640, 400, makecol(80, 140, 60));
+                rectfill(dest, 0, RES(300), RES(640), RES(400), makecol(80, 140, 60));
                 
                 // Grass blades (simple details)
                 for (int i = 0; i < 40; i++)
                 {
-                    int x = (i * 16 + stage_animation_frame) % 640;
-                    vline(dest, x, 380, 385, makecol(100, 160, 80));
+                    int x = (i * 16 + anim_frame) % 640;
+                    vline(dest, RES(x), RES(380), RES(385), makecol(100, 160, 80));
                 }
             }
             break;
@@ -1730,205 +2873,177 @@ static void draw_stage_background(BITMAP* dest, int p1_char, int p2_char)
         case 3: // WIND stage - Sky/Clouds
             {
                 // Light blue sky gradient
-                for (int y = 0; y < 300; y++)
+                for (int y = 0; y < 300; y += RES_STEP)
                 {
                     int r = 150 + (y * 55 / 300);
                     int g = 200 + (y * 35 / 300);
                     int b = 255 - (y * 25 / 300);
-                    hline(dest, 0, y, 640, makecol(r, g, b));
+                    hline(dest, 0, RES(y), RES(640), makecol(r, g, b));
                 }
                 
                 // Floating clouds (animated)
                 for (int i = 0; i < 6; i++)
                 {
-                    int x = ((i * CLOUD_SPACING) - stage_animation_frame + CLOUD_WRAP) % CLOUD_SCREEN_WIDTH - CLOUD_OFFSET;
+                    int x = ((i * CLOUD_SPACING) - anim_frame + CLOUD_WRAP) % CLOUD_SCREEN_WIDTH - CLOUD_OFFSET;
                     int y = 80 + i * 30;
                     
                     // Cloud puffs
-                    circlefill(dest, x, y, 25, makecol(255, 255, 255));
-                    circlefill(dest, x + 20, y, 20, makecol(255, 255, 255));
-                    circlefill(dest, x + 40, y, 25, makecol(255, 255, 255));
-                    circlefill(dest, x - 20, y, 20, makecol(255, 255, 255));
+                    circlefill(dest, RES(x), RES(y), RES(25), makecol(255, 255, 255));
+                    circlefill(dest, RES(x + 20), RES(y), RES(20), makecol(255, 255, 255));
+                    circlefill(dest, RES(x + 40), RES(y), RES(25), makecol(255, 255, 255));
+                    circlefill(dest, RES(x - 20), RES(y), RES(20), makecol(255, 255, 255));
                 }
                 
                 // Distant platforms/mountains
                 for (int i = 0; i < 8; i++)
                 {
-                    int x = i * 90 + ((stage_animation_frame / 3) % 90);
+                    int x = i * 90 + ((anim_frame / 3) % 90);
                     int y = 260 + (i % 2) * 20;
-                    rectfill(dest, x - 40, y, x + 40, y + 10, makecol(180, 180, 200));
+                    rectfill(dest, RES(x - 40), RES(y), RES(x + 40), RES(y + 10), makecol(180, 180, 200));
                 }
                 
                 // Ground platform
-                rectfill(dest, 0, 300, 640, 310, makecol(200, 200, 220));
+                rectfill(dest, 0, RES(300), RES(640), RES(310), makecol(200, 200, 220));
             }
             break;
     }
     
     // Draw ground line (common for all stages)
-    hline(dest, 0, 400, 640, makecol(80, 80, 80));
+    hline(dest, 0, RES(400), RES(640), makecol(80, 80, 80));
 }
 
-void hamoopi_init(void)
+// Static background detail: the stage is rendered once into this cache
+static BITMAP* stage_cache = NULL;
+static int stage_cache_theme = -1;
+
+static void advance_stage_animation()
 {
-    if (initialized)
-        return;
-    
-    // Create screen buffer for rendering
-    screen_buffer = create_bitmap(640, 480);
-    game_buffer = create_bitmap(640, 480);
+    stage_animation_frame++;
+    if (stage_animation_frame >= 360) stage_animation_frame = 0;
+}
+
+// Draw stage background based on characters
+static void draw_stage_background(BITMAP* dest, const RenderState* rs)
+{
+    // Determine stage theme based on P1's character (simpler than blending two themes)
+    int stage_theme = rs->players[0].character_id;
     
-    if (!screen_buffer || !game_buffer)
+    if (core_options.bg_detail == HAMOOPI_BG_STATIC)
     {
-        fprintf(stderr, "Failed to create screen buffers\n");
-        return;
+        if (!stage_cache)
+            stage_cache = create_bitmap(dest->w, dest->h);
+        if (stage_cache)
+        {
+            if (stage_cache_theme != stage_theme)
+            {
+                clear_to_color(stage_cache, makecol(20, 40, 80));
+                render_stage_background(stage_cache, stage_theme, 0);
+                stage_cache_theme = stage_theme;
+            }
+            blit(stage_cache, dest, 0, 0, 0, 0, dest->w, dest->h);
+            return;
+        }
     }
     
-    clear_to_color(screen_buffer, makecol(0, 0, 0));
-    clear_to_color(game_buffer, makecol(0, 0, 0));
-    
-    // Override the global Allegro 'screen' variable
-    screen = screen_buffer;
-    
-    // Initialize keyboard state
-    install_keyboard();
-    
-    // Initialize game font
-    game_font = font;
-    
-    // Initialize sprite system
-    init_sprite_system();
-    
-    // Load backgrounds from config files
-    load_backgrounds();
-    
-    // Load character configurations from INI files
-    init_character_configs();
-    
-    // Initialize players with default characters
-    init_player(&players[0], 0);
-    players[0].character_id = 0;
-    init_player(&players[1], 1);
-    players[1].character_id = 1;
-    
-    game_mode = 0; // Start at title screen
-    frame_count = 0;
-    
-    // Reset character selection state
-    p1_cursor = 0;
-    p2_cursor = 1;
-    p1_ready = false;
-    p2_ready = false;
-    
-    // Initialize projectiles
-    for (int i = 0; i < MAX_PROJECTILES; i++)
+    render_stage_background(dest, stage_theme, rs->stage_animation_frame);
+}
+
+static void free_stage_cache()
+{
+    if (stage_cache)
     {
-        projectiles[i].active = false;
+        destroy_bitmap(stage_cache);
+        stage_cache = NULL;
     }
-    
-    initialized = true;
-    running = false;
+    stage_cache_theme = -1;
 }
 
-void hamoopi_deinit(void)
+// Average core time per frame, against the 16.7 ms budget of a 60 Hz frame
+static void draw_perf_overlay(BITMAP* dest)
 {
-    if (!initialized)
-        return;
-    
-    // Cleanup backgrounds
-    free_backgrounds();
-    
-    // Cleanup sprite system
-    cleanup_sprite_system();
-    
-    if (game_buffer)
+    int64_t total = 0;
+    int count = 0;
+    for (int i = 0; i < PERF_HISTORY; i++)
     {
-        destroy_bitmap(game_buffer);
-        game_buffer = NULL;
+        if (perf_usec[i] > 0)
+        {
+            total += perf_usec[i];
+            count++;
+        }
     }
     
-    if (screen_buffer)
+    char text[64];
+    if (count > 0)
     {
-        destroy_bitmap(screen_buffer);
-        screen_buffer = NULL;
+        int avg = (int)(total / count);
+        snprintf(text, sizeof(text), "CORE %d.%02d ms (%d%%)", avg / 1000, (avg % 1000) / 10, avg * 100 / 16667);
+    }
+    else
+    {
+        snprintf(text, sizeof(text), "CORE -- ms");
     }
     
-    screen = NULL;
-    initialized = false;
-    running = false;
+    rectfill(dest, 0, 0, text_length(game_font, text) + 4, text_height(game_font) + 3, makecol(0, 0, 0));
+    textout_ex(dest, game_font, text, 2, 2, makecol(0, 255, 0), -1);
 }
 
-void hamoopi_reset(void)
+// Copy what the current game mode shows into a frame snapshot
+static void capture_render_state(RenderState* rs)
 {
-    // Reset game state
-    init_player(&players[0], 0);
-    players[0].character_id = 0;
-    init_player(&players[1], 1);
-    players[1].character_id = 1;
-    
-    game_mode = 0;
-    frame_count = 0;
-    
-    // Reset character selection state
-    p1_cursor = 0;
-    p2_cursor = 1;
-    p1_ready = false;
-    p2_ready = false;
-    
-    if (screen_buffer)
-        clear_to_color(screen_buffer, makecol(0, 0, 0));
-    if (game_buffer)
-        clear_to_color(game_buffer, makecol(0, 0, 0));
+    rs->game_mode = game_mode;
+    rs->players[0] = players[0];
+    rs->players[1] = players[1];
+    if (game_mode == 2)
+    {
+        rs->boxes[0] = *fighter_boxes(&players[0]);
+        rs->boxes[1] = *fighter_boxes(&players[1]);
+    }
+    
+    int n = projectiles.count;
+    rs->projectile_count = n;
+    if (n > 0)
+    {
+        memcpy(rs->projectile_x, projectiles.x, n * sizeof(hamoopi_sim_t));
+        memcpy(rs->projectile_y, projectiles.y, n * sizeof(hamoopi_sim_t));
+        memcpy(rs->projectile_type, projectiles.type, n * sizeof(int));
+    }
+    
+    rs->p1_cursor = p1_cursor;
+    rs->p2_cursor = p2_cursor;
+    rs->p1_ready = p1_ready;
+    rs->p2_ready = p2_ready;
+    rs->p1_rounds_won = p1_rounds_won;
+    rs->p2_rounds_won = p2_rounds_won;
+    rs->current_round = current_round;
+    rs->round_winner = 0;
+    if (game_mode == 2 && round_transition_timer > 0)
+        rs->round_winner = players[0].health <= 0 ? 2 : 1;
+    rs->stage_animation_frame = stage_animation_frame;
+    rs->show_debug_boxes = show_debug_boxes;
+    rs->use_sprite_animations = use_sprite_animations;
 }
 
-void hamoopi_run_frame(void)
+// Game logic for one frame. Each mode captures its snapshot where the
+// frame is shown: the menus before they react to input, the fight after
+// everything has moved.
+static void simulate_frame(RenderState* rs)
 {
-    if (!initialized || !screen_buffer || !game_buffer)
-        return;
-    
     frame_count++;
     
-    // Update the Allegro key array based on hamoopi_input state
-    key[p1_up_key] = hamoopi_input[0].up;
-    key[p1_down_key] = hamoopi_input[0].down;
-    key[p1_left_key] = hamoopi_input[0].left;
-    key[p1_right_key] = hamoopi_input[0].right;
-    key[p1_bt1_key] = hamoopi_input[0].a;
-    key[p1_bt2_key] = hamoopi_input[0].b;
-    key[p1_bt3_key] = hamoopi_input[0].y;
-    key[p1_bt4_key] = hamoopi_input[0].x;
-    key[p1_bt5_key] = hamoopi_input[0].l;
-    key[p1_bt6_key] = hamoopi_input[0].r;
-    key[p1_select_key] = hamoopi_input[0].select;
-    key[p1_start_key] = hamoopi_input[0].start;
-    
-    key[p2_up_key] = hamoopi_input[1].up;
-    key[p2_down_key] = hamoopi_input[1].down;
-    key[p2_left_key] = hamoopi_input[1].left;
-    key[p2_right_key] = hamoopi_input[1].right;
-    key[p2_bt1_key] = hamoopi_input[1].a;
-    key[p2_bt2_key] = hamoopi_input[1].b;
-    key[p2_bt3_key] = hamoopi_input[1].y;
-    key[p2_bt4_key] = hamoopi_input[1].x;
-    key[p2_bt5_key] = hamoopi_input[1].l;
-    key[p2_bt6_key] = hamoopi_input[1].r;
-    key[p2_select_key] = hamoopi_input[1].select;
-    key[p2_start_key] = hamoopi_input[1].start;
-    
-    // Clear game buffer
-    clear_to_color(game_buffer, makecol(20, 40, 80));
+    // Button edges for this frame
+    for (int i = 0; i < 2; i++)
+        hamoopi_input_update(&input[i], sim_input[i]);
+    
+    rs->load_sprites[0] = -1;
+    rs->load_sprites[1] = -1;
+    rs->prefetch_stage = -1;
     
-    // Game mode logic
     if (game_mode == 0)
     {
         // Title screen
-        textout_centre_ex(game_buffer, game_font, "HAMOOPI", 320, 150, makecol(255, 255, 255), -1);
-        textout_centre_ex(game_buffer, game_font, "Libretro Core - Fighting Game Demo", 320, 180, makecol(200, 200, 200), -1);
-        textout_centre_ex(game_buffer, game_font, "Press START to begin", 320, 240, makecol(150, 200, 150), -1);
-        textout_centre_ex(game_buffer, game_font, "Player 1: WASD + JKL", 320, 300, makecol(150, 150, 200), -1);
-        textout_centre_ex(game_buffer, game_font, "Player 2: Arrows + Numpad", 320, 320, makecol(150, 150, 200), -1);
+        capture_render_state(rs);
         
-        if (key[p1_start_key] || key[p2_start_key])
+        if ((input[0].held | input[1].held) & BTN(START))
         {
             game_mode = 1; // Go to character select
             p1_ready = false;
@@ -1938,85 +3053,37 @@ void hamoopi_run_frame(void)
     else if (game_mode == 1)
     {
         // Character selection screen
-        textout_centre_ex(game_buffer, game_font, "SELECT YOUR FIGHTER", 320, 30, makecol(255, 255, 255), -1);
-        
-        // Draw character selection boxes
-        int start_x = 120;
-        int start_y = 100;
-        int spacing = 100;
-        
-        for (int i = 0; i < NUM_CHARACTERS; i++)
-        {
-            int x = start_x + (i * spacing);
-            draw_character_box(game_buffer, i, x, start_y, 
-                             (i == p1_cursor), p1_ready);
-        }
-        
-        // Draw second row for Player 2
-        for (int i = 0; i < NUM_CHARACTERS; i++)
-        {
-            int x = start_x + (i * spacing);
-            draw_character_box(game_buffer, i, x, start_y + 150, 
-                             (i == p2_cursor), p2_ready);
-        }
-        
-        // Draw player labels
-        textout_ex(game_buffer, game_font, "PLAYER 1", 50, start_y + 40, makecol(255, 100, 100), -1);
-        textout_ex(game_buffer, game_font, "PLAYER 2", 50, start_y + 190, makecol(100, 100, 255), -1);
-        
-        // Instructions
-        textout_centre_ex(game_buffer, game_font, "Left/Right to select, A to confirm", 320, 420, makecol(200, 200, 200), -1);
+        capture_render_state(rs);
         
         // Player 1 input (only if not ready)
         if (!p1_ready)
         {
-            if (key[p1_left_key] && !p1_left_pressed)
-            {
+            if (hamoopi_input_pressed_mask(&input[0]) & BTN(LEFT))
                 p1_cursor = (p1_cursor - 1 + NUM_CHARACTERS) % NUM_CHARACTERS;
-                p1_left_pressed = true;
-            }
-            if (!key[p1_left_key]) p1_left_pressed = false;
-            
-            if (key[p1_right_key] && !p1_right_pressed)
-            {
+            if (hamoopi_input_pressed_mask(&input[0]) & BTN(RIGHT))
                 p1_cursor = (p1_cursor + 1) % NUM_CHARACTERS;
-                p1_right_pressed = true;
-            }
-            if (!key[p1_right_key]) p1_right_pressed = false;
-            
-            if (key[p1_bt1_key] && !p1_a_pressed)
+            if (hamoopi_input_pressed_mask(&input[0]) & BTN(A))
             {
                 p1_ready = true;
                 players[0].character_id = p1_cursor;
-                p1_a_pressed = true;
+                
+                // P1's character picks the stage: load it while P2 chooses
+                rs->prefetch_stage = p1_cursor;
             }
-            if (!key[p1_bt1_key]) p1_a_pressed = false;
         }
         
         // Player 2 input (only if not ready)
         if (!p2_ready)
         {
-            if (key[p2_left_key] && !p2_left_pressed)
-            {
+            if (hamoopi_input_pressed_mask(&input[1]) & BTN(LEFT))
                 p2_cursor = (p2_cursor - 1 + NUM_CHARACTERS) % NUM_CHARACTERS;
-                p2_left_pressed = true;
-            }
-            if (!key[p2_left_key]) p2_left_pressed = false;
-            
-            if (key[p2_right_key] && !p2_right_pressed)
-            {
+            if (hamoopi_input_pressed_mask(&input[1]) & BTN(RIGHT))
                 p2_cursor = (p2_cursor + 1) % NUM_CHARACTERS;
-                p2_right_pressed = true;
-            }
-            if (!key[p2_right_key]) p2_right_pressed = false;
-            
-            if (key[p2_bt1_key] && !p2_a_pressed)
+            if (hamoopi_input_pressed_mask(&input[1]) & BTN(A))
             {
                 p2_ready = true;
                 players[1].character_id = p2_cursor;
-                p2_a_pressed = true;
             }
-            if (!key[p2_bt1_key]) p2_a_pressed = false;
         }
         
         // Both players ready - start fight
@@ -2028,9 +3095,10 @@ void hamoopi_run_frame(void)
             init_player(&players[1], 1);
             players[1].character_id = p2_cursor;
             
-            // Load sprites for selected characters
-            load_character_sprites(p1_cursor);
-            load_character_sprites(p2_cursor);
+            // Sprites for the selected characters are loaded on the
+            // drawing side, before this frame is presented
+            rs->load_sprites[0] = p1_cursor;
+            rs->load_sprites[1] = p2_cursor;
             
             // Reset round system for new match
             p1_rounds_won = 0;
@@ -2045,339 +3113,47 @@ void hamoopi_run_frame(void)
         
         // Toggle debug boxes with SELECT button (P1 only)
         // Toggle sprite animations with SELECT + START combo (P1 only)
-        static bool select_pressed = false;
-        static bool combo_pressed = false;
-        
-        bool select_down = key[p1_select_key];
-        bool start_down = key[p1_start_key];
+        uint32_t held = input[0].held;
+        uint32_t pressed = hamoopi_input_pressed_mask(&input[0]);
         
-        if (select_down && start_down)
+        if ((held & BTN(SELECT)) && (held & BTN(START)))
         {
             // SELECT + START combo: toggle sprite animations
-            if (!combo_pressed)
-            {
+            if (pressed & (BTN(SELECT) | BTN(START)))
                 use_sprite_animations = !use_sprite_animations;
-                combo_pressed = true;
-                select_pressed = true;  // Prevent single SELECT from triggering
-            }
         }
-        else if (select_down && !start_down)
+        else if (pressed & BTN(SELECT))
         {
             // Just SELECT: toggle debug boxes
-            if (!select_pressed && !combo_pressed)
-            {
-                show_debug_boxes = !show_debug_boxes;
-                select_pressed = true;
-            }
-        }
-        else
-        {
-            // Release
-            select_pressed = false;
-            combo_pressed = false;
+            show_debug_boxes = !show_debug_boxes;
         }
         
-        // Draw stage background
-        draw_stage_background(game_buffer, players[0].character_id, players[1].character_id);
+        advance_stage_animation();
+        
+        // Update both fighters, P1 first
+        for (int i = 0; i < 2; i++)
+            fighter_update(i);
         
-        // Update Player 1
         Player* p1 = &players[0];
-        static int p1_attack_cooldown = 0;
-        if (p1_attack_cooldown > 0) p1_attack_cooldown--;
+        Player* p2 = &players[1];
         
-        if (p1->health > 0)
+        // Body collision - prevent players from walking through each other
+        update_collision_snapshot();
+        CollisionBox p1_body = fighter_boxes(p1)->body;
+        CollisionBox p2_body = fighter_boxes(p2)->body;
+        if (boxes_overlap(p1_body, p2_body))
         {
-            // Check if crouching (DOWN button)
-            p1->is_crouching = key[p1_down_key] && p1->on_ground;
-            
-            // Check if blocking (B button / bt2)
-            bool was_blocking = p1->is_blocking;
-            p1->is_blocking = key[p1_bt2_key];
-            
-            // Block sound effect (when starting to block)
-            if (p1->is_blocking && !was_blocking)
-            {
-                play_sound(SOUND_BLOCK);
-            }
-            
-            // Movement (slower when blocking, can't move horizontally when crouching)
-            if (!p1->is_crouching)
+            // Push players apart
+            hamoopi_sim_t push_force = 2.0f;
+            if (p1->x < p2->x)
             {
-                float speed_multiplier = p1->is_blocking ? BLOCKING_SPEED_MULTIPLIER : 1.0f;
-                if (key[p1_left_key]) { p1->vx = -3.0f * speed_multiplier; p1->facing = -1; }
-                else if (key[p1_right_key]) { p1->vx = 3.0f * speed_multiplier; p1->facing = 1; }
-                else { p1->vx *= 0.8f; }
+                p1->x -= push_force;
+                p2->x += push_force;
             }
             else
             {
-                // Can't move horizontally while crouching
-                p1->vx *= 0.8f;
-            }
-            
-            // Jump (can't jump while blocking or crouching)
-            if (key[p1_up_key] && p1->on_ground && !p1->is_blocking && !p1->is_crouching)
-            {
-                p1->vy = -12.0f;
-                p1->on_ground = false;
-                play_sound(SOUND_JUMP); // Jump sound effect
-            }
-            
-            // Attack with cooldown (can't attack while blocking)
-            if (key[p1_bt1_key] && p1_attack_cooldown == 0 && !p1->is_blocking)
-            {
-                play_sound(SOUND_ATTACK); // Attack sound effect
-                if (p1->is_crouching)
-                {
-                    p1->state = 6; // Crouch attack state
-                }
-                else
-                {
-                    p1->state = 3; // Normal attack state
-                }
-                p1->attack_frame = 0; // Start attack animation
-                p1_attack_cooldown = 15; // 15 frames cooldown (~0.25 seconds)
-            }
-            
-            // Update attack animation
-            if (p1->state == 3 || p1->state == 6)
-            {
-                p1->attack_frame++;
-                if (p1->attack_frame >= 10) // Attack lasts 10 frames
-                {
-                    p1->state = 0; // Return to idle
-                    p1->attack_frame = 0;
-                }
-                
-                // Check hitbox collision during active frames
-                if (p1->attack_frame >= 2 && p1->attack_frame <= 6)
-                {
-                    Player* p2 = &players[1];
-                    if (p2->health > 0)
-                    {
-                        CollisionBox p1_hitbox = get_hitbox(p1);
-                        CollisionBox p2_hurtbox = get_hurtbox(p2);
-                        
-                        // Check for hit
-                        if (boxes_overlap(p1_hitbox, p2_hurtbox))
-                        {
-                            // Only apply damage once per attack
-                            if (p1->attack_frame == 2)
-                            {
-                                if (p2->is_blocking)
-                                {
-                                    p2->health -= BLOCKED_DAMAGE;
-                                    if (p2->health < 0) p2->health = 0;
-                                    play_sound(SOUND_BLOCK);
-                                }
-                                else
-                                {
-                                    p2->health -= NORMAL_DAMAGE;
-                                    if (p2->health < 0) p2->health = 0;
-                                    play_sound(SOUND_HIT);
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-            
-            // Special move (Y button / bt3)
-            if (p1->special_move_cooldown > 0)
-            {
-                p1->special_move_cooldown--;
-            }
-            
-            // Handle WIND dash
-            if (p1->is_dashing)
-            {
-                p1->dash_timer--;
-                p1->vx = WIND_DASH_SPEED * p1->facing;
-                if (p1->dash_timer <= 0)
-                {
-                    p1->is_dashing = false;
-                }
-            }
-            
-            if (key[p1_bt3_key] && p1->special_move_cooldown == 0 && !p1->is_blocking)
-            {
-                Player* p2 = &players[1];
-                execute_special_move(p1, p2, 0);
-            }
-            
-            // Physics
-            p1->vy += 0.5f; // Gravity
-            p1->x += p1->vx;
-            p1->y += p1->vy;
-            
-            // Collision with ground
-            if (p1->y >= 350.0f)
-            {
-                p1->y = 350.0f;
-                p1->vy = 0.0f;
-                p1->on_ground = true;
-            }
-            
-            // Boundary check
-            if (p1->x < 20.0f) p1->x = 20.0f;
-            if (p1->x > 620.0f) p1->x = 620.0f;
-        }
-        
-        // Update Player 2
-        Player* p2 = &players[1];
-        static int p2_attack_cooldown = 0;
-        if (p2_attack_cooldown > 0) p2_attack_cooldown--;
-        
-        if (p2->health > 0)
-        {
-            // Check if crouching (DOWN button)
-            p2->is_crouching = key[p2_down_key] && p2->on_ground;
-            
-            // Check if blocking (B button / bt2)
-            bool was_blocking = p2->is_blocking;
-            p2->is_blocking = key[p2_bt2_key];
-            
-            // Block sound effect (when starting to block)
-            if (p2->is_blocking && !was_blocking)
-            {
-                play_sound(SOUND_BLOCK);
-            }
-            
-            // Movement (slower when blocking, can't move horizontally when crouching)
-            if (!p2->is_crouching)
-            {
-                float speed_multiplier = p2->is_blocking ? BLOCKING_SPEED_MULTIPLIER : 1.0f;
-                if (key[p2_left_key]) { p2->vx = -3.0f * speed_multiplier; p2->facing = -1; }
-                else if (key[p2_right_key]) { p2->vx = 3.0f * speed_multiplier; p2->facing = 1; }
-                else { p2->vx *= 0.8f; }
-            }
-            else
-            {
-                // Can't move horizontally while crouching
-                p2->vx *= 0.8f;
-            }
-            
-            // Jump (can't jump while blocking or crouching)
-            if (key[p2_up_key] && p2->on_ground && !p2->is_blocking && !p2->is_crouching)
-            {
-                p2->vy = -12.0f;
-                p2->on_ground = false;
-                play_sound(SOUND_JUMP); // Jump sound effect
-            }
-            
-            // Attack with cooldown (can't attack while blocking)
-            if (key[p2_bt1_key] && p2_attack_cooldown == 0 && !p2->is_blocking)
-            {
-                play_sound(SOUND_ATTACK); // Attack sound effect
-                if (p2->is_crouching)
-                {
-                    p2->state = 6; // Crouch attack state
-                }
-                else
-                {
-                    p2->state = 3; // Normal attack state
-                }
-                p2->attack_frame = 0; // Start attack animation
-                p2_attack_cooldown = 15; // 15 frames cooldown (~0.25 seconds)
-            }
-            
-            // Update attack animation
-            if (p2->state == 3 || p2->state == 6)
-            {
-                p2->attack_frame++;
-                if (p2->attack_frame >= 10) // Attack lasts 10 frames
-                {
-                    p2->state = 0; // Return to idle
-                    p2->attack_frame = 0;
-                }
-                
-                // Check hitbox collision during active frames
-                if (p2->attack_frame >= 2 && p2->attack_frame <= 6)
-                {
-                    if (p1->health > 0)
-                    {
-                        CollisionBox p2_hitbox = get_hitbox(p2);
-                        CollisionBox p1_hurtbox = get_hurtbox(p1);
-                        
-                        // Check for hit
-                        if (boxes_overlap(p2_hitbox, p1_hurtbox))
-                        {
-                            // Only apply damage once per attack
-                            if (p2->attack_frame == 2)
-                            {
-                                if (p1->is_blocking)
-                                {
-                                    p1->health -= BLOCKED_DAMAGE;
-                                    if (p1->health < 0) p1->health = 0;
-                                    play_sound(SOUND_BLOCK);
-                                }
-                                else
-                                {
-                                    p1->health -= NORMAL_DAMAGE;
-                                    if (p1->health < 0) p1->health = 0;
-                                    play_sound(SOUND_HIT);
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-            
-            // Special move (Y button / bt3)
-            if (p2->special_move_cooldown > 0)
-            {
-                p2->special_move_cooldown--;
-            }
-            
-            // Handle WIND dash
-            if (p2->is_dashing)
-            {
-                p2->dash_timer--;
-                p2->vx = WIND_DASH_SPEED * p2->facing;
-                if (p2->dash_timer <= 0)
-                {
-                    p2->is_dashing = false;
-                }
-            }
-            
-            if (key[p2_bt3_key] && p2->special_move_cooldown == 0 && !p2->is_blocking)
-            {
-                execute_special_move(p2, p1, 1);
-            }
-            
-            // Physics
-            p2->vy += 0.5f; // Gravity
-            p2->x += p2->vx;
-            p2->y += p2->vy;
-            
-            // Collision with ground
-            if (p2->y >= 350.0f)
-            {
-                p2->y = 350.0f;
-                p2->vy = 0.0f;
-                p2->on_ground = true;
-            }
-            
-            // Boundary check
-            if (p2->x < 20.0f) p2->x = 20.0f;
-            if (p2->x > 620.0f) p2->x = 620.0f;
-        }
-        
-        // Body collision - prevent players from walking through each other
-        CollisionBox p1_body = get_body_box(p1);
-        CollisionBox p2_body = get_body_box(p2);
-        if (boxes_overlap(p1_body, p2_body))
-        {
-            // Push players apart
-            float push_force = 2.0f;
-            if (p1->x < p2->x)
-            {
-                p1->x -= push_force;
-                p2->x += push_force;
-            }
-            else
-            {
-                p1->x += push_force;
-                p2->x -= push_force;
+                p1->x += push_force;
+                p2->x -= push_force;
             }
         }
         
@@ -2398,57 +3174,14 @@ void hamoopi_run_frame(void)
         }
         
         // Update player states based on movement
-        if (p1->health > 0)
-        {
-            if (p1->state != 3 && p1->state != 6 && !p1->is_blocking)  // Not attacking or blocking
-            {
-                if (!p1->on_ground)
-                {
-                    p1->state = 2;  // Jump
-                }
-                else if (p1->is_crouching)
-                {
-                    p1->state = 5;  // Crouch
-                }
-                else if (fabs(p1->vx) > 0.5f)
-                {
-                    p1->state = 1;  // Walk
-                }
-                else
-                {
-                    p1->state = 0;  // Idle
-                }
-            }
-        }
-        
-        if (p2->health > 0)
-        {
-            if (p2->state != 3 && p2->state != 6 && !p2->is_blocking)  // Not attacking or blocking
-            {
-                if (!p2->on_ground)
-                {
-                    p2->state = 2;  // Jump
-                }
-                else if (p2->is_crouching)
-                {
-                    p2->state = 5;  // Crouch
-                }
-                else if (fabs(p2->vx) > 0.5f)
-                {
-                    p2->state = 1;  // Walk
-                }
-                else
-                {
-                    p2->state = 0;  // Idle
-                }
-            }
-        }
+        fighter_resolve_state(p1);
+        fighter_resolve_state(p2);
         
         // Attack clashing - check if both players are attacking (normal or crouch attacks)
-        if ((p1->state == 3 || p1->state == 6) && (p2->state == 3 || p2->state == 6))
+        if (fighter_attacking(p1) && fighter_attacking(p2))
         {
-            CollisionBox p1_clash = get_clash_box(p1);
-            CollisionBox p2_clash = get_clash_box(p2);
+            CollisionBox p1_clash = fighter_boxes(p1)->clash;
+            CollisionBox p2_clash = fighter_boxes(p2)->clash;
             
             if (boxes_overlap(p1_clash, p2_clash) && p1_clash.w > 0 && p2_clash.w > 0)
             {
@@ -2468,151 +3201,654 @@ void hamoopi_run_frame(void)
         // Update projectiles
         update_projectiles();
         
+        capture_render_state(rs);
+        
+        // Check for round winner
+        if (round_transition_timer > 0)
+        {
+            round_transition_timer--;
+            
+            // After timer expires, check if match is over or start next round
+            if (round_transition_timer == 0)
+            {
+                if (p1_rounds_won >= 2 || p2_rounds_won >= 2)
+                {
+                    // Match over - go to winner screen
+                    game_mode = 3;
+                }
+                else
+                {
+                    // Start next round - preserve character selections
+                    current_round++;
+                    int p1_char = players[0].character_id;
+                    int p2_char = players[1].character_id;
+                    init_player(&players[0], 0);
+                    players[0].character_id = p1_char;
+                    init_player(&players[1], 1);
+                    players[1].character_id = p2_char;
+                }
+            }
+        }
+        else if (p1->health <= 0 || p2->health <= 0)
+        {
+            // Round just ended - award point and start transition
+            if (p1->health <= 0)
+            {
+                p2_rounds_won++;
+            }
+            else
+            {
+                p1_rounds_won++;
+            }
+            round_transition_timer = 120; // 2 seconds at 60 FPS
+        }
+    }
+    else if (game_mode == 3)
+    {
+        // Match winner screen
+        capture_render_state(rs);
+        
+        if ((input[0].held | input[1].held) & BTN(START))
+        {
+            game_mode = 1; // Back to character select
+            p1_ready = false;
+            p2_ready = false;
+            p1_cursor = players[0].character_id;
+            p2_cursor = players[1].character_id;
+        }
+    }
+    
+    memcpy(rs->sounds, sim_sounds, sim_sound_count * sizeof(sim_sounds[0]));
+    rs->sound_count = sim_sound_count;
+    sim_sound_count = 0;
+    rs->consumed = false;
+}
+
+// Draw a frame snapshot into game_buffer and on to screen_buffer
+static void render_frame(const RenderState* rs)
+{
+    clear_to_color(game_buffer, makecol(20, 40, 80));
+    
+    if (rs->game_mode == 0)
+    {
+        // Title screen
+        res_textout_centre(game_buffer, game_font, "HAMOOPI", 320, 150, makecol(255, 255, 255), -1);
+        res_textout_centre(game_buffer, game_font, "Libretro Core - Fighting Game Demo", 320, 180, makecol(200, 200, 200), -1);
+        res_textout_centre(game_buffer, game_font, "Press START to begin", 320, 240, makecol(150, 200, 150), -1);
+        res_textout_centre(game_buffer, game_font, "Player 1: WASD + JKL", 320, 300, makecol(150, 150, 200), -1);
+        res_textout_centre(game_buffer, game_font, "Player 2: Arrows + Numpad", 320, 320, makecol(150, 150, 200), -1);
+    }
+    else if (rs->game_mode == 1)
+    {
+        // Character selection screen
+        res_textout_centre(game_buffer, game_font, "SELECT YOUR FIGHTER", 320, 30, makecol(255, 255, 255), -1);
+        
+        // Draw character selection boxes
+        int start_x = 120;
+        int start_y = 100;
+        int spacing = 100;
+        
+        for (int i = 0; i < NUM_CHARACTERS; i++)
+        {
+            int x = start_x + (i * spacing);
+            draw_character_box(game_buffer, i, x, start_y, 
+                             (i == rs->p1_cursor), rs->p1_ready);
+        }
+        
+        // Draw second row for Player 2
+        for (int i = 0; i < NUM_CHARACTERS; i++)
+        {
+            int x = start_x + (i * spacing);
+            draw_character_box(game_buffer, i, x, start_y + 150, 
+                             (i == rs->p2_cursor), rs->p2_ready);
+        }
+        
+        // Draw player labels
+        res_textout(game_buffer, game_font, "PLAYER 1", 50, start_y + 40, makecol(255, 100, 100), -1);
+        res_textout(game_buffer, game_font, "PLAYER 2", 50, start_y + 190, makecol(100, 100, 255), -1);
+        
+        // Instructions
+        res_textout_centre(game_buffer, game_font, "Left/Right to select, A to confirm", 320, 420, makecol(200, 200, 200), -1);
+    }
+    else if (rs->game_mode == 2)
+    {
+        const Player* p1 = &rs->players[0];
+        const Player* p2 = &rs->players[1];
+        
+        // Draw stage background
+        draw_stage_background(game_buffer, rs);
+        
         // Draw players
-        draw_player(game_buffer, p1);
-        draw_player(game_buffer, p2);
+        draw_player(game_buffer, rs, 0);
+        draw_player(game_buffer, rs, 1);
         
         // Draw projectiles
-        draw_projectiles(game_buffer);
+        draw_projectiles(game_buffer, rs);
         
         // Draw HUD
-        textout_ex(game_buffer, game_font, "P1", 50, 20, makecol(255, 100, 100), -1);
+        res_textout(game_buffer, game_font, "P1", 50, 20, makecol(255, 100, 100), -1);
         char p1_health_str[32];
         sprintf(p1_health_str, "HP: %d", p1->health);
-        textout_ex(game_buffer, game_font, p1_health_str, 50, 35, makecol(255, 255, 255), -1);
+        res_textout(game_buffer, game_font, p1_health_str, 50, 35, makecol(255, 255, 255), -1);
         
         // P1 Special move cooldown indicator
         if (p1->special_move_cooldown > 0)
         {
             int cooldown_width = (int)((float)p1->special_move_cooldown / SPECIAL_MOVE_COOLDOWN * 60.0f);
-            rectfill(game_buffer, 50, 50, 50 + cooldown_width, 55, makecol(150, 150, 0));
+            rectfill(game_buffer, RES(50), RES(50), RES(50 + cooldown_width), RES(55), makecol(150, 150, 0));
         }
         else
         {
-            textout_ex(game_buffer, game_font, "SPECIAL READY!", 50, 50, makecol(255, 255, 0), -1);
+            res_textout(game_buffer, game_font, "SPECIAL READY!", 50, 50, makecol(255, 255, 0), -1);
         }
         
-        textout_ex(game_buffer, game_font, "P2", 550, 20, makecol(100, 100, 255), -1);
+        res_textout(game_buffer, game_font, "P2", 550, 20, makecol(100, 100, 255), -1);
         char p2_health_str[32];
         sprintf(p2_health_str, "HP: %d", p2->health);
-        textout_ex(game_buffer, game_font, p2_health_str, 550, 35, makecol(255, 255, 255), -1);
+        res_textout(game_buffer, game_font, p2_health_str, 550, 35, makecol(255, 255, 255), -1);
         
         // P2 Special move cooldown indicator
         if (p2->special_move_cooldown > 0)
         {
             int cooldown_width = (int)((float)p2->special_move_cooldown / SPECIAL_MOVE_COOLDOWN * 60.0f);
-            rectfill(game_buffer, 550, 50, 550 + cooldown_width, 55, makecol(150, 150, 0));
+            rectfill(game_buffer, RES(550), RES(50), RES(550 + cooldown_width), RES(55), makecol(150, 150, 0));
         }
         else
         {
-            textout_ex(game_buffer, game_font, "SPECIAL READY!", 550, 50, makecol(255, 255, 0), -1);
+            res_textout(game_buffer, game_font, "SPECIAL READY!", 550, 50, makecol(255, 255, 0), -1);
         }
         
         // Draw round indicators
-        draw_round_indicators(game_buffer);
+        draw_round_indicators(game_buffer, rs);
         
         // Debug info
-        if (show_debug_boxes)
+        if (rs->show_debug_boxes)
         {
-            textout_ex(game_buffer, game_font, "DEBUG MODE - SELECT to toggle", 10, 460, makecol(255, 255, 0), -1);
-            textout_ex(game_buffer, game_font, "Yellow=Body Green=Hurtbox Red=Hitbox Orange=Clash", 10, 470, makecol(255, 255, 255), -1);
+            res_textout(game_buffer, game_font, "DEBUG MODE - SELECT to toggle", 10, 460, makecol(255, 255, 0), -1);
+            res_textout(game_buffer, game_font, "Yellow=Body Green=Hurtbox Red=Hitbox Orange=Clash", 10, 470, makecol(255, 255, 255), -1);
         }
         
         // Display sprite animation status
-        if (!use_sprite_animations)
+        if (!rs->use_sprite_animations)
         {
-            textout_ex(game_buffer, game_font, "SPRITES OFF - SELECT+START to toggle", 200, 460, makecol(255, 128, 0), -1);
+            res_textout(game_buffer, game_font, "SPRITES OFF - SELECT+START to toggle", 200, 460, makecol(255, 128, 0), -1);
         }
         
-        // Check for round winner
-        if (round_transition_timer > 0)
+        // Display round result
+        if (rs->round_winner == 2)
         {
-            // Display round result
-            round_transition_timer--;
-            
-            if (p1->health <= 0)
-            {
-                textout_centre_ex(game_buffer, game_font, "ROUND OVER!", 320, 200, makecol(255, 255, 255), -1);
-                textout_centre_ex(game_buffer, game_font, "PLAYER 2 WINS ROUND!", 320, 230, makecol(100, 200, 255), -1);
-            }
-            else
-            {
-                textout_centre_ex(game_buffer, game_font, "ROUND OVER!", 320, 200, makecol(255, 255, 255), -1);
-                textout_centre_ex(game_buffer, game_font, "PLAYER 1 WINS ROUND!", 320, 230, makecol(255, 200, 100), -1);
-            }
-            
-            // After timer expires, check if match is over or start next round
-            if (round_transition_timer == 0)
-            {
-                if (p1_rounds_won >= 2 || p2_rounds_won >= 2)
-                {
-                    // Match over - go to winner screen
-                    game_mode = 3;
-                }
-                else
-                {
-                    // Start next round - preserve character selections
-                    current_round++;
-                    int p1_char = players[0].character_id;
-                    int p2_char = players[1].character_id;
-                    init_player(&players[0], 0);
-                    players[0].character_id = p1_char;
-                    init_player(&players[1], 1);
-                    players[1].character_id = p2_char;
-                }
-            }
+            res_textout_centre(game_buffer, game_font, "ROUND OVER!", 320, 200, makecol(255, 255, 255), -1);
+            res_textout_centre(game_buffer, game_font, "PLAYER 2 WINS ROUND!", 320, 230, makecol(100, 200, 255), -1);
         }
-        else if (p1->health <= 0 || p2->health <= 0)
+        else if (rs->round_winner == 1)
         {
-            // Round just ended - award point and start transition
-            if (p1->health <= 0)
-            {
-                p2_rounds_won++;
-            }
-            else
-            {
-                p1_rounds_won++;
-            }
-            round_transition_timer = 120; // 2 seconds at 60 FPS
+            res_textout_centre(game_buffer, game_font, "ROUND OVER!", 320, 200, makecol(255, 255, 255), -1);
+            res_textout_centre(game_buffer, game_font, "PLAYER 1 WINS ROUND!", 320, 230, makecol(255, 200, 100), -1);
         }
     }
-    else if (game_mode == 3)
+    else if (rs->game_mode == 3)
     {
         // Match winner screen
         clear_to_color(game_buffer, makecol(20, 20, 40));
         
         // Draw round indicators
-        draw_round_indicators(game_buffer);
+        draw_round_indicators(game_buffer, rs);
         
-        if (p1_rounds_won > p2_rounds_won)
+        if (rs->p1_rounds_won > rs->p2_rounds_won)
         {
-            textout_centre_ex(game_buffer, game_font, "PLAYER 1 WINS THE MATCH!", 320, 200, makecol(255, 200, 100), -1);
+            res_textout_centre(game_buffer, game_font, "PLAYER 1 WINS THE MATCH!", 320, 200, makecol(255, 200, 100), -1);
             char score_text[64];
-            sprintf(score_text, "Score: %d - %d", p1_rounds_won, p2_rounds_won);
-            textout_centre_ex(game_buffer, game_font, score_text, 320, 230, makecol(200, 200, 200), -1);
+            sprintf(score_text, "Score: %d - %d", rs->p1_rounds_won, rs->p2_rounds_won);
+            res_textout_centre(game_buffer, game_font, score_text, 320, 230, makecol(200, 200, 200), -1);
         }
         else
         {
-            textout_centre_ex(game_buffer, game_font, "PLAYER 2 WINS THE MATCH!", 320, 200, makecol(100, 200, 255), -1);
+            res_textout_centre(game_buffer, game_font, "PLAYER 2 WINS THE MATCH!", 320, 200, makecol(100, 200, 255), -1);
             char score_text[64];
-            sprintf(score_text, "Score: %d - %d", p1_rounds_won, p2_rounds_won);
-            textout_centre_ex(game_buffer, game_font, score_text, 320, 230, makecol(200, 200, 200), -1);
+            sprintf(score_text, "Score: %d - %d", rs->p1_rounds_won, rs->p2_rounds_won);
+            res_textout_centre(game_buffer, game_font, score_text, 320, 230, makecol(200, 200, 200), -1);
         }
         
-        textout_centre_ex(game_buffer, game_font, "Press START for rematch", 320, 250, makecol(200, 200, 200), -1);
-        
-        if (key[p1_start_key] || key[p2_start_key])
+        res_textout_centre(game_buffer, game_font, "Press START for rematch", 320, 250, makecol(200, 200, 200), -1);
+    }
+    
+    // Copy game buffer to screen buffer
+    blit(game_buffer, screen_buffer, 0, 0, 0, 0, game_buffer->w, game_buffer->h);
+    if (core_options.perf_overlay)
+        draw_perf_overlay(screen_buffer);
+}
+
+// Static-frame detection: the title, character select and match winner
+// screens only change with the few values below. A frame whose key
+// matches the one last drawn leaves screen_buffer as it is and is
+// reported unchanged, so the frontend can dupe it.
+typedef struct {
+    int game_mode;
+    int p1_cursor, p2_cursor;
+    int p1_ready, p2_ready;
+    int p1_rounds_won, p2_rounds_won;
+} ScreenKey;
+
+static ScreenKey drawn_key;
+static bool drawn_key_valid = false;    // false: next frame is always drawn
+static bool frame_changed = true;       // Last hamoopi_run_frame drew a new frame
+
+// false for screens that change every frame (the fight, the overlay)
+static bool screen_key(const RenderState* rs, ScreenKey* key)
+{
+    if (rs->game_mode == 2 || core_options.perf_overlay)
+        return false;
+    memset(key, 0, sizeof(*key));
+    key->game_mode = rs->game_mode;
+    if (rs->game_mode == 1)
+    {
+        key->p1_cursor = rs->p1_cursor;
+        key->p2_cursor = rs->p2_cursor;
+        key->p1_ready = rs->p1_ready;
+        key->p2_ready = rs->p2_ready;
+    }
+    else if (rs->game_mode == 3)
+    {
+        key->p1_rounds_won = rs->p1_rounds_won;
+        key->p2_rounds_won = rs->p2_rounds_won;
+    }
+    return true;
+}
+
+// Draw the frame unless screen_buffer already shows it
+static void present_frame(const RenderState* rs)
+{
+    ScreenKey key;
+    bool keyed = screen_key(rs, &key);
+    if (keyed && drawn_key_valid && memcmp(&key, &drawn_key, sizeof(key)) == 0)
+    {
+        frame_changed = false;
+        return;
+    }
+    render_frame(rs);
+    drawn_key = key;
+    drawn_key_valid = keyed;
+    frame_changed = true;
+}
+
+// Send the frame's sounds to the mixer and load the sprites and stage it
+// needs, once
+static void consume_frame(RenderState* rs)
+{
+    if (rs->consumed)
+        return;
+    for (int i = 0; i < rs->sound_count; i++)
+        sound_ring_push(sound_frame, rs->sounds[i]);
+    for (int i = 0; i < 2; i++)
+    {
+        if (rs->load_sprites[i] >= 0)
+            load_character_sprites(rs->load_sprites[i]);
+    }
+    if (rs->prefetch_stage >= 0)
+        prefetch_stage(rs->prefetch_stage);
+    rs->consumed = true;
+}
+
+// Simulate/render pipelining (core option "hamoopi_pipeline")
+//
+// The simulation writes the back snapshot of render_states and publishes
+// it by storing its index in render_front; the renderer only reads the
+// front one. Pipelined, a worker thread simulates frame N+1 into the back
+// snapshot while the main thread draws frame N, for one frame of added
+// latency. The worker parks on sim_wake between frames. For the rare
+// frame whose simulation outlasts the drawing, the main thread spins
+// briefly on sim_completed and then sleeps on sim_done.
+static RenderState render_states[2];
+static std::atomic<int> render_front(0);
+static bool runahead_active = false;
+static bool frame_in_flight = false;        // The last run_frame left a frame on the worker
+
+#define PIPELINE_SPIN 16  // Yields before pipeline_wait sleeps
+
+static std::thread sim_thread;
+static std::mutex sim_mutex;
+static std::condition_variable sim_wake;
+static std::condition_variable sim_done;
+static bool sim_quit = false;               // guarded by sim_mutex
+static int sim_requested = 0;               // written under sim_mutex by the main thread
+static std::atomic<int> sim_completed(0);   // written under sim_mutex by the worker
+
+static void simulate_into_back(void)
+{
+    int back = 1 - render_front.load(std::memory_order_relaxed);
+    simulate_frame(&render_states[back]);
+    render_front.store(back, std::memory_order_release);
+}
+
+static void sim_worker(void)
+{
+    int done = sim_completed.load(std::memory_order_acquire);
+    for (;;)
+    {
         {
-            game_mode = 1; // Back to character select
-            p1_ready = false;
-            p2_ready = false;
-            p1_cursor = players[0].character_id;
-            p2_cursor = players[1].character_id;
+            std::unique_lock<std::mutex> lock(sim_mutex);
+            while (!sim_quit && sim_requested == done)
+                sim_wake.wait(lock);
+            if (sim_quit)
+                return;
+        }
+        simulate_into_back();
+        {
+            std::lock_guard<std::mutex> lock(sim_mutex);
+            sim_completed.store(++done, std::memory_order_release);
         }
+        sim_done.notify_one();
+    }
+}
+
+// Simulate the next frame on the worker, starting it on first use
+static void pipeline_kick(void)
+{
+    if (!sim_thread.joinable())
+        sim_thread = std::thread(sim_worker);
+    std::lock_guard<std::mutex> lock(sim_mutex);
+    sim_requested++;
+    sim_wake.notify_one();
+}
+
+// Wait for the frame in flight, if any. Anything that touches game state
+// from the main thread calls this first.
+static void pipeline_wait(void)
+{
+    for (int spin = 0; spin < PIPELINE_SPIN; spin++)
+    {
+        if (sim_completed.load(std::memory_order_acquire) == sim_requested)
+            return;
+        std::this_thread::yield();
     }
     
-    // Copy game buffer to screen buffer
-    blit(game_buffer, screen_buffer, 0, 0, 0, 0, 640, 480);
+    std::unique_lock<std::mutex> lock(sim_mutex);
+    while (sim_completed.load(std::memory_order_acquire) != sim_requested)
+        sim_done.wait(lock);
+}
+
+static void pipeline_stop(void)
+{
+    if (!sim_thread.joinable())
+        return;
+    pipeline_wait();
+    {
+        std::lock_guard<std::mutex> lock(sim_mutex);
+        sim_quit = true;
+    }
+    sim_wake.notify_one();
+    sim_thread.join();
+    sim_quit = false;
+}
+
+// Show the current game state until the first new frame is simulated
+static void reset_render_states(void)
+{
+    RenderState* rs = &render_states[render_front.load(std::memory_order_relaxed)];
+    capture_render_state(rs);
+    rs->sound_count = 0;
+    rs->consumed = true;
+}
+
+// (Re)create screen_buffer and game_buffer at the render resolution
+static bool create_render_buffers(void)
+{
+    if (game_buffer)
+        destroy_bitmap(game_buffer);
+    if (screen_buffer)
+        destroy_bitmap(screen_buffer);
+    
+    screen_buffer = create_bitmap(RES(640), RES(480));
+    game_buffer = create_bitmap(RES(640), RES(480));
+    
+    if (!screen_buffer || !game_buffer)
+    {
+        fprintf(stderr, "Failed to create screen buffers\n");
+        return false;
+    }
+    
+    clear_to_color(screen_buffer, makecol(0, 0, 0));
+    clear_to_color(game_buffer, makecol(0, 0, 0));
+    drawn_key_valid = false;
+    return true;
+}
+
+// Back to the title screen with nothing carried over from earlier play
+static void reset_game_state(void)
+{
+    init_player(&players[0], 0);
+    players[0].character_id = 0;
+    init_player(&players[1], 1);
+    players[1].character_id = 1;
+    
+    game_mode = 0;
+    frame_count = 0;
+    stage_animation_frame = 0;
+    
+    // Reset character selection state
+    p1_cursor = 0;
+    p2_cursor = 1;
+    p1_ready = false;
+    p2_ready = false;
+    
+    p1_rounds_won = 0;
+    p2_rounds_won = 0;
+    current_round = 1;
+    round_transition_timer = 0;
+    
+    memset(input, 0, sizeof(input));
+    memset(sim_input, 0, sizeof(sim_input));
+    memset(attack_cooldown, 0, sizeof(attack_cooldown));
+    sim_sound_count = 0;
+    hamoopi_pool_clear(&projectiles);
+    
+    // In-game toggles go back to their core option values
+    use_sprite_animations = core_options.sprite_animations;
+    show_debug_boxes = core_options.debug_boxes;
+}
+
+// Silence the voices and restart the mixer clock. Only while nothing can
+// be mixing: not from hamoopi_reset, which may race the audio thread.
+static void reset_audio_state(void)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        sound_queue[i] = SOUND_NONE;
+        sound_effect_timer[i] = 0;
+        sound_effect_duration[i] = 0;
+    }
+    sound_ring_head.store(0, std::memory_order_relaxed);
+    sound_ring_tail.store(0, std::memory_order_relaxed);
+    sound_frame = 0;
+    mix_position = 0;
+    mix_offset = 0;
+    mix_noise = 1;
+}
+
+void hamoopi_init(void)
+{
+    if (initialized)
+        return;
+    
+    // Create screen buffer for rendering
+    if (!create_render_buffers())
+        return;
+    
+    // Initialize game font
+    game_font = font;
+    
+    // Initialize sprite system
+    init_sprite_system();
+    
+    // Load backgrounds from config files
+    load_backgrounds();
+    
+    // Load character configurations from INI files
+    init_character_configs();
+    for (int i = 0; i < NUM_CHARACTERS; i++)
+        compile_fighter_fsm(i);
+    invalidate_collision_snapshot();
+    
+    // Initialize projectiles
+    hamoopi_pool_init(&projectiles, MAX_PROJECTILES);
+    
+    // Start at the title screen with default characters
+    reset_game_state();
+    reset_audio_state();
+    reset_render_states();
+    
+    initialized = true;
+    running = false;
+}
+
+void hamoopi_deinit(void)
+{
+    if (!initialized)
+        return;
+    
+    pipeline_stop();
+    
+    // Cleanup backgrounds
+    free_backgrounds();
+    free_stage_cache();
+    
+    // Cleanup sprite system
+    cleanup_sprite_system();
+    free_character_configs();
+    
+    // Cached title/HUD text
+    hamoopi_text_cache_clear();
+    
+    hamoopi_pool_free(&projectiles);
+    
+    if (game_buffer)
+    {
+        destroy_bitmap(game_buffer);
+        game_buffer = NULL;
+    }
+    
+    if (screen_buffer)
+    {
+        destroy_bitmap(screen_buffer);
+        screen_buffer = NULL;
+    }
+    
+    initialized = false;
+    running = false;
+}
+
+void hamoopi_reset(void)
+{
+    pipeline_wait();
+    
+    reset_game_state();
+    
+    if (screen_buffer)
+        clear_to_color(screen_buffer, makecol(0, 0, 0));
+    if (game_buffer)
+        clear_to_color(game_buffer, makecol(0, 0, 0));
+    drawn_key_valid = false;
+    
+    reset_render_states();
+}
+
+void hamoopi_run_frame(void)
+{
+    if (!initialized || !screen_buffer || !game_buffer)
+        return;
+    
+    // Run-ahead needs each frame's output right away; it always gets
+    // the serial path so the pipeline adds no latency on top
+    bool pipelined = core_options.pipeline && !runahead_active;
+    
+    // Frame simulated during the previous call, if any
+    pipeline_wait();
+    RenderState* front = &render_states[render_front.load(std::memory_order_acquire)];
+    consume_frame(front);
+    bool had_frame_in_flight = frame_in_flight;
+    frame_in_flight = false;
+    
+    memcpy(sim_input, input_latched, sizeof(sim_input));
+    if (pipelined)
+    {
+        // Simulate the next frame behind this one while it is drawn
+        pipeline_kick();
+        frame_in_flight = true;
+    }
+    else if (had_frame_in_flight)
+    {
+        // Switching to serial: show the worker's last frame rather than
+        // simulating over it and skipping it
+    }
+    else
+    {
+        simulate_into_back();
+        front = &render_states[render_front.load(std::memory_order_relaxed)];
+        consume_frame(front);
+    }
+    
+    frame_changed = false;
+    if (render_enabled)
+        present_frame(front);
+    
+    sound_frame++;
+}
+
+void hamoopi_set_options(const hamoopi_options_t* options)
+{
+    if (!options)
+        return;
+    
+    pipeline_wait();
+    
+    // The in-game toggles keep working; the option only overrides them
+    // when the option itself changes
+    if (options->sprite_animations != core_options.sprite_animations)
+        use_sprite_animations = options->sprite_animations;
+    if (options->debug_boxes != core_options.debug_boxes)
+        show_debug_boxes = options->debug_boxes;
+    
+    if (options->bg_detail != core_options.bg_detail)
+        free_stage_cache();
+    
+    if (options->low_res != core_options.low_res)
+    {
+        render_shift = options->low_res ? 1 : 0;
+        free_stage_cache();
+        if (initialized)
+            create_render_buffers();
+    }
+    
+    hamoopi_stages_set_budget((size_t)options->stage_cache_mb << 20);
+    
+    if (options->perf_overlay && !core_options.perf_overlay)
+        memset(perf_usec, 0, sizeof(perf_usec));
+    if (options->perf_overlay != core_options.perf_overlay)
+        drawn_key_valid = false;
+    
+    core_options = *options;
+    mix_quality.store(options->audio_quality, std::memory_order_relaxed);
+}
+
+bool hamoopi_frame_changed(void)
+{
+    return frame_changed;
+}
+
+void hamoopi_set_render_enabled(bool enabled)
+{
+    render_enabled = enabled;
+}
+
+void hamoopi_set_runahead(bool active)
+{
+    runahead_active = active;
+}
+
+void hamoopi_report_frame_time(int64_t usec)
+{
+    perf_usec[perf_index] = usec;
+    perf_index = (perf_index + 1) % PERF_HISTORY;
 }
 
 BITMAP* hamoopi_get_screen_buffer(void)
@@ -2620,48 +3856,9 @@ BITMAP* hamoopi_get_screen_buffer(void)
    return screen_buffer;
 }
 
-void hamoopi_set_input_state(unsigned port, unsigned device, unsigned index, unsigned id, int16_t state)
+void hamoopi_set_input(unsigned port, uint32_t buttons)
 {
    if (port > 1)
       return;
-   
-   switch (id)
-   {
-      case RETRO_DEVICE_ID_JOYPAD_UP:
-         hamoopi_input[port].up = state;
-         break;
-      case RETRO_DEVICE_ID_JOYPAD_DOWN:
-         hamoopi_input[port].down = state;
-         break;
-      case RETRO_DEVICE_ID_JOYPAD_LEFT:
-         hamoopi_input[port].left = state;
-         break;
-      case RETRO_DEVICE_ID_JOYPAD_RIGHT:
-         hamoopi_input[port].right = state;
-         break;
-      case RETRO_DEVICE_ID_JOYPAD_A:
-         hamoopi_input[port].a = state;
-         break;
-      case RETRO_DEVICE_ID_JOYPAD_B:
-         hamoopi_input[port].b = state;
-         break;
-      case RETRO_DEVICE_ID_JOYPAD_X:
-         hamoopi_input[port].x = state;
-         break;
-      case RETRO_DEVICE_ID_JOYPAD_Y:
-         hamoopi_input[port].y = state;
-         break;
-      case RETRO_DEVICE_ID_JOYPAD_L:
-         hamoopi_input[port].l = state;
-         break;
-      case RETRO_DEVICE_ID_JOYPAD_R:
-         hamoopi_input[port].r = state;
-         break;
-      case RETRO_DEVICE_ID_JOYPAD_SELECT:
-         hamoopi_input[port].select = state;
-         break;
-      case RETRO_DEVICE_ID_JOYPAD_START:
-         hamoopi_input[port].start = state;
-         break;
-   }
+   input_latched[port] = buttons;
 }
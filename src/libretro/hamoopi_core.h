@@ -12,31 +12,64 @@ void hamoopi_reset(void);
 // Frame execution
 void hamoopi_run_frame(void);
 
+// Core options, applied live (see libretro_core_options.h)
+typedef enum {
+   HAMOOPI_BG_ANIMATED = 0,
+   HAMOOPI_BG_STATIC,
+   HAMOOPI_BG_PROCEDURAL
+} hamoopi_bg_detail_t;
+
+typedef enum {
+   HAMOOPI_AUDIO_OFF = 0,
+   HAMOOPI_AUDIO_LOW,
+   HAMOOPI_AUDIO_HIGH
+} hamoopi_audio_quality_t;
+
+typedef struct {
+   int bg_detail;          // hamoopi_bg_detail_t
+   bool shadows;
+   int audio_quality;      // hamoopi_audio_quality_t
+   bool sprite_animations;
+   bool debug_boxes;
+   bool perf_overlay;
+   bool pipeline;          // Simulate the next frame on a worker thread
+   bool low_res;           // Render at 320x240 instead of 640x480
+   int stage_cache_mb;     // Memory kept for stages already loaded
+} hamoopi_options_t;
+
+void hamoopi_set_options(const hamoopi_options_t* options);
+
+// Frame-skip: when false, the next frames run game logic only
+void hamoopi_set_render_enabled(bool enabled);
+
+// false when the last hamoopi_run_frame left the screen buffer untouched:
+// a skipped frame, or a menu screen identical to the one already drawn
+bool hamoopi_frame_changed(void);
+
+// Run-ahead in progress: frames run serially even with the pipeline
+// option on, so no latency is added on top
+void hamoopi_set_runahead(bool active);
+
+// Time spent on the last frame, shown by the performance overlay
+void hamoopi_report_frame_time(int64_t usec);
+
 // Video
+// 640x480, or 320x240 with the low_res option
 BITMAP* hamoopi_get_screen_buffer(void);
 
 // Audio
+// Mixes the sound effects of the frames run so far. Safe to call from a
+// thread other than hamoopi_run_frame's (the frontend's audio thread), as
+// long as only one thread mixes at a time.
 void hamoopi_get_audio_samples(int16_t* buffer, size_t frames);
 
-// Input
-void hamoopi_set_input_state(unsigned port, unsigned device, unsigned index, unsigned id, int16_t state);
+// Async mode: samples are pulled by an audio thread that does not run in
+// step with the frames, so effects are scheduled with a frame of slack
+void hamoopi_set_audio_async(bool async);
 
-// Input state structure for two players
-typedef struct {
-   int16_t up;
-   int16_t down;
-   int16_t left;
-   int16_t right;
-   int16_t a;
-   int16_t b;
-   int16_t x;
-   int16_t y;
-   int16_t l;
-   int16_t r;
-   int16_t select;
-   int16_t start;
-} hamoopi_input_t;
-
-extern hamoopi_input_t hamoopi_input[2];
+// Input
+// Buttons held by a player, bit n = RETRO_DEVICE_ID_JOYPAD_n (the layout of
+// RETRO_DEVICE_ID_JOYPAD_MASK). Takes effect on the next hamoopi_run_frame().
+void hamoopi_set_input(unsigned port, uint32_t buttons);
 
 #endif /* HAMOOPI_CORE_H */
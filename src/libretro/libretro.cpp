@@ -1,9 +1,14 @@
 #include "libretro.h"
 #include <allegro.h>
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <atomic>
+#include "hamoopi_core.h"
+#include "hamoopi_scaler.h"
+#include "libretro_core_options.h"
 
 // Forward declarations from HAMOOPI
 extern void hamoopi_init();
@@ -11,7 +16,7 @@ extern void hamoopi_run_frame();
 extern void hamoopi_deinit();
 extern void hamoopi_reset();
 extern BITMAP* hamoopi_get_screen_buffer();
-extern void hamoopi_set_input_state(unsigned port, unsigned device, unsigned index, unsigned id, int16_t state);
+extern void hamoopi_set_input(unsigned port, uint32_t buttons);
 extern void hamoopi_get_audio_samples(int16_t* buffer, size_t frames);
 
 static retro_log_printf_t log_cb;
@@ -26,17 +31,164 @@ static retro_input_state_t input_state_cb;
 #define HAMOOPI_WIDTH  640
 #define HAMOOPI_HEIGHT 480
 #define HAMOOPI_FPS    60
+#define HAMOOPI_MAX_SCALE 3
 
 static uint32_t* frame_buf = NULL;
+static unsigned frame_w = HAMOOPI_WIDTH;
+static unsigned frame_h = HAMOOPI_HEIGHT;
+static bool frame_valid = false;  // frame_buf holds the current screen at the current scale
+
+// RGB565 output (core option "hamoopi_pixel_format", or when the frontend
+// rejects XRGB8888): frames are packed from frame_buf into frame_buf16
+static bool use_rgb565 = false;
+static uint16_t* frame_buf16 = NULL;
+
+// Size the core draws at (core option "hamoopi_render_resolution")
+static int render_w = HAMOOPI_WIDTH;
+static int render_h = HAMOOPI_HEIGHT;
+
+// Output scaler (core options "hamoopi_output_scale" / "hamoopi_output_filter")
+static hamoopi_scaler_t scaler;
+static int output_scale = 1;
+static int output_filter = HAMOOPI_SCALE_NEAREST;
+
+// Frame-skip: draw one frame out of frameskip+1
+static int frameskip = 0;
+static int frameskip_counter = 0;
+static bool can_dupe = false;
+static bool input_bitmasks = false;
+
+// Performance overlay timing
+static struct retro_perf_callback perf_cb;
+
+// retro_init calls not yet matched by retro_deinit
+static int allegro_refs = 0;
+
+// Async audio (RETRO_ENVIRONMENT_SET_AUDIO_CALLBACK): the frontend's audio
+// thread pulls samples whenever the device has room, so a slow frame no
+// longer underruns it. retro_run pushes them itself while the frontend
+// has the callback turned off or did not accept it.
+#define AUDIO_CHUNK_FRAMES 512
+static std::atomic<bool> audio_async_enabled(false);
+
+static const char* get_variable(const char* key)
+{
+   struct retro_variable var;
+   var.key   = key;
+   var.value = NULL;
+   if (environ_cb && environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+      return var.value;
+   return NULL;
+}
+
+static bool variable_enabled(const char* key, bool fallback)
+{
+   const char* value = get_variable(key);
+   if (!value)
+      return fallback;
+   return strcmp(value, "enabled") == 0;
+}
+
+static void check_variables(bool startup)
+{
+   const char* value;
+   int scale = output_scale;
+   bool low_res = false;
+
+   value = get_variable("hamoopi_output_scale");
+   if (value)
+   {
+      scale = atoi(value);
+      if (scale < 1 || scale > HAMOOPI_MAX_SCALE)
+         scale = 1;
+   }
+
+   value = get_variable("hamoopi_render_resolution");
+   if (value && strcmp(value, "320x240") == 0)
+      low_res = true;
+
+   value = get_variable("hamoopi_output_filter");
+   if (value)
+   {
+      int filter = hamoopi_scale_filter_from_name(value);
+      if (filter != output_filter)
+         frame_valid = false;
+      output_filter = filter;
+   }
+
+   value = get_variable("hamoopi_frameskip");
+   if (value)
+   {
+      frameskip = atoi(value);
+      if (frameskip < 0)
+         frameskip = 0;
+   }
+
+   hamoopi_options_t options;
+   options.bg_detail = HAMOOPI_BG_ANIMATED;
+   value = get_variable("hamoopi_bg_detail");
+   if (value && strcmp(value, "static") == 0)
+      options.bg_detail = HAMOOPI_BG_STATIC;
+   else if (value && strcmp(value, "procedural") == 0)
+      options.bg_detail = HAMOOPI_BG_PROCEDURAL;
+
+   options.audio_quality = HAMOOPI_AUDIO_HIGH;
+   value = get_variable("hamoopi_audio_quality");
+   if (value && strcmp(value, "low") == 0)
+      options.audio_quality = HAMOOPI_AUDIO_LOW;
+   else if (value && strcmp(value, "off") == 0)
+      options.audio_quality = HAMOOPI_AUDIO_OFF;
+
+   options.shadows           = variable_enabled("hamoopi_shadows", false);
+   options.sprite_animations = variable_enabled("hamoopi_sprite_animations", true);
+   options.debug_boxes       = variable_enabled("hamoopi_debug_boxes", false);
+   options.perf_overlay      = variable_enabled("hamoopi_perf_overlay", false);
+   options.pipeline          = variable_enabled("hamoopi_pipeline", false);
+   options.low_res           = low_res;
+   options.stage_cache_mb    = 8;
+   value = get_variable("hamoopi_stage_cache");
+   if (value)
+      options.stage_cache_mb = atoi(value);
+   hamoopi_set_options(&options);
+
+   int new_w = low_res ? HAMOOPI_WIDTH / 2 : HAMOOPI_WIDTH;
+   int new_h = low_res ? HAMOOPI_HEIGHT / 2 : HAMOOPI_HEIGHT;
+   if (scale != output_scale || new_w != render_w)
+   {
+      output_scale = scale;
+      render_w = new_w;
+      render_h = new_h;
+      frame_valid = false;
+      if (!startup)
+      {
+         struct retro_game_geometry geom;
+         memset(&geom, 0, sizeof(geom));
+         geom.base_width   = render_w * output_scale;
+         geom.base_height  = render_h * output_scale;
+         geom.max_width    = HAMOOPI_WIDTH * HAMOOPI_MAX_SCALE;
+         geom.max_height   = HAMOOPI_HEIGHT * HAMOOPI_MAX_SCALE;
+         geom.aspect_ratio = (float)HAMOOPI_WIDTH / (float)HAMOOPI_HEIGHT;
+         environ_cb(RETRO_ENVIRONMENT_SET_GEOMETRY, &geom);
+      }
+   }
+}
 
 void retro_init(void)
 {
-   // Initialize frame buffer
-   frame_buf = (uint32_t*)malloc(HAMOOPI_WIDTH * HAMOOPI_HEIGHT * sizeof(uint32_t));
+   // Initialize frame buffer (large enough for the biggest output scale)
+   frame_buf = (uint32_t*)malloc(HAMOOPI_WIDTH * HAMOOPI_MAX_SCALE * HAMOOPI_HEIGHT * HAMOOPI_MAX_SCALE * sizeof(uint32_t));
+   frame_buf16 = (uint16_t*)malloc(HAMOOPI_WIDTH * HAMOOPI_MAX_SCALE * HAMOOPI_HEIGHT * HAMOOPI_MAX_SCALE * sizeof(uint16_t));
+   hamoopi_scaler_init(&scaler);
+   frameskip_counter = 0;
+   frame_valid = false;
+   check_variables(true);
    
-   // Initialize Allegro (minimal setup for libretro)
-   allegro_init();
-   install_timer();
+   // Allegro only as a bitmap library: SYSTEM_NONE starts no timer thread,
+   // keyboard or display driver, since the frontend drives timing, input
+   // and video. No atexit hook either: the core may be unloaded before
+   // the process exits. Counted so init/deinit cycles in one process pair up.
+   if (allegro_refs++ == 0)
+      install_allegro(SYSTEM_NONE, &errno, NULL);
    set_color_depth(32);
    
    // Initialize game
@@ -46,14 +198,18 @@ void retro_init(void)
 void retro_deinit(void)
 {
    hamoopi_deinit();
+   hamoopi_scaler_free(&scaler);
    
    if (frame_buf)
    {
       free(frame_buf);
       frame_buf = NULL;
    }
+   free(frame_buf16);
+   frame_buf16 = NULL;
    
-   allegro_exit();
+   if (allegro_refs > 0 && --allegro_refs == 0)
+      allegro_exit();
 }
 
 unsigned retro_api_version(void)
@@ -81,10 +237,10 @@ void retro_get_system_av_info(struct retro_system_av_info *info)
    memset(info, 0, sizeof(*info));
    info->timing.fps            = HAMOOPI_FPS;
    info->timing.sample_rate    = 44100.0;
-   info->geometry.base_width   = HAMOOPI_WIDTH;
-   info->geometry.base_height  = HAMOOPI_HEIGHT;
-   info->geometry.max_width    = HAMOOPI_WIDTH;
-   info->geometry.max_height   = HAMOOPI_HEIGHT;
+   info->geometry.base_width   = render_w * output_scale;
+   info->geometry.base_height  = render_h * output_scale;
+   info->geometry.max_width    = HAMOOPI_WIDTH * HAMOOPI_MAX_SCALE;
+   info->geometry.max_height   = HAMOOPI_HEIGHT * HAMOOPI_MAX_SCALE;
    info->geometry.aspect_ratio = (float)HAMOOPI_WIDTH / (float)HAMOOPI_HEIGHT;
 }
 
@@ -94,6 +250,7 @@ void retro_set_environment(retro_environment_t cb)
    
    bool no_content = true;
    cb(RETRO_ENVIRONMENT_SET_SUPPORT_NO_GAME, &no_content);
+   libretro_set_core_options(cb);
    
    // Set up logging
    struct retro_log_callback log;
@@ -131,6 +288,18 @@ void retro_reset(void)
    hamoopi_reset();
 }
 
+static void RETRO_CALLCONV audio_callback(void)
+{
+   static int16_t samples[AUDIO_CHUNK_FRAMES * 2]; // Stereo, audio thread only
+   hamoopi_get_audio_samples(samples, AUDIO_CHUNK_FRAMES);
+   audio_batch_cb(samples, AUDIO_CHUNK_FRAMES);
+}
+
+static void RETRO_CALLCONV audio_set_state(bool enabled)
+{
+   audio_async_enabled.store(enabled, std::memory_order_release);
+}
+
 static void update_input(void)
 {
    if (!input_poll_cb || !input_state_cb)
@@ -138,73 +307,67 @@ static void update_input(void)
 
    input_poll_cb();
 
-   // Map libretro buttons to HAMOOPI controls
-   // Player 1
-   int16_t p1_up    = input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP);
-   int16_t p1_down  = input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_DOWN);
-   int16_t p1_left  = input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT);
-   int16_t p1_right = input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_RIGHT);
-   int16_t p1_b     = input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_B);
-   int16_t p1_a     = input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_A);
-   int16_t p1_y     = input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_Y);
-   int16_t p1_x     = input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_X);
-   int16_t p1_l     = input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_L);
-   int16_t p1_r     = input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_R);
-   int16_t p1_sel   = input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_SELECT);
-   int16_t p1_start = input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_START);
-
-   // Player 2
-   int16_t p2_up    = input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP);
-   int16_t p2_down  = input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_DOWN);
-   int16_t p2_left  = input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT);
-   int16_t p2_right = input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_RIGHT);
-   int16_t p2_b     = input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_B);
-   int16_t p2_a     = input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_A);
-   int16_t p2_y     = input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_Y);
-   int16_t p2_x     = input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_X);
-   int16_t p2_l     = input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_L);
-   int16_t p2_r     = input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_R);
-   int16_t p2_sel   = input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_SELECT);
-   int16_t p2_start = input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_START);
-
-   // Pass input to HAMOOPI
-   hamoopi_set_input_state(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP, p1_up);
-   hamoopi_set_input_state(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_DOWN, p1_down);
-   hamoopi_set_input_state(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT, p1_left);
-   hamoopi_set_input_state(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_RIGHT, p1_right);
-   hamoopi_set_input_state(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_B, p1_b);
-   hamoopi_set_input_state(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_A, p1_a);
-   hamoopi_set_input_state(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_Y, p1_y);
-   hamoopi_set_input_state(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_X, p1_x);
-   hamoopi_set_input_state(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_L, p1_l);
-   hamoopi_set_input_state(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_R, p1_r);
-   hamoopi_set_input_state(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_SELECT, p1_sel);
-   hamoopi_set_input_state(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_START, p1_start);
-
-   hamoopi_set_input_state(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP, p2_up);
-   hamoopi_set_input_state(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_DOWN, p2_down);
-   hamoopi_set_input_state(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT, p2_left);
-   hamoopi_set_input_state(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_RIGHT, p2_right);
-   hamoopi_set_input_state(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_B, p2_b);
-   hamoopi_set_input_state(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_A, p2_a);
-   hamoopi_set_input_state(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_Y, p2_y);
-   hamoopi_set_input_state(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_X, p2_x);
-   hamoopi_set_input_state(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_L, p2_l);
-   hamoopi_set_input_state(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_R, p2_r);
-   hamoopi_set_input_state(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_SELECT, p2_sel);
-   hamoopi_set_input_state(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_START, p2_start);
+   // One call per player when the frontend supports bitmasks, otherwise
+   // build the same word button by button
+   for (unsigned port = 0; port < 2; port++)
+   {
+      uint32_t buttons = 0;
+      if (input_bitmasks)
+         buttons = (uint16_t)input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_MASK);
+      else
+      {
+         for (unsigned id = 0; id <= RETRO_DEVICE_ID_JOYPAD_R; id++)
+            if (input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, id))
+               buttons |= 1u << id;
+      }
+      hamoopi_set_input(port, buttons);
+   }
 }
 
 static void convert_allegro_bitmap_to_rgb(void)
 {
    BITMAP* screen_buf = hamoopi_get_screen_buffer();
-   if (!screen_buf || !frame_buf)
+   if (!screen_buf || !frame_buf || !frame_buf16)
       return;
 
+   // The render resolution never exceeds 640x480
+   int w = screen_buf->w < HAMOOPI_WIDTH ? screen_buf->w : HAMOOPI_WIDTH;
+   int h = screen_buf->h < HAMOOPI_HEIGHT ? screen_buf->h : HAMOOPI_HEIGHT;
+
+   // 32bpp memory bitmaps already hold XRGB8888 rows: scale them straight
+   // into the frame buffer
+   if (bitmap_color_depth(screen_buf) == 32)
+   {
+      size_t pitch = (size_t)(screen_buf->line[1] - screen_buf->line[0]);
+      int out_w = w * output_scale;
+      int out_h = h * output_scale;
+      frame_w = out_w;
+      frame_h = out_h;
+      
+      // 16-bit at 1x: pack straight from the screen, no 32-bit copy
+      if (use_rgb565 && output_scale == 1)
+      {
+         hamoopi_pack_rgb565((const uint32_t*)screen_buf->line[0], pitch,
+                             frame_buf16, w * sizeof(uint16_t), w, h);
+         return;
+      }
+      
+      hamoopi_scale(&scaler, output_filter, (const uint32_t*)screen_buf->line[0],
+                    w, h, pitch,
+                    frame_buf, out_w, out_h, out_w * sizeof(uint32_t));
+      if (use_rgb565)
+         hamoopi_pack_rgb565(frame_buf, out_w * sizeof(uint32_t),
+                             frame_buf16, out_w * sizeof(uint16_t), out_w, out_h);
+      return;
+   }
+
+   frame_w = w;
+   frame_h = h;
+
    // Convert Allegro bitmap to RGB format for libretro
-   for (int y = 0; y < HAMOOPI_HEIGHT && y < screen_buf->h; y++)
+   for (int y = 0; y < h; y++)
    {
-      for (int x = 0; x < HAMOOPI_WIDTH && x < screen_buf->w; x++)
+      for (int x = 0; x < w; x++)
       {
          int pixel = getpixel(screen_buf, x, y);
          int r = getr(pixel);
@@ -212,28 +375,66 @@ static void convert_allegro_bitmap_to_rgb(void)
          int b = getb(pixel);
          
          // Convert to XRGB8888 format
-         frame_buf[y * HAMOOPI_WIDTH + x] = (0xFF << 24) | (r << 16) | (g << 8) | b;
+         frame_buf[y * w + x] = (0xFF << 24) | (r << 16) | (g << 8) | b;
       }
    }
+   if (use_rgb565)
+      hamoopi_pack_rgb565(frame_buf, w * sizeof(uint32_t), frame_buf16, w * sizeof(uint16_t), w, h);
 }
 
 void retro_run(void)
 {
+    bool updated = false;
+    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &updated) && updated)
+        check_variables(false);
+
     // Update input state
     update_input();
     
+    // Frame-skip: logic runs every frame, drawing only on kept frames
+    bool render = true;
+    if (frameskip > 0)
+    {
+        render = (frameskip_counter == 0);
+        frameskip_counter = (frameskip_counter + 1) % (frameskip + 1);
+    }
+    hamoopi_set_render_enabled(render);
+    
+    // Run-ahead runs its hidden frames with video off and fast savestates on
+    int av_enable = 0;
+    bool runahead = environ_cb(RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE, &av_enable) &&
+                    (!(av_enable & RETRO_AV_ENABLE_VIDEO) || (av_enable & RETRO_AV_ENABLE_FAST_SAVESTATES));
+    hamoopi_set_runahead(runahead);
+    
+    retro_time_t start = perf_cb.get_time_usec ? perf_cb.get_time_usec() : 0;
+    
     // Run one frame of the game
     hamoopi_run_frame();
     
-    // Convert Allegro bitmap to RGB buffer
-    convert_allegro_bitmap_to_rgb();
+    // Convert Allegro bitmap to RGB buffer, unless the core left it as it
+    // was (static menu screens)
+    bool fresh = render && (hamoopi_frame_changed() || !frame_valid);
+    if (fresh)
+    {
+        convert_allegro_bitmap_to_rgb();
+        frame_valid = true;
+    }
+    
+    if (perf_cb.get_time_usec)
+        hamoopi_report_frame_time(perf_cb.get_time_usec() - start);
     
-    // Send video frame to frontend
-    video_cb(frame_buf, HAMOOPI_WIDTH, HAMOOPI_HEIGHT, HAMOOPI_WIDTH * sizeof(uint32_t));
+    // Send video frame to frontend (a skipped or unchanged frame is a dupe
+    // when allowed)
+    const void* frame = use_rgb565 ? (const void*)frame_buf16 : (const void*)frame_buf;
+    size_t pitch = frame_w * (use_rgb565 ? sizeof(uint16_t) : sizeof(uint32_t));
+    if (fresh || !can_dupe)
+        video_cb(frame, frame_w, frame_h, pitch);
+    else
+        video_cb(NULL, frame_w, frame_h, pitch);
     
-    // Generate and send audio samples
+    // Generate and send audio samples, unless the audio thread does
     // 44100 Hz / 60 FPS = 735 samples per frame
-    if (audio_batch_cb)
+    if (audio_batch_cb && !audio_async_enabled.load(std::memory_order_acquire))
     {
         static int16_t audio_samples[735 * 2]; // Stereo
         hamoopi_get_audio_samples(audio_samples, 735);
@@ -243,15 +444,39 @@ void retro_run(void)
 
 bool retro_load_game(const struct retro_game_info *info)
 {
-   enum retro_pixel_format fmt = RETRO_PIXEL_FORMAT_XRGB8888;
+   // XRGB8888 unless RGB565 is asked for; either one falls back to the other
+   const char* value = get_variable("hamoopi_pixel_format");
+   use_rgb565 = value && strcmp(value, "rgb565") == 0;
+   enum retro_pixel_format fmt = use_rgb565 ? RETRO_PIXEL_FORMAT_RGB565 : RETRO_PIXEL_FORMAT_XRGB8888;
    if (!environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
    {
+      use_rgb565 = !use_rgb565;
+      fmt = use_rgb565 ? RETRO_PIXEL_FORMAT_RGB565 : RETRO_PIXEL_FORMAT_XRGB8888;
+      if (!environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
+      {
+         if (log_cb)
+            log_cb(RETRO_LOG_ERROR, "Neither XRGB8888 nor RGB565 is supported.\n");
+         else
+            fprintf(stderr, "HAMOOPI: Neither XRGB8888 nor RGB565 is supported.\n");
+         return false;
+      }
       if (log_cb)
-         log_cb(RETRO_LOG_ERROR, "XRGB8888 is not supported.\n");
-      else
-         fprintf(stderr, "HAMOOPI: XRGB8888 is not supported.\n");
-      return false;
+         log_cb(RETRO_LOG_INFO, "Using %s output.\n", use_rgb565 ? "RGB565" : "XRGB8888");
    }
+   frame_valid = false;
+
+   if (!environ_cb(RETRO_ENVIRONMENT_GET_CAN_DUPE, &can_dupe))
+      can_dupe = false;
+
+   input_bitmasks = environ_cb(RETRO_ENVIRONMENT_GET_INPUT_BITMASKS, NULL);
+
+   memset(&perf_cb, 0, sizeof(perf_cb));
+   environ_cb(RETRO_ENVIRONMENT_GET_PERF_INTERFACE, &perf_cb);
+
+   struct retro_audio_callback audio = { audio_callback, audio_set_state };
+   hamoopi_set_audio_async(true);
+   if (!environ_cb(RETRO_ENVIRONMENT_SET_AUDIO_CALLBACK, &audio))
+      hamoopi_set_audio_async(false);
 
    (void)info;
    return true;
@@ -259,6 +484,7 @@ bool retro_load_game(const struct retro_game_info *info)
 
 void retro_unload_game(void)
 {
+   audio_async_enabled.store(false, std::memory_order_release);
 }
 
 unsigned retro_get_region(void)
@@ -0,0 +1,255 @@
+#ifndef LIBRETRO_CORE_OPTIONS_H__
+#define LIBRETRO_CORE_OPTIONS_H__
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "libretro.h"
+
+/*
+ ********************************
+ * Core Option Definitions
+ ********************************
+ * The first value of each option is used when the frontend has no
+ * stored setting; all options are re-read live through
+ * RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE.
+ */
+
+static struct retro_core_option_definition option_defs_us[] = {
+   {
+      "hamoopi_output_scale",
+      "Output Scale",
+      "Size of the frame handed to the frontend, as a multiple of the Render Resolution; sizes above 1x are produced by the core's scaler.",
+      {
+         { "1x", NULL },
+         { "2x", NULL },
+         { "3x", NULL },
+         { NULL, NULL },
+      },
+      "1x"
+   },
+   {
+      "hamoopi_render_resolution",
+      "Render Resolution",
+      "Size the game is drawn at. 320x240 draws a quarter of the pixels and leaves the upscaling to the frontend; text keeps its size.",
+      {
+         { "640x480", NULL },
+         { "320x240", NULL },
+         { NULL, NULL },
+      },
+      "640x480"
+   },
+   {
+      "hamoopi_output_filter",
+      "Scaling Filter",
+      "Filter used when Output Scale is above 1x.",
+      {
+         { "nearest",  "Nearest" },
+         { "bilinear", "Bilinear" },
+         { "scale2x",  "Scale2x" },
+         { NULL, NULL },
+      },
+      "nearest"
+   },
+   {
+      "hamoopi_pixel_format",
+      "Pixel Format",
+      "Format of the frames handed to the frontend. RGB565 halves the memory traffic per frame on handhelds. Used automatically when the frontend rejects the other one. Takes effect when the core is loaded.",
+      {
+         { "xrgb8888", "XRGB8888" },
+         { "rgb565",   "RGB565" },
+         { NULL, NULL },
+      },
+      "xrgb8888"
+   },
+   {
+      "hamoopi_bg_detail",
+      "Background Detail",
+      "Static draws each stage once and reuses it every frame. Animated scrolls and animates stages. Procedural always uses the generated stages instead of background images.",
+      {
+         { "animated",   "Animated" },
+         { "static",     "Static" },
+         { "procedural", "Procedural" },
+         { NULL, NULL },
+      },
+      "animated"
+   },
+   {
+      "hamoopi_stage_cache",
+      "Stage Cache",
+      "Stage images load when a match needs them, starting as soon as P1 picks a character. Stages already loaded are kept up to this much memory, least recently used freed first.",
+      {
+         { "4",  "4 MB" },
+         { "8",  "8 MB" },
+         { "16", "16 MB" },
+         { "32", "32 MB" },
+         { NULL, NULL },
+      },
+      "8"
+   },
+   {
+      "hamoopi_shadows",
+      "Character Shadows",
+      "Draw translucent ground shadows under the fighters.",
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "hamoopi_audio_quality",
+      "Audio Quality",
+      "High synthesizes every sample. Low synthesizes every other sample and holds it. Off skips sound synthesis entirely.",
+      {
+         { "high", "High" },
+         { "low",  "Low" },
+         { "off",  "Off" },
+         { NULL, NULL },
+      },
+      "high"
+   },
+   {
+      "hamoopi_frameskip",
+      "Frame Skip",
+      "Run the game logic every frame but only draw one frame out of N+1.",
+      {
+         { "0", NULL },
+         { "1", NULL },
+         { "2", NULL },
+         { "3", NULL },
+         { NULL, NULL },
+      },
+      "0"
+   },
+   {
+      "hamoopi_pipeline",
+      "Threaded Simulation",
+      "Simulate the next frame on a second thread while the current one is drawn. Adds one frame of input latency; while run-ahead is active frames are run serially instead.",
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "hamoopi_sprite_animations",
+      "Sprite Animations",
+      "Draw fighters with their animated sprites. When disabled, simple shapes are drawn. Also toggled in game with SELECT+START.",
+      {
+         { "enabled",  NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "enabled"
+   },
+   {
+      "hamoopi_debug_boxes",
+      "Show Collision Boxes",
+      "Draw body, hurt, hit and clash boxes. Also toggled in game with SELECT.",
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "hamoopi_perf_overlay",
+      "Performance Overlay",
+      "Show the time spent per frame in the core.",
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   { NULL, NULL, NULL, {{ NULL, NULL }}, NULL },
+};
+
+/*
+ ********************************
+ * Functions
+ ********************************
+ */
+
+/* Uses RETRO_ENVIRONMENT_SET_CORE_OPTIONS when the frontend supports it,
+ * otherwise builds the legacy "Description; value1|value2" variables
+ * from the same definitions. */
+static void libretro_set_core_options(retro_environment_t environ_cb)
+{
+   unsigned version = 0;
+
+   if (!environ_cb)
+      return;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_CORE_OPTIONS_VERSION, &version) && (version >= 1))
+   {
+      environ_cb(RETRO_ENVIRONMENT_SET_CORE_OPTIONS, (void*)option_defs_us);
+      return;
+   }
+
+   size_t num_options = 0;
+   while (option_defs_us[num_options].key)
+      num_options++;
+
+   struct retro_variable* variables = (struct retro_variable*)calloc(num_options + 1, sizeof(struct retro_variable));
+   char** values_buf = (char**)calloc(num_options, sizeof(char*));
+   if (!variables || !values_buf)
+      goto error;
+
+   for (size_t i = 0; i < num_options; i++)
+   {
+      const char* key = option_defs_us[i].key;
+      const char* desc = option_defs_us[i].desc;
+      const char* default_value = option_defs_us[i].default_value;
+      struct retro_core_option_value* values = option_defs_us[i].values;
+      size_t buf_len = 3;
+      size_t default_index = 0;
+      size_t num_values = 0;
+
+      /* Default value goes first, as the frontend expects */
+      while (values[num_values].value)
+      {
+         if (default_value && strcmp(values[num_values].value, default_value) == 0)
+            default_index = num_values;
+         buf_len += strlen(values[num_values].value);
+         num_values++;
+      }
+      buf_len += num_values - 1 + strlen(desc);
+
+      values_buf[i] = (char*)calloc(buf_len, sizeof(char));
+      if (!values_buf[i])
+         goto error;
+
+      strcpy(values_buf[i], desc);
+      strcat(values_buf[i], "; ");
+      strcat(values_buf[i], values[default_index].value);
+      for (size_t j = 0; j < num_values; j++)
+      {
+         if (j == default_index)
+            continue;
+         strcat(values_buf[i], "|");
+         strcat(values_buf[i], values[j].value);
+      }
+
+      variables[i].key = key;
+      variables[i].value = values_buf[i];
+   }
+
+   environ_cb(RETRO_ENVIRONMENT_SET_VARIABLES, variables);
+
+error:
+   if (values_buf)
+   {
+      for (size_t i = 0; i < num_options; i++)
+         free(values_buf[i]);
+      free(values_buf);
+   }
+   free(variables);
+}
+
+#endif
@@ -34,7 +34,17 @@
 
 #include <allegro.h>
 #include <stdio.h>
+#include <stdint.h>
 #include <math.h>
+#include "hamoopi_scaler.h"
+#include "hamoopi_textcache.h"
+#include "hamoopi_fixed.h"
+#include "hamoopi_pool.h"
+#include "hamoopi_input.h"
+#include "hamoopi_bands.h"
+#include "hamoopi_blend.h"
+#include "hamoopi_loader.h"
+#include "hamoopi_stages.h"
 
 #define P1_UP     ( key[ p1_up     ] )
 #define P1_DOWN   ( key[ p1_down   ] )
@@ -69,13 +79,22 @@
 char versao[45]="HAMOOPI v.001A";
 
 int sair=0; void sair_allegro() {sair=1;}
-int timer=0; void tempo() {timer++;} float delay=0;
+volatile int timer=0; void tempo() {timer++;} //relogio de parede (interrupt), so alimenta o passo fixo
+int LogicTick=0; //relogio da logica: avanca 1 vez por quadro simulado; animacoes e estados usam ele, nunca o timer
+int LogicAcc=1; int LogicTimerLido=0; //passo fixo: quadros de logica devidos pelo relogio / ultimo timer lido
+int TurboMode=0; //TAB segurado: roda LOGIC_TURBO quadros de logica por tick do relogio
+#define LOGIC_TURBO 4
+#define LOGIC_MAX_ATRASO 8 //maquina lenta: recupera no maximo 8 quadros sem apresentar, o resto e descartado
 int Horas=0; int Minutos=0; int Segundos=0;
 int timermenus=-1;
 int Ctrl_FPS=60;
 int WindowResNumber = 2;
 int WindowResX = 640;
 int WindowResY = 480;
+int FiltroSaida = 0; //escala final: 0 nearest, 1 bilinear, 2 scale2x
+hamoopi_scaler_t Escalador;
+BITMAP *TelaSaida = NULL; //buffer no tamanho da janela, usado pelo Escalador
+hamoopi_bands_t Bandas; //threads que dividem as operacoes de tela inteira em faixas horizontais
 
 int ativa_especial=0;
 int bta=0;
@@ -96,28 +115,39 @@ void zeraListaDeInputs();
 void MovSlots_P1();
 void MovSlots_P2();
 void LOAD_PLAYERS();
-void New_HitBox(int Qtde_HitBoxes);
+void New_HitBox();
 void New_Fireball(int Player);
 void PLAYER_STATE(int Player, int State, int AnimIndex, int P1_QtdeFrames);
 void AddTableAtlas(int PlayerInd, int State, int AnimIndex, int TotImg);
+int LinhaDoAtlas(int PlayerInd, int State, int AnimIndex);
+void MontaTabelaDeGolpes(int PlayerInd);
 void ED_inicializar();
 void ED_save_charini();
 void ED_load_charini();
 void ED_load_inputs(int ED_STATE);
+void Cam_Update(BITMAP *dst);
+int Cam_X(float x);
+int Cam_Y(float y);
+void Cam_Draw_BG(BITMAP *dst, BITMAP *bg);
+void Cam_Draw_Sprite(BITMAP *dst, BITMAP *spr, float x, float y, float zoom, int flip);
+void Cam_Draw_Trans_Sprite(BITMAP *dst, BITMAP *spr, float x, float y, int alpha);
+void Cam_Executa();
+int Cam_Lista(BITMAP *dst, BITMAP *spr);
+void Cam_Grava(BITMAP *dst, int Tipo, BITMAP *spr, int sx, int sy, int sw, int sh, int dx, int dy, int dw, int dh, int flip, int alpha);
+int HUD_Checa(struct HUDWidgetDEF *W, int x, int y, int w, int h, int *Chave, int Qtde);
+void HUD_Desenha(BITMAP *dst, struct HUDWidgetDEF *W);
+void HUD_Invalida();
+void Tela_Limpa(BITMAP *dst);
+void Tela_Sprite_Trans(BITMAP *dst, BITMAP *spr, int x, int y, int alpha);
+void Tela_Escurece(BITMAP *dst, int w, int h, int alpha);
+void Apresenta_Tela(BITMAP *src);
+void Relogio_Acumula();
+void Avisa_Arquivos_Faltando(int Erro);
 
 //DECLARACOES DE STRUCTS E VARIAVEIS
-struct HitSparkDEF {
-int x;
-int y;
-int Type; //991, 992, 993, 994, 995
-int StartFrame;
-int FrameTime;
-int IndexAnim;
-int TotalFrames;
-int QtdeFrames;
-int XAlign;
-int YAlign;
-}; struct HitSparkDEF HitSpark[99];
+//HitSparks ficam num pool: type = 991..994, param = alinhamento (X e Y)
+#define MAX_HITSPARKS 256
+hamoopi_pool_t HitSparks;
 
 struct FireballsDEF {
 BITMAP *Spr;
@@ -185,6 +215,9 @@ int TableAtlas[501][51];
 		[0][] other_Color
 		[0][] other_HitStack
 	--------------------*/
+int LinhaAtlas[1000][30]; //[State][Anim] -> linha do TableAtlas (0 se nao houver imagem)
+int ForcaDoState[1000]; //forca do golpe por State: 1 fraco, 2 medio, 3 forte, 0 nao altera
+int MomentoDoState[1000]; //1 em pe, 2 abaixado, 3 pulando, 51/52/53 hurt, 9 defesa
 int Special_Inputs_c[10][17]; //comandos direcionais
 int Special_Inputs_b[10][17]; //botoes
 int Special_Inputs[10][17]; //input combinado (dir+bt)
@@ -224,13 +257,13 @@ int Largura;
 int ConstanteY;
 int Altura_100;
 int Largura_100;
-float Hspeed;
-float Vspeed;
-float Hspeed_temp;
-float Vspeed_temp;
-float Friction;
-float Gravity;
-float Gravity_temp;
+hamoopi_sim_t Hspeed;
+hamoopi_sim_t Vspeed;
+hamoopi_sim_t Hspeed_temp;
+hamoopi_sim_t Vspeed_temp;
+hamoopi_sim_t Friction;
+hamoopi_sim_t Gravity;
+hamoopi_sim_t Gravity_temp;
 float Energy;
 int ChangeDamage;
 int EnergyChange;
@@ -252,10 +285,10 @@ int ChangeState;
 int Freeze;
 int Color;
 int TempoPulo;
-float other_Hspeed;
-float other_Vspeed;
-float other_Friction;
-float other_Gravity;
+hamoopi_sim_t other_Hspeed;
+hamoopi_sim_t other_Vspeed;
+hamoopi_sim_t other_Friction;
+hamoopi_sim_t other_Gravity;
 int other_Energy;
 int other_EnergyChange;
 int other_Special;
@@ -268,26 +301,43 @@ int other_ChangeState;
 int other_Freeze;
 int other_Color;
 int other_TempoPulo;
-int key_UP_pressed, key_UP_hold, key_UP_released, key_UP_status;
-int key_DOWN_pressed, key_DOWN_hold, key_DOWN_released, key_DOWN_status;
-int key_LEFT_pressed, key_LEFT_hold, key_LEFT_released, key_LEFT_status;
-int key_RIGHT_pressed, key_RIGHT_hold, key_RIGHT_released, key_RIGHT_status;
-int key_BT1_pressed, key_BT1_hold, key_BT1_released, key_BT1_status;
-int key_BT2_pressed, key_BT2_hold, key_BT2_released, key_BT2_status;
-int key_BT3_pressed, key_BT3_hold, key_BT3_released, key_BT3_status;
-int key_BT4_pressed, key_BT4_hold, key_BT4_released, key_BT4_status;
-int key_BT5_pressed, key_BT5_hold, key_BT5_released, key_BT5_status;
-int key_BT6_pressed, key_BT6_hold, key_BT6_released, key_BT6_status;
-int key_SELECT_pressed, key_SELECT_hold, key_SELECT_released, key_SELECT_status;
-int key_START_pressed, key_START_hold, key_START_released, key_START_status;
-int key_W_pressed, key_W_hold, key_W_released, key_W_status;
-int key_A_pressed, key_A_hold, key_A_released, key_A_status;
-int key_S_pressed, key_S_hold, key_S_released, key_S_status;
-int key_D_pressed, key_D_hold, key_D_released, key_D_status;
+hamoopi_input_t Teclas; //estado dos botoes, bits TECLA_*
 int Hbox[2][18][4]; //Player, Hit/HurtBox, (x1,y1,x2,y2)
 int Align[2][999][2]; //Player, State, (XAlign, YAlign)
 }; struct PlayerDEF P[3];
 
+//widgets do HUD: desenhados uma vez em cache e reaproveitados enquanto a Chave nao muda
+struct HUDWidgetDEF {
+BITMAP *Cache;
+int x;
+int y;
+int Chave[8];
+int Sujo;
+}; struct HUDWidgetDEF HUD_Energia, HUD_Relogio, HUD_Special;
+
+//lista de desenho da camera: em 32bpp cenario, sombras, players, magias e hitsparks sao
+//gravados aqui e desenhados de uma vez por Cam_Executa, cada faixa da tela recortando a lista
+#define CAM_MAX_CMDS 64
+#define CAM_LIMPA  0
+#define CAM_FUNDO  1
+#define CAM_SPRITE 2
+struct CamCmdDEF {
+int Tipo;
+BITMAP *Spr;
+int sx; int sy; int sw; int sh; //retangulo de origem
+int dx; int dy; int dw; int dh; //retangulo de destino, sem recorte
+int cx1; int cx2; int cy1; int cy2; //destino recortado pela area de clip
+int Mapa; //primeira coluna de origem em Cam_Colunas
+int Mascara; //cor transparente do sprite, -1 no cenario (copia tudo)
+int Alpha; //-1 solido, 0..255 transparente
+int Direto; //1:1 sem espelhar: as colunas de origem sao contiguas
+}; struct CamCmdDEF Cam_Cmd[CAM_MAX_CMDS];
+int Cam_Qtde=0;
+BITMAP *Cam_Destino=NULL;
+int *Cam_Colunas=NULL; int Cam_Colunas_Qtde=0; int Cam_Colunas_Tam=0;
+int *Cam_Mapa=NULL; int Cam_Mapa_Tam=0; //colunas de origem do sprite desenhado fora da lista
+uint32_t *Cam_Linhas=NULL; int Cam_Linhas_Larg=0; //uma linha de rascunho por faixa, da largura do maior destino
+
 //permite a config de teclas
 int p1_up, p2_up;
 int p1_down, p2_down;
@@ -301,6 +351,11 @@ int p1_bt5, p2_bt5;
 int p1_bt6, p2_bt6;
 int p1_select, p2_select;
 int p1_start, p2_start;
+//bits do estado das teclas (hamoopi_input.h)
+enum { TECLA_UP=0, TECLA_DOWN, TECLA_LEFT, TECLA_RIGHT, TECLA_BT1, TECLA_BT2, TECLA_BT3, TECLA_BT4, TECLA_BT5, TECLA_BT6, TECLA_SELECT, TECLA_START, TOTAL_TECLAS };
+enum { SIS_F1=0, SIS_F2, SIS_F3, SIS_F4, SIS_W, SIS_A, SIS_S, SIS_D, SIS_MOUSE_L, SIS_MOUSE_R };
+int *TeclasP1[TOTAL_TECLAS]={ &p1_up, &p1_down, &p1_left, &p1_right, &p1_bt1, &p1_bt2, &p1_bt3, &p1_bt4, &p1_bt5, &p1_bt6, &p1_select, &p1_start };
+int *TeclasP2[TOTAL_TECLAS]={ &p2_up, &p2_down, &p2_left, &p2_right, &p2_bt1, &p2_bt2, &p2_bt3, &p2_bt4, &p2_bt5, &p2_bt6, &p2_select, &p2_start };
 
 int op_sound_volume=255;
 int op_sfx_volume=255;
@@ -348,7 +403,6 @@ int ModoHistoria=0;
 int difficulty=3;
 int ModoMapa=0;
 int ModoMapaTimerAnim=0;
-int Qtde_HitBox=0;
 char Lista_de_Personagens_Instalados[9][50];
 char Lista_de_Personagens_ArcadeMode[9][50];
 char Lista_de_Cenarios_Instalados[9][50];
@@ -364,16 +418,13 @@ int MapPosY;
 
 int desabilita_players=0;
 unsigned int HitPauseKO=500;
-int key_Mouse_L_pressed, key_Mouse_L_hold, key_Mouse_L_released, key_Mouse_L_status;
-int key_Mouse_R_pressed, key_Mouse_R_hold, key_Mouse_R_released, key_Mouse_R_status;
-int key_F1_pressed, key_F1_hold, key_F1_released, key_F1_status;
-int key_F2_pressed, key_F2_hold, key_F2_released, key_F2_status;
-int key_F3_pressed, key_F3_hold, key_F3_released, key_F3_status;
-int key_F4_pressed, key_F4_hold, key_F4_released, key_F4_status;
+int PausaKO=0; //congelamento do KO em quadros de logica; HitPauseKO e em ms
+hamoopi_input_t TeclasSistema; //F1-F4, WASD do editor e mouse, bits SIS_*
 int AlturaPiso=0; int MeioDaTela=0;
 float VScreen_x=0; float VScreen_y=0;
 float VScreen_x2=0; float VScreen_y2=0;
 float VScreen_w=640; float VScreen_h=480;
+float Cam_EscalaX=1; float Cam_EscalaY=1; //fator mundo(2X) -> tela de apresentacao
 int VScreen_FatorZoom=0;
 int Zoom_eixo=0;
 int ZoomMaximoAtingido=0;
@@ -585,11 +636,11 @@ allegro_init(); install_timer(); install_keyboard(); install_mouse(); set_color_
 //set_gfx_mode() é declarado logo abaixo, apos carregar dados do SETUP.INI
 install_sound(DIGI_AUTODETECT, MIDI_AUTODETECT, NULL);
 int ModoFullscreen=0;
-FONT *font_debug = load_font("data/system/font_debug.pcx", NULL, NULL);
-FONT *font_10    = load_font("data/system/font_10.pcx"   , NULL, NULL);
-FONT *font_19    = load_font("data/system/font_19.pcx"   , NULL, NULL);
-FONT *font_20    = load_font("data/system/font_20.pcx"   , NULL, NULL);
-FONT *font_30    = load_font("data/system/font_30.pcx"   , NULL, NULL);
+FONT *font_debug = NULL;
+FONT *font_10    = NULL;
+FONT *font_19    = NULL;
+FONT *font_20    = NULL;
+FONT *font_30    = NULL;
 install_int_ex(tempo, BPS_TO_TIMER(60)); //60fps
 set_window_title("HAMOOPI is Loading... Please wait :) ");
 set_close_button_callback( sair_allegro );
@@ -599,8 +650,7 @@ set_close_button_callback( sair_allegro );
 //Snes [256x224]
 //CapcomCPS1 [384x224]
 //NeoGeo [320x224]
-BITMAP *bg_test = create_bitmap(1280,960); //tamanho max do cenario
-BITMAP *bg_hamoopi[9];
+BITMAP *bg_test = NULL; //cenario em uso, carregado quando a luta comeca
 
 //carrega os dados do setup.ini
 set_config_file("SETUP.ini");
@@ -617,6 +667,14 @@ op_sfx_volume = get_config_int ( "CONFIG" , "sfx_volume",  255 ) ;
 //resolucao de tela no modo windowed
 WindowResX = get_config_int ( "CONFIG" , "window_res_x",  640 ) ;
 WindowResY = get_config_int ( "CONFIG" , "window_res_y",  480 ) ;
+//filtro utilizado para escalar a tela de 640x480 para a resolucao da janela
+FiltroSaida = get_config_int ( "CONFIG" , "output_filter",  0 ) ;
+hamoopi_scaler_init(&Escalador);
+//threads de desenho em faixas, 0 = uma por nucleo
+hamoopi_bands_init(&Bandas, get_config_int ( "CONFIG" , "render_threads",  0 ) );
+//memoria para cenarios ja carregados, em MB
+hamoopi_stages_set_budget( (size_t)get_config_int ( "CONFIG" , "stage_cache_mb",  8 ) << 20 );
+hamoopi_pool_init(&HitSparks, MAX_HITSPARKS);
 //define o ResWindowNumber
 if(WindowResX== 320 && WindowResY==240) WindowResNumber=1;
 if(WindowResX== 640 && WindowResY==480) WindowResNumber=2;
@@ -640,18 +698,10 @@ char strtemp[9]="";
 sprintf(strtemp, "bg%i", ind);
 strcpy(Lista_de_Cenarios_Instalados[ind], (char *)get_config_string("BACKGROUNDS", strtemp, ""));
 }
-//abastece Atlas de cenario
-char bg_choice[25]="";
-for(int ind=1;ind<=8;ind++)
-{
-sprintf(bg_choice, "data/backgrounds/%s/000_00.pcx", Lista_de_Cenarios_Instalados[ind]);
-bg_hamoopi[ind]= load_bitmap(bg_choice, NULL);
-}
 
-BITMAP *bufferx = create_bitmap(2560,1920); //layer do cenario e personagens escalonados
+BITMAP *bufferx = create_bitmap(640,480); //layer dos menus; na gameplay a camera desenha direto em LayerHUDa
 BITMAP *LayerHUD = create_bitmap(WindowResX,WindowResY); //layer das barras de energia
 BITMAP *LayerHUDa = create_bitmap(640,480); //layer das barras de energia
-BITMAP *LayerHUDb = create_bitmap(WindowResX,WindowResY); //layer das barras de energia
 
 for(int ind=0;ind<=500;ind++){
 P[1].SprAtlas[ind]= create_bitmap(480,480); //reserva memoria para sprites dos players
@@ -673,159 +723,122 @@ BITMAP *ED_Mini       = create_bitmap(32,32);
 BITMAP *P1_Spr_Aux    = create_bitmap(480,480); //sprite auxiliar utilizado na funcao de animacao
 BITMAP *P2_Spr_Aux    = create_bitmap(480,480); //sprite auxiliar utilizado na funcao de animacao
 BITMAP *ED_Spr_Aux    = create_bitmap(480,480); //sprite auxiliar utilizado na funcao de animacao
-BITMAP *HitSparkspr   = create_bitmap(260,260);
-BITMAP *HitSpark_Aux  = create_bitmap(130,130);
 BITMAP *P1_Pallete    = create_bitmap(32,10);
 BITMAP *P2_Pallete    = create_bitmap(32,10);
-clear_to_color(HitSparkspr , makecol(255, 0, 255));
-clear_to_color(HitSpark_Aux, makecol(255, 0, 255));
 clear_to_color(P1_Pallete  , makecol(255, 0, 255));
 clear_to_color(P2_Pallete  , makecol(255, 0, 255));
 
 int HamoopiError=0;
-BITMAP *GAME_logo            = load_bitmap("data/system/GAME_logo.pcx", NULL);            if (!GAME_logo)            { HamoopiError=1; }
-BITMAP *flag_BR              = load_bitmap("data/system/flag_BR.pcx", NULL);              if (!flag_BR)              { HamoopiError=1; }
-BITMAP *sel_mark_p1          = load_bitmap("data/system/sel_mark_p1.pcx", NULL);          if (!sel_mark_p1)          { HamoopiError=1; }
-BITMAP *sel_mark_p2          = load_bitmap("data/system/sel_mark_p2.pcx", NULL);          if (!sel_mark_p2)          { HamoopiError=1; }
-BITMAP *flag_US              = load_bitmap("data/system/flag_US.pcx", NULL);              if (!flag_US)              { HamoopiError=1; }
-BITMAP *SELECT_CHARS         = load_bitmap("data/system/SELECT_CHARS.pcx", NULL);         if (!SELECT_CHARS)         { HamoopiError=1; }
-BITMAP *VS_SCREEN            = load_bitmap("data/system/VS_SCREEN.pcx", NULL);            if (!VS_SCREEN)            { HamoopiError=1; }
-BITMAP *vs_icon              = load_bitmap("data/system/vs_icon.pcx", NULL);              if (!vs_icon)              { HamoopiError=1; }
-BITMAP *SELECT_BG            = load_bitmap("data/system/SELECT_BG.pcx", NULL);            if (!SELECT_BG)            { HamoopiError=1; }
-BITMAP *donation             = load_bitmap("data/system/donation.pcx", NULL);             if (!donation)             { HamoopiError=1; }
-BITMAP *spr_p1_cursor        = load_bitmap("data/system/spr_p1_cursor.pcx", NULL);        if (!spr_p1_cursor)        { HamoopiError=1; }
-BITMAP *spr_p2_cursor        = load_bitmap("data/system/spr_p2_cursor.pcx", NULL);        if (!spr_p2_cursor)        { HamoopiError=1; }
-BITMAP *spr_cursor_historia  = load_bitmap("data/system/spr_cursor_historia.pcx", NULL);  if (!spr_cursor_historia)  { HamoopiError=1; }
-BITMAP *spr_cursor_vazio     = load_bitmap("data/system/spr_cursor_vazio.pcx", NULL);     if (!spr_cursor_vazio)     { HamoopiError=1; }
-BITMAP *spr_ponteiro         = load_bitmap("data/system/spr_ponteiro.pcx", NULL);         if (!spr_ponteiro)         { HamoopiError=1; }
-BITMAP *spr_menu_icon        = load_bitmap("data/system/spr_menu_icon.pcx", NULL);        if (!spr_menu_icon)        { HamoopiError=1; }
-BITMAP *GAME_intro           = load_bitmap("data/system/GAME_intro.pcx", NULL);           if (!GAME_intro)           { HamoopiError=1; }
-BITMAP *GAME_options         = load_bitmap("data/system/GAME_options.pcx", NULL);         if (!GAME_options)         { HamoopiError=1; }
-BITMAP *char_generic         = load_bitmap("data/system/char_generic.pcx", NULL);         if (!char_generic)         { HamoopiError=1; }
-BITMAP *char_generic2x       = load_bitmap("data/system/char_generic2x.pcx", NULL);       if (!char_generic2x)       { HamoopiError=1; }
-BITMAP *spr_mold_results     = load_bitmap("data/system/spr_mold_results.pcx", NULL);     if (!spr_mold_results)     { HamoopiError=1; }
-BITMAP *spr_result_perfect   = load_bitmap("data/system/spr_result_perfect.pcx", NULL);   if (!spr_result_perfect)   { HamoopiError=1; }
-BITMAP *spr_result_win       = load_bitmap("data/system/spr_result_win.pcx", NULL);       if (!spr_result_win)       { HamoopiError=1; }
-BITMAP *spr_splash_round1    = load_bitmap("data/system/spr_splash_round1.pcx", NULL);    if (!spr_splash_round1)    { HamoopiError=1; }
-BITMAP *spr_splash_round2    = load_bitmap("data/system/spr_splash_round2.pcx", NULL);    if (!spr_splash_round2)    { HamoopiError=1; }
-BITMAP *spr_splash_round3    = load_bitmap("data/system/spr_splash_round3.pcx", NULL);    if (!spr_splash_round3)    { HamoopiError=1; }
-BITMAP *spr_splash_round4    = load_bitmap("data/system/spr_splash_round4.pcx", NULL);    if (!spr_splash_round4)    { HamoopiError=1; }
-BITMAP *spr_splash_round5    = load_bitmap("data/system/spr_splash_round5.pcx", NULL);    if (!spr_splash_round5)    { HamoopiError=1; }
-BITMAP *spr_splash_fight     = load_bitmap("data/system/spr_splash_fight.pcx", NULL);     if (!spr_splash_fight)     { HamoopiError=1; }
-BITMAP *spr_splash_youwin    = load_bitmap("data/system/spr_splash_youwin.pcx", NULL);    if (!spr_splash_youwin)    { HamoopiError=1; }
-BITMAP *spr_splash_p1win     = load_bitmap("data/system/spr_splash_p1win.pcx", NULL);     if (!spr_splash_p1win)     { HamoopiError=1; }
-BITMAP *spr_splash_p2win     = load_bitmap("data/system/spr_splash_p2win.pcx", NULL);     if (!spr_splash_p2win)     { HamoopiError=1; }
-BITMAP *spr_splash_youlose   = load_bitmap("data/system/spr_splash_youlose.pcx", NULL);   if (!spr_splash_youlose)   { HamoopiError=1; }
-BITMAP *spr_splash_ko        = load_bitmap("data/system/spr_splash_ko.pcx", NULL);        if (!spr_splash_ko)        { HamoopiError=1; }
-BITMAP *spr_splash_perfect   = load_bitmap("data/system/spr_splash_perfect.pcx", NULL);   if (!spr_splash_perfect)   { HamoopiError=1; }
-BITMAP *spr_splash_draw      = load_bitmap("data/system/spr_splash_draw.pcx", NULL);      if (!spr_splash_draw)      { HamoopiError=1; }
-BITMAP *spr_splash_time_over = load_bitmap("data/system/spr_splash_time_over.pcx", NULL); if (!spr_splash_time_over) { HamoopiError=1; }
-BITMAP *bt_joystick          = load_bitmap("data/system/bt_joystick.pcx", NULL);          if (!bt_joystick)          { HamoopiError=1; }
-BITMAP *ed_mode1_on          = load_bitmap("data/system/ed_mode1_on.pcx", NULL);          if (!ed_mode1_on)          { HamoopiError=1; }
-BITMAP *ed_mode2_on          = load_bitmap("data/system/ed_mode2_on.pcx", NULL);          if (!ed_mode2_on)          { HamoopiError=1; }
-BITMAP *ed_mode1_off         = load_bitmap("data/system/ed_mode1_off.pcx", NULL);         if (!ed_mode1_off)         { HamoopiError=1; }
-BITMAP *ed_mode2_off         = load_bitmap("data/system/ed_mode2_off.pcx", NULL);         if (!ed_mode2_off)         { HamoopiError=1; }
-BITMAP *bt_reset_input       = load_bitmap("data/system/bt_reset_input.pcx", NULL);       if (!bt_reset_input)       { HamoopiError=1; }
-BITMAP *bt_up_1              = load_bitmap("data/system/bt_up_1.pcx", NULL);              if (!bt_up_1)              { HamoopiError=1; }
-BITMAP *bt_up_2              = load_bitmap("data/system/bt_up_2.pcx", NULL);              if (!bt_up_2)              { HamoopiError=1; }
-BITMAP *bt_up_3              = load_bitmap("data/system/bt_up_3.pcx", NULL);              if (!bt_up_3)              { HamoopiError=1; }
-BITMAP *bt_down_1            = load_bitmap("data/system/bt_down_1.pcx", NULL);            if (!bt_down_1)            { HamoopiError=1; }
-BITMAP *bt_down_2            = load_bitmap("data/system/bt_down_2.pcx", NULL);            if (!bt_down_2)            { HamoopiError=1; }
-BITMAP *bt_down_3            = load_bitmap("data/system/bt_down_3.pcx", NULL);            if (!bt_down_3)            { HamoopiError=1; }
-BITMAP *bt_left_1            = load_bitmap("data/system/bt_left_1.pcx", NULL);            if (!bt_left_1)            { HamoopiError=1; }
-BITMAP *bt_left_2            = load_bitmap("data/system/bt_left_2.pcx", NULL);            if (!bt_left_2)            { HamoopiError=1; }
-BITMAP *bt_left_3            = load_bitmap("data/system/bt_left_3.pcx", NULL);            if (!bt_left_3)            { HamoopiError=1; }
-BITMAP *bt_right_1           = load_bitmap("data/system/bt_right_1.pcx", NULL);           if (!bt_right_1)           { HamoopiError=1; }
-BITMAP *bt_right_2           = load_bitmap("data/system/bt_right_2.pcx", NULL);           if (!bt_right_2)           { HamoopiError=1; }
-BITMAP *bt_right_3           = load_bitmap("data/system/bt_right_3.pcx", NULL);           if (!bt_right_3)           { HamoopiError=1; }
-BITMAP *bt_1                 = load_bitmap("data/system/bt_1.pcx", NULL);                 if (!bt_1)                 { HamoopiError=1; }
-BITMAP *bt_2                 = load_bitmap("data/system/bt_2.pcx", NULL);                 if (!bt_2)                 { HamoopiError=1; }
-BITMAP *bt_3                 = load_bitmap("data/system/bt_3.pcx", NULL);                 if (!bt_3)                 { HamoopiError=1; }
-BITMAP *bt_ss_1              = load_bitmap("data/system/bt_ss_1.pcx", NULL);              if (!bt_ss_1)              { HamoopiError=1; }
-BITMAP *bt_ss_2              = load_bitmap("data/system/bt_ss_2.pcx", NULL);              if (!bt_ss_2)              { HamoopiError=1; }
-BITMAP *bt_ss_3              = load_bitmap("data/system/bt_ss_3.pcx", NULL);              if (!bt_ss_3)              { HamoopiError=1; }
-BITMAP *spr_input_0          = load_bitmap("data/system/spr_input_0.pcx", NULL);          if (!spr_input_0)          { HamoopiError=1; }
-BITMAP *spr_input_1          = load_bitmap("data/system/spr_input_1.pcx", NULL);          if (!spr_input_1)          { HamoopiError=1; }
-BITMAP *spr_input_2          = load_bitmap("data/system/spr_input_2.pcx", NULL);          if (!spr_input_2)          { HamoopiError=1; }
-BITMAP *spr_input_3          = load_bitmap("data/system/spr_input_3.pcx", NULL);          if (!spr_input_3)          { HamoopiError=1; }
-BITMAP *spr_input_4          = load_bitmap("data/system/spr_input_4.pcx", NULL);          if (!spr_input_4)          { HamoopiError=1; }
-BITMAP *spr_input_5          = load_bitmap("data/system/spr_input_5.pcx", NULL);          if (!spr_input_5)          { HamoopiError=1; }
-BITMAP *spr_input_6          = load_bitmap("data/system/spr_input_6.pcx", NULL);          if (!spr_input_6)          { HamoopiError=1; }
-BITMAP *spr_input_7          = load_bitmap("data/system/spr_input_7.pcx", NULL);          if (!spr_input_7)          { HamoopiError=1; }
-BITMAP *spr_input_8          = load_bitmap("data/system/spr_input_8.pcx", NULL);          if (!spr_input_8)          { HamoopiError=1; }
-BITMAP *spr_input_9          = load_bitmap("data/system/spr_input_9.pcx", NULL);          if (!spr_input_9)          { HamoopiError=1; }
-BITMAP *spr_input_10         = load_bitmap("data/system/spr_input_10.pcx", NULL);         if (!spr_input_10)         { HamoopiError=1; }
-BITMAP *spr_input_11         = load_bitmap("data/system/spr_input_11.pcx", NULL);         if (!spr_input_11)         { HamoopiError=1; }
-BITMAP *spr_input_12         = load_bitmap("data/system/spr_input_12.pcx", NULL);         if (!spr_input_12)         { HamoopiError=1; }
-BITMAP *spr_input_13         = load_bitmap("data/system/spr_input_13.pcx", NULL);         if (!spr_input_13)         { HamoopiError=1; }
-BITMAP *spr_input_14         = load_bitmap("data/system/spr_input_14.pcx", NULL);         if (!spr_input_14)         { HamoopiError=1; }
-BITMAP *spr_input_15         = load_bitmap("data/system/spr_input_15.pcx", NULL);         if (!spr_input_15)         { HamoopiError=1; }
-BITMAP *spr_input_16         = load_bitmap("data/system/spr_input_16.pcx", NULL);         if (!spr_input_16)         { HamoopiError=1; }
-BITMAP *spr_input_17         = load_bitmap("data/system/spr_input_17.pcx", NULL);         if (!spr_input_17)         { HamoopiError=1; }
-BITMAP *spr_bg_bar           = load_bitmap("data/system/spr_bg_bar.pcx", NULL);           if (!spr_bg_bar)           { HamoopiError=1; }
-BITMAP *spr_energy_bar       = load_bitmap("data/system/spr_energy_bar.pcx", NULL);       if (!spr_energy_bar)       { HamoopiError=1; }
-BITMAP *spr_energy_bar_full  = load_bitmap("data/system/spr_energy_bar_full.pcx", NULL);  if (!spr_energy_bar_full)  { HamoopiError=1; }
-BITMAP *spr_energy_red_bar   = load_bitmap("data/system/spr_energy_red_bar.pcx", NULL);   if (!spr_energy_red_bar)   { HamoopiError=1; }
-BITMAP *spr_energy_red_bar_full = load_bitmap("data/system/spr_energy_red_bar_full.pcx", NULL); if (!spr_energy_red_bar_full) { HamoopiError=1; }
-BITMAP *spr_bg_bar_sp        = load_bitmap("data/system/spr_bg_bar_sp.pcx", NULL);        if (!spr_bg_bar_sp)        { HamoopiError=1; }
-BITMAP *spr_bg_energy_bar_sp = load_bitmap("data/system/spr_bg_energy_bar_sp.pcx", NULL); if (!spr_bg_energy_bar_sp) { HamoopiError=1; }
+BITMAP *GAME_logo            = NULL;
+BITMAP *flag_BR              = NULL;
+BITMAP *sel_mark_p1          = NULL;
+BITMAP *sel_mark_p2          = NULL;
+BITMAP *flag_US              = NULL;
+BITMAP *SELECT_CHARS         = NULL;
+BITMAP *VS_SCREEN            = NULL;
+BITMAP *vs_icon              = NULL;
+BITMAP *SELECT_BG            = NULL;
+BITMAP *donation             = NULL;
+BITMAP *spr_p1_cursor        = NULL;
+BITMAP *spr_p2_cursor        = NULL;
+BITMAP *spr_cursor_historia  = NULL;
+BITMAP *spr_cursor_vazio     = NULL;
+BITMAP *spr_ponteiro         = NULL;
+BITMAP *spr_menu_icon        = NULL;
+BITMAP *GAME_intro           = NULL;
+BITMAP *GAME_options         = NULL;
+BITMAP *char_generic         = NULL;
+BITMAP *char_generic2x       = NULL;
+BITMAP *spr_mold_results     = NULL;
+BITMAP *spr_result_perfect   = NULL;
+BITMAP *spr_result_win       = NULL;
+BITMAP *spr_splash_round1    = NULL;
+BITMAP *spr_splash_round2    = NULL;
+BITMAP *spr_splash_round3    = NULL;
+BITMAP *spr_splash_round4    = NULL;
+BITMAP *spr_splash_round5    = NULL;
+BITMAP *spr_splash_fight     = NULL;
+BITMAP *spr_splash_youwin    = NULL;
+BITMAP *spr_splash_p1win     = NULL;
+BITMAP *spr_splash_p2win     = NULL;
+BITMAP *spr_splash_youlose   = NULL;
+BITMAP *spr_splash_ko        = NULL;
+BITMAP *spr_splash_perfect   = NULL;
+BITMAP *spr_splash_draw      = NULL;
+BITMAP *spr_splash_time_over = NULL;
+BITMAP *bt_joystick          = NULL;
+BITMAP *ed_mode1_on          = NULL;
+BITMAP *ed_mode2_on          = NULL;
+BITMAP *ed_mode1_off         = NULL;
+BITMAP *ed_mode2_off         = NULL;
+BITMAP *bt_reset_input       = NULL;
+BITMAP *bt_up_1              = NULL;
+BITMAP *bt_up_2              = NULL;
+BITMAP *bt_up_3              = NULL;
+BITMAP *bt_down_1            = NULL;
+BITMAP *bt_down_2            = NULL;
+BITMAP *bt_down_3            = NULL;
+BITMAP *bt_left_1            = NULL;
+BITMAP *bt_left_2            = NULL;
+BITMAP *bt_left_3            = NULL;
+BITMAP *bt_right_1           = NULL;
+BITMAP *bt_right_2           = NULL;
+BITMAP *bt_right_3           = NULL;
+BITMAP *bt_1                 = NULL;
+BITMAP *bt_2                 = NULL;
+BITMAP *bt_3                 = NULL;
+BITMAP *bt_ss_1              = NULL;
+BITMAP *bt_ss_2              = NULL;
+BITMAP *bt_ss_3              = NULL;
+BITMAP *spr_input_0          = NULL;
+BITMAP *spr_input_1          = NULL;
+BITMAP *spr_input_2          = NULL;
+BITMAP *spr_input_3          = NULL;
+BITMAP *spr_input_4          = NULL;
+BITMAP *spr_input_5          = NULL;
+BITMAP *spr_input_6          = NULL;
+BITMAP *spr_input_7          = NULL;
+BITMAP *spr_input_8          = NULL;
+BITMAP *spr_input_9          = NULL;
+BITMAP *spr_input_10         = NULL;
+BITMAP *spr_input_11         = NULL;
+BITMAP *spr_input_12         = NULL;
+BITMAP *spr_input_13         = NULL;
+BITMAP *spr_input_14         = NULL;
+BITMAP *spr_input_15         = NULL;
+BITMAP *spr_input_16         = NULL;
+BITMAP *spr_input_17         = NULL;
+BITMAP *spr_bg_bar           = NULL;
+BITMAP *spr_energy_bar       = NULL;
+BITMAP *spr_energy_bar_full  = NULL;
+BITMAP *spr_energy_red_bar   = NULL;
+BITMAP *spr_energy_red_bar_full = NULL;
+BITMAP *spr_bg_bar_sp        = NULL;
+BITMAP *spr_bg_energy_bar_sp = NULL;
 BITMAP *spr_num[10];
-spr_num[0]=load_bitmap("data/system/spr_num_0.pcx",NULL); if (!spr_num[0]) { HamoopiError=1; }
-spr_num[1]=load_bitmap("data/system/spr_num_1.pcx",NULL); if (!spr_num[1]) { HamoopiError=1; }
-spr_num[2]=load_bitmap("data/system/spr_num_2.pcx",NULL); if (!spr_num[2]) { HamoopiError=1; }
-spr_num[3]=load_bitmap("data/system/spr_num_3.pcx",NULL); if (!spr_num[3]) { HamoopiError=1; }
-spr_num[4]=load_bitmap("data/system/spr_num_4.pcx",NULL); if (!spr_num[4]) { HamoopiError=1; }
-spr_num[5]=load_bitmap("data/system/spr_num_5.pcx",NULL); if (!spr_num[5]) { HamoopiError=1; }
-spr_num[6]=load_bitmap("data/system/spr_num_6.pcx",NULL); if (!spr_num[6]) { HamoopiError=1; }
-spr_num[7]=load_bitmap("data/system/spr_num_7.pcx",NULL); if (!spr_num[7]) { HamoopiError=1; }
-spr_num[8]=load_bitmap("data/system/spr_num_8.pcx",NULL); if (!spr_num[8]) { HamoopiError=1; }
-spr_num[9]=load_bitmap("data/system/spr_num_9.pcx",NULL); if (!spr_num[9]) { HamoopiError=1; }
-BITMAP *edit_bt_blue         = load_bitmap("data/system/edit_bt_blue.pcx", NULL);         if (!edit_bt_blue)         { HamoopiError=1; }
-BITMAP *edit_bt_red          = load_bitmap("data/system/edit_bt_red.pcx", NULL);          if (!edit_bt_red)          { HamoopiError=1; }
-BITMAP *edit_bt_null         = load_bitmap("data/system/edit_bt_null.pcx", NULL);         if (!edit_bt_null)         { HamoopiError=1; }
-BITMAP *edit_bt_null0        = load_bitmap("data/system/edit_bt_null0.pcx", NULL);        if (!edit_bt_null0)        { HamoopiError=1; }
-BITMAP *edit_prevst          = load_bitmap("data/system/edit_prevst.pcx", NULL);          if (!edit_prevst)          { HamoopiError=1; }
-BITMAP *edit_nextst          = load_bitmap("data/system/edit_nextst.pcx", NULL);          if (!edit_nextst)          { HamoopiError=1; }
-BITMAP *edit_prevchar        = load_bitmap("data/system/edit_prevchar.pcx", NULL);        if (!edit_prevchar)        { HamoopiError=1; }
-BITMAP *edit_nextchar        = load_bitmap("data/system/edit_nextchar.pcx", NULL);        if (!edit_nextchar)        { HamoopiError=1; }
-BITMAP *edit_firstchar       = load_bitmap("data/system/edit_firstchar.pcx", NULL);       if (!edit_firstchar)       { HamoopiError=1; }
-BITMAP *edit_lastchar        = load_bitmap("data/system/edit_lastchar.pcx", NULL);        if (!edit_lastchar)        { HamoopiError=1; }
-BITMAP *spr_nao_implementado = load_bitmap("data/system/spr_nao_implementado.pcx", NULL); if (!spr_nao_implementado) { HamoopiError=1; }
-BITMAP *edit_playback        = load_bitmap("data/system/edit_playback.pcx", NULL);        if (!edit_playback)        { HamoopiError=1; }
-BITMAP *edit_pause           = load_bitmap("data/system/edit_pause.pcx", NULL);           if (!edit_pause)           { HamoopiError=1; }
-BITMAP *edit_bt_FrameTime    = load_bitmap("data/system/edit_bt_FrameTime.pcx", NULL);    if (!edit_bt_FrameTime)    { HamoopiError=1; }
-BITMAP *edit_bt_plus         = load_bitmap("data/system/edit_bt_plus.pcx", NULL);         if (!edit_bt_plus)         { HamoopiError=1; }
-BITMAP *edit_bt_minus        = load_bitmap("data/system/edit_bt_minus.pcx", NULL);        if (!edit_bt_minus)        { HamoopiError=1; }
-BITMAP *mouse                = load_bitmap("data/system/mouse.pcx", NULL);                if (!mouse)                { HamoopiError=1; }
-BITMAP *mouse2               = load_bitmap("data/system/mouse2.pcx", NULL);               if (!mouse2)               { HamoopiError=1; }
-BITMAP *save_file            = load_bitmap("data/system/save_file.pcx", NULL);            if (!save_file)            { HamoopiError=1; }
-BITMAP *bt_pivot             = load_bitmap("data/system/bt_pivot.pcx", NULL);             if (!bt_pivot)             { HamoopiError=1; }
-BITMAP *spr000_00            = load_bitmap("data/system/000_00.pcx", NULL);               if (!spr000_00)            { HamoopiError=1; }
-BITMAP *spr000_01            = load_bitmap("data/system/000_01.pcx", NULL);               if (!spr000_01)            { HamoopiError=1; }
-BITMAP *spr991_00            = load_bitmap("data/system/991_00.pcx", NULL);               if (!spr991_00)            { HamoopiError=1; }
-BITMAP *spr991_01            = load_bitmap("data/system/991_01.pcx", NULL);               if (!spr991_01)            { HamoopiError=1; }
-BITMAP *spr991_02            = load_bitmap("data/system/991_02.pcx", NULL);               if (!spr991_02)            { HamoopiError=1; }
-BITMAP *spr991_03            = load_bitmap("data/system/991_03.pcx", NULL);               if (!spr991_03)            { HamoopiError=1; }
-BITMAP *spr991_04            = load_bitmap("data/system/991_04.pcx", NULL);               if (!spr991_04)            { HamoopiError=1; }
-BITMAP *spr991_05            = load_bitmap("data/system/991_05.pcx", NULL);               if (!spr991_05)            { HamoopiError=1; }
-BITMAP *spr992_00            = load_bitmap("data/system/992_00.pcx", NULL);               if (!spr992_00)            { HamoopiError=1; }
-BITMAP *spr992_01            = load_bitmap("data/system/992_01.pcx", NULL);               if (!spr992_01)            { HamoopiError=1; }
-BITMAP *spr992_02            = load_bitmap("data/system/992_02.pcx", NULL);               if (!spr992_02)            { HamoopiError=1; }
-BITMAP *spr992_03            = load_bitmap("data/system/992_03.pcx", NULL);               if (!spr992_03)            { HamoopiError=1; }
-BITMAP *spr992_04            = load_bitmap("data/system/992_04.pcx", NULL);               if (!spr992_04)            { HamoopiError=1; }
-BITMAP *spr992_05            = load_bitmap("data/system/992_05.pcx", NULL);               if (!spr992_05)            { HamoopiError=1; }
-BITMAP *spr993_00            = load_bitmap("data/system/993_00.pcx", NULL);               if (!spr993_00)            { HamoopiError=1; }
-BITMAP *spr993_01            = load_bitmap("data/system/993_01.pcx", NULL);               if (!spr993_01)            { HamoopiError=1; }
-BITMAP *spr993_02            = load_bitmap("data/system/993_02.pcx", NULL);               if (!spr993_02)            { HamoopiError=1; }
-BITMAP *spr993_03            = load_bitmap("data/system/993_03.pcx", NULL);               if (!spr993_03)            { HamoopiError=1; }
-BITMAP *spr993_04            = load_bitmap("data/system/993_04.pcx", NULL);               if (!spr993_04)            { HamoopiError=1; }
-BITMAP *spr993_05            = load_bitmap("data/system/993_05.pcx", NULL);               if (!spr993_05)            { HamoopiError=1; }
-BITMAP *spr994_00            = load_bitmap("data/system/994_00.pcx", NULL);               if (!spr994_00)            { HamoopiError=1; }
-BITMAP *spr994_01            = load_bitmap("data/system/994_01.pcx", NULL);               if (!spr994_01)            { HamoopiError=1; }
-BITMAP *spr994_02            = load_bitmap("data/system/994_02.pcx", NULL);               if (!spr994_02)            { HamoopiError=1; }
-BITMAP *spr994_03            = load_bitmap("data/system/994_03.pcx", NULL);               if (!spr994_03)            { HamoopiError=1; }
-BITMAP *spr994_04            = load_bitmap("data/system/994_04.pcx", NULL);               if (!spr994_04)            { HamoopiError=1; }
-BITMAP *spr994_05            = load_bitmap("data/system/994_05.pcx", NULL);               if (!spr994_05)            { HamoopiError=1; }
+BITMAP *edit_bt_blue         = NULL;
+BITMAP *edit_bt_red          = NULL;
+BITMAP *edit_bt_null         = NULL;
+BITMAP *edit_bt_null0        = NULL;
+BITMAP *edit_prevst          = NULL;
+BITMAP *edit_nextst          = NULL;
+BITMAP *edit_prevchar        = NULL;
+BITMAP *edit_nextchar        = NULL;
+BITMAP *edit_firstchar       = NULL;
+BITMAP *edit_lastchar        = NULL;
+BITMAP *spr_nao_implementado = NULL;
+BITMAP *edit_playback        = NULL;
+BITMAP *edit_pause           = NULL;
+BITMAP *edit_bt_FrameTime    = NULL;
+BITMAP *edit_bt_plus         = NULL;
+BITMAP *edit_bt_minus        = NULL;
+BITMAP *mouse                = NULL;
+BITMAP *mouse2               = NULL;
+BITMAP *save_file            = NULL;
+BITMAP *bt_pivot             = NULL;
+BITMAP *spr000_00            = NULL;
+BITMAP *spr000_01            = NULL;
+BITMAP *HitSparkSpr[4][6];
 //defesa - nao implementada ainda :)
 //BITMAP *spr995_00            = load_bitmap("data/system/995_00.pcx", NULL);               if (!spr995_00)            { HamoopiError=1; }
 //BITMAP *spr995_01            = load_bitmap("data/system/995_01.pcx", NULL);               if (!spr995_01)            { HamoopiError=1; }
@@ -834,55 +847,251 @@ BITMAP *spr994_05            = load_bitmap("data/system/994_05.pcx", NULL);
 //BITMAP *spr995_04            = load_bitmap("data/system/995_04.pcx", NULL);               if (!spr995_04)            { HamoopiError=1; }
 //BITMAP *spr995_05            = load_bitmap("data/system/995_05.pcx", NULL);               if (!spr995_05)            { HamoopiError=1; }
 BITMAP *AnimTrans[30];
-AnimTrans[0]  = load_bitmap("data/system/AnimTrans00.pcx",NULL); if (!AnimTrans[0])  { CtrlAnimTrans[0] =0; } else { CtrlAnimTrans[0] =1; }
-AnimTrans[1]  = load_bitmap("data/system/AnimTrans01.pcx",NULL); if (!AnimTrans[1])  { CtrlAnimTrans[1] =0; } else { CtrlAnimTrans[1] =1; }
-AnimTrans[2]  = load_bitmap("data/system/AnimTrans02.pcx",NULL); if (!AnimTrans[2])  { CtrlAnimTrans[2] =0; } else { CtrlAnimTrans[2] =1; }
-AnimTrans[3]  = load_bitmap("data/system/AnimTrans03.pcx",NULL); if (!AnimTrans[3])  { CtrlAnimTrans[3] =0; } else { CtrlAnimTrans[3] =1; }
-AnimTrans[4]  = load_bitmap("data/system/AnimTrans04.pcx",NULL); if (!AnimTrans[4])  { CtrlAnimTrans[4] =0; } else { CtrlAnimTrans[4] =1; }
-AnimTrans[5]  = load_bitmap("data/system/AnimTrans05.pcx",NULL); if (!AnimTrans[5])  { CtrlAnimTrans[5] =0; } else { CtrlAnimTrans[5] =1; }
-AnimTrans[6]  = load_bitmap("data/system/AnimTrans06.pcx",NULL); if (!AnimTrans[6])  { CtrlAnimTrans[6] =0; } else { CtrlAnimTrans[6] =1; }
-AnimTrans[7]  = load_bitmap("data/system/AnimTrans07.pcx",NULL); if (!AnimTrans[7])  { CtrlAnimTrans[7] =0; } else { CtrlAnimTrans[7] =1; }
-AnimTrans[8]  = load_bitmap("data/system/AnimTrans08.pcx",NULL); if (!AnimTrans[8])  { CtrlAnimTrans[8] =0; } else { CtrlAnimTrans[8] =1; }
-AnimTrans[9]  = load_bitmap("data/system/AnimTrans09.pcx",NULL); if (!AnimTrans[9])  { CtrlAnimTrans[9] =0; } else { CtrlAnimTrans[9] =1; }
-AnimTrans[10] = load_bitmap("data/system/AnimTrans10.pcx",NULL); if (!AnimTrans[10]) { CtrlAnimTrans[10]=0; } else { CtrlAnimTrans[10]=1; }
-AnimTrans[11] = load_bitmap("data/system/AnimTrans11.pcx",NULL); if (!AnimTrans[11]) { CtrlAnimTrans[11]=0; } else { CtrlAnimTrans[11]=1; }
-AnimTrans[12] = load_bitmap("data/system/AnimTrans12.pcx",NULL); if (!AnimTrans[12]) { CtrlAnimTrans[12]=0; } else { CtrlAnimTrans[12]=1; }
-AnimTrans[13] = load_bitmap("data/system/AnimTrans13.pcx",NULL); if (!AnimTrans[13]) { CtrlAnimTrans[13]=0; } else { CtrlAnimTrans[13]=1; }
-AnimTrans[14] = load_bitmap("data/system/AnimTrans14.pcx",NULL); if (!AnimTrans[14]) { CtrlAnimTrans[14]=0; } else { CtrlAnimTrans[14]=1; }
-AnimTrans[15] = load_bitmap("data/system/AnimTrans15.pcx",NULL); if (!AnimTrans[15]) { CtrlAnimTrans[15]=0; } else { CtrlAnimTrans[15]=1; }
-AnimTrans[16] = load_bitmap("data/system/AnimTrans16.pcx",NULL); if (!AnimTrans[16]) { CtrlAnimTrans[16]=0; } else { CtrlAnimTrans[16]=1; }
-AnimTrans[17] = load_bitmap("data/system/AnimTrans17.pcx",NULL); if (!AnimTrans[17]) { CtrlAnimTrans[17]=0; } else { CtrlAnimTrans[17]=1; }
-AnimTrans[18] = load_bitmap("data/system/AnimTrans18.pcx",NULL); if (!AnimTrans[18]) { CtrlAnimTrans[18]=0; } else { CtrlAnimTrans[18]=1; }
-AnimTrans[19] = load_bitmap("data/system/AnimTrans19.pcx",NULL); if (!AnimTrans[19]) { CtrlAnimTrans[19]=0; } else { CtrlAnimTrans[19]=1; }
-AnimTrans[20] = load_bitmap("data/system/AnimTrans20.pcx",NULL); if (!AnimTrans[20]) { CtrlAnimTrans[20]=0; } else { CtrlAnimTrans[20]=1; }
-AnimTrans[21] = load_bitmap("data/system/AnimTrans21.pcx",NULL); if (!AnimTrans[21]) { CtrlAnimTrans[21]=0; } else { CtrlAnimTrans[21]=1; }
-AnimTrans[22] = load_bitmap("data/system/AnimTrans22.pcx",NULL); if (!AnimTrans[22]) { CtrlAnimTrans[22]=0; } else { CtrlAnimTrans[22]=1; }
-AnimTrans[23] = load_bitmap("data/system/AnimTrans23.pcx",NULL); if (!AnimTrans[23]) { CtrlAnimTrans[23]=0; } else { CtrlAnimTrans[23]=1; }
-AnimTrans[24] = load_bitmap("data/system/AnimTrans24.pcx",NULL); if (!AnimTrans[24]) { CtrlAnimTrans[24]=0; } else { CtrlAnimTrans[24]=1; }
-AnimTrans[25] = load_bitmap("data/system/AnimTrans25.pcx",NULL); if (!AnimTrans[25]) { CtrlAnimTrans[25]=0; } else { CtrlAnimTrans[25]=1; }
-AnimTrans[26] = load_bitmap("data/system/AnimTrans26.pcx",NULL); if (!AnimTrans[26]) { CtrlAnimTrans[26]=0; } else { CtrlAnimTrans[26]=1; }
-AnimTrans[27] = load_bitmap("data/system/AnimTrans27.pcx",NULL); if (!AnimTrans[27]) { CtrlAnimTrans[27]=0; } else { CtrlAnimTrans[27]=1; }
-AnimTrans[28] = load_bitmap("data/system/AnimTrans28.pcx",NULL); if (!AnimTrans[28]) { CtrlAnimTrans[28]=0; } else { CtrlAnimTrans[28]=1; }
-AnimTrans[29] = load_bitmap("data/system/AnimTrans29.pcx",NULL); if (!AnimTrans[29]) { CtrlAnimTrans[29]=0; } else { CtrlAnimTrans[29]=1; }
 BITMAP *AnimIntro[16];
-AnimIntro[0]  = load_bitmap("data/system/AnimIntro00.pcx",NULL); if (!AnimIntro[0])  { CtrlAnimIntro[0] =0; } else { CtrlAnimIntro[0] =1; }
-AnimIntro[1]  = load_bitmap("data/system/AnimIntro01.pcx",NULL); if (!AnimIntro[1])  { CtrlAnimIntro[1] =0; } else { CtrlAnimIntro[1] =1; }
-AnimIntro[2]  = load_bitmap("data/system/AnimIntro02.pcx",NULL); if (!AnimIntro[2])  { CtrlAnimIntro[2] =0; } else { CtrlAnimIntro[2] =1; }
-AnimIntro[3]  = load_bitmap("data/system/AnimIntro03.pcx",NULL); if (!AnimIntro[3])  { CtrlAnimIntro[3] =0; } else { CtrlAnimIntro[3] =1; }
-AnimIntro[4]  = load_bitmap("data/system/AnimIntro04.pcx",NULL); if (!AnimIntro[4])  { CtrlAnimIntro[4] =0; } else { CtrlAnimIntro[4] =1; }
-AnimIntro[5]  = load_bitmap("data/system/AnimIntro05.pcx",NULL); if (!AnimIntro[5])  { CtrlAnimIntro[5] =0; } else { CtrlAnimIntro[5] =1; }
-AnimIntro[6]  = load_bitmap("data/system/AnimIntro06.pcx",NULL); if (!AnimIntro[6])  { CtrlAnimIntro[6] =0; } else { CtrlAnimIntro[6] =1; }
-AnimIntro[7]  = load_bitmap("data/system/AnimIntro07.pcx",NULL); if (!AnimIntro[7])  { CtrlAnimIntro[7] =0; } else { CtrlAnimIntro[7] =1; }
-AnimIntro[8]  = load_bitmap("data/system/AnimIntro08.pcx",NULL); if (!AnimIntro[8])  { CtrlAnimIntro[8] =0; } else { CtrlAnimIntro[8] =1; }
-AnimIntro[9]  = load_bitmap("data/system/AnimIntro09.pcx",NULL); if (!AnimIntro[9])  { CtrlAnimIntro[9] =0; } else { CtrlAnimIntro[9] =1; }
-AnimIntro[10] = load_bitmap("data/system/AnimIntro10.pcx",NULL); if (!AnimIntro[10]) { CtrlAnimIntro[10]=0; } else { CtrlAnimIntro[10]=1; }
-AnimIntro[11] = load_bitmap("data/system/AnimIntro11.pcx",NULL); if (!AnimIntro[11]) { CtrlAnimIntro[11]=0; } else { CtrlAnimIntro[11]=1; }
-AnimIntro[12] = load_bitmap("data/system/AnimIntro12.pcx",NULL); if (!AnimIntro[12]) { CtrlAnimIntro[12]=0; } else { CtrlAnimIntro[12]=1; }
-AnimIntro[13] = load_bitmap("data/system/AnimIntro13.pcx",NULL); if (!AnimIntro[13]) { CtrlAnimIntro[13]=0; } else { CtrlAnimIntro[13]=1; }
-AnimIntro[14] = load_bitmap("data/system/AnimIntro14.pcx",NULL); if (!AnimIntro[14]) { CtrlAnimIntro[14]=0; } else { CtrlAnimIntro[14]=1; }
-AnimIntro[15] = load_bitmap("data/system/AnimIntro15.pcx",NULL); if (!AnimIntro[15]) { CtrlAnimIntro[15]=0; } else { CtrlAnimIntro[15]=1; }
 BITMAP *MINIspr[9];
-MINIspr[0] = load_bitmap("data/system/000_01.pcx", NULL); if (!MINIspr[0]) { HamoopiError=1; }
+//musicas e efeitos
+SAMPLE *intro   = NULL;
+SAMPLE *round1  = NULL;
+SAMPLE *round2  = NULL;
+SAMPLE *round3  = NULL;
+SAMPLE *fight   = NULL;
+SAMPLE *ko      = NULL;
+SAMPLE *perfect = NULL;
+SAMPLE *back    = NULL;
+SAMPLE *choice  = NULL;
+SAMPLE *confirm = NULL;
+SAMPLE *cursor  = NULL;
+SAMPLE *attacklvl1 = NULL;
+SAMPLE *attacklvl2 = NULL;
+SAMPLE *attacklvl3 = NULL;
+SAMPLE *hitlvl1 = NULL;
+SAMPLE *hitlvl2 = NULL;
+SAMPLE *hitlvl3 = NULL;
+MIDI *bgm_apresentacao  = NULL;
+MIDI *bgm_continue      = NULL;
+MIDI *bgm_select_screen = NULL;
+MIDI *bgm_versus_mode   = NULL;
+
+//manifesto de carga: decodificado por threads em segundo plano, na ordem da lista;
+//o que a intro usa vem primeiro e o restante e entregue enquanto ela roda
+hamoopi_load_entry Manifesto[] = {
+{ "data/system/GAME_intro.pcx",              HAMOOPI_LOAD_BITMAP, &GAME_intro,              &HamoopiError, NULL },
+{ "data/sounds/intro.wav",                   HAMOOPI_LOAD_SAMPLE, &intro,                   NULL,          NULL },
+{ "data/system/font_debug.pcx",              HAMOOPI_LOAD_FONT,   &font_debug,              NULL,          NULL },
+{ "data/system/font_10.pcx",                 HAMOOPI_LOAD_FONT,   &font_10,                 NULL,          NULL },
+{ "data/system/font_19.pcx",                 HAMOOPI_LOAD_FONT,   &font_19,                 NULL,          NULL },
+{ "data/system/font_20.pcx",                 HAMOOPI_LOAD_FONT,   &font_20,                 NULL,          NULL },
+{ "data/system/font_30.pcx",                 HAMOOPI_LOAD_FONT,   &font_30,                 NULL,          NULL },
+{ "data/system/GAME_logo.pcx",               HAMOOPI_LOAD_BITMAP, &GAME_logo,               &HamoopiError, NULL },
+{ "data/system/flag_BR.pcx",                 HAMOOPI_LOAD_BITMAP, &flag_BR,                 &HamoopiError, NULL },
+{ "data/system/sel_mark_p1.pcx",             HAMOOPI_LOAD_BITMAP, &sel_mark_p1,             &HamoopiError, NULL },
+{ "data/system/sel_mark_p2.pcx",             HAMOOPI_LOAD_BITMAP, &sel_mark_p2,             &HamoopiError, NULL },
+{ "data/system/flag_US.pcx",                 HAMOOPI_LOAD_BITMAP, &flag_US,                 &HamoopiError, NULL },
+{ "data/system/SELECT_CHARS.pcx",            HAMOOPI_LOAD_BITMAP, &SELECT_CHARS,            &HamoopiError, NULL },
+{ "data/system/VS_SCREEN.pcx",               HAMOOPI_LOAD_BITMAP, &VS_SCREEN,               &HamoopiError, NULL },
+{ "data/system/vs_icon.pcx",                 HAMOOPI_LOAD_BITMAP, &vs_icon,                 &HamoopiError, NULL },
+{ "data/system/SELECT_BG.pcx",               HAMOOPI_LOAD_BITMAP, &SELECT_BG,               &HamoopiError, NULL },
+{ "data/system/donation.pcx",                HAMOOPI_LOAD_BITMAP, &donation,                &HamoopiError, NULL },
+{ "data/system/spr_p1_cursor.pcx",           HAMOOPI_LOAD_BITMAP, &spr_p1_cursor,           &HamoopiError, NULL },
+{ "data/system/spr_p2_cursor.pcx",           HAMOOPI_LOAD_BITMAP, &spr_p2_cursor,           &HamoopiError, NULL },
+{ "data/system/spr_cursor_historia.pcx",     HAMOOPI_LOAD_BITMAP, &spr_cursor_historia,     &HamoopiError, NULL },
+{ "data/system/spr_cursor_vazio.pcx",        HAMOOPI_LOAD_BITMAP, &spr_cursor_vazio,        &HamoopiError, NULL },
+{ "data/system/spr_ponteiro.pcx",            HAMOOPI_LOAD_BITMAP, &spr_ponteiro,            &HamoopiError, NULL },
+{ "data/system/spr_menu_icon.pcx",           HAMOOPI_LOAD_BITMAP, &spr_menu_icon,           &HamoopiError, NULL },
+{ "data/system/GAME_options.pcx",            HAMOOPI_LOAD_BITMAP, &GAME_options,            &HamoopiError, NULL },
+{ "data/system/char_generic.pcx",            HAMOOPI_LOAD_BITMAP, &char_generic,            &HamoopiError, NULL },
+{ "data/system/char_generic2x.pcx",          HAMOOPI_LOAD_BITMAP, &char_generic2x,          &HamoopiError, NULL },
+{ "data/system/spr_mold_results.pcx",        HAMOOPI_LOAD_BITMAP, &spr_mold_results,        &HamoopiError, NULL },
+{ "data/system/spr_result_perfect.pcx",      HAMOOPI_LOAD_BITMAP, &spr_result_perfect,      &HamoopiError, NULL },
+{ "data/system/spr_result_win.pcx",          HAMOOPI_LOAD_BITMAP, &spr_result_win,          &HamoopiError, NULL },
+{ "data/system/spr_splash_round1.pcx",       HAMOOPI_LOAD_BITMAP, &spr_splash_round1,       &HamoopiError, NULL },
+{ "data/system/spr_splash_round2.pcx",       HAMOOPI_LOAD_BITMAP, &spr_splash_round2,       &HamoopiError, NULL },
+{ "data/system/spr_splash_round3.pcx",       HAMOOPI_LOAD_BITMAP, &spr_splash_round3,       &HamoopiError, NULL },
+{ "data/system/spr_splash_round4.pcx",       HAMOOPI_LOAD_BITMAP, &spr_splash_round4,       &HamoopiError, NULL },
+{ "data/system/spr_splash_round5.pcx",       HAMOOPI_LOAD_BITMAP, &spr_splash_round5,       &HamoopiError, NULL },
+{ "data/system/spr_splash_fight.pcx",        HAMOOPI_LOAD_BITMAP, &spr_splash_fight,        &HamoopiError, NULL },
+{ "data/system/spr_splash_youwin.pcx",       HAMOOPI_LOAD_BITMAP, &spr_splash_youwin,       &HamoopiError, NULL },
+{ "data/system/spr_splash_p1win.pcx",        HAMOOPI_LOAD_BITMAP, &spr_splash_p1win,        &HamoopiError, NULL },
+{ "data/system/spr_splash_p2win.pcx",        HAMOOPI_LOAD_BITMAP, &spr_splash_p2win,        &HamoopiError, NULL },
+{ "data/system/spr_splash_youlose.pcx",      HAMOOPI_LOAD_BITMAP, &spr_splash_youlose,      &HamoopiError, NULL },
+{ "data/system/spr_splash_ko.pcx",           HAMOOPI_LOAD_BITMAP, &spr_splash_ko,           &HamoopiError, NULL },
+{ "data/system/spr_splash_perfect.pcx",      HAMOOPI_LOAD_BITMAP, &spr_splash_perfect,      &HamoopiError, NULL },
+{ "data/system/spr_splash_draw.pcx",         HAMOOPI_LOAD_BITMAP, &spr_splash_draw,         &HamoopiError, NULL },
+{ "data/system/spr_splash_time_over.pcx",    HAMOOPI_LOAD_BITMAP, &spr_splash_time_over,    &HamoopiError, NULL },
+{ "data/system/bt_joystick.pcx",             HAMOOPI_LOAD_BITMAP, &bt_joystick,             &HamoopiError, NULL },
+{ "data/system/ed_mode1_on.pcx",             HAMOOPI_LOAD_BITMAP, &ed_mode1_on,             &HamoopiError, NULL },
+{ "data/system/ed_mode2_on.pcx",             HAMOOPI_LOAD_BITMAP, &ed_mode2_on,             &HamoopiError, NULL },
+{ "data/system/ed_mode1_off.pcx",            HAMOOPI_LOAD_BITMAP, &ed_mode1_off,            &HamoopiError, NULL },
+{ "data/system/ed_mode2_off.pcx",            HAMOOPI_LOAD_BITMAP, &ed_mode2_off,            &HamoopiError, NULL },
+{ "data/system/bt_reset_input.pcx",          HAMOOPI_LOAD_BITMAP, &bt_reset_input,          &HamoopiError, NULL },
+{ "data/system/bt_up_1.pcx",                 HAMOOPI_LOAD_BITMAP, &bt_up_1,                 &HamoopiError, NULL },
+{ "data/system/bt_up_2.pcx",                 HAMOOPI_LOAD_BITMAP, &bt_up_2,                 &HamoopiError, NULL },
+{ "data/system/bt_up_3.pcx",                 HAMOOPI_LOAD_BITMAP, &bt_up_3,                 &HamoopiError, NULL },
+{ "data/system/bt_down_1.pcx",               HAMOOPI_LOAD_BITMAP, &bt_down_1,               &HamoopiError, NULL },
+{ "data/system/bt_down_2.pcx",               HAMOOPI_LOAD_BITMAP, &bt_down_2,               &HamoopiError, NULL },
+{ "data/system/bt_down_3.pcx",               HAMOOPI_LOAD_BITMAP, &bt_down_3,               &HamoopiError, NULL },
+{ "data/system/bt_left_1.pcx",               HAMOOPI_LOAD_BITMAP, &bt_left_1,               &HamoopiError, NULL },
+{ "data/system/bt_left_2.pcx",               HAMOOPI_LOAD_BITMAP, &bt_left_2,               &HamoopiError, NULL },
+{ "data/system/bt_left_3.pcx",               HAMOOPI_LOAD_BITMAP, &bt_left_3,               &HamoopiError, NULL },
+{ "data/system/bt_right_1.pcx",              HAMOOPI_LOAD_BITMAP, &bt_right_1,              &HamoopiError, NULL },
+{ "data/system/bt_right_2.pcx",              HAMOOPI_LOAD_BITMAP, &bt_right_2,              &HamoopiError, NULL },
+{ "data/system/bt_right_3.pcx",              HAMOOPI_LOAD_BITMAP, &bt_right_3,              &HamoopiError, NULL },
+{ "data/system/bt_1.pcx",                    HAMOOPI_LOAD_BITMAP, &bt_1,                    &HamoopiError, NULL },
+{ "data/system/bt_2.pcx",                    HAMOOPI_LOAD_BITMAP, &bt_2,                    &HamoopiError, NULL },
+{ "data/system/bt_3.pcx",                    HAMOOPI_LOAD_BITMAP, &bt_3,                    &HamoopiError, NULL },
+{ "data/system/bt_ss_1.pcx",                 HAMOOPI_LOAD_BITMAP, &bt_ss_1,                 &HamoopiError, NULL },
+{ "data/system/bt_ss_2.pcx",                 HAMOOPI_LOAD_BITMAP, &bt_ss_2,                 &HamoopiError, NULL },
+{ "data/system/bt_ss_3.pcx",                 HAMOOPI_LOAD_BITMAP, &bt_ss_3,                 &HamoopiError, NULL },
+{ "data/system/spr_input_0.pcx",             HAMOOPI_LOAD_BITMAP, &spr_input_0,             &HamoopiError, NULL },
+{ "data/system/spr_input_1.pcx",             HAMOOPI_LOAD_BITMAP, &spr_input_1,             &HamoopiError, NULL },
+{ "data/system/spr_input_2.pcx",             HAMOOPI_LOAD_BITMAP, &spr_input_2,             &HamoopiError, NULL },
+{ "data/system/spr_input_3.pcx",             HAMOOPI_LOAD_BITMAP, &spr_input_3,             &HamoopiError, NULL },
+{ "data/system/spr_input_4.pcx",             HAMOOPI_LOAD_BITMAP, &spr_input_4,             &HamoopiError, NULL },
+{ "data/system/spr_input_5.pcx",             HAMOOPI_LOAD_BITMAP, &spr_input_5,             &HamoopiError, NULL },
+{ "data/system/spr_input_6.pcx",             HAMOOPI_LOAD_BITMAP, &spr_input_6,             &HamoopiError, NULL },
+{ "data/system/spr_input_7.pcx",             HAMOOPI_LOAD_BITMAP, &spr_input_7,             &HamoopiError, NULL },
+{ "data/system/spr_input_8.pcx",             HAMOOPI_LOAD_BITMAP, &spr_input_8,             &HamoopiError, NULL },
+{ "data/system/spr_input_9.pcx",             HAMOOPI_LOAD_BITMAP, &spr_input_9,             &HamoopiError, NULL },
+{ "data/system/spr_input_10.pcx",            HAMOOPI_LOAD_BITMAP, &spr_input_10,            &HamoopiError, NULL },
+{ "data/system/spr_input_11.pcx",            HAMOOPI_LOAD_BITMAP, &spr_input_11,            &HamoopiError, NULL },
+{ "data/system/spr_input_12.pcx",            HAMOOPI_LOAD_BITMAP, &spr_input_12,            &HamoopiError, NULL },
+{ "data/system/spr_input_13.pcx",            HAMOOPI_LOAD_BITMAP, &spr_input_13,            &HamoopiError, NULL },
+{ "data/system/spr_input_14.pcx",            HAMOOPI_LOAD_BITMAP, &spr_input_14,            &HamoopiError, NULL },
+{ "data/system/spr_input_15.pcx",            HAMOOPI_LOAD_BITMAP, &spr_input_15,            &HamoopiError, NULL },
+{ "data/system/spr_input_16.pcx",            HAMOOPI_LOAD_BITMAP, &spr_input_16,            &HamoopiError, NULL },
+{ "data/system/spr_input_17.pcx",            HAMOOPI_LOAD_BITMAP, &spr_input_17,            &HamoopiError, NULL },
+{ "data/system/spr_bg_bar.pcx",              HAMOOPI_LOAD_BITMAP, &spr_bg_bar,              &HamoopiError, NULL },
+{ "data/system/spr_energy_bar.pcx",          HAMOOPI_LOAD_BITMAP, &spr_energy_bar,          &HamoopiError, NULL },
+{ "data/system/spr_energy_bar_full.pcx",     HAMOOPI_LOAD_BITMAP, &spr_energy_bar_full,     &HamoopiError, NULL },
+{ "data/system/spr_energy_red_bar.pcx",      HAMOOPI_LOAD_BITMAP, &spr_energy_red_bar,      &HamoopiError, NULL },
+{ "data/system/spr_energy_red_bar_full.pcx", HAMOOPI_LOAD_BITMAP, &spr_energy_red_bar_full, &HamoopiError, NULL },
+{ "data/system/spr_bg_bar_sp.pcx",           HAMOOPI_LOAD_BITMAP, &spr_bg_bar_sp,           &HamoopiError, NULL },
+{ "data/system/spr_bg_energy_bar_sp.pcx",    HAMOOPI_LOAD_BITMAP, &spr_bg_energy_bar_sp,    &HamoopiError, NULL },
+{ "data/system/spr_num_0.pcx",               HAMOOPI_LOAD_BITMAP, &spr_num[0],              &HamoopiError, NULL },
+{ "data/system/spr_num_1.pcx",               HAMOOPI_LOAD_BITMAP, &spr_num[1],              &HamoopiError, NULL },
+{ "data/system/spr_num_2.pcx",               HAMOOPI_LOAD_BITMAP, &spr_num[2],              &HamoopiError, NULL },
+{ "data/system/spr_num_3.pcx",               HAMOOPI_LOAD_BITMAP, &spr_num[3],              &HamoopiError, NULL },
+{ "data/system/spr_num_4.pcx",               HAMOOPI_LOAD_BITMAP, &spr_num[4],              &HamoopiError, NULL },
+{ "data/system/spr_num_5.pcx",               HAMOOPI_LOAD_BITMAP, &spr_num[5],              &HamoopiError, NULL },
+{ "data/system/spr_num_6.pcx",               HAMOOPI_LOAD_BITMAP, &spr_num[6],              &HamoopiError, NULL },
+{ "data/system/spr_num_7.pcx",               HAMOOPI_LOAD_BITMAP, &spr_num[7],              &HamoopiError, NULL },
+{ "data/system/spr_num_8.pcx",               HAMOOPI_LOAD_BITMAP, &spr_num[8],              &HamoopiError, NULL },
+{ "data/system/spr_num_9.pcx",               HAMOOPI_LOAD_BITMAP, &spr_num[9],              &HamoopiError, NULL },
+{ "data/system/edit_bt_blue.pcx",            HAMOOPI_LOAD_BITMAP, &edit_bt_blue,            &HamoopiError, NULL },
+{ "data/system/edit_bt_red.pcx",             HAMOOPI_LOAD_BITMAP, &edit_bt_red,             &HamoopiError, NULL },
+{ "data/system/edit_bt_null.pcx",            HAMOOPI_LOAD_BITMAP, &edit_bt_null,            &HamoopiError, NULL },
+{ "data/system/edit_bt_null0.pcx",           HAMOOPI_LOAD_BITMAP, &edit_bt_null0,           &HamoopiError, NULL },
+{ "data/system/edit_prevst.pcx",             HAMOOPI_LOAD_BITMAP, &edit_prevst,             &HamoopiError, NULL },
+{ "data/system/edit_nextst.pcx",             HAMOOPI_LOAD_BITMAP, &edit_nextst,             &HamoopiError, NULL },
+{ "data/system/edit_prevchar.pcx",           HAMOOPI_LOAD_BITMAP, &edit_prevchar,           &HamoopiError, NULL },
+{ "data/system/edit_nextchar.pcx",           HAMOOPI_LOAD_BITMAP, &edit_nextchar,           &HamoopiError, NULL },
+{ "data/system/edit_firstchar.pcx",          HAMOOPI_LOAD_BITMAP, &edit_firstchar,          &HamoopiError, NULL },
+{ "data/system/edit_lastchar.pcx",           HAMOOPI_LOAD_BITMAP, &edit_lastchar,           &HamoopiError, NULL },
+{ "data/system/spr_nao_implementado.pcx",    HAMOOPI_LOAD_BITMAP, &spr_nao_implementado,    &HamoopiError, NULL },
+{ "data/system/edit_playback.pcx",           HAMOOPI_LOAD_BITMAP, &edit_playback,           &HamoopiError, NULL },
+{ "data/system/edit_pause.pcx",              HAMOOPI_LOAD_BITMAP, &edit_pause,              &HamoopiError, NULL },
+{ "data/system/edit_bt_FrameTime.pcx",       HAMOOPI_LOAD_BITMAP, &edit_bt_FrameTime,       &HamoopiError, NULL },
+{ "data/system/edit_bt_plus.pcx",            HAMOOPI_LOAD_BITMAP, &edit_bt_plus,            &HamoopiError, NULL },
+{ "data/system/edit_bt_minus.pcx",           HAMOOPI_LOAD_BITMAP, &edit_bt_minus,           &HamoopiError, NULL },
+{ "data/system/mouse.pcx",                   HAMOOPI_LOAD_BITMAP, &mouse,                   &HamoopiError, NULL },
+{ "data/system/mouse2.pcx",                  HAMOOPI_LOAD_BITMAP, &mouse2,                  &HamoopiError, NULL },
+{ "data/system/save_file.pcx",               HAMOOPI_LOAD_BITMAP, &save_file,               &HamoopiError, NULL },
+{ "data/system/bt_pivot.pcx",                HAMOOPI_LOAD_BITMAP, &bt_pivot,                &HamoopiError, NULL },
+{ "data/system/000_00.pcx",                  HAMOOPI_LOAD_BITMAP, &spr000_00,               &HamoopiError, NULL },
+{ "data/system/000_01.pcx",                  HAMOOPI_LOAD_BITMAP, &spr000_01,               &HamoopiError, NULL },
+{ "data/system/991_00.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[0][0],       &HamoopiError, NULL },
+{ "data/system/991_01.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[0][1],       &HamoopiError, NULL },
+{ "data/system/991_02.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[0][2],       &HamoopiError, NULL },
+{ "data/system/991_03.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[0][3],       &HamoopiError, NULL },
+{ "data/system/991_04.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[0][4],       &HamoopiError, NULL },
+{ "data/system/991_05.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[0][5],       &HamoopiError, NULL },
+{ "data/system/992_00.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[1][0],       &HamoopiError, NULL },
+{ "data/system/992_01.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[1][1],       &HamoopiError, NULL },
+{ "data/system/992_02.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[1][2],       &HamoopiError, NULL },
+{ "data/system/992_03.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[1][3],       &HamoopiError, NULL },
+{ "data/system/992_04.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[1][4],       &HamoopiError, NULL },
+{ "data/system/992_05.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[1][5],       &HamoopiError, NULL },
+{ "data/system/993_00.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[2][0],       &HamoopiError, NULL },
+{ "data/system/993_01.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[2][1],       &HamoopiError, NULL },
+{ "data/system/993_02.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[2][2],       &HamoopiError, NULL },
+{ "data/system/993_03.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[2][3],       &HamoopiError, NULL },
+{ "data/system/993_04.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[2][4],       &HamoopiError, NULL },
+{ "data/system/993_05.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[2][5],       &HamoopiError, NULL },
+{ "data/system/994_00.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[3][0],       &HamoopiError, NULL },
+{ "data/system/994_01.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[3][1],       &HamoopiError, NULL },
+{ "data/system/994_02.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[3][2],       &HamoopiError, NULL },
+{ "data/system/994_03.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[3][3],       &HamoopiError, NULL },
+{ "data/system/994_04.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[3][4],       &HamoopiError, NULL },
+{ "data/system/994_05.pcx",                  HAMOOPI_LOAD_BITMAP, &HitSparkSpr[3][5],       &HamoopiError, NULL },
+{ "data/system/AnimTrans00.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[0],            NULL,          &CtrlAnimTrans[0] },
+{ "data/system/AnimTrans01.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[1],            NULL,          &CtrlAnimTrans[1] },
+{ "data/system/AnimTrans02.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[2],            NULL,          &CtrlAnimTrans[2] },
+{ "data/system/AnimTrans03.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[3],            NULL,          &CtrlAnimTrans[3] },
+{ "data/system/AnimTrans04.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[4],            NULL,          &CtrlAnimTrans[4] },
+{ "data/system/AnimTrans05.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[5],            NULL,          &CtrlAnimTrans[5] },
+{ "data/system/AnimTrans06.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[6],            NULL,          &CtrlAnimTrans[6] },
+{ "data/system/AnimTrans07.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[7],            NULL,          &CtrlAnimTrans[7] },
+{ "data/system/AnimTrans08.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[8],            NULL,          &CtrlAnimTrans[8] },
+{ "data/system/AnimTrans09.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[9],            NULL,          &CtrlAnimTrans[9] },
+{ "data/system/AnimTrans10.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[10],           NULL,          &CtrlAnimTrans[10] },
+{ "data/system/AnimTrans11.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[11],           NULL,          &CtrlAnimTrans[11] },
+{ "data/system/AnimTrans12.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[12],           NULL,          &CtrlAnimTrans[12] },
+{ "data/system/AnimTrans13.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[13],           NULL,          &CtrlAnimTrans[13] },
+{ "data/system/AnimTrans14.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[14],           NULL,          &CtrlAnimTrans[14] },
+{ "data/system/AnimTrans15.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[15],           NULL,          &CtrlAnimTrans[15] },
+{ "data/system/AnimTrans16.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[16],           NULL,          &CtrlAnimTrans[16] },
+{ "data/system/AnimTrans17.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[17],           NULL,          &CtrlAnimTrans[17] },
+{ "data/system/AnimTrans18.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[18],           NULL,          &CtrlAnimTrans[18] },
+{ "data/system/AnimTrans19.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[19],           NULL,          &CtrlAnimTrans[19] },
+{ "data/system/AnimTrans20.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[20],           NULL,          &CtrlAnimTrans[20] },
+{ "data/system/AnimTrans21.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[21],           NULL,          &CtrlAnimTrans[21] },
+{ "data/system/AnimTrans22.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[22],           NULL,          &CtrlAnimTrans[22] },
+{ "data/system/AnimTrans23.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[23],           NULL,          &CtrlAnimTrans[23] },
+{ "data/system/AnimTrans24.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[24],           NULL,          &CtrlAnimTrans[24] },
+{ "data/system/AnimTrans25.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[25],           NULL,          &CtrlAnimTrans[25] },
+{ "data/system/AnimTrans26.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[26],           NULL,          &CtrlAnimTrans[26] },
+{ "data/system/AnimTrans27.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[27],           NULL,          &CtrlAnimTrans[27] },
+{ "data/system/AnimTrans28.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[28],           NULL,          &CtrlAnimTrans[28] },
+{ "data/system/AnimTrans29.pcx",             HAMOOPI_LOAD_BITMAP, &AnimTrans[29],           NULL,          &CtrlAnimTrans[29] },
+{ "data/system/AnimIntro00.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[0],            NULL,          &CtrlAnimIntro[0] },
+{ "data/system/AnimIntro01.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[1],            NULL,          &CtrlAnimIntro[1] },
+{ "data/system/AnimIntro02.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[2],            NULL,          &CtrlAnimIntro[2] },
+{ "data/system/AnimIntro03.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[3],            NULL,          &CtrlAnimIntro[3] },
+{ "data/system/AnimIntro04.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[4],            NULL,          &CtrlAnimIntro[4] },
+{ "data/system/AnimIntro05.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[5],            NULL,          &CtrlAnimIntro[5] },
+{ "data/system/AnimIntro06.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[6],            NULL,          &CtrlAnimIntro[6] },
+{ "data/system/AnimIntro07.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[7],            NULL,          &CtrlAnimIntro[7] },
+{ "data/system/AnimIntro08.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[8],            NULL,          &CtrlAnimIntro[8] },
+{ "data/system/AnimIntro09.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[9],            NULL,          &CtrlAnimIntro[9] },
+{ "data/system/AnimIntro10.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[10],           NULL,          &CtrlAnimIntro[10] },
+{ "data/system/AnimIntro11.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[11],           NULL,          &CtrlAnimIntro[11] },
+{ "data/system/AnimIntro12.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[12],           NULL,          &CtrlAnimIntro[12] },
+{ "data/system/AnimIntro13.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[13],           NULL,          &CtrlAnimIntro[13] },
+{ "data/system/AnimIntro14.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[14],           NULL,          &CtrlAnimIntro[14] },
+{ "data/system/AnimIntro15.pcx",             HAMOOPI_LOAD_BITMAP, &AnimIntro[15],           NULL,          &CtrlAnimIntro[15] },
+{ "data/system/000_01.pcx",                  HAMOOPI_LOAD_BITMAP, &MINIspr[0],              &HamoopiError, NULL },
+{ "data/sounds/round1.wav",                  HAMOOPI_LOAD_SAMPLE, &round1,                  NULL,          NULL },
+{ "data/sounds/round2.wav",                  HAMOOPI_LOAD_SAMPLE, &round2,                  NULL,          NULL },
+{ "data/sounds/round3.wav",                  HAMOOPI_LOAD_SAMPLE, &round3,                  NULL,          NULL },
+{ "data/sounds/fight.wav",                   HAMOOPI_LOAD_SAMPLE, &fight,                   NULL,          NULL },
+{ "data/sounds/ko.wav",                      HAMOOPI_LOAD_SAMPLE, &ko,                      NULL,          NULL },
+{ "data/sounds/perfect.wav",                 HAMOOPI_LOAD_SAMPLE, &perfect,                 NULL,          NULL },
+{ "data/sounds/back.wav",                    HAMOOPI_LOAD_SAMPLE, &back,                    NULL,          NULL },
+{ "data/sounds/choice.wav",                  HAMOOPI_LOAD_SAMPLE, &choice,                  NULL,          NULL },
+{ "data/sounds/confirm.wav",                 HAMOOPI_LOAD_SAMPLE, &confirm,                 NULL,          NULL },
+{ "data/sounds/cursor.wav",                  HAMOOPI_LOAD_SAMPLE, &cursor,                  NULL,          NULL },
+{ "data/sounds/attacklvl1.wav",              HAMOOPI_LOAD_SAMPLE, &attacklvl1,              NULL,          NULL },
+{ "data/sounds/attacklvl2.wav",              HAMOOPI_LOAD_SAMPLE, &attacklvl2,              NULL,          NULL },
+{ "data/sounds/attacklvl3.wav",              HAMOOPI_LOAD_SAMPLE, &attacklvl3,              NULL,          NULL },
+{ "data/sounds/hitlvl1.wav",                 HAMOOPI_LOAD_SAMPLE, &hitlvl1,                 NULL,          NULL },
+{ "data/sounds/hitlvl2.wav",                 HAMOOPI_LOAD_SAMPLE, &hitlvl2,                 NULL,          NULL },
+{ "data/sounds/hitlvl3.wav",                 HAMOOPI_LOAD_SAMPLE, &hitlvl3,                 NULL,          NULL },
+{ "data/sounds/bgm_apresentacao.mid",        HAMOOPI_LOAD_MIDI,   &bgm_apresentacao,        NULL,          NULL },
+{ "data/sounds/bgm_continue.mid",            HAMOOPI_LOAD_MIDI,   &bgm_continue,            NULL,          NULL },
+{ "data/sounds/bgm_select_screen.mid",       HAMOOPI_LOAD_MIDI,   &bgm_select_screen,       NULL,          NULL },
+{ "data/sounds/bgm_versus_mode.mid",         HAMOOPI_LOAD_MIDI,   &bgm_versus_mode,         NULL,          NULL },
+};
+int CargaIntro=2; //GAME_intro e intro.wav
 MINIspr[1] = create_bitmap(32,32);
 MINIspr[2] = create_bitmap(32,32);
 MINIspr[3] = create_bitmap(32,32);
@@ -917,8 +1126,6 @@ BITMAP *P2BIGDisplayInv = create_bitmap(128,128);
 
 //idioma do jogo
 strcpy(IDIOMA, (char *)get_config_string("CONFIG", "language", "BR"));
-if (strcmp (IDIOMA,"BR")==0){ if (HamoopiError==1) allegro_message("ARQUIVOS OU DIRETORIOS NAO ENCONTRADOS."); };
-if (strcmp (IDIOMA,"US")==0){ if (HamoopiError==1) allegro_message("FILES OR DIRECTORIES NOT FOUND."); };
 
 //define centro do mapa
 MapCenterX=get_config_int ( "TEMPLATE", "MapCenterX", 320 );
@@ -995,6 +1202,11 @@ sprintf(P2_1s, "data/chars/%s/000_01.pcx", P[2].Name);
 BITMAP *P2_1 = load_bitmap(P2_1s, NULL);
 if (!P2_1) { P2_1=load_bitmap("data/system/000_01.pcx", NULL); }
 
+//as miniaturas acima podem ser paletadas e passam pela conversao global de cores do Allegro:
+//o manifesto so comeca depois delas, para nenhuma thread decodificar ao mesmo tempo
+hamoopi_loader_t Carga; int Carregando=1;
+hamoopi_loader_start(&Carga, Manifesto, sizeof(Manifesto)/sizeof(Manifesto[0]), get_config_int ( "CONFIG" , "load_threads",  0 ) );
+
 //propriedades de round
 RoundTime = get_config_int ("CONFIG", "time", 99 );
 RoundTime = RoundTime*60+59;
@@ -1030,41 +1242,20 @@ p2_start  = get_config_int ( "P2_CONTROL" , "P2_START"  ,  20 ) ;
 P[1].DefineCorDaPaleta=0;
 P[2].DefineCorDaPaleta=0;
 
-//musicas e efeitos
-SAMPLE *intro   = load_sample("data/sounds/intro.wav");
-SAMPLE *round1  = load_sample("data/sounds/round1.wav");
-SAMPLE *round2  = load_sample("data/sounds/round2.wav");
-SAMPLE *round3  = load_sample("data/sounds/round3.wav");
-SAMPLE *fight   = load_sample("data/sounds/fight.wav");
-SAMPLE *ko      = load_sample("data/sounds/ko.wav");
-SAMPLE *perfect = load_sample("data/sounds/perfect.wav");
-SAMPLE *back    = load_sample("data/sounds/back.wav");
-SAMPLE *choice  = load_sample("data/sounds/choice.wav");
-SAMPLE *confirm = load_sample("data/sounds/confirm.wav");
-SAMPLE *cursor  = load_sample("data/sounds/cursor.wav");
-SAMPLE *attacklvl1 = load_sample("data/sounds/attacklvl1.wav");
-SAMPLE *attacklvl2 = load_sample("data/sounds/attacklvl2.wav");
-SAMPLE *attacklvl3 = load_sample("data/sounds/attacklvl3.wav");
-SAMPLE *hitlvl1 = load_sample("data/sounds/hitlvl1.wav");
-SAMPLE *hitlvl2 = load_sample("data/sounds/hitlvl2.wav");
-SAMPLE *hitlvl3 = load_sample("data/sounds/hitlvl3.wav");
-MIDI *bgm_apresentacao  = load_midi("data/sounds/bgm_apresentacao.mid");
-MIDI *bgm_continue      = load_midi("data/sounds/bgm_continue.mid");
-MIDI *bgm_select_screen = load_midi("data/sounds/bgm_select_screen.mid");
-MIDI *bgm_versus_mode   = load_midi("data/sounds/bgm_versus_mode.mid");
-
 set_window_title(versao);
 
 /////////////////////////////////////////////////////////////////////////////
 // LOOP DE JOGO -------------------------------------------------------[**03]
 /////////////////////////////////////////////////////////////////////////////
 
+hamoopi_loader_wait(&Carga, CargaIntro); //a intro comeca assim que sua imagem e som estiverem prontos
+Avisa_Arquivos_Faltando(HamoopiError); //antes de desenhar a intro, como antes do carregamento em threads
+LogicTimerLido=timer; //o tempo gasto carregando nao conta
 while (sair==0)
 {
 
 check_keys_P1(); check_keys_P2(); //verifica teclas key_press, key_hold, key_released
-delay=timer;
-Segundos=((timer/60)-Minutos*60)-Horas*3600;
+Segundos=((LogicTick/60)-Minutos*60)-Horas*3600;
 if (Segundos>=60) { Minutos++; Segundos=0; if(Minutos>=60){ Horas++; Minutos=0; } }
 if (timermenus<15) { timermenus++; } //utilizado para melhor navegacao entre os menus
 MeioDaTela=(P[1].x+P[2].x)/2;
@@ -1092,7 +1283,7 @@ P[2].Pode_Mexer=1;
 if (timermenus==15){
 if (key[KEY_ESC]) {sair=1;}
 if (key[KEY_ALT] && key[KEY_F4]) {sair=1;}
-if (P[1].key_START_pressed==1) { timermenus=0; FadeCtr=255; FadeIN=0; FadeOUT=1; IntroMode=0; IntroTimer=0; DonationScreen=1; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_START)==1) { timermenus=0; FadeCtr=255; FadeIN=0; FadeOUT=1; IntroMode=0; IntroTimer=0; DonationScreen=1; }
 }
 
 if (IntroTimer==300-30){ FadeIN=1; FadeOUT=0; }
@@ -1101,6 +1292,15 @@ draw_sprite(bufferx, GAME_intro, 0, 0);
 stretch_blit(bufferx, bufferx, 0, 0, 640, 480, 0, 0, 640, 480);
 }
 
+//o restante do manifesto chega durante a intro; ao sair dela, espera o que faltar e valida
+if (Carregando==1) {
+if (hamoopi_loader_poll(&Carga) || IntroMode==0) {
+hamoopi_loader_finish(&Carga); Carregando=0;
+Avisa_Arquivos_Faltando(HamoopiError);
+LogicTimerLido=timer; //a espera nao conta como atraso
+}
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // DONATION SCREEN ----------------------------------------------------------
 /////////////////////////////////////////////////////////////////////////////
@@ -1115,7 +1315,7 @@ IntroTimer++;
 if (timermenus==15){
 if (key[KEY_ESC]) {sair=1;}
 if (key[KEY_ALT] && key[KEY_F4]) {sair=1;}
-if (P[1].key_START_pressed==1) { timermenus=0; FadeCtr=255; FadeIN=0; FadeOUT=1; DonationScreen=0; ApresentacaoMode=1; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_START)==1) { timermenus=0; FadeCtr=255; FadeIN=0; FadeOUT=1; DonationScreen=0; ApresentacaoMode=1; }
 }
 
 if (IntroTimer==300-30){ FadeIN=1; FadeOUT=0; }
@@ -1126,17 +1326,17 @@ rectfill(bufferx, 160,  20, 600, 150, makecol(255,255,255));
 rectfill(bufferx, 100, 370, 600, 460, makecol(255,255,255));
 
 if (strcmp (IDIOMA,"US")==0){
-textprintf_centre_ex(bufferx, font_19, 380, 40+15, makecol(000,000,000), -1, "Please donate any amount of" );
-textprintf_centre_ex(bufferx, font_19, 380, 65+15, makecol(000,000,000), -1, "   to keep project alive" );
-textprintf_centre_ex(bufferx, font_19, 380, 65+15, makecol(000,140,010), -1, "   BTC                        " );
-textprintf_centre_ex(bufferx, font_19, 320,   400, makecol(000,000,000), -1, "Thanks, Hamoopi Team" );
+textprintf_centre_cache_ex(bufferx, font_19, 380, 40+15, makecol(000,000,000), -1, "Please donate any amount of" );
+textprintf_centre_cache_ex(bufferx, font_19, 380, 65+15, makecol(000,000,000), -1, "   to keep project alive" );
+textprintf_centre_cache_ex(bufferx, font_19, 380, 65+15, makecol(000,140,010), -1, "   BTC                        " );
+textprintf_centre_cache_ex(bufferx, font_19, 320,   400, makecol(000,000,000), -1, "Thanks, Hamoopi Team" );
 }
 if (strcmp (IDIOMA,"BR")==0){
-textprintf_centre_ex(bufferx, font_19, 380, 30+10, makecol(000,000,000), -1, "Por favor considere fazer uma" );
-textprintf_centre_ex(bufferx, font_19, 380, 55+10, makecol(000,000,000), -1, "doação de qualquer quantia de" );
-textprintf_centre_ex(bufferx, font_19, 380, 80+10, makecol(000,000,000), -1, "   para manter o projeto vivo" );
-textprintf_centre_ex(bufferx, font_19, 380, 80+10, makecol(000,140,010), -1, "   BTC                            " );
-textprintf_centre_ex(bufferx, font_19, 320,   400, makecol(000,000,000), -1, "Obrigado, Equipe Hamoopi" );
+textprintf_centre_cache_ex(bufferx, font_19, 380, 30+10, makecol(000,000,000), -1, "Por favor considere fazer uma" );
+textprintf_centre_cache_ex(bufferx, font_19, 380, 55+10, makecol(000,000,000), -1, "doação de qualquer quantia de" );
+textprintf_centre_cache_ex(bufferx, font_19, 380, 80+10, makecol(000,000,000), -1, "   para manter o projeto vivo" );
+textprintf_centre_cache_ex(bufferx, font_19, 380, 80+10, makecol(000,140,010), -1, "   BTC                            " );
+textprintf_centre_cache_ex(bufferx, font_19, 320,   400, makecol(000,000,000), -1, "Obrigado, Equipe Hamoopi" );
 }
 
 stretch_blit(bufferx, bufferx, 0, 0, 640, 480, 0, 0, 640, 480);
@@ -1154,13 +1354,13 @@ draw_sprite(bufferx, GAME_logo, 0, 0);
 /*temporario*/ if (timermenus==0){ menu_op=2; } if(menu_op==1){ menu_op=2; } /*temporario*/
 
 if (timermenus==15){
-if (P[1].key_UP_pressed  ==1) { menu_op--; play_sample(cursor, 255, 128, 1000, 0); if (menu_op<1) { menu_op=5; }}
-if (P[1].key_DOWN_pressed==1) { menu_op++; play_sample(cursor, 255, 128, 1000, 0); if (menu_op>5) { menu_op=1; }}
-//if (P[1].key_START_pressed==1 && menu_op==1) { play_sample(confirm, 255, 128, 1000, 0); timermenus=0; FadeCtr=255; FadeIN=0; FadeOUT=1; menu_op=1; ApresentacaoMode=0; SelectCharMode=1; ModoHistoria=1; }
-if (P[1].key_START_pressed==1 && menu_op==2) { play_sample(confirm, 255, 128, 1000, 0); timermenus=0; FadeCtr=255; FadeIN=0; FadeOUT=1; menu_op=1; ApresentacaoMode=0; SelectCharMode=1; strcpy(ChoiceP2,""); strcpy(P[2].Name,""); }
-if (P[1].key_START_pressed==1 && menu_op==3) { play_sample(confirm, 255, 128, 1000, 0); timermenus=0; FadeCtr=255; FadeIN=0; FadeOUT=1; menu_op=1; ApresentacaoMode=0; EditMode=1; }
-if (P[1].key_START_pressed==1 && menu_op==4) { play_sample(confirm, 255, 128, 1000, 0); timermenus=0; FadeCtr=255; FadeIN=0; FadeOUT=1; menu_op=1; ApresentacaoMode=0; OptionsMode=1; options_op=1; }
-if (P[1].key_START_pressed==1 && menu_op==5) { sair=1; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_UP)  ==1) { menu_op--; play_sample(cursor, 255, 128, 1000, 0); if (menu_op<1) { menu_op=5; }}
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_DOWN)==1) { menu_op++; play_sample(cursor, 255, 128, 1000, 0); if (menu_op>5) { menu_op=1; }}
+//if (hamoopi_input_pressed(&P[1].Teclas, TECLA_START)==1 && menu_op==1) { play_sample(confirm, 255, 128, 1000, 0); timermenus=0; FadeCtr=255; FadeIN=0; FadeOUT=1; menu_op=1; ApresentacaoMode=0; SelectCharMode=1; ModoHistoria=1; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_START)==1 && menu_op==2) { play_sample(confirm, 255, 128, 1000, 0); timermenus=0; FadeCtr=255; FadeIN=0; FadeOUT=1; menu_op=1; ApresentacaoMode=0; SelectCharMode=1; strcpy(ChoiceP2,""); strcpy(P[2].Name,""); }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_START)==1 && menu_op==3) { play_sample(confirm, 255, 128, 1000, 0); timermenus=0; FadeCtr=255; FadeIN=0; FadeOUT=1; menu_op=1; ApresentacaoMode=0; EditMode=1; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_START)==1 && menu_op==4) { play_sample(confirm, 255, 128, 1000, 0); timermenus=0; FadeCtr=255; FadeIN=0; FadeOUT=1; menu_op=1; ApresentacaoMode=0; OptionsMode=1; options_op=1; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_START)==1 && menu_op==5) { sair=1; }
 if (key[KEY_ALT] && key[KEY_F4]) {sair=1;}
 if (key[KEY_ESC]) {sair=1;}
 }
@@ -1173,38 +1373,38 @@ if (menu_op==4){ draw_sprite(bufferx, spr_menu_icon, 180, 225+(espacamento*3));
 if (menu_op==5){ draw_sprite(bufferx, spr_menu_icon, 180, 225+(espacamento*4)); }
 
 if (strcmp (IDIOMA,"US")==0){
-textprintf_centre_ex(bufferx, font_30, 322, 227+30*0, makecol(000,000,000), -1, "ARCADE" );
-textprintf_centre_ex(bufferx, font_30, 322, 227+30*1, makecol(000,000,000), -1, "VERSUS" );
-textprintf_centre_ex(bufferx, font_30, 322, 227+30*2, makecol(000,000,000), -1, "EDITOR" );
-textprintf_centre_ex(bufferx, font_30, 322, 227+30*3, makecol(000,000,000), -1, "OPTIONS" );
-textprintf_centre_ex(bufferx, font_30, 322, 227+30*4, makecol(000,000,000), -1, "EXIT" );
-textprintf_centre_ex(bufferx, font_30, 320, 225+30*0, makecol(155,155,155), -1, "ARCADE" );
-textprintf_centre_ex(bufferx, font_30, 320, 225+30*1, makecol(255,255,255), -1, "VERSUS" );
-textprintf_centre_ex(bufferx, font_30, 320, 225+30*2, makecol(255,255,255), -1, "EDITOR" );
-textprintf_centre_ex(bufferx, font_30, 320, 225+30*3, makecol(255,255,255), -1, "OPTIONS" );
-textprintf_centre_ex(bufferx, font_30, 320, 225+30*4, makecol(255,010,005), -1, "EXIT" );
-if (menu_op==1) textprintf_centre_ex(bufferx, font_30, 320, 225+30*0, makecol(255,170,000), -1, "ARCADE" );
-if (menu_op==2) textprintf_centre_ex(bufferx, font_30, 320, 225+30*1, makecol(255,170,000), -1, "VERSUS" );
-if (menu_op==3) textprintf_centre_ex(bufferx, font_30, 320, 225+30*2, makecol(255,170,000), -1, "EDITOR" );
-if (menu_op==4) textprintf_centre_ex(bufferx, font_30, 320, 225+30*3, makecol(255,170,000), -1, "OPTIONS" );
-if (menu_op==5) textprintf_centre_ex(bufferx, font_30, 320, 225+30*4, makecol(255,170,000), -1, "EXIT" );
+textprintf_centre_cache_ex(bufferx, font_30, 322, 227+30*0, makecol(000,000,000), -1, "ARCADE" );
+textprintf_centre_cache_ex(bufferx, font_30, 322, 227+30*1, makecol(000,000,000), -1, "VERSUS" );
+textprintf_centre_cache_ex(bufferx, font_30, 322, 227+30*2, makecol(000,000,000), -1, "EDITOR" );
+textprintf_centre_cache_ex(bufferx, font_30, 322, 227+30*3, makecol(000,000,000), -1, "OPTIONS" );
+textprintf_centre_cache_ex(bufferx, font_30, 322, 227+30*4, makecol(000,000,000), -1, "EXIT" );
+textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*0, makecol(155,155,155), -1, "ARCADE" );
+textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*1, makecol(255,255,255), -1, "VERSUS" );
+textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*2, makecol(255,255,255), -1, "EDITOR" );
+textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*3, makecol(255,255,255), -1, "OPTIONS" );
+textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*4, makecol(255,010,005), -1, "EXIT" );
+if (menu_op==1) textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*0, makecol(255,170,000), -1, "ARCADE" );
+if (menu_op==2) textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*1, makecol(255,170,000), -1, "VERSUS" );
+if (menu_op==3) textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*2, makecol(255,170,000), -1, "EDITOR" );
+if (menu_op==4) textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*3, makecol(255,170,000), -1, "OPTIONS" );
+if (menu_op==5) textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*4, makecol(255,170,000), -1, "EXIT" );
 }
 if (strcmp (IDIOMA,"BR")==0){
-textprintf_centre_ex(bufferx, font_30, 322, 227+30*0, makecol(000,000,000), -1, "ARCADE" );
-textprintf_centre_ex(bufferx, font_30, 322, 227+30*1, makecol(000,000,000), -1, "VERSUS" );
-textprintf_centre_ex(bufferx, font_30, 322, 227+30*2, makecol(000,000,000), -1, "EDITOR" );
-textprintf_centre_ex(bufferx, font_30, 322, 227+30*3, makecol(000,000,000), -1, "OPÇÕES" );
-textprintf_centre_ex(bufferx, font_30, 322, 227+30*4, makecol(000,000,000), -1, "SAIR" );
-textprintf_centre_ex(bufferx, font_30, 320, 225+30*0, makecol(155,155,155), -1, "ARCADE" );
-textprintf_centre_ex(bufferx, font_30, 320, 225+30*1, makecol(255,255,255), -1, "VERSUS" );
-textprintf_centre_ex(bufferx, font_30, 320, 225+30*2, makecol(255,255,255), -1, "EDITOR" );
-textprintf_centre_ex(bufferx, font_30, 320, 225+30*3, makecol(255,255,255), -1, "OPÇÕES" );
-textprintf_centre_ex(bufferx, font_30, 320, 225+30*4, makecol(255,010,005), -1, "SAIR" );
-if (menu_op==1) textprintf_centre_ex(bufferx, font_30, 320, 225+30*0, makecol(255,170,000), -1, "ARCADE" );
-if (menu_op==2) textprintf_centre_ex(bufferx, font_30, 320, 225+30*1, makecol(255,170,000), -1, "VERSUS" );
-if (menu_op==3) textprintf_centre_ex(bufferx, font_30, 320, 225+30*2, makecol(255,170,000), -1, "EDITOR" );
-if (menu_op==4) textprintf_centre_ex(bufferx, font_30, 320, 225+30*3, makecol(255,170,000), -1, "OPÇÕES" );
-if (menu_op==5) textprintf_centre_ex(bufferx, font_30, 320, 225+30*4, makecol(255,170,000), -1, "SAIR" );
+textprintf_centre_cache_ex(bufferx, font_30, 322, 227+30*0, makecol(000,000,000), -1, "ARCADE" );
+textprintf_centre_cache_ex(bufferx, font_30, 322, 227+30*1, makecol(000,000,000), -1, "VERSUS" );
+textprintf_centre_cache_ex(bufferx, font_30, 322, 227+30*2, makecol(000,000,000), -1, "EDITOR" );
+textprintf_centre_cache_ex(bufferx, font_30, 322, 227+30*3, makecol(000,000,000), -1, "OPÇÕES" );
+textprintf_centre_cache_ex(bufferx, font_30, 322, 227+30*4, makecol(000,000,000), -1, "SAIR" );
+textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*0, makecol(155,155,155), -1, "ARCADE" );
+textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*1, makecol(255,255,255), -1, "VERSUS" );
+textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*2, makecol(255,255,255), -1, "EDITOR" );
+textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*3, makecol(255,255,255), -1, "OPÇÕES" );
+textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*4, makecol(255,010,005), -1, "SAIR" );
+if (menu_op==1) textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*0, makecol(255,170,000), -1, "ARCADE" );
+if (menu_op==2) textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*1, makecol(255,170,000), -1, "VERSUS" );
+if (menu_op==3) textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*2, makecol(255,170,000), -1, "EDITOR" );
+if (menu_op==4) textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*3, makecol(255,170,000), -1, "OPÇÕES" );
+if (menu_op==5) textprintf_centre_cache_ex(bufferx, font_30, 320, 225+30*4, makecol(255,170,000), -1, "SAIR" );
 }
 
 //versao da HAMOOPI
@@ -1223,9 +1423,9 @@ if (timermenus>=15){
 int salvardados=0;
 if (key[KEY_ESC]) { play_sample(back, 255, 128, 1000, 0); timermenus=0; FadeCtr=255; FadeIN=0; FadeOUT=1; menu_op=1; ApresentacaoMode=1; OptionsMode=0; salvardados=1; }
 if (key[KEY_ALT] && key[KEY_F4]) {sair=1;}
-if (P[1].key_START_pressed==1 && options_op==15) { play_sample(confirm, 255, 128, 1000, 0); timermenus=0; FadeCtr=255; FadeIN=0; FadeOUT=1; menu_op=1; ApresentacaoMode=1; OptionsMode=0; salvardados=1; }
-if (P[1].key_UP_pressed  ==1) { options_op--; play_sample(cursor, 255, 128, 1000, 0); if (options_op< 1) { options_op=15; }}
-if (P[1].key_DOWN_pressed==1) { options_op++; play_sample(cursor, 255, 128, 1000, 0); if (options_op>15) { options_op= 1; }}
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_START)==1 && options_op==15) { play_sample(confirm, 255, 128, 1000, 0); timermenus=0; FadeCtr=255; FadeIN=0; FadeOUT=1; menu_op=1; ApresentacaoMode=1; OptionsMode=0; salvardados=1; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_UP)  ==1) { options_op--; play_sample(cursor, 255, 128, 1000, 0); if (options_op< 1) { options_op=15; }}
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_DOWN)==1) { options_op++; play_sample(cursor, 255, 128, 1000, 0); if (options_op>15) { options_op= 1; }}
 
 if(salvardados==1){
 salvardados=0;
@@ -1297,168 +1497,168 @@ if (options_op==15){ draw_sprite(bufferx, spr_menu_icon, 130, 70+(espacamento*14
 
 if (strcmp (IDIOMA,"US")==0){
 draw_sprite(bufferx, flag_US, 422, 58);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 0), makecol(025,025,025), -1, "Language: %s", IDIOMA);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 1), makecol(025,025,025), -1, "Rounds: %i", RoundTotal);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 2), makecol(025,025,025), -1, "Timer: %i", RoundTime/60);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 3), makecol(025,025,025), -1, "P1 Energy: %i", P[1].Energy/10);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 4), makecol(025,025,025), -1, "P1 Special: %i", P[1].Special/10);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 5), makecol(025,025,025), -1, "P2 Energy: %i", P[2].Energy/10);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 6), makecol(025,025,025), -1, "P2 Special: %i", P[2].Special/10);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 7), makecol(025,025,025), -1, "Full Screen: %i", ModoFullscreen);
-if (WindowResNumber==1) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 320x240");
-if (WindowResNumber==2) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 640x480");
-if (WindowResNumber==3) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 720x480");
-if (WindowResNumber==4) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 800x600");
-if (WindowResNumber==5) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 960x640");
-if (WindowResNumber==6) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 960x720");
-if (WindowResNumber==7) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 1024x600");
-if (WindowResNumber==8) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 1280x720");
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 9), makecol(025,025,025), -1, "Draw Shadows: %i", op_desenhar_sombras );
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento*10), makecol(025,025,025), -1, "Enable Zoom: %i", op_Zoom );
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento*11), makecol(025,025,025), -1, "Draw Inputs: %i", Draw_Input );
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento*12), makecol(025,025,025), -1, "Frame Data: %i", op_ShowFrameData );
-
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento*14), makecol(025,025,025), -1, "EXIT" );
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 0), makecol(255,255,255), -1, "Language: %s", IDIOMA);
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 1), makecol(255,255,255), -1, "Rounds: %i", RoundTotal);
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 2), makecol(255,255,255), -1, "Timer: %i", RoundTime/60);
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 3), makecol(255,255,255), -1, "P1 Energy: %i", P[1].Energy/10);
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 4), makecol(255,255,255), -1, "P1 Special: %i", P[1].Special/10);
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 5), makecol(255,255,255), -1, "P2 Energy: %i", P[2].Energy/10);
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 6), makecol(255,255,255), -1, "P2 Special: %i", P[2].Special/10);
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 7), makecol(255,255,255), -1, "Full Screen: %i", ModoFullscreen);
-if (WindowResNumber==1) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 320x240");
-if (WindowResNumber==2) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 640x480");
-if (WindowResNumber==3) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 720x480");
-if (WindowResNumber==4) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 800x600");
-if (WindowResNumber==5) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 960x640");
-if (WindowResNumber==6) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 960x720");
-if (WindowResNumber==7) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 1024x600");
-if (WindowResNumber==8) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 1280x720");
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 9), makecol(255,255,255), -1, "Draw Shadows: %i", op_desenhar_sombras );
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento*10), makecol(255,255,255), -1, "Enable Zoom: %i", op_Zoom );
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento*11), makecol(255,255,255), -1, "Draw Inputs: %i", Draw_Input );
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento*12), makecol(255,255,255), -1, "Frame Data: %i", op_ShowFrameData );
-
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento*14), makecol(255,010,005), -1, "EXIT" );
-if (options_op== 1) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 0), makecol(255,170,000), -1, "Language: %s", IDIOMA);
-if (options_op== 2) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 1), makecol(255,170,000), -1, "Rounds: %i", RoundTotal);
-if (options_op== 3) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 2), makecol(255,170,000), -1, "Timer: %i", RoundTime/60);
-if (options_op== 4) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 3), makecol(255,170,000), -1, "P1 Energy: %i", P[1].Energy/10);
-if (options_op== 5) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 4), makecol(255,170,000), -1, "P1 Special: %i", P[1].Special/10);
-if (options_op== 6) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 5), makecol(255,170,000), -1, "P2 Energy: %i", P[2].Energy/10);
-if (options_op== 7) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 6), makecol(255,170,000), -1, "P2 Special: %i", P[2].Special/10);
-if (options_op== 8) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 7), makecol(255,170,000), -1, "Full Screen: %i", ModoFullscreen );
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 0), makecol(025,025,025), -1, "Language: %s", IDIOMA);
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 1), makecol(025,025,025), -1, "Rounds: %i", RoundTotal);
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 2), makecol(025,025,025), -1, "Timer: %i", RoundTime/60);
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 3), makecol(025,025,025), -1, "P1 Energy: %i", P[1].Energy/10);
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 4), makecol(025,025,025), -1, "P1 Special: %i", P[1].Special/10);
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 5), makecol(025,025,025), -1, "P2 Energy: %i", P[2].Energy/10);
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 6), makecol(025,025,025), -1, "P2 Special: %i", P[2].Special/10);
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 7), makecol(025,025,025), -1, "Full Screen: %i", ModoFullscreen);
+if (WindowResNumber==1) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 320x240");
+if (WindowResNumber==2) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 640x480");
+if (WindowResNumber==3) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 720x480");
+if (WindowResNumber==4) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 800x600");
+if (WindowResNumber==5) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 960x640");
+if (WindowResNumber==6) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 960x720");
+if (WindowResNumber==7) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 1024x600");
+if (WindowResNumber==8) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 1280x720");
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 9), makecol(025,025,025), -1, "Draw Shadows: %i", op_desenhar_sombras );
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento*10), makecol(025,025,025), -1, "Enable Zoom: %i", op_Zoom );
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento*11), makecol(025,025,025), -1, "Draw Inputs: %i", Draw_Input );
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento*12), makecol(025,025,025), -1, "Frame Data: %i", op_ShowFrameData );
+
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento*14), makecol(025,025,025), -1, "EXIT" );
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 0), makecol(255,255,255), -1, "Language: %s", IDIOMA);
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 1), makecol(255,255,255), -1, "Rounds: %i", RoundTotal);
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 2), makecol(255,255,255), -1, "Timer: %i", RoundTime/60);
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 3), makecol(255,255,255), -1, "P1 Energy: %i", P[1].Energy/10);
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 4), makecol(255,255,255), -1, "P1 Special: %i", P[1].Special/10);
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 5), makecol(255,255,255), -1, "P2 Energy: %i", P[2].Energy/10);
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 6), makecol(255,255,255), -1, "P2 Special: %i", P[2].Special/10);
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 7), makecol(255,255,255), -1, "Full Screen: %i", ModoFullscreen);
+if (WindowResNumber==1) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 320x240");
+if (WindowResNumber==2) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 640x480");
+if (WindowResNumber==3) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 720x480");
+if (WindowResNumber==4) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 800x600");
+if (WindowResNumber==5) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 960x640");
+if (WindowResNumber==6) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 960x720");
+if (WindowResNumber==7) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 1024x600");
+if (WindowResNumber==8) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 1280x720");
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 9), makecol(255,255,255), -1, "Draw Shadows: %i", op_desenhar_sombras );
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*10), makecol(255,255,255), -1, "Enable Zoom: %i", op_Zoom );
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*11), makecol(255,255,255), -1, "Draw Inputs: %i", Draw_Input );
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*12), makecol(255,255,255), -1, "Frame Data: %i", op_ShowFrameData );
+
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*14), makecol(255,010,005), -1, "EXIT" );
+if (options_op== 1) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 0), makecol(255,170,000), -1, "Language: %s", IDIOMA);
+if (options_op== 2) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 1), makecol(255,170,000), -1, "Rounds: %i", RoundTotal);
+if (options_op== 3) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 2), makecol(255,170,000), -1, "Timer: %i", RoundTime/60);
+if (options_op== 4) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 3), makecol(255,170,000), -1, "P1 Energy: %i", P[1].Energy/10);
+if (options_op== 5) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 4), makecol(255,170,000), -1, "P1 Special: %i", P[1].Special/10);
+if (options_op== 6) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 5), makecol(255,170,000), -1, "P2 Energy: %i", P[2].Energy/10);
+if (options_op== 7) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 6), makecol(255,170,000), -1, "P2 Special: %i", P[2].Special/10);
+if (options_op== 8) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 7), makecol(255,170,000), -1, "Full Screen: %i", ModoFullscreen );
 if (options_op== 9){
-if (WindowResNumber==1) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 320x240");
-if (WindowResNumber==2) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 640x480");
-if (WindowResNumber==3) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 720x480");
-if (WindowResNumber==4) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 800x600");
-if (WindowResNumber==5) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 960x640");
-if (WindowResNumber==6) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 960x720");
-if (WindowResNumber==7) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 1024x600");
-if (WindowResNumber==8) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 1280x720");
+if (WindowResNumber==1) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 320x240");
+if (WindowResNumber==2) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 640x480");
+if (WindowResNumber==3) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 720x480");
+if (WindowResNumber==4) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 800x600");
+if (WindowResNumber==5) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 960x640");
+if (WindowResNumber==6) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 960x720");
+if (WindowResNumber==7) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 1024x600");
+if (WindowResNumber==8) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 1280x720");
 }
-if (options_op==10) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 9), makecol(255,170,000), -1, "Draw Shadows: %i", op_desenhar_sombras );
-if (options_op==11) textprintf_ex(bufferx, font_20, 190, 80+(espacamento*10), makecol(255,170,000), -1, "Enable Zoom: %i", op_Zoom );
-if (options_op==12) textprintf_ex(bufferx, font_20, 190, 80+(espacamento*11), makecol(255,170,000), -1, "Draw Inputs: %i", Draw_Input );
-if (options_op==13) textprintf_ex(bufferx, font_20, 190, 80+(espacamento*12), makecol(255,170,000), -1, "Frame Data: %i", op_ShowFrameData );
+if (options_op==10) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 9), makecol(255,170,000), -1, "Draw Shadows: %i", op_desenhar_sombras );
+if (options_op==11) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*10), makecol(255,170,000), -1, "Enable Zoom: %i", op_Zoom );
+if (options_op==12) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*11), makecol(255,170,000), -1, "Draw Inputs: %i", Draw_Input );
+if (options_op==13) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*12), makecol(255,170,000), -1, "Frame Data: %i", op_ShowFrameData );
 
-if (options_op==15) textprintf_ex(bufferx, font_20, 190, 80+(espacamento*14), makecol(255,170,000), -1, "EXIT" );
+if (options_op==15) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*14), makecol(255,170,000), -1, "EXIT" );
 }
 
 if (strcmp (IDIOMA,"BR")==0){
 draw_sprite(bufferx, flag_BR, 422, 58);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 0), makecol(025,025,025), -1, "Idioma: %s", IDIOMA);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 1), makecol(025,025,025), -1, "Rounds: %i", RoundTotal);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 2), makecol(025,025,025), -1, "Relógio: %i", RoundTime/60);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 3), makecol(025,025,025), -1, "P1 Energia: %i", P[1].Energy/10);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 4), makecol(025,025,025), -1, "P1 Especial: %i", P[1].Special/10);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 5), makecol(025,025,025), -1, "P2 Energia: %i", P[2].Energy/10);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 6), makecol(025,025,025), -1, "P2 Especial: %i", P[2].Special/10);
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 7), makecol(025,025,025), -1, "Tela Cheia: %i", ModoFullscreen);
-if (WindowResNumber==1) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 320x240");
-if (WindowResNumber==2) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 640x480");
-if (WindowResNumber==3) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 720x480");
-if (WindowResNumber==4) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 800x600");
-if (WindowResNumber==5) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 960x640");
-if (WindowResNumber==6) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 960x720");
-if (WindowResNumber==7) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 1024x600");
-if (WindowResNumber==8) textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 1280x720");
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento* 9), makecol(025,025,025), -1, "Desenhar Sombras: %i", op_desenhar_sombras );
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento*10), makecol(025,025,025), -1, "Ativar Zoom: %i", op_Zoom );
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento*11), makecol(025,025,025), -1, "Desenhar Inputs: %i", Draw_Input );
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento*12), makecol(025,025,025), -1, "Frame Data: %i", op_ShowFrameData );
-
-textprintf_ex(bufferx, font_20, 192, 82+(espacamento*14), makecol(025,025,025), -1, "SAIR" );
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 0), makecol(255,255,255), -1, "Idioma: %s", IDIOMA);
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 1), makecol(255,255,255), -1, "Rounds: %i", RoundTotal);
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 2), makecol(255,255,255), -1, "Relógio: %i", RoundTime/60);
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 3), makecol(255,255,255), -1, "P1 Energia: %i", P[1].Energy/10);
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 4), makecol(255,255,255), -1, "P1 Especial: %i", P[1].Special/10);
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 5), makecol(255,255,255), -1, "P2 Energia: %i", P[2].Energy/10);
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 6), makecol(255,255,255), -1, "P2 Especial: %i", P[2].Special/10);
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 7), makecol(255,255,255), -1, "Tela Cheia: %i", ModoFullscreen);
-if (WindowResNumber==1) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 320x240");
-if (WindowResNumber==2) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 640x480");
-if (WindowResNumber==3) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 720x480");
-if (WindowResNumber==4) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 800x600");
-if (WindowResNumber==5) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 960x640");
-if (WindowResNumber==6) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 960x720");
-if (WindowResNumber==7) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 1024x600");
-if (WindowResNumber==8) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 1280x720");
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 9), makecol(255,255,255), -1, "Desenhar Sombras: %i", op_desenhar_sombras );
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento*10), makecol(255,255,255), -1, "Ativar Zoom: %i", op_Zoom );
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento*11), makecol(255,255,255), -1, "Desenhar Inputs: %i", Draw_Input );
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento*12), makecol(255,255,255), -1, "Frame Data: %i", op_ShowFrameData );
-
-textprintf_ex(bufferx, font_20, 190, 80+(espacamento*14), makecol(255,010,005), -1, "SAIR" );
-if (options_op== 1) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 0), makecol(255,170,000), -1, "Idioma: %s", IDIOMA);
-if (options_op== 2) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 1), makecol(255,170,000), -1, "Rounds: %i", RoundTotal);
-if (options_op== 3) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 2), makecol(255,170,000), -1, "Relógio: %i", RoundTime/60);
-if (options_op== 4) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 3), makecol(255,170,000), -1, "P1 Energia: %i", P[1].Energy/10);
-if (options_op== 5) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 4), makecol(255,170,000), -1, "P1 Especial: %i", P[1].Special/10);
-if (options_op== 6) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 5), makecol(255,170,000), -1, "P2 Energia: %i", P[2].Energy/10);
-if (options_op== 7) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 6), makecol(255,170,000), -1, "P2 Especial: %i", P[2].Special/10);
-if (options_op== 8) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 7), makecol(255,170,000), -1, "Tela Cheia: %i", ModoFullscreen );
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 0), makecol(025,025,025), -1, "Idioma: %s", IDIOMA);
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 1), makecol(025,025,025), -1, "Rounds: %i", RoundTotal);
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 2), makecol(025,025,025), -1, "Relógio: %i", RoundTime/60);
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 3), makecol(025,025,025), -1, "P1 Energia: %i", P[1].Energy/10);
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 4), makecol(025,025,025), -1, "P1 Especial: %i", P[1].Special/10);
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 5), makecol(025,025,025), -1, "P2 Energia: %i", P[2].Energy/10);
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 6), makecol(025,025,025), -1, "P2 Especial: %i", P[2].Special/10);
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 7), makecol(025,025,025), -1, "Tela Cheia: %i", ModoFullscreen);
+if (WindowResNumber==1) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 320x240");
+if (WindowResNumber==2) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 640x480");
+if (WindowResNumber==3) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 720x480");
+if (WindowResNumber==4) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 800x600");
+if (WindowResNumber==5) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 960x640");
+if (WindowResNumber==6) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 960x720");
+if (WindowResNumber==7) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 1024x600");
+if (WindowResNumber==8) textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 8), makecol(025,025,025), -1, "Win Res: 1280x720");
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento* 9), makecol(025,025,025), -1, "Desenhar Sombras: %i", op_desenhar_sombras );
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento*10), makecol(025,025,025), -1, "Ativar Zoom: %i", op_Zoom );
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento*11), makecol(025,025,025), -1, "Desenhar Inputs: %i", Draw_Input );
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento*12), makecol(025,025,025), -1, "Frame Data: %i", op_ShowFrameData );
+
+textprintf_cache_ex(bufferx, font_20, 192, 82+(espacamento*14), makecol(025,025,025), -1, "SAIR" );
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 0), makecol(255,255,255), -1, "Idioma: %s", IDIOMA);
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 1), makecol(255,255,255), -1, "Rounds: %i", RoundTotal);
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 2), makecol(255,255,255), -1, "Relógio: %i", RoundTime/60);
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 3), makecol(255,255,255), -1, "P1 Energia: %i", P[1].Energy/10);
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 4), makecol(255,255,255), -1, "P1 Especial: %i", P[1].Special/10);
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 5), makecol(255,255,255), -1, "P2 Energia: %i", P[2].Energy/10);
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 6), makecol(255,255,255), -1, "P2 Especial: %i", P[2].Special/10);
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 7), makecol(255,255,255), -1, "Tela Cheia: %i", ModoFullscreen);
+if (WindowResNumber==1) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 320x240");
+if (WindowResNumber==2) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 640x480");
+if (WindowResNumber==3) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 720x480");
+if (WindowResNumber==4) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 800x600");
+if (WindowResNumber==5) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 960x640");
+if (WindowResNumber==6) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 960x720");
+if (WindowResNumber==7) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 1024x600");
+if (WindowResNumber==8) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,255,255), -1, "Win Res: 1280x720");
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 9), makecol(255,255,255), -1, "Desenhar Sombras: %i", op_desenhar_sombras );
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*10), makecol(255,255,255), -1, "Ativar Zoom: %i", op_Zoom );
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*11), makecol(255,255,255), -1, "Desenhar Inputs: %i", Draw_Input );
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*12), makecol(255,255,255), -1, "Frame Data: %i", op_ShowFrameData );
+
+textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*14), makecol(255,010,005), -1, "SAIR" );
+if (options_op== 1) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 0), makecol(255,170,000), -1, "Idioma: %s", IDIOMA);
+if (options_op== 2) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 1), makecol(255,170,000), -1, "Rounds: %i", RoundTotal);
+if (options_op== 3) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 2), makecol(255,170,000), -1, "Relógio: %i", RoundTime/60);
+if (options_op== 4) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 3), makecol(255,170,000), -1, "P1 Energia: %i", P[1].Energy/10);
+if (options_op== 5) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 4), makecol(255,170,000), -1, "P1 Especial: %i", P[1].Special/10);
+if (options_op== 6) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 5), makecol(255,170,000), -1, "P2 Energia: %i", P[2].Energy/10);
+if (options_op== 7) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 6), makecol(255,170,000), -1, "P2 Especial: %i", P[2].Special/10);
+if (options_op== 8) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 7), makecol(255,170,000), -1, "Tela Cheia: %i", ModoFullscreen );
 if (options_op== 9){
-if (WindowResNumber==1) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 320x240");
-if (WindowResNumber==2) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 640x480");
-if (WindowResNumber==3) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 720x480");
-if (WindowResNumber==4) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 800x600");
-if (WindowResNumber==5) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 960x640");
-if (WindowResNumber==6) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 960x720");
-if (WindowResNumber==7) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 1024x600");
-if (WindowResNumber==8) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 1280x720");
+if (WindowResNumber==1) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 320x240");
+if (WindowResNumber==2) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 640x480");
+if (WindowResNumber==3) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 720x480");
+if (WindowResNumber==4) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 800x600");
+if (WindowResNumber==5) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 960x640");
+if (WindowResNumber==6) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 960x720");
+if (WindowResNumber==7) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 1024x600");
+if (WindowResNumber==8) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 8), makecol(255,170,000), -1, "Win Res: 1280x720");
 }
-if (options_op==10) textprintf_ex(bufferx, font_20, 190, 80+(espacamento* 9), makecol(255,170,000), -1, "Desenhar Sombras: %i", op_desenhar_sombras );
-if (options_op==11) textprintf_ex(bufferx, font_20, 190, 80+(espacamento*10), makecol(255,170,000), -1, "Ativar Zoom: %i", op_Zoom );
-if (options_op==12) textprintf_ex(bufferx, font_20, 190, 80+(espacamento*11), makecol(255,170,000), -1, "Desenhar Inputs: %i", Draw_Input );
-if (options_op==13) textprintf_ex(bufferx, font_20, 190, 80+(espacamento*12), makecol(255,170,000), -1, "Frame Data: %i", op_ShowFrameData );
+if (options_op==10) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento* 9), makecol(255,170,000), -1, "Desenhar Sombras: %i", op_desenhar_sombras );
+if (options_op==11) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*10), makecol(255,170,000), -1, "Ativar Zoom: %i", op_Zoom );
+if (options_op==12) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*11), makecol(255,170,000), -1, "Desenhar Inputs: %i", Draw_Input );
+if (options_op==13) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*12), makecol(255,170,000), -1, "Frame Data: %i", op_ShowFrameData );
 
-if (options_op==15) textprintf_ex(bufferx, font_20, 190, 80+(espacamento*14), makecol(255,170,000), -1, "SAIR" );
+if (options_op==15) textprintf_cache_ex(bufferx, font_20, 190, 80+(espacamento*14), makecol(255,170,000), -1, "SAIR" );
 }
 
 //altera valores configuraveis
-if (P[1].key_RIGHT_pressed ==1 && options_op==1 ) { strcpy(IDIOMA, "BR"); }
-if (P[1].key_LEFT_pressed  ==1 && options_op==1 ) { strcpy(IDIOMA, "US"); }
-if (P[1].key_RIGHT_pressed ==1 && options_op==2 && RoundTotal<=  4) { RoundTotal=RoundTotal+1; }
-if (P[1].key_LEFT_pressed  ==1 && options_op==2 && RoundTotal>=  2) { RoundTotal=RoundTotal-1; }
-if ((/*P[1].key_RIGHT_pressed ==1 || */P[1].key_RIGHT_hold==1) && options_op==3 && RoundTime<=60*99) { RoundTime =RoundTime+60; if(RoundTime>60*99)RoundTime=60*99; }
-if ((/*P[1].key_LEFT_pressed  ==1 || */P[1].key_LEFT_hold==1) && options_op==3 && RoundTime>=66*10) { RoundTime =RoundTime-60; if(RoundTime<60*10)RoundTime=60*10; }
-if (P[1].key_RIGHT_pressed ==1 && options_op==4 && P[1].Energy<1000) { P[1].Energy =P[1].Energy+100; }
-if (P[1].key_LEFT_pressed  ==1 && options_op==4 && P[1].Energy> 100) { P[1].Energy =P[1].Energy-100; }
-if (P[1].key_RIGHT_pressed ==1 && options_op==5 && P[1].Special<1000) { P[1].Special =P[1].Special+100; }
-if (P[1].key_LEFT_pressed  ==1 && options_op==5 && P[1].Special>   0) { P[1].Special =P[1].Special-100; }
-if (P[1].key_RIGHT_pressed ==1 && options_op==6 && P[2].Energy<1000) { P[2].Energy =P[2].Energy+100; }
-if (P[1].key_LEFT_pressed  ==1 && options_op==6 && P[2].Energy> 100) { P[2].Energy =P[2].Energy-100; }
-if (P[1].key_RIGHT_pressed ==1 && options_op==7 && P[2].Special<1000) { P[2].Special =P[2].Special+100; }
-if (P[1].key_LEFT_pressed  ==1 && options_op==7 && P[2].Special>   0) { P[2].Special =P[2].Special-100; }
-if (P[1].key_RIGHT_pressed ==1 && options_op==8 && ModoFullscreen==0 ) { ModoFullscreen=1; set_gfx_mode(GFX_AUTODETECT_FULLSCREEN, 640, 480, 0, 0); }
-if (P[1].key_LEFT_pressed  ==1 && options_op==8 && ModoFullscreen==1 ) { ModoFullscreen=0; set_gfx_mode(GFX_AUTODETECT_WINDOWED, WindowResX, WindowResY, 0, 0); }
-if (P[1].key_RIGHT_pressed ==1 && options_op==9 && WindowResNumber<=7) { WindowResNumber++; }
-if (P[1].key_LEFT_pressed  ==1 && options_op==9 && WindowResNumber>=2) { WindowResNumber--; }
-if (P[1].key_START_pressed ==1 && options_op==9 && ModoFullscreen==0) {
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT) ==1 && options_op==1 ) { strcpy(IDIOMA, "BR"); }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT)  ==1 && options_op==1 ) { strcpy(IDIOMA, "US"); }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT) ==1 && options_op==2 && RoundTotal<=  4) { RoundTotal=RoundTotal+1; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT)  ==1 && options_op==2 && RoundTotal>=  2) { RoundTotal=RoundTotal-1; }
+if ((/*hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT) ==1 || */hamoopi_input_hold(&P[1].Teclas, TECLA_RIGHT)==1) && options_op==3 && RoundTime<=60*99) { RoundTime =RoundTime+60; if(RoundTime>60*99)RoundTime=60*99; }
+if ((/*hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT)  ==1 || */hamoopi_input_hold(&P[1].Teclas, TECLA_LEFT)==1) && options_op==3 && RoundTime>=66*10) { RoundTime =RoundTime-60; if(RoundTime<60*10)RoundTime=60*10; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT) ==1 && options_op==4 && P[1].Energy<1000) { P[1].Energy =P[1].Energy+100; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT)  ==1 && options_op==4 && P[1].Energy> 100) { P[1].Energy =P[1].Energy-100; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT) ==1 && options_op==5 && P[1].Special<1000) { P[1].Special =P[1].Special+100; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT)  ==1 && options_op==5 && P[1].Special>   0) { P[1].Special =P[1].Special-100; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT) ==1 && options_op==6 && P[2].Energy<1000) { P[2].Energy =P[2].Energy+100; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT)  ==1 && options_op==6 && P[2].Energy> 100) { P[2].Energy =P[2].Energy-100; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT) ==1 && options_op==7 && P[2].Special<1000) { P[2].Special =P[2].Special+100; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT)  ==1 && options_op==7 && P[2].Special>   0) { P[2].Special =P[2].Special-100; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT) ==1 && options_op==8 && ModoFullscreen==0 ) { ModoFullscreen=1; set_gfx_mode(GFX_AUTODETECT_FULLSCREEN, 640, 480, 0, 0); }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT)  ==1 && options_op==8 && ModoFullscreen==1 ) { ModoFullscreen=0; set_gfx_mode(GFX_AUTODETECT_WINDOWED, WindowResX, WindowResY, 0, 0); }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT) ==1 && options_op==9 && WindowResNumber<=7) { WindowResNumber++; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT)  ==1 && options_op==9 && WindowResNumber>=2) { WindowResNumber--; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_START) ==1 && options_op==9 && ModoFullscreen==0) {
 if(WindowResNumber==1) { WindowResX= 320; WindowResY=240; }
 if(WindowResNumber==2) { WindowResX= 640; WindowResY=480; }
 if(WindowResNumber==3) { WindowResX= 720; WindowResY=480; }
@@ -1469,14 +1669,14 @@ if(WindowResNumber==7) { WindowResX=1024; WindowResY=600; }
 if(WindowResNumber==8) { WindowResX=1280; WindowResY=720; }
 set_gfx_mode(GFX_AUTODETECT_WINDOWED, WindowResX, WindowResY, 0, 0);
 }
-if (P[1].key_LEFT_pressed  ==1 && options_op==10) op_desenhar_sombras=0;
-if (P[1].key_RIGHT_pressed ==1 && options_op==10) op_desenhar_sombras=1;
-if (P[1].key_LEFT_pressed  ==1 && options_op==11) op_Zoom=0;
-if (P[1].key_RIGHT_pressed ==1 && options_op==11) op_Zoom=1;
-if (P[1].key_LEFT_pressed  ==1 && options_op==12) Draw_Input=0;
-if (P[1].key_RIGHT_pressed ==1 && options_op==12) Draw_Input=1;
-if (P[1].key_LEFT_pressed  ==1 && options_op==13) op_ShowFrameData=0;
-if (P[1].key_RIGHT_pressed ==1 && options_op==13) op_ShowFrameData=1;
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT)  ==1 && options_op==10) op_desenhar_sombras=0;
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT) ==1 && options_op==10) op_desenhar_sombras=1;
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT)  ==1 && options_op==11) op_Zoom=0;
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT) ==1 && options_op==11) op_Zoom=1;
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT)  ==1 && options_op==12) Draw_Input=0;
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT) ==1 && options_op==12) Draw_Input=1;
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT)  ==1 && options_op==13) op_ShowFrameData=0;
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT) ==1 && options_op==13) op_ShowFrameData=1;
 
 stretch_blit(bufferx, bufferx, 0, 0, 640, 480, 0, 0, 640, 480);
 }
@@ -1523,10 +1723,10 @@ play_midi(bgm_apresentacao, 1); //bgm
 if (key[KEY_ALT] && key[KEY_F4]) {sair=1;}
 
 //seleciona o personagem P1
-if (P[1].key_RIGHT_pressed==1 && NumPersonagensEscolhidos<2){ SelectCharP1ID++; }
-if (P[1].key_LEFT_pressed ==1 && NumPersonagensEscolhidos<2){ SelectCharP1ID--; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT)==1 && NumPersonagensEscolhidos<2){ SelectCharP1ID++; }
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT) ==1 && NumPersonagensEscolhidos<2){ SelectCharP1ID--; }
 char SelectCharP1Caminho[99];
-if (P[1].key_RIGHT_pressed==1 && (strcmp( ChoiceP1,"") ==0)) {
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT)==1 && (strcmp( ChoiceP1,"") ==0)) {
 play_sample(cursor, 255, 128, 1000, 0);
 if(SelectCharP1ID>Qtde_Personagens_Instalados) SelectCharP1ID=1;
 if (SelectCharP1ID==1){ sprintf(P1BIGDisplaystring, "data/chars/%s/000_00.pcx", Lista_de_Personagens_Instalados[1]);	}
@@ -1540,7 +1740,7 @@ if (SelectCharP1ID==8){ sprintf(P1BIGDisplaystring, "data/chars/%s/000_00.pcx",
 P1BIGDisplay = load_bitmap(P1BIGDisplaystring, NULL);
 if (!P1BIGDisplay) { P1BIGDisplay=load_bitmap("data/system/000_00.pcx", NULL); }
 }
-if (P[1].key_LEFT_pressed ==1 && (strcmp( ChoiceP1,"") ==0)) {
+if (hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT) ==1 && (strcmp( ChoiceP1,"") ==0)) {
 play_sample(cursor, 255, 128, 1000, 0);
 if(SelectCharP1ID<1) SelectCharP1ID=Qtde_Personagens_Instalados;
 if (SelectCharP1ID==8){ sprintf(P1BIGDisplaystring, "data/chars/%s/000_00.pcx", Lista_de_Personagens_Instalados[8]);	}
@@ -1556,9 +1756,9 @@ if (!P1BIGDisplay) { P1BIGDisplay=load_bitmap("data/system/000_00.pcx", NULL); }
 }
 
 //seleciona o personagem P2
-if (P[2].key_RIGHT_pressed==1 && NumPersonagensEscolhidos<2){ SelectCharP2ID++; }
-if (P[2].key_LEFT_pressed ==1 && NumPersonagensEscolhidos<2){ SelectCharP2ID--; }
-if (P[2].key_RIGHT_pressed==1 && (strcmp( ChoiceP2,"") ==0)) {
+if (hamoopi_input_pressed(&P[2].Teclas, TECLA_RIGHT)==1 && NumPersonagensEscolhidos<2){ SelectCharP2ID++; }
+if (hamoopi_input_pressed(&P[2].Teclas, TECLA_LEFT) ==1 && NumPersonagensEscolhidos<2){ SelectCharP2ID--; }
+if (hamoopi_input_pressed(&P[2].Teclas, TECLA_RIGHT)==1 && (strcmp( ChoiceP2,"") ==0)) {
 play_sample(cursor, 255, 128, 1000, 0);
 if(SelectCharP2ID>Qtde_Personagens_Instalados) SelectCharP2ID=1;
 if (SelectCharP2ID==1){ sprintf(P2BIGDisplaystring, "data/chars/%s/000_00.pcx", Lista_de_Personagens_Instalados[1]); }
@@ -1572,7 +1772,7 @@ if (SelectCharP2ID==8){ sprintf(P2BIGDisplaystring, "data/chars/%s/000_00.pcx",
 P2BIGDisplay = load_bitmap(P2BIGDisplaystring, NULL);
 if (!P2BIGDisplay) { P2BIGDisplay=load_bitmap("data/system/000_00.pcx", NULL); }
 }
-if (P[2].key_LEFT_pressed ==1 && (strcmp( ChoiceP2,"") ==0)) {
+if (hamoopi_input_pressed(&P[2].Teclas, TECLA_LEFT) ==1 && (strcmp( ChoiceP2,"") ==0)) {
 play_sample(cursor, 255, 128, 1000, 0);
 if(SelectCharP2ID<1) SelectCharP2ID=Qtde_Personagens_Instalados;
 if (SelectCharP2ID==8){ sprintf(P2BIGDisplaystring, "data/chars/%s/000_00.pcx", Lista_de_Personagens_Instalados[8]);	}
@@ -1616,12 +1816,12 @@ SelectCharTimerAnim++; if (SelectCharTimerAnim>5) { SelectCharTimerAnim=0; } //u
 draw_sprite(bufferx, SELECT_CHARS, 0, 0); //bg
 if (NumPersonagensEscolhidos<2) {
 if (strcmp (IDIOMA,"US")==0){
-textprintf_centre_ex(bufferx, font_20, 323, 5, makecol(000,000,000), -1, "Select your Character"); //sombra do texto
-textprintf_centre_ex(bufferx, font_20, 320, 2, makecol(255,255,255), -1, "Select your Character"); //texto
+textprintf_centre_cache_ex(bufferx, font_20, 323, 5, makecol(000,000,000), -1, "Select your Character"); //sombra do texto
+textprintf_centre_cache_ex(bufferx, font_20, 320, 2, makecol(255,255,255), -1, "Select your Character"); //texto
 }
 if (strcmp (IDIOMA,"BR")==0){
-textprintf_centre_ex(bufferx, font_20, 323, 5, makecol(000,000,000), -1, "Escolha seu Personagem"); //sombra do texto
-textprintf_centre_ex(bufferx, font_20, 320, 2, makecol(255,255,255), -1, "Escolha seu Personagem"); //texto
+textprintf_centre_cache_ex(bufferx, font_20, 323, 5, makecol(000,000,000), -1, "Escolha seu Personagem"); //sombra do texto
+textprintf_centre_cache_ex(bufferx, font_20, 320, 2, makecol(255,255,255), -1, "Escolha seu Personagem"); //texto
 }
 }
 
@@ -1655,12 +1855,12 @@ draw_sprite(bufferx, spr_ponteiro, MapCenterX+MapPosX-16, MapCenterY+MapPosY-16)
 
 draw_sprite(bufferx, SELECT_BG, 20, 405);
 if (strcmp (IDIOMA,"US")==0){
-textprintf_centre_ex(bufferx, font_20, 323, 410, makecol(000,000,000), -1, "Background Choice");
-textprintf_centre_ex(bufferx, font_20, 320, 407, makecol(255,255,255), -1, "Background Choice");
+textprintf_centre_cache_ex(bufferx, font_20, 323, 410, makecol(000,000,000), -1, "Background Choice");
+textprintf_centre_cache_ex(bufferx, font_20, 320, 407, makecol(255,255,255), -1, "Background Choice");
 }
 if (strcmp (IDIOMA,"BR")==0){
-textprintf_centre_ex(bufferx, font_20, 323, 410, makecol(000,000,000), -1, "Escolha o Cenario");
-textprintf_centre_ex(bufferx, font_20, 320, 407, makecol(255,255,255), -1, "Escolha o Cenario");
+textprintf_centre_cache_ex(bufferx, font_20, 323, 410, makecol(000,000,000), -1, "Escolha o Cenario");
+textprintf_centre_cache_ex(bufferx, font_20, 320, 407, makecol(255,255,255), -1, "Escolha o Cenario");
 }
 
 //desenha nome do cenario na tela
@@ -1674,15 +1874,15 @@ if (SelectBGID==5) { strcpy(bg_read, (char *)get_config_string("BACKGROUNDS", "b
 if (SelectBGID==6) { strcpy(bg_read, (char *)get_config_string("BACKGROUNDS", "bg6", "")); }
 if (SelectBGID==7) { strcpy(bg_read, (char *)get_config_string("BACKGROUNDS", "bg7", "")); }
 if (SelectBGID==8) { strcpy(bg_read, (char *)get_config_string("BACKGROUNDS", "bg8", "")); }
-textprintf_centre_ex(bufferx, font_20, 322, 439, makecol(000,000,000), -1, "%s", bg_read);
-textprintf_centre_ex(bufferx, font_20, 320, 437, makecol(255,255,000), -1, "%s", bg_read);
+textprintf_centre_cache_ex(bufferx, font_20, 322, 439, makecol(000,000,000), -1, "%s", bg_read);
+textprintf_centre_cache_ex(bufferx, font_20, 320, 437, makecol(255,255,000), -1, "%s", bg_read);
 }
 
 //escolha dos personagens
 //p1
 if (timermenus>=15 && NumPersonagensEscolhidos<2 && (
-P[1].key_BT1_pressed==1 || P[1].key_BT2_pressed==1 || P[1].key_BT3_pressed==1 || P[1].key_SELECT_pressed==1 ||
-P[1].key_BT4_pressed==1 || P[1].key_BT5_pressed==1 || P[1].key_BT6_pressed==1 || P[1].key_START_pressed==1 )){
+hamoopi_input_pressed(&P[1].Teclas, TECLA_BT1)==1 || hamoopi_input_pressed(&P[1].Teclas, TECLA_BT2)==1 || hamoopi_input_pressed(&P[1].Teclas, TECLA_BT3)==1 || hamoopi_input_pressed(&P[1].Teclas, TECLA_SELECT)==1 ||
+hamoopi_input_pressed(&P[1].Teclas, TECLA_BT4)==1 || hamoopi_input_pressed(&P[1].Teclas, TECLA_BT5)==1 || hamoopi_input_pressed(&P[1].Teclas, TECLA_BT6)==1 || hamoopi_input_pressed(&P[1].Teclas, TECLA_START)==1 )){
 
 if (strcmp( ChoiceP1,"") ==0) { NumPersonagensEscolhidos++; play_sample(choice, 255, 128, 1000, 0); }
 if (SelectCharP1ID==1) { strcpy(ChoiceP1, Lista_de_Personagens_Instalados[1]); }
@@ -1703,14 +1903,14 @@ P1_Pallete = load_bitmap(P1_Pallete_string, NULL);
 if (!P1_Pallete) { P[1].PossuiPaletaDeCor=0; } else { P[1].PossuiPaletaDeCor=1; }
 //define a cor do personagem, se ele tiver paleta de cores
 if(P[1].PossuiPaletaDeCor==1){
-if(P[1].key_BT1_pressed    ==1) { P[1].DefineCorDaPaleta=0; }
-if(P[1].key_BT2_pressed    ==1) { P[1].DefineCorDaPaleta=1; }
-if(P[1].key_BT3_pressed    ==1) { P[1].DefineCorDaPaleta=2; }
-if(P[1].key_BT4_pressed    ==1) { P[1].DefineCorDaPaleta=3; }
-if(P[1].key_BT5_pressed    ==1) { P[1].DefineCorDaPaleta=4; }
-if(P[1].key_BT6_pressed    ==1) { P[1].DefineCorDaPaleta=5; }
-if(P[1].key_SELECT_pressed ==1) { P[1].DefineCorDaPaleta=6; }
-if(P[1].key_START_pressed  ==1) { P[1].DefineCorDaPaleta=7; }
+if(hamoopi_input_pressed(&P[1].Teclas, TECLA_BT1)    ==1) { P[1].DefineCorDaPaleta=0; }
+if(hamoopi_input_pressed(&P[1].Teclas, TECLA_BT2)    ==1) { P[1].DefineCorDaPaleta=1; }
+if(hamoopi_input_pressed(&P[1].Teclas, TECLA_BT3)    ==1) { P[1].DefineCorDaPaleta=2; }
+if(hamoopi_input_pressed(&P[1].Teclas, TECLA_BT4)    ==1) { P[1].DefineCorDaPaleta=3; }
+if(hamoopi_input_pressed(&P[1].Teclas, TECLA_BT5)    ==1) { P[1].DefineCorDaPaleta=4; }
+if(hamoopi_input_pressed(&P[1].Teclas, TECLA_BT6)    ==1) { P[1].DefineCorDaPaleta=5; }
+if(hamoopi_input_pressed(&P[1].Teclas, TECLA_SELECT) ==1) { P[1].DefineCorDaPaleta=6; }
+if(hamoopi_input_pressed(&P[1].Teclas, TECLA_START)  ==1) { P[1].DefineCorDaPaleta=7; }
 //if(P[1].key_HOLD_pressed   ==1) { P[1].DefineCorDaPaleta=8; } //precisa ser implementado
 }
 
@@ -1816,8 +2016,8 @@ if (NumPersonagensEscolhidos==2) { timermenus=0; if(ModoHistoria==1){timermenus=
 }
 //p2
 if (timermenus>=15 && NumPersonagensEscolhidos<2 && (
-P[2].key_BT1_pressed==1 || P[2].key_BT2_pressed==1 || P[2].key_BT3_pressed==1 || P[2].key_SELECT_pressed==1 ||
-P[2].key_BT4_pressed==1 || P[2].key_BT5_pressed==1 || P[2].key_BT6_pressed==1 || P[2].key_START_pressed==1 )){
+hamoopi_input_pressed(&P[2].Teclas, TECLA_BT1)==1 || hamoopi_input_pressed(&P[2].Teclas, TECLA_BT2)==1 || hamoopi_input_pressed(&P[2].Teclas, TECLA_BT3)==1 || hamoopi_input_pressed(&P[2].Teclas, TECLA_SELECT)==1 ||
+hamoopi_input_pressed(&P[2].Teclas, TECLA_BT4)==1 || hamoopi_input_pressed(&P[2].Teclas, TECLA_BT5)==1 || hamoopi_input_pressed(&P[2].Teclas, TECLA_BT6)==1 || hamoopi_input_pressed(&P[2].Teclas, TECLA_START)==1 )){
 
 if (strcmp( ChoiceP2,"") ==0) { NumPersonagensEscolhidos++; play_sample(choice, 255, 128, 1000, 0); }
 if (SelectCharP2ID==1) { strcpy(ChoiceP2, Lista_de_Personagens_Instalados[1]); }
@@ -1838,14 +2038,14 @@ P2_Pallete = load_bitmap(P2_Pallete_string, NULL);
 if (!P2_Pallete) { P[2].PossuiPaletaDeCor=0; } else { P[2].PossuiPaletaDeCor=1; }
 //define a cor do personagem, se ele tiver paleta de cores
 if(P[2].PossuiPaletaDeCor==1){
-if(P[2].key_BT1_pressed    ==1) { P[2].DefineCorDaPaleta=0; }
-if(P[2].key_BT2_pressed    ==1) { P[2].DefineCorDaPaleta=1; }
-if(P[2].key_BT3_pressed    ==1) { P[2].DefineCorDaPaleta=2; }
-if(P[2].key_BT4_pressed    ==1) { P[2].DefineCorDaPaleta=3; }
-if(P[2].key_BT5_pressed    ==1) { P[2].DefineCorDaPaleta=4; }
-if(P[2].key_BT6_pressed    ==1) { P[2].DefineCorDaPaleta=5; }
-if(P[2].key_SELECT_pressed ==1) { P[2].DefineCorDaPaleta=6; }
-if(P[2].key_START_pressed  ==1) { P[2].DefineCorDaPaleta=7; }
+if(hamoopi_input_pressed(&P[2].Teclas, TECLA_BT1)    ==1) { P[2].DefineCorDaPaleta=0; }
+if(hamoopi_input_pressed(&P[2].Teclas, TECLA_BT2)    ==1) { P[2].DefineCorDaPaleta=1; }
+if(hamoopi_input_pressed(&P[2].Teclas, TECLA_BT3)    ==1) { P[2].DefineCorDaPaleta=2; }
+if(hamoopi_input_pressed(&P[2].Teclas, TECLA_BT4)    ==1) { P[2].DefineCorDaPaleta=3; }
+if(hamoopi_input_pressed(&P[2].Teclas, TECLA_BT5)    ==1) { P[2].DefineCorDaPaleta=4; }
+if(hamoopi_input_pressed(&P[2].Teclas, TECLA_BT6)    ==1) { P[2].DefineCorDaPaleta=5; }
+if(hamoopi_input_pressed(&P[2].Teclas, TECLA_SELECT) ==1) { P[2].DefineCorDaPaleta=6; }
+if(hamoopi_input_pressed(&P[2].Teclas, TECLA_START)  ==1) { P[2].DefineCorDaPaleta=7; }
 //if(P[2].key_HOLD_pressed   ==1) { P[2].DefineCorDaPaleta=8; } //precisa ser implementado
 }
 
@@ -2012,10 +2212,10 @@ textprintf_right_ex( bufferx, font_10, 630, 380, makecol(255,255,255), -1, "%s",
 //escolha do cenario
 if (NumPersonagensEscolhidos==2 && timermenus>=15) {
 int AtualizaGPS=0;
-if (((P[1].key_RIGHT_pressed==1)or(P[2].key_RIGHT_pressed==1)) && SelectBGID<Qtde_Cenarios_Instalados) {
+if (((hamoopi_input_pressed(&P[1].Teclas, TECLA_RIGHT)==1)or(hamoopi_input_pressed(&P[2].Teclas, TECLA_RIGHT)==1)) && SelectBGID<Qtde_Cenarios_Instalados) {
 SelectBGID++; play_sample(cursor, 255, 128, 1000, 0); AtualizaGPS=1;
 }
-if (((P[1].key_LEFT_pressed ==1)or(P[2].key_LEFT_pressed ==1)) && SelectBGID>1) {
+if (((hamoopi_input_pressed(&P[1].Teclas, TECLA_LEFT) ==1)or(hamoopi_input_pressed(&P[2].Teclas, TECLA_LEFT) ==1)) && SelectBGID>1) {
 SelectBGID--; play_sample(cursor, 255, 128, 1000, 0); AtualizaGPS=1;
 }
 if (AtualizaGPS==1){
@@ -2051,10 +2251,10 @@ menu_op=1; ModoMapa=1; SelectCharMode=0;
 }
 
 if ( strcmp( ChoiceBG,"") ==0 &&
-(P[1].key_BT1_pressed==1 || P[1].key_BT2_pressed==1 || P[1].key_BT3_pressed==1 ||
-P[1].key_BT4_pressed==1 || P[1].key_BT5_pressed==1 || P[1].key_BT6_pressed==1 || P[1].key_START_pressed==1 ||
-P[2].key_BT1_pressed==1 || P[2].key_BT2_pressed==1 || P[2].key_BT3_pressed==1 ||
-P[2].key_BT4_pressed==1 || P[2].key_BT5_pressed==1 || P[2].key_BT6_pressed==1 || P[2].key_START_pressed==1) ){
+(hamoopi_input_pressed(&P[1].Teclas, TECLA_BT1)==1 || hamoopi_input_pressed(&P[1].Teclas, TECLA_BT2)==1 || hamoopi_input_pressed(&P[1].Teclas, TECLA_BT3)==1 ||
+hamoopi_input_pressed(&P[1].Teclas, TECLA_BT4)==1 || hamoopi_input_pressed(&P[1].Teclas, TECLA_BT5)==1 || hamoopi_input_pressed(&P[1].Teclas, TECLA_BT6)==1 || hamoopi_input_pressed(&P[1].Teclas, TECLA_START)==1 ||
+hamoopi_input_pressed(&P[2].Teclas, TECLA_BT1)==1 || hamoopi_input_pressed(&P[2].Teclas, TECLA_BT2)==1 || hamoopi_input_pressed(&P[2].Teclas, TECLA_BT3)==1 ||
+hamoopi_input_pressed(&P[2].Teclas, TECLA_BT4)==1 || hamoopi_input_pressed(&P[2].Teclas, TECLA_BT5)==1 || hamoopi_input_pressed(&P[2].Teclas, TECLA_BT6)==1 || hamoopi_input_pressed(&P[2].Teclas, TECLA_START)==1) ){
 play_sample(choice, 255, 128, 1000, 0);
 if (SelectBGID==1) { strcpy(ChoiceBG, Lista_de_Cenarios_Instalados[1]); }
 if (SelectBGID==2) { strcpy(ChoiceBG, Lista_de_Cenarios_Instalados[2]); }
@@ -2065,23 +2265,12 @@ if (SelectBGID==6) { strcpy(ChoiceBG, Lista_de_Cenarios_Instalados[6]); }
 if (SelectBGID==7) { strcpy(ChoiceBG, Lista_de_Cenarios_Instalados[7]); }
 if (SelectBGID==8) { strcpy(ChoiceBG, Lista_de_Cenarios_Instalados[8]); }
 
-//posiciona os players
+//cenario, carrega durante a tela de versus
+char bg_choice[99]="";
+sprintf(bg_choice, "data/backgrounds/%s/000_00.pcx", ChoiceBG);
+hamoopi_stage_prefetch(bg_choice);
 
-//cenario, atribuicao
-for(int ind=1;ind<=8;ind++){
-if(SelectBGID==ind){
-bg_test->w=bg_hamoopi[ind]->w;
-bg_test->h=bg_hamoopi[ind]->h;
-blit(bg_hamoopi[ind], bg_test, 0, 0, 0, 0, bg_hamoopi[ind]->w, bg_hamoopi[ind]->h);
-}
-}
-
-//posicao dos players
-P[1].x=bg_test->w/2-80;
-P[2].x=bg_test->w/2+80;
-AlturaPiso=bg_test->h-20;
-P[1].y=AlturaPiso;
-P[2].y=AlturaPiso;
+//posiciona os players
 P[1].State=100; P[2].State=100; //define estado inicial
 P[1].Lado=1; P[2].Lado=-1;
 P[1].Energy=1000; P[2].Energy=1000;
@@ -2127,8 +2316,8 @@ P2BIGDisplay = load_bitmap(P2BIGDisplaystring, NULL);
 if (!P2BIGDisplay) { P2BIGDisplay=load_bitmap("data/system/000_00.pcx", NULL); }
 
 draw_sprite(bufferx, SELECT_CHARS, 0, 0); //bg
-textprintf_centre_ex(bufferx, font_20, 323, 5, makecol(000,000,000), -1, "Proximo Oponente");
-textprintf_centre_ex(bufferx, font_20, 320, 2, makecol(255,255,255), -1, "Proximo Oponente");
+textprintf_centre_cache_ex(bufferx, font_20, 323, 5, makecol(000,000,000), -1, "Proximo Oponente");
+textprintf_centre_cache_ex(bufferx, font_20, 320, 2, makecol(255,255,255), -1, "Proximo Oponente");
 //miniaturas
 draw_sprite(bufferx, spr_cursor_vazio, 64+(64*0), 400);
 draw_sprite(bufferx, spr_cursor_vazio, 64+(64*1), 400);
@@ -2199,7 +2388,7 @@ TelaDeVersusTimer++;
 
 int numtemp=57;
 
-if ((P[1].key_START_pressed==1 || P[2].key_START_pressed==1) && timermenus>=15) {
+if ((hamoopi_input_pressed(&P[1].Teclas, TECLA_START)==1 || hamoopi_input_pressed(&P[2].Teclas, TECLA_START)==1) && timermenus>=15) {
 TelaDeVersusTimer=350-numtemp;
 zeraListaDeInputs();
 desabilita_players=1;
@@ -2210,6 +2399,18 @@ if (TelaDeVersusTimer>350){ iniciaRound=1; desabilita_players=0; }
 
 if(iniciaRound==1){
 iniciaRound=0;
+//cenario escolhido, pega o que foi carregado durante a tela de versus
+char bg_choice[99]="";
+sprintf(bg_choice, "data/backgrounds/%s/000_00.pcx", ChoiceBG);
+BITMAP *bg_anterior=bg_test;
+bg_test=hamoopi_stage_acquire(bg_choice);
+hamoopi_stage_release(bg_anterior);
+//posicao dos players
+P[1].x=bg_test->w/2-80;
+P[2].x=bg_test->w/2+80;
+AlturaPiso=bg_test->h-20;
+P[1].y=AlturaPiso;
+P[2].y=AlturaPiso;
 timermenus=0; TelaDeVersus=0; GamePlayMode=1; RoundAtual=1; zeraListaDeInputs(); LOAD_PLAYERS();
 //carrega dados
 set_config_file("SETUP.ini");
@@ -2257,7 +2458,9 @@ stretch_blit(bufferx, bufferx, 0, 0, 640, 480, 0, 0, 640, 480);
 // GAME PLAY ----------------------------------------------------------------
 /////////////////////////////////////////////////////////////////////////////
 
-if (GamePlayMode==1){
+//KO: a luta fica congelada por PausaKO quadros, apresentando a ultima tela composta
+if (GamePlayMode==1 && PausaKO>0) { PausaKO--; }
+else if (GamePlayMode==1){
 
 //inicio de round
 if (timer_rounds==0) {
@@ -2272,6 +2475,7 @@ char P2_1s[25]="";
 sprintf(P2_1s, "data/chars/%s/000_01.pcx", P[2].Name);
 P2_1 = load_bitmap(P2_1s, NULL);
 if (!P2_1) { P2_1=load_bitmap("data/system/000_01.pcx", NULL); }
+HUD_Invalida(); //fotos novas, refaz o cache do HUD
 }
 
 //timer_rounds é um contador de frames crescente utilizado em animacoes
@@ -2345,8 +2549,8 @@ P[1].EnergyRedBar=1000; P[2].EnergyRedBar=1000;
 P[1].Color=-1; P[2].Color=-1;
 P[1].Visible=1; P[2].Visible=1;
 P[1].RoomLimit=1; P[2].RoomLimit=1;
-P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1();
-P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2();
+P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1();
+P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2();
 }
 
 /*reinicia a luta*/
@@ -2372,8 +2576,8 @@ P[1].EnergyRedBar=1000; P[2].EnergyRedBar=1000;
 P[1].Color=-1; P[2].Color=-1;
 P[1].Visible=1; P[2].Visible=1;
 P[1].RoomLimit=1; P[2].RoomLimit=1;
-P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1();
-P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2();
+P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1();
+P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2();
 }
 
 /*TECLAS DE SISTEMA*/
@@ -2405,14 +2609,14 @@ P[1].EnergyRedBar=1000; P[2].EnergyRedBar=1000;
 P[1].Color=-1; P[2].Color=-1;
 P[1].Visible=1; P[2].Visible=1;
 P[1].RoomLimit=1; P[2].RoomLimit=1;
-P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1();
-P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2();
+P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1();
+P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2();
 }
 if (key[KEY_ALT] && key[KEY_F4]) {sair=1;}
-if ( key_F1_status==1 && Draw_Debug==0) { Draw_Debug=1; } else if ( key_F1_status==1 && Draw_Debug==1) { Draw_Debug=0; }
-if ( key_F2_status==1 && Draw_Box==0) { Draw_Box=1; } else if ( key_F2_status==1 && Draw_Box==1) { Draw_Box=0; }
-if ( key_F3_status==1 && Draw_Input==0) { Draw_Input=1; } else if ( key_F3_status==1 && Draw_Input==1) { Draw_Input=0; }
-if ( key_F4_status==1 && op_ShowFrameData==0) { op_ShowFrameData=1; } else if ( key_F4_status==1 && op_ShowFrameData==1) { op_ShowFrameData=0; }
+if ( hamoopi_input_status(&TeclasSistema, SIS_F1)==1 && Draw_Debug==0) { Draw_Debug=1; } else if ( hamoopi_input_status(&TeclasSistema, SIS_F1)==1 && Draw_Debug==1) { Draw_Debug=0; }
+if ( hamoopi_input_status(&TeclasSistema, SIS_F2)==1 && Draw_Box==0) { Draw_Box=1; } else if ( hamoopi_input_status(&TeclasSistema, SIS_F2)==1 && Draw_Box==1) { Draw_Box=0; }
+if ( hamoopi_input_status(&TeclasSistema, SIS_F3)==1 && Draw_Input==0) { Draw_Input=1; } else if ( hamoopi_input_status(&TeclasSistema, SIS_F3)==1 && Draw_Input==1) { Draw_Input=0; }
+if ( hamoopi_input_status(&TeclasSistema, SIS_F4)==1 && op_ShowFrameData==0) { op_ShowFrameData=1; } else if ( hamoopi_input_status(&TeclasSistema, SIS_F4)==1 && op_ShowFrameData==1) { op_ShowFrameData=0; }
 if ( key[KEY_F5 ] ) { P[1].Energy+=-10; P[1].Special+=-10; }
 if ( key[KEY_F6 ] ) { P[1].Energy+= 10; P[1].Special+= 10; }
 if ( key[KEY_F7 ] ) { P[2].Energy+=-10; P[2].Special+=-10; }
@@ -2436,18 +2640,18 @@ Aplicar_HIT();
 for(int ind=1; ind<=2; ind++){
 P[ind].PodeTestarEspecial=0;
 if(
-P[ind].key_LEFT_pressed==1 ||
-P[ind].key_RIGHT_pressed==1 ||
-P[ind].key_UP_pressed==1 ||
-P[ind].key_DOWN_pressed==1 ||
-P[ind].key_BT1_pressed==1 ||
-P[ind].key_BT2_pressed==1 ||
-P[ind].key_BT3_pressed==1 ||
-P[ind].key_BT4_pressed==1 ||
-P[ind].key_BT5_pressed==1 ||
-P[ind].key_BT6_pressed==1 ||
-P[ind].key_SELECT_pressed==1 ||
-P[ind].key_START_pressed==1
+hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 ||
+hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 ||
+hamoopi_input_pressed(&P[ind].Teclas, TECLA_UP)==1 ||
+hamoopi_input_pressed(&P[ind].Teclas, TECLA_DOWN)==1 ||
+hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT1)==1 ||
+hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT2)==1 ||
+hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT3)==1 ||
+hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT4)==1 ||
+hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT5)==1 ||
+hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT6)==1 ||
+hamoopi_input_pressed(&P[ind].Teclas, TECLA_SELECT)==1 ||
+hamoopi_input_pressed(&P[ind].Teclas, TECLA_START)==1
 ){ P[ind].PodeTestarEspecial=1; }
 }
 
@@ -2621,9 +2825,9 @@ if(AtivadorDeMagia==1){
 
 //inicializa a magia
 P[ind].QtdeMagias=0;
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 PLAYER_STATE(ind, AtivadorDeMagiaNumeroDoEspecial, 0, P[ind].TotalDeFramesMov[AtivadorDeMagiaNumeroDoEspecial]);
-Fireball[ind].StartFrame=timer;
+Fireball[ind].StartFrame=LogicTick;
 New_Fireball(ind);
 
 //som da magia
@@ -2643,156 +2847,156 @@ AtivadorDeMagia=0;
 
 /*101 Soco Fraco em Pe*/
 if ( (P[ind].State==100 || P[ind].State==410 || P[ind].State==420 || P[ind].State==602 || P[ind].State==101)
-and (P[ind].key_BT1_pressed==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT1)==1)
 and (abs(P[1].x-P[2].x)>=60)
 and (P[ind].TotalDeFramesMov[101]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=101; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*102 Soco Medio em Pe*/
 if ( (P[ind].State==100 || P[ind].State==410 || P[ind].State==420 || P[ind].State==602)
-and (P[ind].key_BT2_pressed==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT2)==1)
 and (abs(P[1].x-P[2].x)>=60)
 and (P[ind].TotalDeFramesMov[102]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=102; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*103 Soco Forte em Pe*/
 if ( (P[ind].State==100 || P[ind].State==410 || P[ind].State==420 || P[ind].State==602)
-and (P[ind].key_BT3_pressed==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT3)==1)
 and (abs(P[1].x-P[2].x)>=60)
 and (P[ind].TotalDeFramesMov[103]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=103; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 /*104 Chute Fraco em Pe*/
 if ( (P[ind].State==100 || P[ind].State==410 || P[ind].State==420 || P[ind].State==602)
-and (P[ind].key_BT4_pressed==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT4)==1)
 and (abs(P[1].x-P[2].x)>=60)
 and (P[ind].TotalDeFramesMov[104]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=104; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*105 Chute Medio em Pe*/
 if ( (P[ind].State==100 || P[ind].State==410 || P[ind].State==420 || P[ind].State==602)
-and (P[ind].key_BT5_pressed==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT5)==1)
 and (abs(P[1].x-P[2].x)>=60)
 and (P[ind].TotalDeFramesMov[105]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=105; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*106 Chute Forte em Pe*/
 if ( (P[ind].State==100 || P[ind].State==410 || P[ind].State==420 || P[ind].State==602)
-and (P[ind].key_BT6_pressed==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT6)==1)
 and (abs(P[1].x-P[2].x)>=60)
 and (P[ind].TotalDeFramesMov[106]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=106; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 /*151 Soco Fraco em Pe (PERTO)*/
 if ( (P[ind].State==100 || P[ind].State==410 || P[ind].State==420 || P[ind].State==602)
-and (P[ind].key_BT1_pressed==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT1)==1)
 and (abs(P[1].x-P[2].x)<60) )
 {
 if(P[ind].TotalDeFramesMov[151] >-1){
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=151; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 if(P[ind].TotalDeFramesMov[151]==-1
 and P[ind].TotalDeFramesMov[101] >-1){
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=101; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 }
 /*152 Soco Medio em Pe (PERTO)*/
 if ( (P[ind].State==100 || P[ind].State==410 || P[ind].State==420 || P[ind].State==602)
-and (P[ind].key_BT2_pressed==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT2)==1)
 and (abs(P[1].x-P[2].x)<60) )
 {
 if(P[ind].TotalDeFramesMov[152] >-1){
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=152; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 if(P[ind].TotalDeFramesMov[152]==-1
 and P[ind].TotalDeFramesMov[102] >-1){
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=102; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 }
 /*153 Soco Forte em Pe (PERTO)*/
 if ( (P[ind].State==100 || P[ind].State==410 || P[ind].State==420 || P[ind].State==602)
-and (P[ind].key_BT3_pressed==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT3)==1)
 and (abs(P[1].x-P[2].x)<60) )
 {
 if(P[ind].TotalDeFramesMov[153] >-1){
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=153; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 if(P[ind].TotalDeFramesMov[153]==-1
 and P[ind].TotalDeFramesMov[103] >-1){
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=103; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 }
 /*154 Chute Fraco em Pe (PERTO)*/
 if ( (P[ind].State==100 || P[ind].State==410 || P[ind].State==420 || P[ind].State==602)
-and (P[ind].key_BT4_pressed==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT4)==1)
 and (abs(P[1].x-P[2].x)<60) )
 {
 if(P[ind].TotalDeFramesMov[154] >-1){
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=154; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 if(P[ind].TotalDeFramesMov[154]==-1
 and P[ind].TotalDeFramesMov[104] >-1){
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=104; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 }
 /*155 Chute Medio em Pe (PERTO)*/
 if ( (P[ind].State==100 || P[ind].State==410 || P[ind].State==420 || P[ind].State==602)
-and (P[ind].key_BT5_pressed==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT5)==1)
 and (abs(P[1].x-P[2].x)<60) )
 {
 if(P[ind].TotalDeFramesMov[155] >-1){
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=155; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 if(P[ind].TotalDeFramesMov[155]==-1
 and P[ind].TotalDeFramesMov[105] >-1){
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=105; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 }
 /*156 Chute Forte em Pe (PERTO)*/
 if ( (P[ind].State==100 || P[ind].State==410 || P[ind].State==420 || P[ind].State==602)
-and (P[ind].key_BT6_pressed==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT6)==1)
 and (abs(P[1].x-P[2].x)<60) )
 {
 if(P[ind].TotalDeFramesMov[156] >-1){
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=156; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 if(P[ind].TotalDeFramesMov[156]==-1
 and P[ind].TotalDeFramesMov[106] >-1){
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=106; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
@@ -2800,351 +3004,351 @@ play_sample(attacklvl3, 255, 128, 1000, 0);
 /*211 Soco Fraco Abaixado + Tras*/
 if ( (P[ind].State==200 || P[ind].State==210 )
 and P[ind].Lado== 1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
-and P[ind].key_BT1_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT1)==1
 and (P[ind].TotalDeFramesMov[211]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=211; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*211 Soco Fraco Abaixado + Tras*/
 if ( (P[ind].State==200 || P[ind].State==210 )
 and P[ind].Lado==-1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
-and P[ind].key_BT1_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT1)==1
 and (P[ind].TotalDeFramesMov[211]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=211; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*212 Soco Medio Abaixado + Tras*/
 if ( (P[ind].State==200 || P[ind].State==210 )
 and P[ind].Lado== 1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
-and P[ind].key_BT2_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT2)==1
 and (P[ind].TotalDeFramesMov[212]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=212; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*212 Soco Medio Abaixado + Tras*/
 if ( (P[ind].State==200 || P[ind].State==210 )
 and P[ind].Lado==-1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
-and P[ind].key_BT2_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT2)==1
 and (P[ind].TotalDeFramesMov[212]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=212; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*213 Soco Forte Abaixado + Tras*/
 if ( (P[ind].State==200 || P[ind].State==210 )
 and P[ind].Lado== 1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
-and P[ind].key_BT3_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT3)==1
 and (P[ind].TotalDeFramesMov[213]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=213; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 /*213 Soco Forte Abaixado + Tras*/
 if ( (P[ind].State==200 || P[ind].State==210 )
 and P[ind].Lado==-1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
-and P[ind].key_BT3_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT3)==1
 and (P[ind].TotalDeFramesMov[213]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=213; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 /*214 Chute Fraco Abaixado + Tras*/
 if ( (P[ind].State==200 || P[ind].State==210 )
 and P[ind].Lado== 1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
-and P[ind].key_BT4_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT4)==1
 and (P[ind].TotalDeFramesMov[214]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=214; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*214 Chute Fraco Abaixado + Tras*/
 if ( (P[ind].State==200 || P[ind].State==210 )
 and P[ind].Lado==-1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
-and P[ind].key_BT4_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT4)==1
 and (P[ind].TotalDeFramesMov[214]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=214; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*215 Chute Medio Abaixado + Tras*/
 if ( (P[ind].State==200 || P[ind].State==210 )
 and P[ind].Lado== 1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
-and P[ind].key_BT5_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT5)==1
 and (P[ind].TotalDeFramesMov[215]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=215; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*215 Chute Medio Abaixado + Tras*/
 if ( (P[ind].State==200 || P[ind].State==210 )
 and P[ind].Lado==-1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
-and P[ind].key_BT5_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT5)==1
 and (P[ind].TotalDeFramesMov[215]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=215; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*216 Chute Forte Abaixado + Tras*/
 if ( (P[ind].State==200 || P[ind].State==210 )
 and P[ind].Lado== 1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
-and P[ind].key_BT6_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT6)==1
 and (P[ind].TotalDeFramesMov[216]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=216; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 /*216 Chute Forte Abaixado + Tras*/
 if ( (P[ind].State==200 || P[ind].State==210 )
 and P[ind].Lado==-1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
-and P[ind].key_BT6_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT6)==1
 and (P[ind].TotalDeFramesMov[216]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=216; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 /*221 Soco Fraco Abaixado + Frente*/
 if ( (P[ind].State==200 || P[ind].State==220 )
 and P[ind].Lado== 1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
-and P[ind].key_BT1_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT1)==1
 and (P[ind].TotalDeFramesMov[221]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=221; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*221 Soco Fraco Abaixado + Frente*/
 if ( (P[ind].State==200 || P[ind].State==220 )
 and P[ind].Lado==-1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
-and P[ind].key_BT1_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT1)==1
 and (P[ind].TotalDeFramesMov[221]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=221; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*222 Soco Medio Abaixado + Frente*/
 if ( (P[ind].State==200 || P[ind].State==220 )
 and P[ind].Lado== 1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
-and P[ind].key_BT2_pressed==1 && (P[ind].TotalDeFramesMov[222]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT2)==1 && (P[ind].TotalDeFramesMov[222]>-1) ) {
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=222; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*222 Soco Medio Abaixado + Frente*/
 if ( (P[ind].State==200 || P[ind].State==220 )
 and P[ind].Lado==-1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
-and P[ind].key_BT2_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT2)==1
 and (P[ind].TotalDeFramesMov[222]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=222; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*223 Soco Forte Abaixado + Frente*/
 if ( (P[ind].State==200 || P[ind].State==220 )
 and P[ind].Lado== 1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
-and P[ind].key_BT3_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT3)==1
 and (P[ind].TotalDeFramesMov[223]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=223; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 /*223 Soco Forte Abaixado + Frente*/
 if ( (P[ind].State==200 || P[ind].State==220 )
 and P[ind].Lado==-1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
-and P[ind].key_BT3_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT3)==1
 and (P[ind].TotalDeFramesMov[223]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=223; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 /*224 Chute Fraco Abaixado + Frente*/
 if ( (P[ind].State==200 || P[ind].State==220 )
 and P[ind].Lado== 1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
-and P[ind].key_BT4_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT4)==1
 and (P[ind].TotalDeFramesMov[224]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=224; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*224 Chute Fraco Abaixado + Frente*/
 if ( (P[ind].State==200 || P[ind].State==220 )
 and P[ind].Lado==-1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
-and P[ind].key_BT4_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT4)==1
 and (P[ind].TotalDeFramesMov[224]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=224; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*225 Chute Medio Abaixado + Frente*/
 if ( (P[ind].State==200 || P[ind].State==220 )
 and P[ind].Lado== 1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
-and P[ind].key_BT5_pressed==1 && (P[ind].TotalDeFramesMov[225]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT5)==1 && (P[ind].TotalDeFramesMov[225]>-1) ) {
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=225; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*225 Chute Medio Abaixado + Frente*/
 if ( (P[ind].State==200 || P[ind].State==220 )
 and P[ind].Lado==-1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
-and P[ind].key_BT5_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT5)==1
 and (P[ind].TotalDeFramesMov[225]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=225; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*226 Chute Forte Abaixado + Frente*/
 if ( (P[ind].State==200 || P[ind].State==220 )
 and P[ind].Lado== 1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
-and P[ind].key_BT6_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT6)==1
 and (P[ind].TotalDeFramesMov[226]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=226; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 /*226 Chute Forte Abaixado + Frente*/
 if ( (P[ind].State==200 || P[ind].State==220 )
 and P[ind].Lado==-1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
-and P[ind].key_BT6_pressed==1
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT6)==1
 and (P[ind].TotalDeFramesMov[226]>-1) ) {
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=226; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 /*201 Soco Fraco Abaixado*/
 if ( (P[ind].State==200 || P[ind].State==601)
-and P[ind].key_BT1_pressed==1
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT1)==1
 and (P[ind].TotalDeFramesMov[201]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=201; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*202 Soco Medio Abaixado*/
 if ( (P[ind].State==200 || P[ind].State==601)
-and P[ind].key_BT2_pressed==1
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT2)==1
 and (P[ind].TotalDeFramesMov[202]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=202; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*203 Soco Forte Abaixado*/
 if ( (P[ind].State==200 || P[ind].State==601)
-and P[ind].key_BT3_pressed==1
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT3)==1
 and (P[ind].TotalDeFramesMov[203]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=203; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 /*204 Chute Fraco Abaixado*/
 if ( (P[ind].State==200 || P[ind].State==601)
-and P[ind].key_BT4_pressed==1
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT4)==1
 and (P[ind].TotalDeFramesMov[204]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=204; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*205 Chute Medio Abaixado*/
 if ( (P[ind].State==200 || P[ind].State==601)
-and P[ind].key_BT5_pressed==1
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT5)==1
 and (P[ind].TotalDeFramesMov[205]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=205; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*206 Chute Forte Abaixado*/
 if ( (P[ind].State==200 || P[ind].State==601)
-and P[ind].key_BT6_pressed==1
+and hamoopi_input_pressed(&P[ind].Teclas, TECLA_BT6)==1
 and (P[ind].TotalDeFramesMov[206]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=206; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 /*210 Baixo e Tras*/
 if (  P[ind].State==200
 and P[ind].Lado== 1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
 and (P[ind].TotalDeFramesMov[210]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=210; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*210 Baixo e Tras*/
 if (  P[ind].State==200
 and P[ind].Lado==-1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
 and (P[ind].TotalDeFramesMov[210]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=210; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*220 Baixo e Frente*/
 if (  P[ind].State==200
 and P[ind].Lado== 1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
 and (P[ind].TotalDeFramesMov[220]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=220; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*220 Baixo e Frente*/
 if (  P[ind].State==200
 and P[ind].Lado==-1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
 and (P[ind].TotalDeFramesMov[220]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=220; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*410 Andando para Tras*/
 if (  P[ind].State==100
 and P[ind].Lado== 1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
 and (P[ind].TotalDeFramesMov[410]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=410; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*410 Andando para Tras*/
 if (  P[ind].State==100
 and P[ind].Lado==-1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
 and (P[ind].TotalDeFramesMov[410]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=410; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*420 Andando para Frente*/
 if (  P[ind].State==100
 and P[ind].Lado== 1
-and (P[ind].key_RIGHT_pressed==1 || P[ind].key_RIGHT_hold==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_RIGHT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_RIGHT)==1)
 and (P[ind].TotalDeFramesMov[420]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=420; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*420 Andando para Frente*/
 if (  P[ind].State==100
 and P[ind].Lado==-1
-and (P[ind].key_LEFT_pressed==1 || P[ind].key_LEFT_hold==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_LEFT)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_LEFT)==1)
 and (P[ind].TotalDeFramesMov[420]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=420; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*507 End Reversao Aerea 507->606*/
@@ -3152,7 +3356,7 @@ if ( P[ind].State==507
 and P[ind].y==AlturaPiso
 and P[ind].Vspeed>=0
 and (P[ind].TotalDeFramesMov[606]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=606; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*507 End Reversao Aerea 507->100*/
@@ -3160,7 +3364,7 @@ if ( P[ind].State==507
 and P[ind].y==AlturaPiso
 and P[ind].Vspeed>=0
 and (P[ind].TotalDeFramesMov[100]>-1) ) {
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=100; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*551 End Queda*/
@@ -3168,7 +3372,7 @@ if ( P[ind].State==550
 and P[ind].y==AlturaPiso
 and P[ind].Vspeed>=0
 and (P[ind].TotalDeFramesMov[550]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=551; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*552 End Queda continuacao*/
@@ -3176,7 +3380,7 @@ if ( P[ind].State==551
 and P[ind].y==AlturaPiso
 and P[ind].Vspeed>=0
 and (P[ind].TotalDeFramesMov[551]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=552; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*571 End Queda p/ KO*/
@@ -3184,7 +3388,7 @@ if ( P[ind].State==570
 and P[ind].y==AlturaPiso
 and P[ind].Vspeed>=0
 and (P[ind].TotalDeFramesMov[570]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=571; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*572 End Queda p/ KO continuacao*/
@@ -3192,109 +3396,109 @@ if ( P[ind].State==571
 and P[ind].y==AlturaPiso
 and P[ind].Vspeed>=0
 and (P[ind].TotalDeFramesMov[571]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=572; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*601 Abaixando*/
 if ( P[ind].State==100
-and (P[ind].key_DOWN_pressed==1 || P[ind].key_DOWN_hold==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_DOWN)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_DOWN)==1)
 and (P[ind].TotalDeFramesMov[601]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=601; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*601 Abaixando*/
 if ( P[ind].State==410
-and (P[ind].key_DOWN_pressed==1 || P[ind].key_DOWN_hold==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_DOWN)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_DOWN)==1)
 and (P[ind].TotalDeFramesMov[601]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=601; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*601 Abaixando*/
 if ( P[ind].State==420
-and (P[ind].key_DOWN_pressed==1 || P[ind].key_DOWN_hold==1)
+and (hamoopi_input_pressed(&P[ind].Teclas, TECLA_DOWN)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_DOWN)==1)
 and (P[ind].TotalDeFramesMov[601]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=601; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*601/608 Abaixando/Virando de Lado abaixado*/
-if (  P[ind].State==606 && P[ind].key_DOWN_status>0 ) {
+if (  P[ind].State==606 && hamoopi_input_status(&P[ind].Teclas, TECLA_DOWN)>0 ) {
 int a=1;
 if (a==1 && P[ind].Lado== 1 && P[ind].x<MeioDaTela && (P[ind].TotalDeFramesMov[601]>-1) ) {
 a=0; AHitP1=1;
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=601; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 if (a==1 && P[ind].Lado== 1 && P[ind].x>MeioDaTela && (P[ind].TotalDeFramesMov[608]>-1) ) {
 a=0; AHitP1=1;
 P[ind].Lado=-1;
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=608; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 if (a==1 && P[ind].Lado==-1 && P[ind].x>MeioDaTela && (P[ind].TotalDeFramesMov[601]>-1) ) {
-a=0; AHitP1=1; P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+a=0; AHitP1=1; P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=601; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 if (a==1 && P[ind].Lado==-1 && P[ind].x<MeioDaTela && (P[ind].TotalDeFramesMov[608]>-1) ) {
 a=0; AHitP1=1;
 P[ind].Lado= 1;
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=608; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 }
 /*602 Levantando*/
 if ( P[ind].State==200
-and (P[ind].key_DOWN_released==1 || P[ind].key_DOWN_hold==0)
+and (hamoopi_input_released(&P[ind].Teclas, TECLA_DOWN)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_DOWN)==0)
 and (P[ind].TotalDeFramesMov[602]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=602; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*603 Intro Pulo Tras*/
 if ( P[ind].State==410
 and P[ind].Lado== 1
-and (P[ind].key_UP_status>0)
-and P[ind].key_LEFT_status> 0
-and P[ind].key_RIGHT_status==0
+and (hamoopi_input_status(&P[ind].Teclas, TECLA_UP)>0)
+and hamoopi_input_status(&P[ind].Teclas, TECLA_LEFT)> 0
+and hamoopi_input_status(&P[ind].Teclas, TECLA_RIGHT)==0
 and (P[ind].TotalDeFramesMov[603]>-1) ) {
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=603; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*603 Intro Pulo Tras*/
 if ( P[ind].State==410
 and P[ind].Lado==-1
-and (P[ind].key_UP_status>0)
-and P[ind].key_LEFT_status==0
-and P[ind].key_RIGHT_status> 0
+and (hamoopi_input_status(&P[ind].Teclas, TECLA_UP)>0)
+and hamoopi_input_status(&P[ind].Teclas, TECLA_LEFT)==0
+and hamoopi_input_status(&P[ind].Teclas, TECLA_RIGHT)> 0
 and (P[ind].TotalDeFramesMov[603]>-1) ) {
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=603; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*604 Intro Pulo Neutro*/
 if ( P[ind].State==100
-and (P[ind].key_UP_status>0)
-and P[ind].key_LEFT_status==0
-and P[ind].key_RIGHT_status==0
+and (hamoopi_input_status(&P[ind].Teclas, TECLA_UP)>0)
+and hamoopi_input_status(&P[ind].Teclas, TECLA_LEFT)==0
+and hamoopi_input_status(&P[ind].Teclas, TECLA_RIGHT)==0
 and (P[ind].TotalDeFramesMov[604]>-1) ) {
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=604; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*605 Intro Pulo Frente*/
 if ( P[ind].State==420
 and P[ind].Lado==-1
-and (P[ind].key_UP_status>0)
-and P[ind].key_LEFT_status> 0
-and P[ind].key_RIGHT_status==0
+and (hamoopi_input_status(&P[ind].Teclas, TECLA_UP)>0)
+and hamoopi_input_status(&P[ind].Teclas, TECLA_LEFT)> 0
+and hamoopi_input_status(&P[ind].Teclas, TECLA_RIGHT)==0
 and (P[ind].TotalDeFramesMov[605]>-1) ) {
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=605; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*605 Intro Pulo Frente*/
 if ( P[ind].State==420
 and P[ind].Lado== 1
-and (P[ind].key_UP_status>0)
-and P[ind].key_LEFT_status==0
-and P[ind].key_RIGHT_status> 0
+and (hamoopi_input_status(&P[ind].Teclas, TECLA_UP)>0)
+and hamoopi_input_status(&P[ind].Teclas, TECLA_LEFT)==0
+and hamoopi_input_status(&P[ind].Teclas, TECLA_RIGHT)> 0
 and (P[ind].TotalDeFramesMov[605]>-1) ) {
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=605; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*606 End Pulo*/
@@ -3304,7 +3508,7 @@ or P[ind].State==304 || P[ind].State==305 || P[ind].State==306)
 and P[ind].y==AlturaPiso
 and P[ind].Vspeed>=0
 and (P[ind].TotalDeFramesMov[606]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=606; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*606 End Pulo*/
@@ -3314,7 +3518,7 @@ or P[ind].State==314 || P[ind].State==315 || P[ind].State==316)
 and P[ind].y==AlturaPiso
 and P[ind].Vspeed>=0
 and (P[ind].TotalDeFramesMov[606]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=606; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*606 End Pulo*/
@@ -3324,102 +3528,102 @@ or P[ind].State==324 || P[ind].State==325 || P[ind].State==326)
 and P[ind].y==AlturaPiso
 and P[ind].Vspeed>=0
 and (P[ind].TotalDeFramesMov[606]>-1) ) {
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=606; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*301 Pulo Neutro + Soco Fraco*/
 if ( P[ind].State==300
-and P[ind].key_BT1_status==1
+and hamoopi_input_status(&P[ind].Teclas, TECLA_BT1)==1
 and (P[ind].TotalDeFramesMov[301]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=301; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*302 Pulo Neutro + Soco Medio*/
 if ( P[ind].State==300
-and P[ind].key_BT2_status==1
+and hamoopi_input_status(&P[ind].Teclas, TECLA_BT2)==1
 and (P[ind].TotalDeFramesMov[302]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=302; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*303 Pulo Neutro + Soco Forte*/
 if ( P[ind].State==300
-and P[ind].key_BT3_status==1
+and hamoopi_input_status(&P[ind].Teclas, TECLA_BT3)==1
 and (P[ind].TotalDeFramesMov[303]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=303; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 /*304 Pulo Neutro + Chute Fraco*/
 if ( P[ind].State==300
-and P[ind].key_BT4_status==1
+and hamoopi_input_status(&P[ind].Teclas, TECLA_BT4)==1
 and (P[ind].TotalDeFramesMov[304]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=304; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*305 Pulo Neutro + Chute Medio*/
 if ( P[ind].State==300
-and P[ind].key_BT5_status==1
+and hamoopi_input_status(&P[ind].Teclas, TECLA_BT5)==1
 and (P[ind].TotalDeFramesMov[305]>-1) ){
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=305; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*306 Pulo Neutro + Chute Forte*/
 if ( P[ind].State==300
-and P[ind].key_BT6_status==1
+and hamoopi_input_status(&P[ind].Teclas, TECLA_BT6)==1
 and (P[ind].TotalDeFramesMov[306]>-1) ){
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=306; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 /*321 Pulo Frente + Soco Fraco*/
 if ( (P[ind].State==310 || P[ind].State==320)
-and P[ind].key_BT1_status==1
+and hamoopi_input_status(&P[ind].Teclas, TECLA_BT1)==1
 and (P[ind].TotalDeFramesMov[321]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=321; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*322 Pulo Frente + Soco Medio*/
 if ( (P[ind].State==310 || P[ind].State==320)
-and P[ind].key_BT2_status==1
+and hamoopi_input_status(&P[ind].Teclas, TECLA_BT2)==1
 and (P[ind].TotalDeFramesMov[322]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=322; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*323 Pulo Frente + Soco Forte*/
 if ( (P[ind].State==310 || P[ind].State==320)
-and P[ind].key_BT3_status==1
+and hamoopi_input_status(&P[ind].Teclas, TECLA_BT3)==1
 and (P[ind].TotalDeFramesMov[323]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=323; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
 /*324 Pulo Frente + Chute Fraco*/
 if ( (P[ind].State==310 || P[ind].State==320)
-and P[ind].key_BT4_status==1
+and hamoopi_input_status(&P[ind].Teclas, TECLA_BT4)==1
 and (P[ind].TotalDeFramesMov[324]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=324; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl1, 255, 128, 1000, 0);
 }
 /*325 Pulo Frente + Chute Medio*/
 if ( (P[ind].State==310 || P[ind].State==320)
-and P[ind].key_BT5_status==1
+and hamoopi_input_status(&P[ind].Teclas, TECLA_BT5)==1
 and (P[ind].TotalDeFramesMov[325]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=325; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl2, 255, 128, 1000, 0);
 }
 /*326 Pulo Frente + Chute Forte*/
 if ( (P[ind].State==310 || P[ind].State==320)
-and P[ind].key_BT6_status==1
+and hamoopi_input_status(&P[ind].Teclas, TECLA_BT6)==1
 and (P[ind].TotalDeFramesMov[326]>-1) )	{
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 int set=326; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 play_sample(attacklvl3, 255, 128, 1000, 0);
 }
@@ -3429,7 +3633,7 @@ and (P[ind].x>MeioDaTela
 and P[ind].Lado== 1)
 and (P[ind].TotalDeFramesMov[607]>-1) )	{
 P[ind].Lado=-1;
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=607; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*607 Virando de Lado em Pe*/
@@ -3438,7 +3642,7 @@ and (P[ind].x<MeioDaTela
 and P[ind].Lado==-1)
 and (P[ind].TotalDeFramesMov[607]>-1) )	{
 P[ind].Lado= 1;
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=607; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*607 Virando de Lado em Pe*/
@@ -3447,7 +3651,7 @@ and P[ind].Lado== 1
 and P[ind].x>MeioDaTela
 and (P[ind].TotalDeFramesMov[607]>-1) )	{
 P[ind].Lado=-1;
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=607; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*607 Virando de Lado em Pe*/
@@ -3456,7 +3660,7 @@ and P[ind].Lado==-1
 and P[ind].x<MeioDaTela
 and (P[ind].TotalDeFramesMov[607]>-1) )	{
 P[ind].Lado= 1;
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=607; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*608 Virando de Lado Abaixado*/
@@ -3465,7 +3669,7 @@ and (P[ind].x>MeioDaTela
 and P[ind].Lado== 1)
 and (P[ind].TotalDeFramesMov[608]>-1) )	{
 P[ind].Lado=-1;
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=608; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*608 Virando de Lado Abaixado*/
@@ -3474,7 +3678,7 @@ and (P[ind].x<MeioDaTela
 and P[ind].Lado==-1)
 and (P[ind].TotalDeFramesMov[608]>-1) )	{
 P[ind].Lado= 1;
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=608; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*608 Virando de Lado Abaixado*/
@@ -3483,7 +3687,7 @@ and P[ind].Lado== 1
 and P[ind].x>MeioDaTela
 and (P[ind].TotalDeFramesMov[608]>-1) )	{
 P[ind].Lado=-1;
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=608; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*608 Virando de Lado Abaixado*/
@@ -3491,75 +3695,75 @@ if ( P[ind].State==220
 and P[ind].Lado==-1
 and P[ind].x<MeioDaTela
 and (P[ind].TotalDeFramesMov[608]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=608; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*210 Abaixado Andando para Tras*/
 if ( P[ind].State==210
-and P[ind].key_LEFT_released==1
+and hamoopi_input_released(&P[ind].Teclas, TECLA_LEFT)==1
 and (P[ind].TotalDeFramesMov[200]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=200; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*210 Abaixado Andando para Tras*/
 if ( P[ind].State==210
-and P[ind].key_RIGHT_released==1
+and hamoopi_input_released(&P[ind].Teclas, TECLA_RIGHT)==1
 and P[ind].Lado==-1
 and (P[ind].TotalDeFramesMov[200]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=200; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*220 Abaixado Andando para Frente*/
 if ( P[ind].State==220
-and P[ind].key_RIGHT_released==1
+and hamoopi_input_released(&P[ind].Teclas, TECLA_RIGHT)==1
 and (P[ind].TotalDeFramesMov[200]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=200; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*220 Abaixado Andando para Frente*/
 if ( P[ind].State==220
-and P[ind].key_LEFT_released==1
+and hamoopi_input_released(&P[ind].Teclas, TECLA_LEFT)==1
 and P[ind].Lado==-1
 and (P[ind].TotalDeFramesMov[200]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=200; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*210;220 Stop*/
 if ( (P[ind].State==210 || P[ind].State==220)
-and (P[ind].key_DOWN_released==1 || P[ind].key_DOWN_hold==0) ) {
+and (hamoopi_input_released(&P[ind].Teclas, TECLA_DOWN)==1 || hamoopi_input_hold(&P[ind].Teclas, TECLA_DOWN)==0) ) {
 int set=0;
 if(P[ind].TotalDeFramesMov[602]>-1){ set=602; }else{ set=100; }
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*100 Parado*/
 if ( P[ind].State==410
-and P[ind].key_LEFT_released==1
+and hamoopi_input_released(&P[ind].Teclas, TECLA_LEFT)==1
 and (P[ind].TotalDeFramesMov[100]>-1) ) {
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=100; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*100 Parado*/
 if ( P[ind].State==410
-and P[ind].key_RIGHT_released==1
+and hamoopi_input_released(&P[ind].Teclas, TECLA_RIGHT)==1
 and P[ind].Lado==-1
 and (P[ind].TotalDeFramesMov[100]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=100; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*100 Parado*/
 if ( P[ind].State==420
-and P[ind].key_RIGHT_released==1
+and hamoopi_input_released(&P[ind].Teclas, TECLA_RIGHT)==1
 and (P[ind].TotalDeFramesMov[100]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=100; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*100 Parado*/
 if ( P[ind].State==420
-and P[ind].key_LEFT_released==1
+and hamoopi_input_released(&P[ind].Teclas, TECLA_LEFT)==1
 and P[ind].Lado==-1
 and (P[ind].TotalDeFramesMov[100]>-1) )	{
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=100; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 /*611 Ganhou por KO ou Time Over*/
@@ -3572,12 +3776,12 @@ or P[other].State==616 || P[other].State==617
 or P[other].State==618 || P[other].State==100) ){
 if(P[ind].TotalDeFramesMov[611]> -1){
 P[ind].Hspeed=0;
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=611; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 if(P[ind].TotalDeFramesMov[611]==-1){
 P[ind].Hspeed=0;
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=100; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 }
@@ -3602,12 +3806,12 @@ and P[ind].State!= 11 && P[ind].State!= 12 && P[ind].State!= 13
 && P[ind].Energy>0 ){
 if(P[ind].TotalDeFramesMov[616]> -1){
 P[ind].Hspeed=0;
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=616; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 if(P[ind].TotalDeFramesMov[616]==-1){
 P[ind].Hspeed=0;
-P[ind].StartFrame=timer; //P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; //P[ind].MovStartFrame=P[ind].StartFrame;
 int set=100; PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 }
@@ -3639,7 +3843,7 @@ if(P[1].x >= bg_test->w-30){ P[2].x -= 1; P[1].x = bg_test->w-30;}
 /* <P1> */
 //DIF01 - Mantem o personagem dentro da tela
 if ( P[1].Hspeed!=0 && P1HitPause==0 ) {
-P[1].x+=P[1].Hspeed;
+P[1].x=hamoopi_sim_add(P[1].x, P[1].Hspeed);
 if(P[1].x<=30){
 P[1].x=30;
 }
@@ -3648,12 +3852,12 @@ P[1].x=bg_test->w-30;
 }
 }
 //DIF02 - Define a distancia maxima entre os jogadores
-if(op_Zoom==1) { if (abs(P[1].x-P[2].x)>bufferx->h*0.6) { P[1].x+=(P[1].Hspeed*-1); P[2].x+=(P[2].Hspeed*-1); } }
-if(op_Zoom==0) { if (abs(P[1].x-P[2].x)>250) { P[1].x+=(P[1].Hspeed*-1); } }
+if(op_Zoom==1) { if (abs(P[1].x-P[2].x)>bg_test->h*2*0.6) { P[1].x=hamoopi_sim_add(P[1].x, -P[1].Hspeed); P[2].x=hamoopi_sim_add(P[2].x, -P[2].Hspeed); } }
+if(op_Zoom==0) { if (abs(P[1].x-P[2].x)>250) { P[1].x=hamoopi_sim_add(P[1].x, -P[1].Hspeed); } }
 //DIF03 - Calcula o pulo e o pouso no chao
 if ( P[1].Vspeed!=0 && P1HitPause==0 ) {
-P[1].y+=P[1].Vspeed; //if(P[1].y<=0){P[1].y=0;}
-P[1].ConstanteY+=P[1].Vspeed-P[1].Gravity;
+P[1].y=hamoopi_sim_add(P[1].y, P[1].Vspeed); //if(P[1].y<=0){P[1].y=0;}
+P[1].ConstanteY=hamoopi_sim_add(P[1].ConstanteY, P[1].Vspeed-P[1].Gravity);
 if (P[1].y>=AlturaPiso){
 P[1].y=AlturaPiso;
 P[1].Hspeed=0;
@@ -3670,7 +3874,7 @@ if(P[1].State==100) { P[1].Hspeed=0; P[1].Vspeed=0; }
 /* <P2> */
 //DIF01 - Mantem o personagem dentro da tela
 if ( P[2].Hspeed!=0 && P2HitPause==0 ) {
-P[2].x+=P[2].Hspeed;
+P[2].x=hamoopi_sim_add(P[2].x, P[2].Hspeed);
 if(P[2].x<=30){
 P[2].x=30;
 }
@@ -3679,12 +3883,12 @@ P[2].x=bg_test->w-30;
 }
 }
 //DIF02 - Define a distancia maxima entre os jogadores
-if(op_Zoom==1) { if (abs(P[1].x-P[2].x)>bufferx->h*0.6) { P[1].x+=(P[1].Hspeed*-1); P[2].x+=(P[2].Hspeed*-1); } }
-if(op_Zoom==0) { if (abs(P[1].x-P[2].x)>250) { P[2].x+=(P[2].Hspeed*-1); } }
+if(op_Zoom==1) { if (abs(P[1].x-P[2].x)>bg_test->h*2*0.6) { P[1].x=hamoopi_sim_add(P[1].x, -P[1].Hspeed); P[2].x=hamoopi_sim_add(P[2].x, -P[2].Hspeed); } }
+if(op_Zoom==0) { if (abs(P[1].x-P[2].x)>250) { P[2].x=hamoopi_sim_add(P[2].x, -P[2].Hspeed); } }
 //DIF03 - Calcula o pulo e o pouso no chao
 if ( P[2].Vspeed!=0 && P2HitPause==0 ) {
-P[2].y+=P[2].Vspeed; //if(P[2].y<=0){P[2].y=0;}
-P[2].ConstanteY+=P[2].Vspeed-P[2].Gravity;
+P[2].y=hamoopi_sim_add(P[2].y, P[2].Vspeed); //if(P[2].y<=0){P[2].y=0;}
+P[2].ConstanteY=hamoopi_sim_add(P[2].ConstanteY, P[2].Vspeed-P[2].Gravity);
 if (P[2].y>=AlturaPiso){
 P[2].y=AlturaPiso;
 P[2].Hspeed=0;
@@ -3705,127 +3909,126 @@ if(P[2].State==100) { P[2].Hspeed=0; P[2].Vspeed=0; }
 int Atuador1=0;
 int Atuador2=0;
 
-//clear_to_color(bufferx,makecol(100,149,237)); //fundo azul
-clear_to_color(bufferx,makecol(0,0,0)); //fundo preto
+//o fundo e desenhado pela camera, direto na tela de apresentacao (ver Cam_Draw_BG)
 
 /* <P1> anim */
 if ( P1HitPause==0 && P2HitPause==0 )
 {
 int HitStackChange=0;
-if (P[1].IndexAnim== 0) { if (timer>P[1].StartFrame+P1_FrameTime_00) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_01; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim== 0) { if (LogicTick>P[1].StartFrame+P1_FrameTime_00) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_01; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim== 1) { if (timer>P[1].StartFrame+P1_FrameTime_01) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_02; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim== 1) { if (LogicTick>P[1].StartFrame+P1_FrameTime_01) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_02; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim== 2) { if (timer>P[1].StartFrame+P1_FrameTime_02) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_03; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim== 2) { if (LogicTick>P[1].StartFrame+P1_FrameTime_02) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_03; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim== 3) { if (timer>P[1].StartFrame+P1_FrameTime_03) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_04; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim== 3) { if (LogicTick>P[1].StartFrame+P1_FrameTime_03) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_04; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim== 4) { if (timer>P[1].StartFrame+P1_FrameTime_04) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_05; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim== 4) { if (LogicTick>P[1].StartFrame+P1_FrameTime_04) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_05; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim== 5) { if (timer>P[1].StartFrame+P1_FrameTime_05) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_06; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim== 5) { if (LogicTick>P[1].StartFrame+P1_FrameTime_05) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_06; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim== 6) { if (timer>P[1].StartFrame+P1_FrameTime_06) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_07; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim== 6) { if (LogicTick>P[1].StartFrame+P1_FrameTime_06) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_07; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim== 7) { if (timer>P[1].StartFrame+P1_FrameTime_07) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_08; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim== 7) { if (LogicTick>P[1].StartFrame+P1_FrameTime_07) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_08; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim== 8) { if (timer>P[1].StartFrame+P1_FrameTime_08) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_09; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim== 8) { if (LogicTick>P[1].StartFrame+P1_FrameTime_08) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_09; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim== 9) { if (timer>P[1].StartFrame+P1_FrameTime_09) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_10; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim== 9) { if (LogicTick>P[1].StartFrame+P1_FrameTime_09) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_10; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==10) { if (timer>P[1].StartFrame+P1_FrameTime_10) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_11; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==10) { if (LogicTick>P[1].StartFrame+P1_FrameTime_10) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_11; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==11) { if (timer>P[1].StartFrame+P1_FrameTime_11) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_12; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==11) { if (LogicTick>P[1].StartFrame+P1_FrameTime_11) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_12; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==12) { if (timer>P[1].StartFrame+P1_FrameTime_12) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_13; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==12) { if (LogicTick>P[1].StartFrame+P1_FrameTime_12) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_13; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==13) { if (timer>P[1].StartFrame+P1_FrameTime_13) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_14; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==13) { if (LogicTick>P[1].StartFrame+P1_FrameTime_13) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_14; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==14) { if (timer>P[1].StartFrame+P1_FrameTime_14) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_15; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==14) { if (LogicTick>P[1].StartFrame+P1_FrameTime_14) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_15; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==15) { if (timer>P[1].StartFrame+P1_FrameTime_15) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_16; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==15) { if (LogicTick>P[1].StartFrame+P1_FrameTime_15) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_16; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==16) { if (timer>P[1].StartFrame+P1_FrameTime_16) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_17; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==16) { if (LogicTick>P[1].StartFrame+P1_FrameTime_16) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_17; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==17) { if (timer>P[1].StartFrame+P1_FrameTime_17) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_18; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==17) { if (LogicTick>P[1].StartFrame+P1_FrameTime_17) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_18; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==18) { if (timer>P[1].StartFrame+P1_FrameTime_18) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_19; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==18) { if (LogicTick>P[1].StartFrame+P1_FrameTime_18) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_19; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==19) { if (timer>P[1].StartFrame+P1_FrameTime_19) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_20; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==19) { if (LogicTick>P[1].StartFrame+P1_FrameTime_19) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_20; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==20) { if (timer>P[1].StartFrame+P1_FrameTime_20) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_21; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==20) { if (LogicTick>P[1].StartFrame+P1_FrameTime_20) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_21; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==21) { if (timer>P[1].StartFrame+P1_FrameTime_21) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_22; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==21) { if (LogicTick>P[1].StartFrame+P1_FrameTime_21) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_22; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==22) { if (timer>P[1].StartFrame+P1_FrameTime_22) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_23; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==22) { if (LogicTick>P[1].StartFrame+P1_FrameTime_22) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_23; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==23) { if (timer>P[1].StartFrame+P1_FrameTime_23) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_24; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==23) { if (LogicTick>P[1].StartFrame+P1_FrameTime_23) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_24; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==24) { if (timer>P[1].StartFrame+P1_FrameTime_24) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_25; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==24) { if (LogicTick>P[1].StartFrame+P1_FrameTime_24) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_25; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==25) { if (timer>P[1].StartFrame+P1_FrameTime_25) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_26; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==25) { if (LogicTick>P[1].StartFrame+P1_FrameTime_25) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_26; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==26) { if (timer>P[1].StartFrame+P1_FrameTime_26) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_27; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==26) { if (LogicTick>P[1].StartFrame+P1_FrameTime_26) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_27; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==27) { if (timer>P[1].StartFrame+P1_FrameTime_27) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_28; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==27) { if (LogicTick>P[1].StartFrame+P1_FrameTime_27) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_28; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[1].IndexAnim==28) { if (timer>P[1].StartFrame+P1_FrameTime_28) {
-Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_29; P[1].StartFrame=timer; Draw_CHBoxes_P1();
+if (P[1].IndexAnim==28) { if (LogicTick>P[1].StartFrame+P1_FrameTime_28) {
+Atuador1=1; P[1].IndexAnim++; P1_FrameTime=P1_FrameTime_29; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1();
 if (strcmp (P[1].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
 if(HitStackChange==1){
@@ -3858,86 +4061,86 @@ and P[1].State!=700 && P[1].State!=710 && P[1].State!=720 && P[1].State!=730
 and P[1].State!=740 && P[1].State!=750 && P[1].State!=760
 and P[1].State!=770 && P[1].State!=780 && P[1].State!=790
 ) //EXCESSOES DE NON LOOPS
-{ P[1].IndexAnim=0; P1_FrameTime=P1_FrameTime_00; P[1].StartFrame=timer; Draw_CHBoxes_P1(); } //-loop
+{ P[1].IndexAnim=0; P1_FrameTime=P1_FrameTime_00; P[1].StartFrame=LogicTick; Draw_CHBoxes_P1(); } //-loop
 /* <P1> Non Loops FSM! */
 //movimentos sem loop terminam e carregam outros movimentos, exemplo: final do soco fraco [101] carrega movimento parado [100]
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==101) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==102) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==103) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==104) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==105) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==106) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==151) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==152) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==153) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==154) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==155) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==156) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==201) { P[1].StartFrame=timer; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==202) { P[1].StartFrame=timer; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==203) { P[1].StartFrame=timer; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==204) { P[1].StartFrame=timer; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==205) { P[1].StartFrame=timer; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==206) { P[1].StartFrame=timer; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==501) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==502) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==503) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==504) { P[1].StartFrame=timer; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==505) { P[1].StartFrame=timer; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==506) { P[1].StartFrame=timer; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==511) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==512) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==513) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==601) { P[1].StartFrame=timer; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==552) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==602) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==603) { P[1].StartFrame=timer; PLAYER_STATE(1, 310, 0, P[1].TotalDeFramesMov[310]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==604) { P[1].StartFrame=timer; PLAYER_STATE(1, 300, 0, P[1].TotalDeFramesMov[300]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==605) { P[1].StartFrame=timer; PLAYER_STATE(1, 320, 0, P[1].TotalDeFramesMov[320]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==606) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==607) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==608) { P[1].StartFrame=timer; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==700) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==710) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==720) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==730) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==740) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==750) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==760) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==770) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==780) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==790) { P[1].StartFrame=timer; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==101) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==102) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==103) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==104) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==105) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==106) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==151) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==152) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==153) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==154) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==155) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==156) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==201) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==202) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==203) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==204) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==205) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==206) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==501) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==502) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==503) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==504) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==505) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==506) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==511) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==512) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==513) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==601) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==552) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==602) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==603) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 310, 0, P[1].TotalDeFramesMov[310]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==604) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 300, 0, P[1].TotalDeFramesMov[300]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==605) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 320, 0, P[1].TotalDeFramesMov[320]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==606) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==607) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==608) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 200, 0, P[1].TotalDeFramesMov[200]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==700) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==710) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==720) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==730) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==740) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==750) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==760) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==770) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==780) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==790) { P[1].StartFrame=LogicTick; PLAYER_STATE(1, 100, 0, P[1].TotalDeFramesMov[100]); Draw_CHBoxes_P1(); }
 
 //Anim Infinita
 //if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==300) {  }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==301) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 301, P[1].IndexAnim, P[1].TotalDeFramesMov[301]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==302) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 302, P[1].IndexAnim, P[1].TotalDeFramesMov[302]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==303) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 303, P[1].IndexAnim, P[1].TotalDeFramesMov[303]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==304) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 304, P[1].IndexAnim, P[1].TotalDeFramesMov[304]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==305) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 305, P[1].IndexAnim, P[1].TotalDeFramesMov[305]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==306) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 306, 0, P[1].TotalDeFramesMov[306]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==301) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 301, P[1].IndexAnim, P[1].TotalDeFramesMov[301]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==302) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 302, P[1].IndexAnim, P[1].TotalDeFramesMov[302]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==303) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 303, P[1].IndexAnim, P[1].TotalDeFramesMov[303]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==304) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 304, P[1].IndexAnim, P[1].TotalDeFramesMov[304]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==305) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 305, P[1].IndexAnim, P[1].TotalDeFramesMov[305]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==306) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 306, 0, P[1].TotalDeFramesMov[306]); Draw_CHBoxes_P1(); }
 //if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==310) {  }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==311) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 311, P[1].IndexAnim, P[1].TotalDeFramesMov[311]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==312) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 312, P[1].IndexAnim, P[1].TotalDeFramesMov[312]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==313) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 313, P[1].IndexAnim, P[1].TotalDeFramesMov[313]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==314) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 314, P[1].IndexAnim, P[1].TotalDeFramesMov[314]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==315) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 315, P[1].IndexAnim, P[1].TotalDeFramesMov[315]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==316) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 316, P[1].IndexAnim, P[1].TotalDeFramesMov[316]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==311) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 311, P[1].IndexAnim, P[1].TotalDeFramesMov[311]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==312) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 312, P[1].IndexAnim, P[1].TotalDeFramesMov[312]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==313) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 313, P[1].IndexAnim, P[1].TotalDeFramesMov[313]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==314) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 314, P[1].IndexAnim, P[1].TotalDeFramesMov[314]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==315) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 315, P[1].IndexAnim, P[1].TotalDeFramesMov[315]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==316) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 316, P[1].IndexAnim, P[1].TotalDeFramesMov[316]); Draw_CHBoxes_P1(); }
 //if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==320) {  }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==321) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 321, P[1].IndexAnim, P[1].TotalDeFramesMov[321]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==322) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 322, P[1].IndexAnim, P[1].TotalDeFramesMov[322]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==323) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 323, P[1].IndexAnim, P[1].TotalDeFramesMov[323]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==324) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 324, P[1].IndexAnim, P[1].TotalDeFramesMov[324]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==325) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 325, P[1].IndexAnim, P[1].TotalDeFramesMov[325]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==326) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 326, P[1].IndexAnim, P[1].TotalDeFramesMov[326]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==321) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 321, P[1].IndexAnim, P[1].TotalDeFramesMov[321]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==322) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 322, P[1].IndexAnim, P[1].TotalDeFramesMov[322]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==323) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 323, P[1].IndexAnim, P[1].TotalDeFramesMov[323]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==324) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 324, P[1].IndexAnim, P[1].TotalDeFramesMov[324]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==325) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 325, P[1].IndexAnim, P[1].TotalDeFramesMov[325]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==326) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 326, P[1].IndexAnim, P[1].TotalDeFramesMov[326]); Draw_CHBoxes_P1(); }
 //if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==507) {  }
 //if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==550) {  }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==611) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 611, P[1].IndexAnim, P[1].TotalDeFramesMov[611]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==612) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 612, P[1].IndexAnim, P[1].TotalDeFramesMov[612]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==613) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 613, P[1].IndexAnim, P[1].TotalDeFramesMov[613]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==616) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 616, P[1].IndexAnim, P[1].TotalDeFramesMov[616]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==617) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 617, P[1].IndexAnim, P[1].TotalDeFramesMov[617]); Draw_CHBoxes_P1(); }
-if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==618) { P[1].IndexAnim--; P[1].StartFrame=timer; PLAYER_STATE(1, 618, P[1].IndexAnim, P[1].TotalDeFramesMov[618]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==611) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 611, P[1].IndexAnim, P[1].TotalDeFramesMov[611]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==612) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 612, P[1].IndexAnim, P[1].TotalDeFramesMov[612]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==613) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 613, P[1].IndexAnim, P[1].TotalDeFramesMov[613]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==616) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 616, P[1].IndexAnim, P[1].TotalDeFramesMov[616]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==617) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 617, P[1].IndexAnim, P[1].TotalDeFramesMov[617]); Draw_CHBoxes_P1(); }
+if (P[1].IndexAnim>P[1].TotalFrames && P[1].State==618) { P[1].IndexAnim--; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 618, P[1].IndexAnim, P[1].TotalDeFramesMov[618]); Draw_CHBoxes_P1(); }
 
 //garante que o IndexAnim nunca vai ser maior que TotalFrames
 if (P[1].IndexAnim>P[1].TotalFrames){ P[1].IndexAnim=P[1].TotalFrames; }
@@ -3946,120 +4149,120 @@ if (P[1].IndexAnim>P[1].TotalFrames){ P[1].IndexAnim=P[1].TotalFrames; }
 if ( P2HitPause==0 && P1HitPause==0 )
 {
 int HitStackChange=0;
-if (P[2].IndexAnim== 0) { if (timer>P[2].StartFrame+P2_FrameTime_00) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_01; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim== 0) { if (LogicTick>P[2].StartFrame+P2_FrameTime_00) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_01; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim== 1) { if (timer>P[2].StartFrame+P2_FrameTime_01) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_02; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim== 1) { if (LogicTick>P[2].StartFrame+P2_FrameTime_01) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_02; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim== 2) { if (timer>P[2].StartFrame+P2_FrameTime_02) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_03; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim== 2) { if (LogicTick>P[2].StartFrame+P2_FrameTime_02) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_03; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim== 3) { if (timer>P[2].StartFrame+P2_FrameTime_03) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_04; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim== 3) { if (LogicTick>P[2].StartFrame+P2_FrameTime_03) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_04; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim== 4) { if (timer>P[2].StartFrame+P2_FrameTime_04) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_05; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim== 4) { if (LogicTick>P[2].StartFrame+P2_FrameTime_04) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_05; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim== 5) { if (timer>P[2].StartFrame+P2_FrameTime_05) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_06; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim== 5) { if (LogicTick>P[2].StartFrame+P2_FrameTime_05) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_06; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim== 6) { if (timer>P[2].StartFrame+P2_FrameTime_06) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_07; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim== 6) { if (LogicTick>P[2].StartFrame+P2_FrameTime_06) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_07; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim== 7) { if (timer>P[2].StartFrame+P2_FrameTime_07) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_08; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim== 7) { if (LogicTick>P[2].StartFrame+P2_FrameTime_07) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_08; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim== 8) { if (timer>P[2].StartFrame+P2_FrameTime_08) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_09; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim== 8) { if (LogicTick>P[2].StartFrame+P2_FrameTime_08) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_09; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim== 9) { if (timer>P[2].StartFrame+P2_FrameTime_09) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_10; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim== 9) { if (LogicTick>P[2].StartFrame+P2_FrameTime_09) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_10; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==10) { if (timer>P[2].StartFrame+P2_FrameTime_10) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_11; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==10) { if (LogicTick>P[2].StartFrame+P2_FrameTime_10) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_11; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==11) { if (timer>P[2].StartFrame+P2_FrameTime_11) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_12; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==11) { if (LogicTick>P[2].StartFrame+P2_FrameTime_11) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_12; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==12) { if (timer>P[2].StartFrame+P2_FrameTime_12) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_13; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==12) { if (LogicTick>P[2].StartFrame+P2_FrameTime_12) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_13; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==13) { if (timer>P[2].StartFrame+P2_FrameTime_13) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_14; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==13) { if (LogicTick>P[2].StartFrame+P2_FrameTime_13) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_14; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==14) { if (timer>P[2].StartFrame+P2_FrameTime_14) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_15; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==14) { if (LogicTick>P[2].StartFrame+P2_FrameTime_14) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_15; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==15) { if (timer>P[2].StartFrame+P2_FrameTime_15) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_16; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==15) { if (LogicTick>P[2].StartFrame+P2_FrameTime_15) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_16; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==16) { if (timer>P[2].StartFrame+P2_FrameTime_16) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_17; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==16) { if (LogicTick>P[2].StartFrame+P2_FrameTime_16) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_17; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==17) { if (timer>P[2].StartFrame+P2_FrameTime_17) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_18; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==17) { if (LogicTick>P[2].StartFrame+P2_FrameTime_17) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_18; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==18) { if (timer>P[2].StartFrame+P2_FrameTime_18) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_19; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==18) { if (LogicTick>P[2].StartFrame+P2_FrameTime_18) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_19; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==19) { if (timer>P[2].StartFrame+P2_FrameTime_19) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_20; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==19) { if (LogicTick>P[2].StartFrame+P2_FrameTime_19) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_20; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==20) { if (timer>P[2].StartFrame+P2_FrameTime_20) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_21; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==20) { if (LogicTick>P[2].StartFrame+P2_FrameTime_20) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_21; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==21) { if (timer>P[2].StartFrame+P2_FrameTime_21) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_22; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==21) { if (LogicTick>P[2].StartFrame+P2_FrameTime_21) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_22; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==22) { if (timer>P[2].StartFrame+P2_FrameTime_22) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_23; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==22) { if (LogicTick>P[2].StartFrame+P2_FrameTime_22) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_23; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==23) { if (timer>P[2].StartFrame+P2_FrameTime_23) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_24; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==23) { if (LogicTick>P[2].StartFrame+P2_FrameTime_23) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_24; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==24) { if (timer>P[2].StartFrame+P2_FrameTime_24) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_25; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==24) { if (LogicTick>P[2].StartFrame+P2_FrameTime_24) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_25; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==25) { if (timer>P[2].StartFrame+P2_FrameTime_25) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_26; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==25) { if (LogicTick>P[2].StartFrame+P2_FrameTime_25) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_26; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==26) { if (timer>P[2].StartFrame+P2_FrameTime_26) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_27; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==26) { if (LogicTick>P[2].StartFrame+P2_FrameTime_26) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_27; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==27) { if (timer>P[2].StartFrame+P2_FrameTime_27) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_28; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==27) { if (LogicTick>P[2].StartFrame+P2_FrameTime_27) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_28; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
-if (P[2].IndexAnim==28) { if (timer>P[2].StartFrame+P2_FrameTime_28) {
-Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_29; P[2].StartFrame=timer; Draw_CHBoxes_P2();
+if (P[2].IndexAnim==28) { if (LogicTick>P[2].StartFrame+P2_FrameTime_28) {
+Atuador2=1; P[2].IndexAnim++; P2_FrameTime=P2_FrameTime_29; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2();
 if (strcmp (P[2].HitStack,"Multi")==0){ HitStackChange=1; }
 }}
 if(HitStackChange==1){
@@ -4091,86 +4294,86 @@ and P[2].State!=700 && P[2].State!=710 && P[2].State!=720 && P[2].State!=730
 and P[2].State!=740 && P[2].State!=750 && P[2].State!=760
 and P[2].State!=770 && P[2].State!=780 && P[2].State!=790
 ) //EXCESSOES DE NON LOOPS
-{ P[2].IndexAnim=0; P2_FrameTime=P2_FrameTime_00; P[2].StartFrame=timer; Draw_CHBoxes_P2(); } //-loop
+{ P[2].IndexAnim=0; P2_FrameTime=P2_FrameTime_00; P[2].StartFrame=LogicTick; Draw_CHBoxes_P2(); } //-loop
 /* <P2> Non Loops FSM! */
 //movimentos sem loop terminam e carregam outros movimentos, exemplo: final do soco fraco [101] carrega movimento parado [100]
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==101) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==102) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==103) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==104) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==105) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==106) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==151) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==152) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==153) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==154) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==155) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==156) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==201) { P[2].StartFrame=timer; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==202) { P[2].StartFrame=timer; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==203) { P[2].StartFrame=timer; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==204) { P[2].StartFrame=timer; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==205) { P[2].StartFrame=timer; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==206) { P[2].StartFrame=timer; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==501) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==502) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==503) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==504) { P[2].StartFrame=timer; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==505) { P[2].StartFrame=timer; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==506) { P[2].StartFrame=timer; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==511) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==512) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==513) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==601) { P[2].StartFrame=timer; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==552) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==602) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==603) { P[2].StartFrame=timer; PLAYER_STATE(2, 310, 0, P[2].TotalDeFramesMov[310]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==604) { P[2].StartFrame=timer; PLAYER_STATE(2, 300, 0, P[2].TotalDeFramesMov[300]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==605) { P[2].StartFrame=timer; PLAYER_STATE(2, 320, 0, P[2].TotalDeFramesMov[320]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==606) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==607) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==608) { P[2].StartFrame=timer; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==700) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==710) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==720) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==730) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==740) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==750) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==760) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==770) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==780) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==790) { P[2].StartFrame=timer; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==101) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==102) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==103) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==104) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==105) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==106) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==151) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==152) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==153) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==154) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==155) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==156) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==201) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==202) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==203) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==204) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==205) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==206) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==501) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==502) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==503) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==504) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==505) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==506) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==511) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==512) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==513) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==601) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==552) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==602) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==603) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 310, 0, P[2].TotalDeFramesMov[310]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==604) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 300, 0, P[2].TotalDeFramesMov[300]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==605) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 320, 0, P[2].TotalDeFramesMov[320]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==606) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==607) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==608) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 200, 0, P[2].TotalDeFramesMov[200]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==700) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==710) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==720) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==730) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==740) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==750) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==760) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==770) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==780) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==790) { P[2].StartFrame=LogicTick; PLAYER_STATE(2, 100, 0, P[2].TotalDeFramesMov[100]); Draw_CHBoxes_P2(); }
 
 //Anim Infinita
 //if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==300) {  }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==301) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 301, P[2].IndexAnim, P[2].TotalDeFramesMov[301]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==302) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 302, P[2].IndexAnim, P[2].TotalDeFramesMov[302]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==303) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 303, P[2].IndexAnim, P[2].TotalDeFramesMov[303]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==304) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 304, P[2].IndexAnim, P[2].TotalDeFramesMov[304]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==305) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 305, P[2].IndexAnim, P[2].TotalDeFramesMov[305]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==306) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(1, 306, 0, P[2].TotalDeFramesMov[306]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==301) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 301, P[2].IndexAnim, P[2].TotalDeFramesMov[301]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==302) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 302, P[2].IndexAnim, P[2].TotalDeFramesMov[302]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==303) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 303, P[2].IndexAnim, P[2].TotalDeFramesMov[303]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==304) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 304, P[2].IndexAnim, P[2].TotalDeFramesMov[304]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==305) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 305, P[2].IndexAnim, P[2].TotalDeFramesMov[305]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==306) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(1, 306, 0, P[2].TotalDeFramesMov[306]); Draw_CHBoxes_P2(); }
 //if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==310) {  }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==311) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 311, P[2].IndexAnim, P[2].TotalDeFramesMov[311]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==312) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 312, P[2].IndexAnim, P[2].TotalDeFramesMov[312]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==313) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 313, P[2].IndexAnim, P[2].TotalDeFramesMov[313]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==314) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 314, P[2].IndexAnim, P[2].TotalDeFramesMov[314]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==315) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 315, P[2].IndexAnim, P[2].TotalDeFramesMov[315]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==316) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 316, P[2].IndexAnim, P[2].TotalDeFramesMov[316]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==311) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 311, P[2].IndexAnim, P[2].TotalDeFramesMov[311]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==312) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 312, P[2].IndexAnim, P[2].TotalDeFramesMov[312]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==313) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 313, P[2].IndexAnim, P[2].TotalDeFramesMov[313]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==314) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 314, P[2].IndexAnim, P[2].TotalDeFramesMov[314]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==315) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 315, P[2].IndexAnim, P[2].TotalDeFramesMov[315]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==316) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 316, P[2].IndexAnim, P[2].TotalDeFramesMov[316]); Draw_CHBoxes_P2(); }
 //if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==320) {  }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==321) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 321, P[2].IndexAnim, P[2].TotalDeFramesMov[321]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==322) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 322, P[2].IndexAnim, P[2].TotalDeFramesMov[322]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==323) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 323, P[2].IndexAnim, P[2].TotalDeFramesMov[323]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==324) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 324, P[2].IndexAnim, P[2].TotalDeFramesMov[324]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==325) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 325, P[2].IndexAnim, P[2].TotalDeFramesMov[325]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==326) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 326, P[2].IndexAnim, P[2].TotalDeFramesMov[326]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==321) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 321, P[2].IndexAnim, P[2].TotalDeFramesMov[321]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==322) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 322, P[2].IndexAnim, P[2].TotalDeFramesMov[322]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==323) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 323, P[2].IndexAnim, P[2].TotalDeFramesMov[323]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==324) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 324, P[2].IndexAnim, P[2].TotalDeFramesMov[324]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==325) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 325, P[2].IndexAnim, P[2].TotalDeFramesMov[325]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==326) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 326, P[2].IndexAnim, P[2].TotalDeFramesMov[326]); Draw_CHBoxes_P2(); }
 //if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==507) {  }
 //if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==550) {  }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==611) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 611, P[2].IndexAnim, P[2].TotalDeFramesMov[611]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==612) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 612, P[2].IndexAnim, P[2].TotalDeFramesMov[612]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==613) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 613, P[2].IndexAnim, P[2].TotalDeFramesMov[613]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==616) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 616, P[2].IndexAnim, P[2].TotalDeFramesMov[616]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==617) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 617, P[2].IndexAnim, P[2].TotalDeFramesMov[617]); Draw_CHBoxes_P2(); }
-if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==618) { P[2].IndexAnim--; P[2].StartFrame=timer; PLAYER_STATE(2, 618, P[2].IndexAnim, P[2].TotalDeFramesMov[618]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==611) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 611, P[2].IndexAnim, P[2].TotalDeFramesMov[611]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==612) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 612, P[2].IndexAnim, P[2].TotalDeFramesMov[612]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==613) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 613, P[2].IndexAnim, P[2].TotalDeFramesMov[613]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==616) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 616, P[2].IndexAnim, P[2].TotalDeFramesMov[616]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==617) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 617, P[2].IndexAnim, P[2].TotalDeFramesMov[617]); Draw_CHBoxes_P2(); }
+if (P[2].IndexAnim>P[2].TotalFrames && P[2].State==618) { P[2].IndexAnim--; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 618, P[2].IndexAnim, P[2].TotalDeFramesMov[618]); Draw_CHBoxes_P2(); }
 
 //garante que o IndexAnim nunca vai ser maior que TotalFrames
 if (P[2].IndexAnim>P[2].TotalFrames){ P[2].IndexAnim=P[2].TotalFrames; }
@@ -4192,14 +4395,7 @@ if(Atuador1==1){ Atuador1=0; }
 if(Atuador2==1){ Atuador2=0; }
 
 //localiza a linha especifica no TableAtlas
-int line=0;
-for(int indx=0;indx<=500;indx++){
-if( P[ind].State==P[ind].TableAtlas[indx][0]
-and P[ind].IndexAnim==P[ind].TableAtlas[indx][1]){
-line=P[ind].TableAtlas[indx][2];
-}
-if(line!=0) break;
-}
+int line=LinhaDoAtlas(ind, P[ind].State, P[ind].IndexAnim);
 
 //somente aplica os atuadores do 2 frame em diante da animacao
 //lembrando que o atuador do primeiro frame é carregado no LOAD_PLAYER
@@ -4270,7 +4466,7 @@ if(a==2) { strcpy(P[ind].HitType, "Fall");}
 //ChangeState//
 if(P[ind].TableAtlas[line][17]!=-5555){
 int set=P[ind].TableAtlas[line][17];
-P[ind].StartFrame=timer; P[ind].MovStartFrame=P[ind].StartFrame;
+P[ind].StartFrame=LogicTick; P[ind].MovStartFrame=P[ind].StartFrame;
 PLAYER_STATE(ind, set, 0, P[ind].TotalDeFramesMov[set]);
 }
 
@@ -4299,15 +4495,10 @@ if(a==2) { strcpy(P[ind].HitStack, "Multi"); }
 // DESENHA PERSONAGENS NA TELA --------------------------------------------
 ///////////////////////////////////////////////////////////////////////////
 
-//desenha o cenario em render 2X em bufferx
-bufferx->w=bg_test->w*2;
-bufferx->h=bg_test->h*2;
-stretch_blit(bg_test, bufferx, 0, 0, bg_test->w, bg_test->h, 0, 0, bufferx->w, bufferx->h);
-
 //---VScreen+Zoom---//
 
 if(op_Zoom==1) {
-if( (VScreen_h-VScreen_y)/bufferx->h < 1 ) {
+if( (VScreen_h-VScreen_y)/(bg_test->h*2) < 1 ) {
 ZoomMaximoAtingido=0;
 }
 else {
@@ -4325,7 +4516,7 @@ if(VScreen_FatorZoom<=250) { VScreen_FatorZoom=250; } //limita a diminuicao do z
 if(ZoomMaximoAtingido==0){
 //VS_x
 VScreen_x=MeioDaTela*2-VScreen_FatorZoom;
-if(VScreen_x>bufferx->w-VScreen_FatorZoom*2) VScreen_x=bufferx->w-VScreen_FatorZoom*2;
+if(VScreen_x>bg_test->w*2-VScreen_FatorZoom*2) VScreen_x=bg_test->w*2-VScreen_FatorZoom*2;
 if(VScreen_x<0) { VScreen_x=0; }
 //VS_y
 VScreen_y=bg_test->h*2-(480*VScreen_FatorZoom/320);
@@ -4333,14 +4524,14 @@ VScreen_y+=P[1].ConstanteY+P[2].ConstanteY;
 if(VScreen_y<0) { VScreen_y=0; }
 //VS_w, VS_h
 VScreen_w=VScreen_x+VScreen_FatorZoom*2;
-if(VScreen_w>bufferx->w) { VScreen_w=bufferx->w; }
+if(VScreen_w>bg_test->w*2) { VScreen_w=bg_test->w*2; }
 VScreen_h=VScreen_y+(480*VScreen_FatorZoom/320);
 //VS_x2
 VScreen_x2=VScreen_w-VScreen_x;
-if(VScreen_x2>bufferx->w) { VScreen_x2=bufferx->w; }
+if(VScreen_x2>bg_test->w*2) { VScreen_x2=bg_test->w*2; }
 //VS_y2
 VScreen_y2=VScreen_h-VScreen_y;
-if(VScreen_y2>bufferx->h) { VScreen_y2=bufferx->h; }
+if(VScreen_y2>bg_test->h*2) { VScreen_y2=bg_test->h*2; }
 }
 
 //desliga o efeito de zoom
@@ -4349,7 +4540,7 @@ if(op_Zoom==0) { if(ZoomMaximoAtingido==0){Zoom_eixo=(VScreen_w-VScreen_x)/2;} Z
 if(ZoomMaximoAtingido==1){
 VScreen_x=MeioDaTela*2-Zoom_eixo;
 if(VScreen_x<0) { VScreen_x=0; }
-if((VScreen_x+Zoom_eixo*2)>bufferx->w) { VScreen_x=bufferx->w-Zoom_eixo*2; }
+if((VScreen_x+Zoom_eixo*2)>bg_test->w*2) { VScreen_x=bg_test->w*2-Zoom_eixo*2; }
 if(op_Zoom==1){
 //calcular a reentrada do zoom
 int ZVScreen_y;
@@ -4361,7 +4552,7 @@ if(ZVScreen_y<0) { ZVScreen_y=0; }
 //VS_h
 ZVScreen_h=ZVScreen_y+(480*VScreen_FatorZoom/320);
 //ativa o zoom in
-if( (ZVScreen_h-ZVScreen_y)/bufferx->h < 1 ) {
+if( (ZVScreen_h-ZVScreen_y)/(bg_test->h*2) < 1 ) {
 ZoomMaximoAtingido=0;
 VScreen_h=ZVScreen_h;
 VScreen_y=ZVScreen_y;
@@ -4370,6 +4561,10 @@ VScreen_y=ZVScreen_y;
 }
 //---fim de VScreen+Zoom---//
 
+//desenha o cenario (mundo em 2X), somente a janela visivel do VScreen
+Cam_Update(LayerHUDa);
+Cam_Draw_BG(LayerHUDa, bg_test);
+
 int ShakeTemp1=ShakeDist;
 int ShakeTemp2=ShakeDist;
 if (P2HitPause==0) { ShakeTemp1=0; }
@@ -4426,14 +4621,7 @@ for(int indx=1;indx<=2;indx++){
 //[ind][0] State
 //[ind][1] Anim
 //[ind][2] TotalDeImagensUtilizadas (numero desta imagem no total de imagens do char)
-carga=0;
-for(int ind=0;ind<=500;ind++){
-if( P[indx].State==P[indx].TableAtlas[ind][0]
-and P[indx].IndexAnim==P[indx].TableAtlas[ind][1]){
-carga=P[indx].TableAtlas[ind][2];
-}
-if(carga!=0) break;
-}
+carga=LinhaDoAtlas(indx, P[indx].State, P[indx].IndexAnim);
 //depois, pega a imagem SprAtlas correspondente ao indexador, e a coloca em P[n].Spr
 blit(P[indx].SprAtlas[carga], P[indx].Spr, 0, 0, 0, 0, P[indx].SprAtlas[carga]->w, P[indx].SprAtlas[carga]->h);
 P[indx].Spr->w  = P[indx].SprAtlas[carga]->w;
@@ -4484,45 +4672,45 @@ if(P[1].Lado== 1){ draw_sprite_h_flip(P2_Sombra_Aux, P2_Sombra, 0, 0); }
 }
 
 drawing_mode(DRAW_MODE_TRANS,NULL,0,0); set_trans_blender(0,0,0,100);
-/* sombra <P2> no bufferx */
+/* sombra <P2> */
 if(P[2].Visible==1){
-if(P[2].Lado== 1){ draw_trans_sprite(bufferx, P2_Sombra_Aux, (P[2].x*2+ShakeTemp2*2)-P[2].XAlign*2, AlturaPiso*2-P2_Sombra_Aux->h+P[2].ConstanteY/3 ); }
-if(P[2].Lado==-1){ draw_trans_sprite(bufferx, P2_Sombra_Aux, ((P[2].x*2+ShakeTemp2*2)-P[2].Spr->w)+P[2].XAlign*2, AlturaPiso*2-P2_Sombra_Aux->h+P[2].ConstanteY/3 ); }
+if(P[2].Lado== 1){ Cam_Draw_Trans_Sprite(LayerHUDa, P2_Sombra_Aux, (P[2].x*2+ShakeTemp2*2)-P[2].XAlign*2, AlturaPiso*2-P2_Sombra_Aux->h+P[2].ConstanteY/3, 100); }
+if(P[2].Lado==-1){ Cam_Draw_Trans_Sprite(LayerHUDa, P2_Sombra_Aux, ((P[2].x*2+ShakeTemp2*2)-P[2].Spr->w)+P[2].XAlign*2, AlturaPiso*2-P2_Sombra_Aux->h+P[2].ConstanteY/3, 100); }
 }
-/* sombra <P1> no bufferx */
+/* sombra <P1> */
 if(P[1].Visible==1){
-if(P[1].Lado== 1){ draw_trans_sprite(bufferx, P1_Sombra_Aux, (P[1].x*2+ShakeTemp1*2)-P[1].XAlign*2, AlturaPiso*2-P1_Sombra_Aux->h+P[1].ConstanteY/3 ); }
-if(P[1].Lado==-1){ draw_trans_sprite(bufferx, P1_Sombra_Aux, ((P[1].x*2+ShakeTemp1*2)-P[1].Spr->w)+P[1].XAlign*2, AlturaPiso*2-P1_Sombra_Aux->h+P[1].ConstanteY/3 ); }
+if(P[1].Lado== 1){ Cam_Draw_Trans_Sprite(LayerHUDa, P1_Sombra_Aux, (P[1].x*2+ShakeTemp1*2)-P[1].XAlign*2, AlturaPiso*2-P1_Sombra_Aux->h+P[1].ConstanteY/3, 100); }
+if(P[1].Lado==-1){ Cam_Draw_Trans_Sprite(LayerHUDa, P1_Sombra_Aux, ((P[1].x*2+ShakeTemp1*2)-P[1].Spr->w)+P[1].XAlign*2, AlturaPiso*2-P1_Sombra_Aux->h+P[1].ConstanteY/3, 100); }
 }
 solid_mode();
 }
 
 for(int indp=0;indp<=1;indp++){
 
-/* <P2> desenhado no bufferx */
+/* <P2> desenhado pela camera */
 if(P[2].Visible==1){
 if(P[2].Prioridade==indp){
 if (P[2].State!=607 && P[2].State!=608) {
-if (P[2].Lado== 1) { draw_sprite(bufferx, P[2].Spr, (P[2].x*2+ShakeTemp2*2)-P[2].XAlign*2, P[2].y*2-P[2].YAlign*2); }
-if (P[2].Lado==-1) { draw_sprite_h_flip(bufferx, P[2].Spr, ((P[2].x*2+ShakeTemp2*2)-P[2].Spr->w)+P[2].XAlign*2, P[2].y*2-P[2].YAlign*2); }
+if (P[2].Lado== 1) { Cam_Draw_Sprite(LayerHUDa, P[2].Spr, (P[2].x*2+ShakeTemp2*2)-P[2].XAlign*2, P[2].y*2-P[2].YAlign*2, 1, 0); }
+if (P[2].Lado==-1) { Cam_Draw_Sprite(LayerHUDa, P[2].Spr, ((P[2].x*2+ShakeTemp2*2)-P[2].Spr->w)+P[2].XAlign*2, P[2].y*2-P[2].YAlign*2, 1, 1); }
 }
 else {
-if (P[2].Lado==-1) { draw_sprite(bufferx, P[2].Spr, (P[2].x*2+ShakeTemp2*2)-P[2].XAlign*2, P[2].y*2-P[2].YAlign*2); }
-if (P[2].Lado== 1) { draw_sprite_h_flip(bufferx, P[2].Spr, ((P[2].x*2+ShakeTemp2*2)-P[2].Spr->w)+P[2].XAlign*2, P[2].y*2-P[2].YAlign*2); }
+if (P[2].Lado==-1) { Cam_Draw_Sprite(LayerHUDa, P[2].Spr, (P[2].x*2+ShakeTemp2*2)-P[2].XAlign*2, P[2].y*2-P[2].YAlign*2, 1, 0); }
+if (P[2].Lado== 1) { Cam_Draw_Sprite(LayerHUDa, P[2].Spr, ((P[2].x*2+ShakeTemp2*2)-P[2].Spr->w)+P[2].XAlign*2, P[2].y*2-P[2].YAlign*2, 1, 1); }
 }
 }
 }
 
-/* <P1> desenhado no bufferx */
+/* <P1> desenhado pela camera */
 if(P[1].Visible==1){
 if(P[1].Prioridade==indp){
 if (P[1].State!=607 && P[1].State!=608) {
-if (P[1].Lado== 1) { draw_sprite(bufferx, P[1].Spr, (P[1].x*2+ShakeTemp1*2)-P[1].XAlign*2, P[1].y*2-P[1].YAlign*2); }
-if (P[1].Lado==-1) { draw_sprite_h_flip(bufferx, P[1].Spr, ((P[1].x*2+ShakeTemp1*2)-P[1].Spr->w)+P[1].XAlign*2, P[1].y*2-P[1].YAlign*2); }
+if (P[1].Lado== 1) { Cam_Draw_Sprite(LayerHUDa, P[1].Spr, (P[1].x*2+ShakeTemp1*2)-P[1].XAlign*2, P[1].y*2-P[1].YAlign*2, 1, 0); }
+if (P[1].Lado==-1) { Cam_Draw_Sprite(LayerHUDa, P[1].Spr, ((P[1].x*2+ShakeTemp1*2)-P[1].Spr->w)+P[1].XAlign*2, P[1].y*2-P[1].YAlign*2, 1, 1); }
 }
 else {
-if (P[1].Lado==-1) { draw_sprite(bufferx, P[1].Spr, (P[1].x*2+ShakeTemp1*2)-P[1].XAlign*2, P[1].y*2-P[1].YAlign*2); }
-if (P[1].Lado== 1) { draw_sprite_h_flip(bufferx, P[1].Spr, ((P[1].x*2+ShakeTemp1*2)-P[1].Spr->w)+P[1].XAlign*2, P[1].y*2-P[1].YAlign*2); }
+if (P[1].Lado==-1) { Cam_Draw_Sprite(LayerHUDa, P[1].Spr, (P[1].x*2+ShakeTemp1*2)-P[1].XAlign*2, P[1].y*2-P[1].YAlign*2, 1, 0); }
+if (P[1].Lado== 1) { Cam_Draw_Sprite(LayerHUDa, P[1].Spr, ((P[1].x*2+ShakeTemp1*2)-P[1].Spr->w)+P[1].XAlign*2, P[1].y*2-P[1].YAlign*2, 1, 1); }
 }
 }
 }
@@ -4534,14 +4722,7 @@ for(int ind=1; ind<=2; ind++){
 
 if(P[ind].QtdeMagias>0){
 //primeiro, encontra na TableAtlas o indexador correspondente a imagem que vai ser carregada
-carga=0;
-for(int indx=0;indx<=500;indx++){
-if( Fireball[ind].State==P[ind].TableAtlas[indx][0]
-&& Fireball[ind].IndexAnim==P[ind].TableAtlas[indx][1]){
-carga=P[ind].TableAtlas[indx][2];
-}
-if(carga!=0) break;
-}
+carga=LinhaDoAtlas(ind, Fireball[ind].State, Fireball[ind].IndexAnim);
 //depois, pega a imagem SprAtlas correspondente ao indexador, e a coloca em Fireball[n].Spr
 //precisa otimizar, pois nao é reamente necessario fazer  blit toda hora, apenas na hora de mudar o frame de animacao
 blit(P[ind].SprAtlas[carga], Fireball[ind].Spr, 0, 0, 0, 0, P[ind].SprAtlas[carga]->w, P[ind].SprAtlas[carga]->h);
@@ -4623,21 +4804,23 @@ if (ForcaDoGolpeP1==2) {play_sample(hitlvl2, 255, 128, 1000, 0);}
 if (ForcaDoGolpeP1==3) {play_sample(hitlvl3, 255, 128, 1000, 0);}
 }
 
-//desenha a Fireball na tela (bufferx)
+//desenha a Fireball na tela (camera)
 if (Fireball[ind].Direcao== 1) {
-draw_sprite(
-bufferx,
+Cam_Draw_Sprite(
+LayerHUDa,
 Fireball[ind].Spr,
 (Fireball[ind].x*2)-Fireball[ind].XAlign*2,
-Fireball[ind].y*2-Fireball[ind].YAlign*2
+Fireball[ind].y*2-Fireball[ind].YAlign*2,
+1, 0
 );
 }
 if (Fireball[ind].Direcao==-1) {
-draw_sprite_h_flip(
-bufferx,
+Cam_Draw_Sprite(
+LayerHUDa,
 Fireball[ind].Spr,
 (Fireball[ind].x*2)-Fireball[ind].XAlign*2,
-Fireball[ind].y*2-Fireball[ind].YAlign*2
+Fireball[ind].y*2-Fireball[ind].YAlign*2,
+1, 1
 );
 }
 //destruir a fireball caso ela passe os limites da tela
@@ -4661,38 +4844,38 @@ P[ind].QtdeMagias=0;
 if(Fireball[ind].Ativa==2){
 //animacao da fireball /no momento limitada a 10frames! Preciso otimizar o codigo.
 if (Fireball[ind].IndexAnim== 0) {
-if (timer>Fireball[ind].StartFrame+P1_Fireball_FrameTime_00) {
-Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_01; Fireball[ind].StartFrame=timer; }}
+if (LogicTick>Fireball[ind].StartFrame+P1_Fireball_FrameTime_00) {
+Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_01; Fireball[ind].StartFrame=LogicTick; }}
 if (Fireball[ind].IndexAnim== 1) {
-if (timer>Fireball[ind].StartFrame+P1_Fireball_FrameTime_01) {
-Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_02; Fireball[ind].StartFrame=timer; }}
+if (LogicTick>Fireball[ind].StartFrame+P1_Fireball_FrameTime_01) {
+Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_02; Fireball[ind].StartFrame=LogicTick; }}
 if (Fireball[ind].IndexAnim== 2) {
-if (timer>Fireball[ind].StartFrame+P1_Fireball_FrameTime_02) {
-Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_03; Fireball[ind].StartFrame=timer; }}
+if (LogicTick>Fireball[ind].StartFrame+P1_Fireball_FrameTime_02) {
+Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_03; Fireball[ind].StartFrame=LogicTick; }}
 if (Fireball[ind].IndexAnim== 3) {
-if (timer>Fireball[ind].StartFrame+P1_Fireball_FrameTime_03) {
-Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_04; Fireball[ind].StartFrame=timer; }}
+if (LogicTick>Fireball[ind].StartFrame+P1_Fireball_FrameTime_03) {
+Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_04; Fireball[ind].StartFrame=LogicTick; }}
 if (Fireball[ind].IndexAnim== 4) {
-if (timer>Fireball[ind].StartFrame+P1_Fireball_FrameTime_04) {
-Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_05; Fireball[ind].StartFrame=timer; }}
+if (LogicTick>Fireball[ind].StartFrame+P1_Fireball_FrameTime_04) {
+Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_05; Fireball[ind].StartFrame=LogicTick; }}
 if (Fireball[ind].IndexAnim== 5) {
-if (timer>Fireball[ind].StartFrame+P1_Fireball_FrameTime_05) {
-Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_05; Fireball[ind].StartFrame=timer; }}
+if (LogicTick>Fireball[ind].StartFrame+P1_Fireball_FrameTime_05) {
+Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_05; Fireball[ind].StartFrame=LogicTick; }}
 if (Fireball[ind].IndexAnim== 6) {
-if (timer>Fireball[ind].StartFrame+P1_Fireball_FrameTime_06) {
-Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_06; Fireball[ind].StartFrame=timer; }}
+if (LogicTick>Fireball[ind].StartFrame+P1_Fireball_FrameTime_06) {
+Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_06; Fireball[ind].StartFrame=LogicTick; }}
 if (Fireball[ind].IndexAnim== 7) {
-if (timer>Fireball[ind].StartFrame+P1_Fireball_FrameTime_07) {
-Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_07; Fireball[ind].StartFrame=timer; }}
+if (LogicTick>Fireball[ind].StartFrame+P1_Fireball_FrameTime_07) {
+Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_07; Fireball[ind].StartFrame=LogicTick; }}
 if (Fireball[ind].IndexAnim== 8) {
-if (timer>Fireball[ind].StartFrame+P1_Fireball_FrameTime_08) {
-Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_08; Fireball[ind].StartFrame=timer; }}
+if (LogicTick>Fireball[ind].StartFrame+P1_Fireball_FrameTime_08) {
+Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_08; Fireball[ind].StartFrame=LogicTick; }}
 if (Fireball[ind].IndexAnim== 9) {
-if (timer>Fireball[ind].StartFrame+P1_Fireball_FrameTime_09) {
-Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_10; Fireball[ind].StartFrame=timer; }}
+if (LogicTick>Fireball[ind].StartFrame+P1_Fireball_FrameTime_09) {
+Fireball[ind].IndexAnim++; P1_Fireball_FrameTime=P1_Fireball_FrameTime_10; Fireball[ind].StartFrame=LogicTick; }}
 //loop
 if(Fireball[ind].IndexAnim>Fireball[ind].TotalFrames){
-if(Fireball[ind].State==701){ Fireball[ind].IndexAnim=0; P1_Fireball_FrameTime=P1_FrameTime_00; Fireball[ind].StartFrame=timer; }
+if(Fireball[ind].State==701){ Fireball[ind].IndexAnim=0; P1_Fireball_FrameTime=P1_FrameTime_00; Fireball[ind].StartFrame=LogicTick; }
 if(Fireball[ind].State==702){ Fireball[ind].Ativa=0; }
 }
 }
@@ -4700,96 +4883,56 @@ if(Fireball[ind].State==702){ Fireball[ind].Ativa=0; }
 }
 
 //desenha / anima hitboxes
-
-if (Qtde_HitBox>0){
-for(int ind=1; ind<=Qtde_HitBox; ind++){
-if (HitSpark[ind].IndexAnim==0) {
-if (timer > HitSpark[ind].StartFrame + HitSpark[ind].FrameTime) { HitSpark[ind].IndexAnim++; HitSpark[ind].StartFrame=timer; }}
-if (HitSpark[ind].IndexAnim==1) {
-if (timer > HitSpark[ind].StartFrame + HitSpark[ind].FrameTime) { HitSpark[ind].IndexAnim++; HitSpark[ind].StartFrame=timer; }}
-if (HitSpark[ind].IndexAnim==2) {
-if (timer > HitSpark[ind].StartFrame + HitSpark[ind].FrameTime) { HitSpark[ind].IndexAnim++; HitSpark[ind].StartFrame=timer; }}
-if (HitSpark[ind].IndexAnim==3) {
-if (timer > HitSpark[ind].StartFrame + HitSpark[ind].FrameTime) { HitSpark[ind].IndexAnim++; HitSpark[ind].StartFrame=timer; }}
-if (HitSpark[ind].IndexAnim==4) {
-if (timer > HitSpark[ind].StartFrame + HitSpark[ind].FrameTime) { HitSpark[ind].IndexAnim++; HitSpark[ind].StartFrame=timer; }}
-if (HitSpark[ind].IndexAnim==5) {
-if (timer > HitSpark[ind].StartFrame + HitSpark[ind].FrameTime) { HitSpark[ind].IndexAnim++; HitSpark[ind].StartFrame=timer; }}
-if (HitSpark[ind].IndexAnim==6) {
-Qtde_HitBox--;
-}
-
-clear_to_color(HitSparkspr, makecol(255, 0, 255));
-//clear_to_color(HitSpark_Aux, makecol(255, 0, 255));
-if (HitSpark[ind].Type==991 && HitSpark[ind].IndexAnim==0) { HitSpark_Aux=spr991_00; }
-if (HitSpark[ind].Type==991 && HitSpark[ind].IndexAnim==1) { HitSpark_Aux=spr991_01; }
-if (HitSpark[ind].Type==991 && HitSpark[ind].IndexAnim==2) { HitSpark_Aux=spr991_02; }
-if (HitSpark[ind].Type==991 && HitSpark[ind].IndexAnim==3) { HitSpark_Aux=spr991_03; }
-if (HitSpark[ind].Type==991 && HitSpark[ind].IndexAnim==4) { HitSpark_Aux=spr991_04; }
-if (HitSpark[ind].Type==991 && HitSpark[ind].IndexAnim==5) { HitSpark_Aux=spr991_05; }
-if (HitSpark[ind].Type==992 && HitSpark[ind].IndexAnim==0) { HitSpark_Aux=spr992_00; }
-if (HitSpark[ind].Type==992 && HitSpark[ind].IndexAnim==1) { HitSpark_Aux=spr992_01; }
-if (HitSpark[ind].Type==992 && HitSpark[ind].IndexAnim==2) { HitSpark_Aux=spr992_02; }
-if (HitSpark[ind].Type==992 && HitSpark[ind].IndexAnim==3) { HitSpark_Aux=spr992_03; }
-if (HitSpark[ind].Type==992 && HitSpark[ind].IndexAnim==4) { HitSpark_Aux=spr992_04; }
-if (HitSpark[ind].Type==992 && HitSpark[ind].IndexAnim==5) { HitSpark_Aux=spr992_05; }
-if (HitSpark[ind].Type==993 && HitSpark[ind].IndexAnim==0) { HitSpark_Aux=spr993_00; }
-if (HitSpark[ind].Type==993 && HitSpark[ind].IndexAnim==1) { HitSpark_Aux=spr993_01; }
-if (HitSpark[ind].Type==993 && HitSpark[ind].IndexAnim==2) { HitSpark_Aux=spr993_02; }
-if (HitSpark[ind].Type==993 && HitSpark[ind].IndexAnim==3) { HitSpark_Aux=spr993_03; }
-if (HitSpark[ind].Type==993 && HitSpark[ind].IndexAnim==4) { HitSpark_Aux=spr993_04; }
-if (HitSpark[ind].Type==993 && HitSpark[ind].IndexAnim==5) { HitSpark_Aux=spr993_05; }
-if (HitSpark[ind].Type==994 && HitSpark[ind].IndexAnim==0) { HitSpark_Aux=spr994_00; }
-if (HitSpark[ind].Type==994 && HitSpark[ind].IndexAnim==1) { HitSpark_Aux=spr994_01; }
-if (HitSpark[ind].Type==994 && HitSpark[ind].IndexAnim==2) { HitSpark_Aux=spr994_02; }
-if (HitSpark[ind].Type==994 && HitSpark[ind].IndexAnim==3) { HitSpark_Aux=spr994_03; }
-if (HitSpark[ind].Type==994 && HitSpark[ind].IndexAnim==4) { HitSpark_Aux=spr994_04; }
-if (HitSpark[ind].Type==994 && HitSpark[ind].IndexAnim==5) { HitSpark_Aux=spr994_05; }
-
-stretch_blit(HitSpark_Aux , HitSparkspr, 0, 0, HitSpark_Aux->w, HitSpark_Aux->h, 0, 0, HitSpark_Aux->w*2, HitSpark_Aux->h*2);
-draw_sprite(bufferx, HitSparkspr, HitSpark[ind].x+HitSpark[ind].XAlign*2, HitSpark[ind].y+HitSpark[ind].YAlign*2);
-}
+hamoopi_pool_animate(&HitSparks, LogicTick);
+for(int ind=0; ind<HitSparks.count; ind++){
+int Tipo=HitSparks.type[ind]-991;
+if (Tipo<0 || Tipo>3) continue;
+Cam_Draw_Sprite(LayerHUDa, HitSparkSpr[Tipo][HitSparks.frame[ind]],
+(float)(HitSparks.x[ind]+HitSparks.param[ind]*2), (float)(HitSparks.y[ind]+HitSparks.param[ind]*2), 2, 0);
 }
 
+//fim da camada da camera: desenha a lista gravada antes das caixas e do HUD
+Cam_Executa();
+
 if (Draw_Box==1) {
 //Desenha Caixas
-if (P1_HurtBox01x1!=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HurtBox01x1)*2, ((P[1].y*2)+P1_HurtBox01y1*2), (P[1].x*2)+(P[1].Lado*P1_HurtBox01x2)*2, ((P[1].y*2)+P1_HurtBox01y2*2), makecol(000,000,255)); }
-if (P1_HurtBox02x1!=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HurtBox02x1)*2, ((P[1].y*2)+P1_HurtBox02y1*2), (P[1].x*2)+(P[1].Lado*P1_HurtBox02x2)*2, ((P[1].y*2)+P1_HurtBox02y2*2), makecol(000,000,255)); }
-if (P1_HurtBox03x1!=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HurtBox03x1)*2, ((P[1].y*2)+P1_HurtBox03y1*2), (P[1].x*2)+(P[1].Lado*P1_HurtBox03x2)*2, ((P[1].y*2)+P1_HurtBox03y2*2), makecol(000,000,255)); }
-if (P1_HurtBox04x1!=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HurtBox04x1)*2, ((P[1].y*2)+P1_HurtBox04y1*2), (P[1].x*2)+(P[1].Lado*P1_HurtBox04x2)*2, ((P[1].y*2)+P1_HurtBox04y2*2), makecol(000,000,255)); }
-if (P1_HurtBox05x1!=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HurtBox05x1)*2, ((P[1].y*2)+P1_HurtBox05y1*2), (P[1].x*2)+(P[1].Lado*P1_HurtBox05x2)*2, ((P[1].y*2)+P1_HurtBox05y2*2), makecol(000,000,255)); }
-if (P1_HurtBox06x1!=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HurtBox06x1)*2, ((P[1].y*2)+P1_HurtBox06y1*2), (P[1].x*2)+(P[1].Lado*P1_HurtBox06x2)*2, ((P[1].y*2)+P1_HurtBox06y2*2), makecol(000,000,255)); }
-if (P1_HurtBox07x1!=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HurtBox07x1)*2, ((P[1].y*2)+P1_HurtBox07y1*2), (P[1].x*2)+(P[1].Lado*P1_HurtBox07x2)*2, ((P[1].y*2)+P1_HurtBox07y2*2), makecol(000,000,255)); }
-if (P1_HurtBox08x1!=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HurtBox08x1)*2, ((P[1].y*2)+P1_HurtBox08y1*2), (P[1].x*2)+(P[1].Lado*P1_HurtBox08x2)*2, ((P[1].y*2)+P1_HurtBox08y2*2), makecol(000,000,255)); }
-if (P1_HurtBox09x1!=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HurtBox09x1)*2, ((P[1].y*2)+P1_HurtBox09y1*2), (P[1].x*2)+(P[1].Lado*P1_HurtBox09x2)*2, ((P[1].y*2)+P1_HurtBox09y2*2), makecol(000,000,255)); }
-if (P1_HitBox01x1 !=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HitBox01x1)*2 , ((P[1].y*2)+P1_HitBox01y1*2) , (P[1].x*2)+(P[1].Lado*P1_HitBox01x2)*2 , ((P[1].y*2)+P1_HitBox01y2*2) , makecol(255,000,000)); }
-if (P1_HitBox02x1 !=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HitBox02x1)*2 , ((P[1].y*2)+P1_HitBox02y1*2) , (P[1].x*2)+(P[1].Lado*P1_HitBox02x2)*2 , ((P[1].y*2)+P1_HitBox02y2*2) , makecol(255,000,000)); }
-if (P1_HitBox03x1 !=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HitBox03x1)*2 , ((P[1].y*2)+P1_HitBox03y1*2) , (P[1].x*2)+(P[1].Lado*P1_HitBox03x2)*2 , ((P[1].y*2)+P1_HitBox03y2*2) , makecol(255,000,000)); }
-if (P1_HitBox04x1 !=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HitBox04x1)*2 , ((P[1].y*2)+P1_HitBox04y1*2) , (P[1].x*2)+(P[1].Lado*P1_HitBox04x2)*2 , ((P[1].y*2)+P1_HitBox04y2*2) , makecol(255,000,000)); }
-if (P1_HitBox05x1 !=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HitBox05x1)*2 , ((P[1].y*2)+P1_HitBox05y1*2) , (P[1].x*2)+(P[1].Lado*P1_HitBox05x2)*2 , ((P[1].y*2)+P1_HitBox05y2*2) , makecol(255,000,000)); }
-if (P1_HitBox06x1 !=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HitBox06x1)*2 , ((P[1].y*2)+P1_HitBox06y1*2) , (P[1].x*2)+(P[1].Lado*P1_HitBox06x2)*2 , ((P[1].y*2)+P1_HitBox06y2*2) , makecol(255,000,000)); }
-if (P1_HitBox07x1 !=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HitBox07x1)*2 , ((P[1].y*2)+P1_HitBox07y1*2) , (P[1].x*2)+(P[1].Lado*P1_HitBox07x2)*2 , ((P[1].y*2)+P1_HitBox07y2*2) , makecol(255,000,000)); }
-if (P1_HitBox08x1 !=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HitBox08x1)*2 , ((P[1].y*2)+P1_HitBox08y1*2) , (P[1].x*2)+(P[1].Lado*P1_HitBox08x2)*2 , ((P[1].y*2)+P1_HitBox08y2*2) , makecol(255,000,000)); }
-if (P1_HitBox09x1 !=-5555) { rect(bufferx, (P[1].x*2)+(P[1].Lado*P1_HitBox09x1)*2 , ((P[1].y*2)+P1_HitBox09y1*2) , (P[1].x*2)+(P[1].Lado*P1_HitBox09x2)*2 , ((P[1].y*2)+P1_HitBox09y2*2) , makecol(255,000,000)); }
-
-if (P2_HurtBox01x1!=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HurtBox01x1)*2, ((P[2].y*2)+P2_HurtBox01y1*2), (P[2].x*2)+(P[2].Lado*P2_HurtBox01x2)*2, ((P[2].y*2)+P2_HurtBox01y2*2), makecol(000,000,255)); }
-if (P2_HurtBox02x1!=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HurtBox02x1)*2, ((P[2].y*2)+P2_HurtBox02y1*2), (P[2].x*2)+(P[2].Lado*P2_HurtBox02x2)*2, ((P[2].y*2)+P2_HurtBox02y2*2), makecol(000,000,255)); }
-if (P2_HurtBox03x1!=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HurtBox03x1)*2, ((P[2].y*2)+P2_HurtBox03y1*2), (P[2].x*2)+(P[2].Lado*P2_HurtBox03x2)*2, ((P[2].y*2)+P2_HurtBox03y2*2), makecol(000,000,255)); }
-if (P2_HurtBox04x1!=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HurtBox04x1)*2, ((P[2].y*2)+P2_HurtBox04y1*2), (P[2].x*2)+(P[2].Lado*P2_HurtBox04x2)*2, ((P[2].y*2)+P2_HurtBox04y2*2), makecol(000,000,255)); }
-if (P2_HurtBox05x1!=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HurtBox05x1)*2, ((P[2].y*2)+P2_HurtBox05y1*2), (P[2].x*2)+(P[2].Lado*P2_HurtBox05x2)*2, ((P[2].y*2)+P2_HurtBox05y2*2), makecol(000,000,255)); }
-if (P2_HurtBox06x1!=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HurtBox06x1)*2, ((P[2].y*2)+P2_HurtBox06y1*2), (P[2].x*2)+(P[2].Lado*P2_HurtBox06x2)*2, ((P[2].y*2)+P2_HurtBox06y2*2), makecol(000,000,255)); }
-if (P2_HurtBox07x1!=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HurtBox07x1)*2, ((P[2].y*2)+P2_HurtBox07y1*2), (P[2].x*2)+(P[2].Lado*P2_HurtBox07x2)*2, ((P[2].y*2)+P2_HurtBox07y2*2), makecol(000,000,255)); }
-if (P2_HurtBox08x1!=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HurtBox08x1)*2, ((P[2].y*2)+P2_HurtBox08y1*2), (P[2].x*2)+(P[2].Lado*P2_HurtBox08x2)*2, ((P[2].y*2)+P2_HurtBox08y2*2), makecol(000,000,255)); }
-if (P2_HurtBox09x1!=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HurtBox09x1)*2, ((P[2].y*2)+P2_HurtBox09y1*2), (P[2].x*2)+(P[2].Lado*P2_HurtBox09x2)*2, ((P[2].y*2)+P2_HurtBox09y2*2), makecol(000,000,255)); }
-if (P2_HitBox01x1 !=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HitBox01x1)*2 , ((P[2].y*2)+P2_HitBox01y1*2) , (P[2].x*2)+(P[2].Lado*P2_HitBox01x2)*2 , ((P[2].y*2)+P2_HitBox01y2*2) , makecol(255,000,000)); }
-if (P2_HitBox02x1 !=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HitBox02x1)*2 , ((P[2].y*2)+P2_HitBox02y1*2) , (P[2].x*2)+(P[2].Lado*P2_HitBox02x2)*2 , ((P[2].y*2)+P2_HitBox02y2*2) , makecol(255,000,000)); }
-if (P2_HitBox03x1 !=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HitBox03x1)*2 , ((P[2].y*2)+P2_HitBox03y1*2) , (P[2].x*2)+(P[2].Lado*P2_HitBox03x2)*2 , ((P[2].y*2)+P2_HitBox03y2*2) , makecol(255,000,000)); }
-if (P2_HitBox04x1 !=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HitBox04x1)*2 , ((P[2].y*2)+P2_HitBox04y1*2) , (P[2].x*2)+(P[2].Lado*P2_HitBox04x2)*2 , ((P[2].y*2)+P2_HitBox04y2*2) , makecol(255,000,000)); }
-if (P2_HitBox05x1 !=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HitBox05x1)*2 , ((P[2].y*2)+P2_HitBox05y1*2) , (P[2].x*2)+(P[2].Lado*P2_HitBox05x2)*2 , ((P[2].y*2)+P2_HitBox05y2*2) , makecol(255,000,000)); }
-if (P2_HitBox06x1 !=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HitBox06x1)*2 , ((P[2].y*2)+P2_HitBox06y1*2) , (P[2].x*2)+(P[2].Lado*P2_HitBox06x2)*2 , ((P[2].y*2)+P2_HitBox06y2*2) , makecol(255,000,000)); }
-if (P2_HitBox07x1 !=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HitBox07x1)*2 , ((P[2].y*2)+P2_HitBox07y1*2) , (P[2].x*2)+(P[2].Lado*P2_HitBox07x2)*2 , ((P[2].y*2)+P2_HitBox07y2*2) , makecol(255,000,000)); }
-if (P2_HitBox08x1 !=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HitBox08x1)*2 , ((P[2].y*2)+P2_HitBox08y1*2) , (P[2].x*2)+(P[2].Lado*P2_HitBox08x2)*2 , ((P[2].y*2)+P2_HitBox08y2*2) , makecol(255,000,000)); }
-if (P2_HitBox09x1 !=+5555) { rect(bufferx, (P[2].x*2)+(P[2].Lado*P2_HitBox09x1)*2 , ((P[2].y*2)+P2_HitBox09y1*2) , (P[2].x*2)+(P[2].Lado*P2_HitBox09x2)*2 , ((P[2].y*2)+P2_HitBox09y2*2) , makecol(255,000,000)); }
+if (P1_HurtBox01x1!=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox01x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox01y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox01x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox01y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox02x1!=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox02x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox02y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox02x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox02y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox03x1!=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox03x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox03y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox03x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox03y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox04x1!=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox04x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox04y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox04x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox04y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox05x1!=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox05x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox05y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox05x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox05y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox06x1!=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox06x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox06y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox06x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox06y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox07x1!=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox07x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox07y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox07x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox07y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox08x1!=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox08x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox08y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox08x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox08y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox09x1!=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox09x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox09y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HurtBox09x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox09y2*2)), makecol(000,000,255)); }
+if (P1_HitBox01x1 !=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox01x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox01y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox01x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox01y2*2)), makecol(255,000,000)); }
+if (P1_HitBox02x1 !=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox02x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox02y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox02x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox02y2*2)), makecol(255,000,000)); }
+if (P1_HitBox03x1 !=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox03x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox03y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox03x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox03y2*2)), makecol(255,000,000)); }
+if (P1_HitBox04x1 !=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox04x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox04y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox04x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox04y2*2)), makecol(255,000,000)); }
+if (P1_HitBox05x1 !=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox05x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox05y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox05x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox05y2*2)), makecol(255,000,000)); }
+if (P1_HitBox06x1 !=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox06x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox06y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox06x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox06y2*2)), makecol(255,000,000)); }
+if (P1_HitBox07x1 !=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox07x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox07y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox07x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox07y2*2)), makecol(255,000,000)); }
+if (P1_HitBox08x1 !=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox08x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox08y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox08x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox08y2*2)), makecol(255,000,000)); }
+if (P1_HitBox09x1 !=-5555) { rect(LayerHUDa, Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox09x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox09y1*2)), Cam_X((P[1].x*2)+(P[1].Lado*P1_HitBox09x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox09y2*2)), makecol(255,000,000)); }
+
+if (P2_HurtBox01x1!=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox01x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox01y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox01x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox01y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox02x1!=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox02x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox02y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox02x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox02y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox03x1!=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox03x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox03y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox03x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox03y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox04x1!=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox04x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox04y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox04x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox04y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox05x1!=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox05x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox05y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox05x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox05y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox06x1!=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox06x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox06y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox06x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox06y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox07x1!=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox07x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox07y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox07x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox07y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox08x1!=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox08x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox08y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox08x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox08y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox09x1!=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox09x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox09y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HurtBox09x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox09y2*2)), makecol(000,000,255)); }
+if (P2_HitBox01x1 !=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox01x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox01y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox01x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox01y2*2)), makecol(255,000,000)); }
+if (P2_HitBox02x1 !=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox02x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox02y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox02x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox02y2*2)), makecol(255,000,000)); }
+if (P2_HitBox03x1 !=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox03x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox03y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox03x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox03y2*2)), makecol(255,000,000)); }
+if (P2_HitBox04x1 !=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox04x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox04y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox04x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox04y2*2)), makecol(255,000,000)); }
+if (P2_HitBox05x1 !=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox05x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox05y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox05x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox05y2*2)), makecol(255,000,000)); }
+if (P2_HitBox06x1 !=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox06x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox06y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox06x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox06y2*2)), makecol(255,000,000)); }
+if (P2_HitBox07x1 !=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox07x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox07y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox07x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox07y2*2)), makecol(255,000,000)); }
+if (P2_HitBox08x1 !=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox08x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox08y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox08x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox08y2*2)), makecol(255,000,000)); }
+if (P2_HitBox09x1 !=+5555) { rect(LayerHUDa, Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox09x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox09y1*2)), Cam_X((P[2].x*2)+(P[2].Lado*P2_HitBox09x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox09y2*2)), makecol(255,000,000)); }
 } //fim Draw_Box
 
 if (Draw_Box==1) {
@@ -4797,80 +4940,73 @@ if (Draw_Box==1) {
 drawing_mode(DRAW_MODE_TRANS, 0, 0, 0);
 set_trans_blender(0, 0, 0, 77);
 //Desenha Caixas
-if (P1_HurtBox01x1!=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HurtBox01x1)*2, ((P[1].y*2)+P1_HurtBox01y1*2), ((P[1].x)*2)+(P[1].Lado*P1_HurtBox01x2)*2, ((P[1].y*2)+P1_HurtBox01y2*2), makecol(000,000,255)); }
-if (P1_HurtBox02x1!=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HurtBox02x1)*2, ((P[1].y*2)+P1_HurtBox02y1*2), ((P[1].x)*2)+(P[1].Lado*P1_HurtBox02x2)*2, ((P[1].y*2)+P1_HurtBox02y2*2), makecol(000,000,255)); }
-if (P1_HurtBox03x1!=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HurtBox03x1)*2, ((P[1].y*2)+P1_HurtBox03y1*2), ((P[1].x)*2)+(P[1].Lado*P1_HurtBox03x2)*2, ((P[1].y*2)+P1_HurtBox03y2*2), makecol(000,000,255)); }
-if (P1_HurtBox04x1!=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HurtBox04x1)*2, ((P[1].y*2)+P1_HurtBox04y1*2), ((P[1].x)*2)+(P[1].Lado*P1_HurtBox04x2)*2, ((P[1].y*2)+P1_HurtBox04y2*2), makecol(000,000,255)); }
-if (P1_HurtBox05x1!=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HurtBox05x1)*2, ((P[1].y*2)+P1_HurtBox05y1*2), ((P[1].x)*2)+(P[1].Lado*P1_HurtBox05x2)*2, ((P[1].y*2)+P1_HurtBox05y2*2), makecol(000,000,255)); }
-if (P1_HurtBox06x1!=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HurtBox06x1)*2, ((P[1].y*2)+P1_HurtBox06y1*2), ((P[1].x)*2)+(P[1].Lado*P1_HurtBox06x2)*2, ((P[1].y*2)+P1_HurtBox06y2*2), makecol(000,000,255)); }
-if (P1_HurtBox07x1!=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HurtBox07x1)*2, ((P[1].y*2)+P1_HurtBox07y1*2), ((P[1].x)*2)+(P[1].Lado*P1_HurtBox07x2)*2, ((P[1].y*2)+P1_HurtBox07y2*2), makecol(000,000,255)); }
-if (P1_HurtBox08x1!=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HurtBox08x1)*2, ((P[1].y*2)+P1_HurtBox08y1*2), ((P[1].x)*2)+(P[1].Lado*P1_HurtBox08x2)*2, ((P[1].y*2)+P1_HurtBox08y2*2), makecol(000,000,255)); }
-if (P1_HurtBox09x1!=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HurtBox09x1)*2, ((P[1].y*2)+P1_HurtBox09y1*2), ((P[1].x)*2)+(P[1].Lado*P1_HurtBox09x2)*2, ((P[1].y*2)+P1_HurtBox09y2*2), makecol(000,000,255)); }
-if (P1_HitBox01x1 !=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HitBox01x1)*2 , ((P[1].y*2)+P1_HitBox01y1*2) , ((P[1].x)*2)+(P[1].Lado*P1_HitBox01x2)*2 , ((P[1].y*2)+P1_HitBox01y2*2) , makecol(255,000,000)); }
-if (P1_HitBox02x1 !=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HitBox02x1)*2 , ((P[1].y*2)+P1_HitBox02y1*2) , ((P[1].x)*2)+(P[1].Lado*P1_HitBox02x2)*2 , ((P[1].y*2)+P1_HitBox02y2*2) , makecol(255,000,000)); }
-if (P1_HitBox03x1 !=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HitBox03x1)*2 , ((P[1].y*2)+P1_HitBox03y1*2) , ((P[1].x)*2)+(P[1].Lado*P1_HitBox03x2)*2 , ((P[1].y*2)+P1_HitBox03y2*2) , makecol(255,000,000)); }
-if (P1_HitBox04x1 !=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HitBox04x1)*2 , ((P[1].y*2)+P1_HitBox04y1*2) , ((P[1].x)*2)+(P[1].Lado*P1_HitBox04x2)*2 , ((P[1].y*2)+P1_HitBox04y2*2) , makecol(255,000,000)); }
-if (P1_HitBox05x1 !=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HitBox05x1)*2 , ((P[1].y*2)+P1_HitBox05y1*2) , ((P[1].x)*2)+(P[1].Lado*P1_HitBox05x2)*2 , ((P[1].y*2)+P1_HitBox05y2*2) , makecol(255,000,000)); }
-if (P1_HitBox06x1 !=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HitBox06x1)*2 , ((P[1].y*2)+P1_HitBox06y1*2) , ((P[1].x)*2)+(P[1].Lado*P1_HitBox06x2)*2 , ((P[1].y*2)+P1_HitBox06y2*2) , makecol(255,000,000)); }
-if (P1_HitBox07x1 !=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HitBox07x1)*2 , ((P[1].y*2)+P1_HitBox07y1*2) , ((P[1].x)*2)+(P[1].Lado*P1_HitBox07x2)*2 , ((P[1].y*2)+P1_HitBox07y2*2) , makecol(255,000,000)); }
-if (P1_HitBox08x1 !=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HitBox08x1)*2 , ((P[1].y*2)+P1_HitBox08y1*2) , ((P[1].x)*2)+(P[1].Lado*P1_HitBox08x2)*2 , ((P[1].y*2)+P1_HitBox08y2*2) , makecol(255,000,000)); }
-if (P1_HitBox09x1 !=-5555) { rectfill(bufferx, ((P[1].x)*2)+(P[1].Lado*P1_HitBox09x1)*2 , ((P[1].y*2)+P1_HitBox09y1*2) , ((P[1].x)*2)+(P[1].Lado*P1_HitBox09x2)*2 , ((P[1].y*2)+P1_HitBox09y2*2) , makecol(255,000,000)); }
-
-if (P2_HurtBox01x1!=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HurtBox01x1)*2, ((P[2].y*2)+P2_HurtBox01y1*2), ((P[2].x)*2)+(P[2].Lado*P2_HurtBox01x2)*2, ((P[2].y*2)+P2_HurtBox01y2*2), makecol(000,000,255)); }
-if (P2_HurtBox02x1!=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HurtBox02x1)*2, ((P[2].y*2)+P2_HurtBox02y1*2), ((P[2].x)*2)+(P[2].Lado*P2_HurtBox02x2)*2, ((P[2].y*2)+P2_HurtBox02y2*2), makecol(000,000,255)); }
-if (P2_HurtBox03x1!=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HurtBox03x1)*2, ((P[2].y*2)+P2_HurtBox03y1*2), ((P[2].x)*2)+(P[2].Lado*P2_HurtBox03x2)*2, ((P[2].y*2)+P2_HurtBox03y2*2), makecol(000,000,255)); }
-if (P2_HurtBox04x1!=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HurtBox04x1)*2, ((P[2].y*2)+P2_HurtBox04y1*2), ((P[2].x)*2)+(P[2].Lado*P2_HurtBox04x2)*2, ((P[2].y*2)+P2_HurtBox04y2*2), makecol(000,000,255)); }
-if (P2_HurtBox05x1!=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HurtBox05x1)*2, ((P[2].y*2)+P2_HurtBox05y1*2), ((P[2].x)*2)+(P[2].Lado*P2_HurtBox05x2)*2, ((P[2].y*2)+P2_HurtBox05y2*2), makecol(000,000,255)); }
-if (P2_HurtBox06x1!=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HurtBox06x1)*2, ((P[2].y*2)+P2_HurtBox06y1*2), ((P[2].x)*2)+(P[2].Lado*P2_HurtBox06x2)*2, ((P[2].y*2)+P2_HurtBox06y2*2), makecol(000,000,255)); }
-if (P2_HurtBox07x1!=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HurtBox07x1)*2, ((P[2].y*2)+P2_HurtBox07y1*2), ((P[2].x)*2)+(P[2].Lado*P2_HurtBox07x2)*2, ((P[2].y*2)+P2_HurtBox07y2*2), makecol(000,000,255)); }
-if (P2_HurtBox08x1!=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HurtBox08x1)*2, ((P[2].y*2)+P2_HurtBox08y1*2), ((P[2].x)*2)+(P[2].Lado*P2_HurtBox08x2)*2, ((P[2].y*2)+P2_HurtBox08y2*2), makecol(000,000,255)); }
-if (P2_HurtBox09x1!=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HurtBox09x1)*2, ((P[2].y*2)+P2_HurtBox09y1*2), ((P[2].x)*2)+(P[2].Lado*P2_HurtBox09x2)*2, ((P[2].y*2)+P2_HurtBox09y2*2), makecol(000,000,255)); }
-if (P2_HitBox01x1 !=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HitBox01x1)*2 , ((P[2].y*2)+P2_HitBox01y1*2) , ((P[2].x)*2)+(P[2].Lado*P2_HitBox01x2)*2 , ((P[2].y*2)+P2_HitBox01y2*2) , makecol(255,000,000)); }
-if (P2_HitBox02x1 !=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HitBox02x1)*2 , ((P[2].y*2)+P2_HitBox02y1*2) , ((P[2].x)*2)+(P[2].Lado*P2_HitBox02x2)*2 , ((P[2].y*2)+P2_HitBox02y2*2) , makecol(255,000,000)); }
-if (P2_HitBox03x1 !=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HitBox03x1)*2 , ((P[2].y*2)+P2_HitBox03y1*2) , ((P[2].x)*2)+(P[2].Lado*P2_HitBox03x2)*2 , ((P[2].y*2)+P2_HitBox03y2*2) , makecol(255,000,000)); }
-if (P2_HitBox04x1 !=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HitBox04x1)*2 , ((P[2].y*2)+P2_HitBox04y1*2) , ((P[2].x)*2)+(P[2].Lado*P2_HitBox04x2)*2 , ((P[2].y*2)+P2_HitBox04y2*2) , makecol(255,000,000)); }
-if (P2_HitBox05x1 !=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HitBox05x1)*2 , ((P[2].y*2)+P2_HitBox05y1*2) , ((P[2].x)*2)+(P[2].Lado*P2_HitBox05x2)*2 , ((P[2].y*2)+P2_HitBox05y2*2) , makecol(255,000,000)); }
-if (P2_HitBox06x1 !=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HitBox06x1)*2 , ((P[2].y*2)+P2_HitBox06y1*2) , ((P[2].x)*2)+(P[2].Lado*P2_HitBox06x2)*2 , ((P[2].y*2)+P2_HitBox06y2*2) , makecol(255,000,000)); }
-if (P2_HitBox07x1 !=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HitBox07x1)*2 , ((P[2].y*2)+P2_HitBox07y1*2) , ((P[2].x)*2)+(P[2].Lado*P2_HitBox07x2)*2 , ((P[2].y*2)+P2_HitBox07y2*2) , makecol(255,000,000)); }
-if (P2_HitBox08x1 !=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HitBox08x1)*2 , ((P[2].y*2)+P2_HitBox08y1*2) , ((P[2].x)*2)+(P[2].Lado*P2_HitBox08x2)*2 , ((P[2].y*2)+P2_HitBox08y2*2) , makecol(255,000,000)); }
-if (P2_HitBox09x1 !=+5555) { rectfill(bufferx, ((P[2].x)*2)+(P[2].Lado*P2_HitBox09x1)*2 , ((P[2].y*2)+P2_HitBox09y1*2) , ((P[2].x)*2)+(P[2].Lado*P2_HitBox09x2)*2 , ((P[2].y*2)+P2_HitBox09y2*2) , makecol(255,000,000)); }
+if (P1_HurtBox01x1!=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox01x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox01y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox01x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox01y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox02x1!=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox02x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox02y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox02x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox02y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox03x1!=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox03x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox03y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox03x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox03y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox04x1!=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox04x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox04y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox04x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox04y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox05x1!=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox05x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox05y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox05x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox05y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox06x1!=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox06x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox06y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox06x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox06y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox07x1!=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox07x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox07y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox07x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox07y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox08x1!=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox08x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox08y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox08x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox08y2*2)), makecol(000,000,255)); }
+if (P1_HurtBox09x1!=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox09x1)*2), Cam_Y(((P[1].y*2)+P1_HurtBox09y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HurtBox09x2)*2), Cam_Y(((P[1].y*2)+P1_HurtBox09y2*2)), makecol(000,000,255)); }
+if (P1_HitBox01x1 !=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox01x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox01y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox01x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox01y2*2)), makecol(255,000,000)); }
+if (P1_HitBox02x1 !=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox02x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox02y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox02x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox02y2*2)), makecol(255,000,000)); }
+if (P1_HitBox03x1 !=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox03x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox03y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox03x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox03y2*2)), makecol(255,000,000)); }
+if (P1_HitBox04x1 !=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox04x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox04y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox04x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox04y2*2)), makecol(255,000,000)); }
+if (P1_HitBox05x1 !=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox05x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox05y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox05x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox05y2*2)), makecol(255,000,000)); }
+if (P1_HitBox06x1 !=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox06x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox06y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox06x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox06y2*2)), makecol(255,000,000)); }
+if (P1_HitBox07x1 !=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox07x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox07y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox07x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox07y2*2)), makecol(255,000,000)); }
+if (P1_HitBox08x1 !=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox08x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox08y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox08x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox08y2*2)), makecol(255,000,000)); }
+if (P1_HitBox09x1 !=-5555) { rectfill(LayerHUDa, Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox09x1)*2), Cam_Y(((P[1].y*2)+P1_HitBox09y1*2)), Cam_X(((P[1].x)*2)+(P[1].Lado*P1_HitBox09x2)*2), Cam_Y(((P[1].y*2)+P1_HitBox09y2*2)), makecol(255,000,000)); }
+
+if (P2_HurtBox01x1!=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox01x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox01y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox01x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox01y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox02x1!=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox02x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox02y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox02x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox02y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox03x1!=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox03x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox03y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox03x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox03y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox04x1!=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox04x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox04y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox04x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox04y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox05x1!=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox05x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox05y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox05x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox05y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox06x1!=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox06x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox06y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox06x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox06y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox07x1!=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox07x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox07y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox07x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox07y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox08x1!=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox08x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox08y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox08x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox08y2*2)), makecol(000,000,255)); }
+if (P2_HurtBox09x1!=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox09x1)*2), Cam_Y(((P[2].y*2)+P2_HurtBox09y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HurtBox09x2)*2), Cam_Y(((P[2].y*2)+P2_HurtBox09y2*2)), makecol(000,000,255)); }
+if (P2_HitBox01x1 !=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox01x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox01y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox01x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox01y2*2)), makecol(255,000,000)); }
+if (P2_HitBox02x1 !=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox02x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox02y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox02x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox02y2*2)), makecol(255,000,000)); }
+if (P2_HitBox03x1 !=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox03x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox03y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox03x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox03y2*2)), makecol(255,000,000)); }
+if (P2_HitBox04x1 !=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox04x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox04y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox04x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox04y2*2)), makecol(255,000,000)); }
+if (P2_HitBox05x1 !=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox05x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox05y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox05x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox05y2*2)), makecol(255,000,000)); }
+if (P2_HitBox06x1 !=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox06x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox06y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox06x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox06y2*2)), makecol(255,000,000)); }
+if (P2_HitBox07x1 !=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox07x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox07y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox07x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox07y2*2)), makecol(255,000,000)); }
+if (P2_HitBox08x1 !=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox08x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox08y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox08x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox08y2*2)), makecol(255,000,000)); }
+if (P2_HitBox09x1 !=+5555) { rectfill(LayerHUDa, Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox09x1)*2), Cam_Y(((P[2].y*2)+P2_HitBox09y1*2)), Cam_X(((P[2].x)*2)+(P[2].Lado*P2_HitBox09x2)*2), Cam_Y(((P[2].y*2)+P2_HitBox09y2*2)), makecol(255,000,000)); }
 drawing_mode(DRAW_MODE_SOLID, 0, 0, 0);
 }
 
 if (Draw_Debug==1) {
-line(bufferx, 0, AlturaPiso*2, bufferx->w, AlturaPiso*2, makecol(020,020,020));
-circlefill (bufferx, P[1].x*2, P[1].y*2, 3, makecol(000,000,000));
-circlefill (bufferx, P[1].x*2, P[1].y*2, 1, makecol(255,255,255));
-circlefill (bufferx, P[2].x*2, P[2].y*2, 3, makecol(000,000,000));
-circlefill (bufferx, P[2].x*2, P[2].y*2, 1, makecol(255,255,255));
-textprintf_centre_ex(bufferx, font_debug, MeioDaTela*2+1, AlturaPiso*2-20+1, makecol(000,000,000), -1, "%i", abs(P[1].x-P[2].x) );
-textprintf_centre_ex(bufferx, font_debug, MeioDaTela*2, AlturaPiso*2-20, makecol(255,255,255), -1, "%i", abs(P[1].x-P[2].x) );
-circlefill (bufferx, MeioDaTela*2, AlturaPiso*2, 3, makecol(255,000,000));
-circlefill (bufferx, MeioDaTela*2, AlturaPiso*2, 1, makecol(255,255,255));
+line(LayerHUDa, 0, Cam_Y(AlturaPiso*2), LayerHUDa->w, Cam_Y(AlturaPiso*2), makecol(020,020,020));
+circlefill (LayerHUDa, Cam_X(P[1].x*2), Cam_Y(P[1].y*2), 3, makecol(000,000,000));
+circlefill (LayerHUDa, Cam_X(P[1].x*2), Cam_Y(P[1].y*2), 1, makecol(255,255,255));
+circlefill (LayerHUDa, Cam_X(P[2].x*2), Cam_Y(P[2].y*2), 3, makecol(000,000,000));
+circlefill (LayerHUDa, Cam_X(P[2].x*2), Cam_Y(P[2].y*2), 1, makecol(255,255,255));
+textprintf_centre_ex(LayerHUDa, font_debug, Cam_X(MeioDaTela*2)+1, Cam_Y(AlturaPiso*2)-20+1, makecol(000,000,000), -1, "%i", abs(P[1].x-P[2].x) );
+textprintf_centre_ex(LayerHUDa, font_debug, Cam_X(MeioDaTela*2), Cam_Y(AlturaPiso*2)-20, makecol(255,255,255), -1, "%i", abs(P[1].x-P[2].x) );
+circlefill (LayerHUDa, Cam_X(MeioDaTela*2), Cam_Y(AlturaPiso*2), 3, makecol(255,000,000));
+circlefill (LayerHUDa, Cam_X(MeioDaTela*2), Cam_Y(AlturaPiso*2), 1, makecol(255,255,255));
 }
 
 /*
 			// debug de Spark´s
-			if(Qtde_HitBox>0){
-			textprintf_centre_ex(LayerHUD, font_debug, 320,  50, makecol(255,255,255), -1, "HitSpark[1].x: %i", HitSpark[1].x);
-			textprintf_centre_ex(LayerHUD, font_debug, 320,  60, makecol(255,255,255), -1, "HitSpark[1].y: %i", HitSpark[1].y);
-			circlefill (bufferx, HitSpark[1].x, HitSpark[1].y, 5, makecol(000,000,255));
-			circlefill (bufferx, HitSpark[1].x, HitSpark[1].y, 3, makecol(255,255,255));
+			if(HitSparks.count>0){
+			textprintf_centre_ex(LayerHUD, font_debug, 320,  50, makecol(255,255,255), -1, "HitSparks.x[0]: %i", (int)HitSparks.x[0]);
+			textprintf_centre_ex(LayerHUD, font_debug, 320,  60, makecol(255,255,255), -1, "HitSparks.y[0]: %i", (int)HitSparks.y[0]);
+			circlefill (bufferx, HitSparks.x[0], HitSparks.y[0], 5, makecol(000,000,255));
+			circlefill (bufferx, HitSparks.x[0], HitSparks.y[0], 3, makecol(255,255,255));
 			rect(bufferx,
-			HitSpark[1].x-HitSpark[1].XAlign*2,
-			HitSpark[1].y-HitSpark[1].YAlign*2,
-			HitSpark[1].x+HitSpark[1].XAlign*2,
-			HitSpark[1].y+HitSpark[1].YAlign*2, 0);
+			HitSparks.x[0]-HitSparks.param[0]*2,
+			HitSparks.y[0]-HitSparks.param[0]*2,
+			HitSparks.x[0]+HitSparks.param[0]*2,
+			HitSparks.y[0]+HitSparks.param[0]*2, 0);
 			}
 		*/
 
-/////////////////////////////////
-// DESENHA BUFFERX em LAYERHUD //
-/////////////////////////////////
-
-stretch_blit(bufferx, LayerHUDa, VScreen_x, VScreen_y, VScreen_x2, VScreen_y2, 0, 0, LayerHUDa->w, LayerHUDa->h);
-stretch_blit(bufferx, LayerHUDb, VScreen_x, VScreen_y, VScreen_x2, VScreen_y2, 0, 0, LayerHUDb->w, LayerHUDb->h);
-
 /////////////////////////////////////////////////////////////////////////////
 // DEBUG --------------------------------------------------------------[**08]
 /////////////////////////////////////////////////////////////////////////////
@@ -5043,10 +5179,10 @@ FD_P1_MovFramesTot=FD_P1_Startup+FD_P1_Active+FD_P1_Recovery;
 }
 
 //define o status do P1
-if(timer-P[1].MovStartFrame<FD_P1_Startup) { FD_P1_Status=1; }
-if( ((timer-P[1].MovStartFrame)>=FD_P1_Startup) && ((timer-P[1].MovStartFrame)<FD_P1_MovFramesTot-FD_P1_Recovery) ) { FD_P1_Status=2; }
-if(timer-P[1].MovStartFrame>=FD_P1_MovFramesTot-FD_P1_Recovery) { FD_P1_Status=3; }
-if( timer-P[1].MovStartFrame>=FD_P1_MovFramesTot ) {
+if(LogicTick-P[1].MovStartFrame<FD_P1_Startup) { FD_P1_Status=1; }
+if( ((LogicTick-P[1].MovStartFrame)>=FD_P1_Startup) && ((LogicTick-P[1].MovStartFrame)<FD_P1_MovFramesTot-FD_P1_Recovery) ) { FD_P1_Status=2; }
+if(LogicTick-P[1].MovStartFrame>=FD_P1_MovFramesTot-FD_P1_Recovery) { FD_P1_Status=3; }
+if( LogicTick-P[1].MovStartFrame>=FD_P1_MovFramesTot ) {
 FD_P1_Status=0;
 FD_P1_Startup=0;
 FD_P1_Active=0;
@@ -5056,7 +5192,7 @@ FD_P1_MovFramesTot=0;
 //desenha retangulos: Startup P1
 if( FD_P1_Status==1 ){
 for(int ind=0; ind<=FD_P1_Startup-1;ind++){
-if((timer-P[1].MovStartFrame)>=ind) {
+if((LogicTick-P[1].MovStartFrame)>=ind) {
 rectfill(LayerHUDa,  86+ 15*ind, 50, 86+ 15+15*ind, 50+15, makecol(000,255,000)); //verde
 }
 if(ind< 9) { textprintf_ex(LayerHUDa, font_10, 88+ ind*15, 51, makecol(050,050,050), -1, "0%d", ind+1); }
@@ -5069,7 +5205,7 @@ rect(LayerHUDa,  86+ 15*ind, 50, 86+ 15+15*ind, 50+15, makecol(255,255,255));
 //desenha retangulos: Active P1
 if( FD_P1_Status==2 ){
 for(int ind=0; ind<=FD_P1_Active-1;ind++){
-if((timer-P[1].MovStartFrame-FD_P1_Startup)>=ind) {
+if((LogicTick-P[1].MovStartFrame-FD_P1_Startup)>=ind) {
 rectfill(LayerHUDa,  86+ 15*ind, 50, 86+ 15+15*ind, 50+15, makecol(255,000,000)); //vermelho
 }
 if(ind< 9) { textprintf_ex(LayerHUDa, font_10, 88+ ind*15, 51, makecol(050,050,050), -1, "0%d", ind+1); }
@@ -5082,7 +5218,7 @@ rect(LayerHUDa,  86+ 15*ind, 50, 86+ 15+15*ind, 50+15, makecol(255,255,255));
 //desenha retangulos: Recovery P1
 if( FD_P1_Status==3 ){
 for(int ind=0; ind<=FD_P1_Recovery-1;ind++){
-if((timer-P[1].MovStartFrame-FD_P1_Startup-FD_P1_Active)>=ind) {
+if((LogicTick-P[1].MovStartFrame-FD_P1_Startup-FD_P1_Active)>=ind) {
 rectfill(LayerHUDa,  86+ 15*ind, 50, 86+ 15+15*ind, 50+15, makecol(255,255,000)); //amarelo
 }
 if(ind< 9) { textprintf_ex(LayerHUDa, font_10, 88+ ind*15, 51, makecol(050,050,050), -1, "0%d", ind+1); }
@@ -5157,10 +5293,10 @@ FD_P2_MovFramesTot=FD_P2_Startup+FD_P2_Active+FD_P2_Recovery;
 }
 
 //define o status do P2
-if(timer-P[2].MovStartFrame<FD_P2_Startup) { FD_P2_Status=1; }
-if( ((timer-P[2].MovStartFrame)>=FD_P2_Startup) && ((timer-P[2].MovStartFrame)<FD_P2_MovFramesTot-FD_P2_Recovery) ) { FD_P2_Status=2; }
-if(timer-P[2].MovStartFrame>=FD_P2_MovFramesTot-FD_P2_Recovery) { FD_P2_Status=3; }
-if( timer-P[2].MovStartFrame>=FD_P2_MovFramesTot ) {
+if(LogicTick-P[2].MovStartFrame<FD_P2_Startup) { FD_P2_Status=1; }
+if( ((LogicTick-P[2].MovStartFrame)>=FD_P2_Startup) && ((LogicTick-P[2].MovStartFrame)<FD_P2_MovFramesTot-FD_P2_Recovery) ) { FD_P2_Status=2; }
+if(LogicTick-P[2].MovStartFrame>=FD_P2_MovFramesTot-FD_P2_Recovery) { FD_P2_Status=3; }
+if( LogicTick-P[2].MovStartFrame>=FD_P2_MovFramesTot ) {
 FD_P2_Status=0;
 FD_P2_Startup=0;
 FD_P2_Active=0;
@@ -5170,7 +5306,7 @@ FD_P2_MovFramesTot=0;
 //desenha retangulos: Startup P2
 if( FD_P2_Status==1 ){
 for(int ind=0; ind<=FD_P2_Startup-1;ind++){
-if((timer-P[2].MovStartFrame)>=ind) {
+if((LogicTick-P[2].MovStartFrame)>=ind) {
 rectfill(LayerHUDa,  86+ 15*ind, 65, 86+ 15+15*ind, 65+15, makecol(000,255,000)); //verde
 }
 if(ind< 9) { textprintf_ex(LayerHUDa, font_10, 88+ ind*15, 66, makecol(050,050,050), -1, "0%d", ind+1); }
@@ -5183,7 +5319,7 @@ rect(LayerHUDa,  86+ 15*ind, 65, 86+ 15+15*ind, 65+15, makecol(255,255,255));
 //desenha retangulos: Active P2
 if( FD_P2_Status==2 ){
 for(int ind=0; ind<=FD_P2_Active-1;ind++){
-if((timer-P[2].MovStartFrame-FD_P2_Startup)>=ind) {
+if((LogicTick-P[2].MovStartFrame-FD_P2_Startup)>=ind) {
 rectfill(LayerHUDa,  86+ 15*ind, 65, 86+ 15+15*ind, 65+15, makecol(255,000,000)); //vermelho
 }
 if(ind< 9) { textprintf_ex(LayerHUDa, font_10, 88+ ind*15, 66, makecol(050,050,050), -1, "0%d", ind+1); }
@@ -5196,7 +5332,7 @@ rect(LayerHUDa,  86+ 15*ind, 65, 86+ 15+15*ind, 65+15, makecol(255,255,255));
 //desenha retangulos: Recovery P2
 if( FD_P2_Status==3 ){
 for(int ind=0; ind<=FD_P2_Recovery-1;ind++){
-if((timer-P[2].MovStartFrame-FD_P2_Startup-FD_P2_Active)>=ind) {
+if((LogicTick-P[2].MovStartFrame-FD_P2_Startup-FD_P2_Active)>=ind) {
 rectfill(LayerHUDa,  86+ 15*ind, 65, 86+ 15+15*ind, 65+15, makecol(255,255,000)); //amarelo
 }
 if(ind< 9) { textprintf_ex(LayerHUDa, font_10, 88+ ind*15, 66, makecol(050,050,050), -1, "0%d", ind+1); }
@@ -5448,82 +5584,82 @@ textprintf_centre_ex(LayerHUDa, font_debug, 320, 20+290, makecol(255,255,255), -
 textprintf_centre_ex(LayerHUDa, font_debug, 320, 20+310, makecol(255,255,255), -1, "[F10] FPS-");
 textprintf_centre_ex(LayerHUDa, font_debug, 320, 20+330, makecol(255,255,255), -1, "[F11] FPS+");
 textprintf_centre_ex(LayerHUDa, font_debug, 320, 20+350, makecol(255,255,255), -1, "[F12] FPS60");
-textprintf_centre_ex(LayerHUDa, font_debug, 321,  86, makecol(000,000,000), -1, "FPS[%d] [%d]", Ctrl_FPS, timer);
-textprintf_centre_ex(LayerHUDa, font_debug, 320,  85, makecol(255,255,000), -1, "FPS[%d] [%d]", Ctrl_FPS, timer);
-textprintf_right_ex( LayerHUDa, font_debug, 311, 436, makecol(000,000,000), -1, "[P1] x:%i y:%i Vsp:%i Hsp:%i G.:%i TP:%i", P[1].x, P[1].y, abs(P[1].Vspeed), abs(P[1].Hspeed), abs(P[1].Gravity), P[1].TempoPulo); //P1
-textprintf_right_ex( LayerHUDa, font_debug, 310, 435, makecol(255,255,255), -1, "[P1] x:%i y:%i Vsp:%i Hsp:%i G.:%i TP:%i", P[1].x, P[1].y, abs(P[1].Vspeed), abs(P[1].Hspeed), abs(P[1].Gravity), P[1].TempoPulo); //P1
-textprintf_ex(       LayerHUDa, font_debug, 331, 436, makecol(000,000,000), -1, "[P2] x:%i y:%i Vsp:%i Hsp:%i G.:%i TP:%i", P[2].x, P[2].y, abs(P[2].Vspeed), abs(P[2].Hspeed), abs(P[2].Gravity), P[2].TempoPulo); //P2
-textprintf_ex(       LayerHUDa, font_debug, 330, 435, makecol(255,255,255), -1, "[P2] x:%i y:%i Vsp:%i Hsp:%i G.:%i TP:%i", P[2].x, P[2].y, abs(P[2].Vspeed), abs(P[2].Hspeed), abs(P[2].Gravity), P[2].TempoPulo); //P2
+textprintf_centre_ex(LayerHUDa, font_debug, 321,  86, makecol(000,000,000), -1, "FPS[%d] [%d]", Ctrl_FPS, LogicTick);
+textprintf_centre_ex(LayerHUDa, font_debug, 320,  85, makecol(255,255,000), -1, "FPS[%d] [%d]", Ctrl_FPS, LogicTick);
+textprintf_right_ex( LayerHUDa, font_debug, 311, 436, makecol(000,000,000), -1, "[P1] x:%i y:%i Vsp:%i Hsp:%i G.:%i TP:%i", P[1].x, P[1].y, abs((int)P[1].Vspeed), abs((int)P[1].Hspeed), abs((int)P[1].Gravity), P[1].TempoPulo); //P1
+textprintf_right_ex( LayerHUDa, font_debug, 310, 435, makecol(255,255,255), -1, "[P1] x:%i y:%i Vsp:%i Hsp:%i G.:%i TP:%i", P[1].x, P[1].y, abs((int)P[1].Vspeed), abs((int)P[1].Hspeed), abs((int)P[1].Gravity), P[1].TempoPulo); //P1
+textprintf_ex(       LayerHUDa, font_debug, 331, 436, makecol(000,000,000), -1, "[P2] x:%i y:%i Vsp:%i Hsp:%i G.:%i TP:%i", P[2].x, P[2].y, abs((int)P[2].Vspeed), abs((int)P[2].Hspeed), abs((int)P[2].Gravity), P[2].TempoPulo); //P2
+textprintf_ex(       LayerHUDa, font_debug, 330, 435, makecol(255,255,255), -1, "[P2] x:%i y:%i Vsp:%i Hsp:%i G.:%i TP:%i", P[2].x, P[2].y, abs((int)P[2].Vspeed), abs((int)P[2].Hspeed), abs((int)P[2].Gravity), P[2].TempoPulo); //P2
 
 //-status do -P1- sombra
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[%i/%i]"    , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[%i/0%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[0%i/%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[0%i/0%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[%i/%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[%i/0%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[0%i/%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[0%i/0%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[%i/%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[%i/0%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[0%i/%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[0%i/0%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[%i/%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[%i/0%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[0%i/%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[0%i/0%i]", P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[%i/%i]"    , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[%i/0%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[0%i/%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[0%i/0%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[%i/%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[%i/0%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[0%i/%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[0%i/0%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[%i/%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[%i/0%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[0%i/%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[0%i/0%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[%i/%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[%i/0%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[0%i/%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 171, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[0%i/0%i]", P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
 //-status do -P2- sombra
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[%i/%i]"    , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[%i/0%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[0%i/%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[0%i/0%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[%i/%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[%i/0%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[0%i/%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[0%i/0%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[%i/%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[%i/0%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[0%i/%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[0%i/0%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[%i/%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[%i/0%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[0%i/%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[0%i/0%i]", P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[%i/%i]"    , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[%i/0%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[0%i/%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/%i]-[0%i/0%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[%i/%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[%i/0%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[0%i/%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[%i/0%i]-[0%i/0%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[%i/%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[%i/0%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[0%i/%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/%i]-[0%i/0%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[%i/%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[%i/0%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[0%i/%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 331, 455, makecol(000,000,000), -1, "[%i]-[0%i/0%i]-[0%i/0%i]", P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
 
 //-status do -P1-
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[%i/%i]"    , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[%i/0%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[0%i/%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[0%i/0%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[%i/%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[%i/0%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[0%i/%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[0%i/0%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[%i/%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[%i/0%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[0%i/%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (timer-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[0%i/0%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[%i/%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[%i/0%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[0%i/%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
-if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (timer-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[0%i/0%i]", P[1].State, P[1].IndexAnim, P[1].TotalFrames, (timer-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[%i/%i]"    , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[%i/0%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[0%i/%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[0%i/0%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[%i/%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[%i/0%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[0%i/%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim>=10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[0%i/0%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[%i/%i]"   , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[%i/0%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[0%i/%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames>=10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[0%i/0%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[%i/%i]"  , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame>=10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[%i/0%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[0%i/%i]" , P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
+if ( P[1].IndexAnim< 10 && P[1].TotalFrames< 10 && (LogicTick-P[1].StartFrame< 10) && P1_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 170, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[0%i/0%i]", P[1].State, P[1].IndexAnim, P[1].TotalFrames, (LogicTick-P[1].StartFrame)+1, P1_FrameTime+1); }
 //-status do -P2-
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[%i/%i]"    , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[%i/0%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[0%i/%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[0%i/0%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[%i/%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[%i/0%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[0%i/%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[0%i/0%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[%i/%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[%i/0%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[0%i/%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (timer-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[0%i/0%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[%i/%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[%i/0%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[0%i/%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
-if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (timer-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[0%i/0%i]", P[2].State, P[2].IndexAnim, P[2].TotalFrames, timer-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[%i/%i]"    , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[%i/0%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[0%i/%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/%i]-[0%i/0%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[%i/%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[%i/0%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[0%i/%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim>=10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[%i/0%i]-[0%i/0%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[%i/%i]"   , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[%i/0%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[0%i/%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames>=10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/%i]-[0%i/0%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[%i/%i]"  , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame>=10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[%i/0%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime>=10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[0%i/%i]" , P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
+if ( P[2].IndexAnim< 10 && P[2].TotalFrames< 10 && (LogicTick-P[2].StartFrame< 10) && P2_FrameTime< 10 ) { textprintf_ex(LayerHUDa, font_debug, 330, 454, makecol(255,255,255), -1, "[%i]-[0%i/0%i]-[0%i/0%i]", P[2].State, P[2].IndexAnim, P[2].TotalFrames, LogicTick-P[2].StartFrame, P2_FrameTime); }
 
 //exibe relogio sombra
 if (Horas>=10 && Minutos>=10 && Segundos>=10) { textprintf_centre_ex(LayerHUDa, font_debug, 321, 101, makecol(000,000,000), -1, "[%d:%d:%d]"   , Horas, Minutos, Segundos); }
@@ -5547,42 +5683,42 @@ if (Horas <10 && Minutos <10 && Segundos <10) { textprintf_centre_ex(LayerHUDa,
 //exibe joystick virtual
 draw_sprite(LayerHUDa, bt_joystick,   5, 440-400);
 draw_sprite(LayerHUDa, bt_joystick, 605, 440-400);
-if ( P[1].key_UP_status==1 )     { draw_sprite(LayerHUDa,    bt_up_1, 005+5, 227+215-400); }
-if ( P[1].key_UP_status==2 )     { draw_sprite(LayerHUDa,    bt_up_2, 005+5, 227+215-400); }
-if ( P[1].key_UP_status==3 )     { draw_sprite(LayerHUDa,    bt_up_3, 005+5, 227+215-400); } if ( P[1].key_UP_status==0 ){  }
-if ( P[1].key_DOWN_status==1 )   { draw_sprite(LayerHUDa,  bt_down_1, 005+5, 233+215-400); }
-if ( P[1].key_DOWN_status==2 )   { draw_sprite(LayerHUDa,  bt_down_2, 005+5, 233+215-400); }
-if ( P[1].key_DOWN_status==3 )   { draw_sprite(LayerHUDa,  bt_down_3, 005+5, 233+215-400); } if ( P[1].key_DOWN_status==0 ){  }
-if ( P[1].key_LEFT_status==1 )   { draw_sprite(LayerHUDa,  bt_left_1, 002+5, 230+215-400); }
-if ( P[1].key_LEFT_status==2 )   { draw_sprite(LayerHUDa,  bt_left_2, 002+5, 230+215-400); }
-if ( P[1].key_LEFT_status==3 )   { draw_sprite(LayerHUDa,  bt_left_3, 002+5, 230+215-400); } if ( P[1].key_LEFT_status==0 ){  }
-if ( P[1].key_RIGHT_status==1 )  { draw_sprite(LayerHUDa, bt_right_1, 010+5, 230+215-400); }
-if ( P[1].key_RIGHT_status==2 )  { draw_sprite(LayerHUDa, bt_right_2, 010+5, 230+215-400); }
-if ( P[1].key_RIGHT_status==3 )  { draw_sprite(LayerHUDa, bt_right_3, 010+5, 230+215-400); } if ( P[1].key_RIGHT_status==0 ){  }
-if ( P[1].key_BT1_status==1 )    { draw_sprite(LayerHUDa,       bt_1, 016+5, 229+215-400); }
-if ( P[1].key_BT1_status==2 )    { draw_sprite(LayerHUDa,       bt_2, 016+5, 229+215-400); }
-if ( P[1].key_BT1_status==3 )    { draw_sprite(LayerHUDa,       bt_3, 016+5, 229+215-400); } if ( P[1].key_BT1_status==0 ){  }
-if ( P[1].key_BT2_status==1 )    { draw_sprite(LayerHUDa,       bt_1, 023+5, 229+215-400); }
-if ( P[1].key_BT2_status==2 )    { draw_sprite(LayerHUDa,       bt_2, 023+5, 229+215-400); }
-if ( P[1].key_BT2_status==3 )    { draw_sprite(LayerHUDa,       bt_3, 023+5, 229+215-400); } if ( P[1].key_BT2_status==0 ){  }
-if ( P[1].key_BT3_status==1 )    { draw_sprite(LayerHUDa,       bt_1, 030+5, 229+215-400); }
-if ( P[1].key_BT3_status==2 )    { draw_sprite(LayerHUDa,       bt_2, 030+5, 229+215-400); }
-if ( P[1].key_BT3_status==3 )    { draw_sprite(LayerHUDa,       bt_3, 030+5, 229+215-400); } if ( P[1].key_BT3_status==0 ){  }
-if ( P[1].key_BT4_status==1 )    { draw_sprite(LayerHUDa,       bt_1, 016+5, 234+215-400); }
-if ( P[1].key_BT4_status==2 )    { draw_sprite(LayerHUDa,       bt_2, 016+5, 234+215-400); }
-if ( P[1].key_BT4_status==3 )    { draw_sprite(LayerHUDa,       bt_3, 016+5, 234+215-400); } if ( P[1].key_BT4_status==0 ){  }
-if ( P[1].key_BT5_status==1 )    { draw_sprite(LayerHUDa,       bt_1, 023+5, 234+215-400); }
-if ( P[1].key_BT5_status==2 )    { draw_sprite(LayerHUDa,       bt_2, 023+5, 234+215-400); }
-if ( P[1].key_BT5_status==3 )    { draw_sprite(LayerHUDa,       bt_3, 023+5, 234+215-400); } if ( P[1].key_BT5_status==0 ){  }
-if ( P[1].key_BT6_status==1 )    { draw_sprite(LayerHUDa,       bt_1, 030+5, 234+215-400); }
-if ( P[1].key_BT6_status==2 )    { draw_sprite(LayerHUDa,       bt_2, 030+5, 234+215-400); }
-if ( P[1].key_BT6_status==3 )    { draw_sprite(LayerHUDa,       bt_3, 030+5, 234+215-400); } if ( P[1].key_BT6_status==0 ){  }
-if ( P[1].key_SELECT_status==1 ) { draw_sprite(LayerHUDa,    bt_ss_1, 020+5, 227+215-400); }
-if ( P[1].key_SELECT_status==2 ) { draw_sprite(LayerHUDa,    bt_ss_2, 020+5, 227+215-400); }
-if ( P[1].key_SELECT_status==3 ) { draw_sprite(LayerHUDa,    bt_ss_3, 020+5, 227+215-400); } if ( P[1].key_SELECT_status==0 ){  }
-if ( P[1].key_START_status==1 )  { draw_sprite(LayerHUDa,    bt_ss_1, 026+5, 227+215-400); }
-if ( P[1].key_START_status==2 )  { draw_sprite(LayerHUDa,    bt_ss_2, 026+5, 227+215-400); }
-if ( P[1].key_START_status==3 )  { draw_sprite(LayerHUDa,    bt_ss_3, 026+5, 227+215-400); } if ( P[1].key_START_status==0 ){  }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_UP)==1 )     { draw_sprite(LayerHUDa,    bt_up_1, 005+5, 227+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_UP)==2 )     { draw_sprite(LayerHUDa,    bt_up_2, 005+5, 227+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_UP)==3 )     { draw_sprite(LayerHUDa,    bt_up_3, 005+5, 227+215-400); } if ( hamoopi_input_status(&P[1].Teclas, TECLA_UP)==0 ){  }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)==1 )   { draw_sprite(LayerHUDa,  bt_down_1, 005+5, 233+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)==2 )   { draw_sprite(LayerHUDa,  bt_down_2, 005+5, 233+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)==3 )   { draw_sprite(LayerHUDa,  bt_down_3, 005+5, 233+215-400); } if ( hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)==0 ){  }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)==1 )   { draw_sprite(LayerHUDa,  bt_left_1, 002+5, 230+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)==2 )   { draw_sprite(LayerHUDa,  bt_left_2, 002+5, 230+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)==3 )   { draw_sprite(LayerHUDa,  bt_left_3, 002+5, 230+215-400); } if ( hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)==0 ){  }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT)==1 )  { draw_sprite(LayerHUDa, bt_right_1, 010+5, 230+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT)==2 )  { draw_sprite(LayerHUDa, bt_right_2, 010+5, 230+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT)==3 )  { draw_sprite(LayerHUDa, bt_right_3, 010+5, 230+215-400); } if ( hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT)==0 ){  }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT1)==1 )    { draw_sprite(LayerHUDa,       bt_1, 016+5, 229+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT1)==2 )    { draw_sprite(LayerHUDa,       bt_2, 016+5, 229+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT1)==3 )    { draw_sprite(LayerHUDa,       bt_3, 016+5, 229+215-400); } if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT1)==0 ){  }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT2)==1 )    { draw_sprite(LayerHUDa,       bt_1, 023+5, 229+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT2)==2 )    { draw_sprite(LayerHUDa,       bt_2, 023+5, 229+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT2)==3 )    { draw_sprite(LayerHUDa,       bt_3, 023+5, 229+215-400); } if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT2)==0 ){  }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT3)==1 )    { draw_sprite(LayerHUDa,       bt_1, 030+5, 229+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT3)==2 )    { draw_sprite(LayerHUDa,       bt_2, 030+5, 229+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT3)==3 )    { draw_sprite(LayerHUDa,       bt_3, 030+5, 229+215-400); } if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT3)==0 ){  }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT4)==1 )    { draw_sprite(LayerHUDa,       bt_1, 016+5, 234+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT4)==2 )    { draw_sprite(LayerHUDa,       bt_2, 016+5, 234+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT4)==3 )    { draw_sprite(LayerHUDa,       bt_3, 016+5, 234+215-400); } if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT4)==0 ){  }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT5)==1 )    { draw_sprite(LayerHUDa,       bt_1, 023+5, 234+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT5)==2 )    { draw_sprite(LayerHUDa,       bt_2, 023+5, 234+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT5)==3 )    { draw_sprite(LayerHUDa,       bt_3, 023+5, 234+215-400); } if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT5)==0 ){  }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT6)==1 )    { draw_sprite(LayerHUDa,       bt_1, 030+5, 234+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT6)==2 )    { draw_sprite(LayerHUDa,       bt_2, 030+5, 234+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT6)==3 )    { draw_sprite(LayerHUDa,       bt_3, 030+5, 234+215-400); } if ( hamoopi_input_status(&P[1].Teclas, TECLA_BT6)==0 ){  }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_SELECT)==1 ) { draw_sprite(LayerHUDa,    bt_ss_1, 020+5, 227+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_SELECT)==2 ) { draw_sprite(LayerHUDa,    bt_ss_2, 020+5, 227+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_SELECT)==3 ) { draw_sprite(LayerHUDa,    bt_ss_3, 020+5, 227+215-400); } if ( hamoopi_input_status(&P[1].Teclas, TECLA_SELECT)==0 ){  }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_START)==1 )  { draw_sprite(LayerHUDa,    bt_ss_1, 026+5, 227+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_START)==2 )  { draw_sprite(LayerHUDa,    bt_ss_2, 026+5, 227+215-400); }
+if ( hamoopi_input_status(&P[1].Teclas, TECLA_START)==3 )  { draw_sprite(LayerHUDa,    bt_ss_3, 026+5, 227+215-400); } if ( hamoopi_input_status(&P[1].Teclas, TECLA_START)==0 ){  }
 }//fim Draw_Debug
 
 if (Draw_Debug==1){
@@ -5775,37 +5911,65 @@ if(P[ind].EnergyRedBar!=P[ind].Energy){ P[ind].EnergyRedBarSleep--; if(P[ind].En
 if( (P[ind].EnergyRedBar!=P[ind].Energy) && P[ind].EnergyRedBarSleep==0 ){ P[ind].EnergyRedBar-=5; }
 }
 
-draw_sprite(LayerHUDa, spr_bg_bar,  320-(spr_bg_bar->w/2), 0);
+//o HUD e composto por widgets em cache: cada um so e redesenhado quando sua Chave
+//(os valores que ele exibe) muda, e entao e copiado uma unica vez para o LayerHUDa
 
 //dica de codigo
 //stretch_blit(BITMAP*source, BITMAP*dest, source_x, source_y, source_width, source_height, dest_x, dest_y, dest_width, dest_height);
 //masked_blit(BITMAP *source, BITMAP *dest, int source_x, int source_y, int dest_x, int dest_y, int width, int height);
 
-//energia
-
+//energia, moldura e mini fotos in game
+int HUD_Alt=spr_bg_bar->h;
+if (spr_energy_bar_full->h>HUD_Alt)     { HUD_Alt=spr_energy_bar_full->h; }
+if (spr_energy_red_bar_full->h>HUD_Alt) { HUD_Alt=spr_energy_red_bar_full->h; }
+if (P1_1->h+5>HUD_Alt) { HUD_Alt=P1_1->h+5; }
+if (P2_1->h+5>HUD_Alt) { HUD_Alt=P2_1->h+5; }
+int P1_RedW=(P[1].EnergyRedBar*250)/1000;
+int P2_RedW=(P[2].EnergyRedBar*250)/1000;
+int P1_EnergiaW=(((P[1].Energy*100)/1000)/100)*250;
+int P2_EnergiaW=(((P[2].Energy*100)/1000)/100)*250;
+int ChaveEnergia[4]={ P1_RedW, P2_RedW, P1_EnergiaW, P2_EnergiaW };
+if (HUD_Checa(&HUD_Energia, 0, 0, 640, HUD_Alt, ChaveEnergia, 4)==1) {
+BITMAP *hud=HUD_Energia.Cache;
+draw_sprite(hud, spr_bg_bar,  320-(spr_bg_bar->w/2), 0);
 /*p1red*/
 clear_to_color(P1_energy_red_flip, makecol(255, 0, 255));
 draw_sprite_h_flip(P1_energy_red_flip, spr_energy_red_bar_full, 0, 0);
-masked_blit(P1_energy_red_flip, LayerHUDa, P1_energy_red_flip->w-(P[1].EnergyRedBar*250)/1000, 0, 50+(P1_energy_red_flip->w-(P[1].EnergyRedBar*250)/1000), 0, P1_energy_red_flip->w, P1_energy_red_flip->h);
+masked_blit(P1_energy_red_flip, hud, P1_energy_red_flip->w-P1_RedW, 0, 50+(P1_energy_red_flip->w-P1_RedW), 0, P1_energy_red_flip->w, P1_energy_red_flip->h);
 /*p2red*/
-masked_blit(spr_energy_red_bar_full, LayerHUDa, 0, 0, 320+20, 0, (P[2].EnergyRedBar*250)/1000, spr_energy_red_bar_full->h);
+masked_blit(spr_energy_red_bar_full, hud, 0, 0, 320+20, 0, P2_RedW, spr_energy_red_bar_full->h);
 /*p1*/
 clear_to_color(P1_energy_flip, makecol(255, 0, 255));
 draw_sprite_h_flip(P1_energy_flip, spr_energy_bar_full, 0, 0);
-masked_blit(P1_energy_flip, LayerHUDa, P1_energy_flip->w-((((P[1].Energy*100)/1000)/100)*250), 0, 50+(P1_energy_flip->w-((((P[1].Energy*100)/1000)/100)*250)), 0, P1_energy_flip->w, P1_energy_flip->h);
+masked_blit(P1_energy_flip, hud, P1_energy_flip->w-P1_EnergiaW, 0, 50+(P1_energy_flip->w-P1_EnergiaW), 0, P1_energy_flip->w, P1_energy_flip->h);
 /*p2*/
-masked_blit(spr_energy_bar_full, LayerHUDa, 0, 0, 320+20, 0, (((P[2].Energy*100)/1000)/100)*250, spr_energy_bar_full->h);
+masked_blit(spr_energy_bar_full, hud, 0, 0, 320+20, 0, P2_EnergiaW, spr_energy_bar_full->h);
+//mini fotos in game
+draw_sprite(hud, P1_1, 5, 5);
+draw_sprite_h_flip(hud, P2_1, 602, 5);
+}
+HUD_Desenha(LayerHUDa, &HUD_Energia);
 
-//Special
-/*p1*/stretch_blit(spr_bg_energy_bar_sp  , LayerHUDa, 0, 0, spr_bg_energy_bar_sp->w, spr_bg_energy_bar_sp->h ,                                  30, 457, (P[1].Special*250)/2000     , spr_bg_energy_bar_sp->h);
-/*p2*/stretch_blit(spr_bg_energy_bar_sp  , LayerHUDa, 0, 0, spr_bg_energy_bar_sp->w, spr_bg_energy_bar_sp->h , 360+(250-((P[2].Special*125)/1000)), 457, (P[2].Special*250)/2000     , spr_bg_energy_bar_sp->h);
+//Special (coordenadas relativas ao widget, que comeca em y=440)
+int ChaveSpecial[2]={ P[1].Special, P[2].Special };
+if (HUD_Checa(&HUD_Special, 0, 440, 640, 40, ChaveSpecial, 2)==1) {
+BITMAP *hud=HUD_Special.Cache;
+/*p1*/stretch_blit(spr_bg_energy_bar_sp  , hud, 0, 0, spr_bg_energy_bar_sp->w, spr_bg_energy_bar_sp->h ,                                  30, 17, (P[1].Special*250)/2000     , spr_bg_energy_bar_sp->h);
+/*p2*/stretch_blit(spr_bg_energy_bar_sp  , hud, 0, 0, spr_bg_energy_bar_sp->w, spr_bg_energy_bar_sp->h , 360+(250-((P[2].Special*125)/1000)), 17, (P[2].Special*250)/2000     , spr_bg_energy_bar_sp->h);
 //molduras barra de Special
-/*p1*/draw_sprite(LayerHUDa, spr_bg_bar_sp, 0, 440);
-/*p2*/draw_sprite_h_flip(LayerHUDa, spr_bg_bar_sp, 480, 440);
-
-//mini fotos in game
-draw_sprite(LayerHUDa, P1_1, 5, 5);
-draw_sprite_h_flip(LayerHUDa, P2_1, 602, 5);
+/*p1*/draw_sprite(hud, spr_bg_bar_sp, 0, 0);
+/*p2*/draw_sprite_h_flip(hud, spr_bg_bar_sp, 480, 0);
+//desenha numero (valor) do Special 1,2,3
+if (P[1].Special<333)                      { textprintf_centre_ex(hud, font_debug,  18,  9, makecol(255,255,255), -1, "0"); }
+if (P[1].Special>=333 && P[1].Special<666) { textprintf_centre_ex(hud, font_debug,  18,  9, makecol(255,255,255), -1, "1"); }
+if (P[1].Special>=666 && P[1].Special<999) { textprintf_centre_ex(hud, font_debug,  18,  9, makecol(255,255,255), -1, "2"); }
+if (P[1].Special==1000)                    { textprintf_centre_ex(hud, font_debug,  18,  9, makecol(255,255,255), -1, "3"); }
+if (P[2].Special<333)                      { textprintf_centre_ex(hud, font_debug, 622,  9, makecol(255,255,255), -1, "0"); }
+if (P[2].Special>=333 && P[2].Special<666) { textprintf_centre_ex(hud, font_debug, 622,  9, makecol(255,255,255), -1, "1"); }
+if (P[2].Special>=666 && P[2].Special<999) { textprintf_centre_ex(hud, font_debug, 622,  9, makecol(255,255,255), -1, "2"); }
+if (P[2].Special==1000)                    { textprintf_centre_ex(hud, font_debug, 622,  9, makecol(255,255,255), -1, "3"); }
+}
+HUD_Desenha(LayerHUDa, &HUD_Special);
 
 /*relogio*/
 //calculo de digitos
@@ -5815,25 +5979,19 @@ int RelogioTimerParteInteira;
 int RelogioTimerParteDecimal;
 RelogioTimerParteInteira=abs(RelogioTimer);
 RelogioTimerParteDecimal=((RoundTime/60)-(RelogioTimerParteInteira*10));
-//desenha os digitos
+//desenha os digitos (widget comeca em x=290, so muda uma vez por segundo)
+int ChaveRelogio[2]={ RelogioTimerParteInteira, RelogioTimerParteDecimal };
+if (HUD_Checa(&HUD_Relogio, 320-30, 0, 40, spr_num[0]->h, ChaveRelogio, 2)==1) {
 for(int ind=0;ind<=9;ind++){
 if(RelogioTimerParteDecimal==ind) {
-draw_sprite(LayerHUDa, spr_num[ind], 320-10, 0);
+draw_sprite(HUD_Relogio.Cache, spr_num[ind], 20, 0);
 }
 if(RelogioTimerParteInteira==ind) {
-draw_sprite(LayerHUDa, spr_num[ind], 320-30, 0);
+draw_sprite(HUD_Relogio.Cache, spr_num[ind], 0, 0);
 }
 }
-
-//desenha numero (valor) do Special 1,2,3
-if (P[1].Special<333)                      { textprintf_centre_ex(LayerHUDa, font_debug,  18,  449, makecol(255,255,255), -1, "0"); }
-if (P[1].Special>=333 && P[1].Special<666) { textprintf_centre_ex(LayerHUDa, font_debug,  18,  449, makecol(255,255,255), -1, "1"); }
-if (P[1].Special>=666 && P[1].Special<999) { textprintf_centre_ex(LayerHUDa, font_debug,  18,  449, makecol(255,255,255), -1, "2"); }
-if (P[1].Special==1000)                    { textprintf_centre_ex(LayerHUDa, font_debug,  18,  449, makecol(255,255,255), -1, "3"); }
-if (P[2].Special<333)                      { textprintf_centre_ex(LayerHUDa, font_debug, 622,  449, makecol(255,255,255), -1, "0"); }
-if (P[2].Special>=333 && P[2].Special<666) { textprintf_centre_ex(LayerHUDa, font_debug, 622,  449, makecol(255,255,255), -1, "1"); }
-if (P[2].Special>=666 && P[2].Special<999) { textprintf_centre_ex(LayerHUDa, font_debug, 622,  449, makecol(255,255,255), -1, "2"); }
-if (P[2].Special==1000)                    { textprintf_centre_ex(LayerHUDa, font_debug, 622,  449, makecol(255,255,255), -1, "3"); }
+}
+HUD_Desenha(LayerHUDa, &HUD_Relogio);
 
 //desenha splash round 1 fight
 if (timer_rounds>= 30 && timer_rounds<150){
@@ -5876,16 +6034,13 @@ if(P[1].Energy<P[2].Energy){ P[2].Round_Wins++; if(P[2].Energy==1000){ P[2].Perf
 }
 }
 
-//desenha molduras com transparencia
-drawing_mode(DRAW_MODE_TRANS,NULL,0,0);
-set_trans_blender(0,0,0,77); //aprox 25% transparente
-if(RoundTotal>=1){ draw_trans_sprite(LayerHUDa, spr_mold_results, 5+40*0+0, 45); }
-if(RoundTotal>=2){ draw_trans_sprite(LayerHUDa, spr_mold_results, 5+40*1+1, 45); }
-if(RoundTotal>=4){ draw_trans_sprite(LayerHUDa, spr_mold_results, 5+40*2+2, 45); }
-if(RoundTotal>=1){ draw_trans_sprite(LayerHUDa, spr_mold_results, 640-5-40*1-1, 45); }
-if(RoundTotal>=2){ draw_trans_sprite(LayerHUDa, spr_mold_results, 640-5-40*2-2, 45); }
-if(RoundTotal>=4){ draw_trans_sprite(LayerHUDa, spr_mold_results, 640-5-40*3-3, 45); }
-solid_mode();
+//desenha molduras com transparencia (77: aprox 25% transparente)
+if(RoundTotal>=1){ Tela_Sprite_Trans(LayerHUDa, spr_mold_results, 5+40*0+0, 45, 77); }
+if(RoundTotal>=2){ Tela_Sprite_Trans(LayerHUDa, spr_mold_results, 5+40*1+1, 45, 77); }
+if(RoundTotal>=4){ Tela_Sprite_Trans(LayerHUDa, spr_mold_results, 5+40*2+2, 45, 77); }
+if(RoundTotal>=1){ Tela_Sprite_Trans(LayerHUDa, spr_mold_results, 640-5-40*1-1, 45, 77); }
+if(RoundTotal>=2){ Tela_Sprite_Trans(LayerHUDa, spr_mold_results, 640-5-40*2-2, 45, 77); }
+if(RoundTotal>=4){ Tela_Sprite_Trans(LayerHUDa, spr_mold_results, 640-5-40*3-3, 45, 77); }
 if(P[1].Round_Wins>=1){ draw_sprite(LayerHUDa, spr_result_win, 5+40*0+0, 45); }
 if(P[1].Round_Wins>=2){ draw_sprite(LayerHUDa, spr_result_win, 5+40*1+1, 45); }
 if(P[1].Round_Wins>=3){ draw_sprite(LayerHUDa, spr_result_win, 5+40*2+2, 45); }
@@ -5916,33 +6071,33 @@ if ( key[KEY_F10] ) { Ctrl_FPS+=-1; if (Ctrl_FPS<1 ) { Ctrl_FPS= 1; } install_in
 if ( key[KEY_F11] ) { Ctrl_FPS+=+1; if (Ctrl_FPS>60) { Ctrl_FPS=60; } install_int_ex(tempo, BPS_TO_TIMER(Ctrl_FPS)); }
 if ( key[KEY_F12] ) { Ctrl_FPS=60; install_int_ex(tempo, BPS_TO_TIMER(60)); }
 //movimenta o player, dentro do editor
-if ( ED_y> 50/2 && ( P[1].key_W_status ==1 || P[1].key_W_status ==2 ) ) { ED_y--; } //w
-if ( ED_y<470/2 && ( P[1].key_S_status ==1 || P[1].key_S_status ==2 ) ) { ED_y++; } //s
-if ( ED_x>180/2 && ( P[1].key_A_status ==1 || P[1].key_A_status ==2 ) ) { ED_x--; } //a
-if ( ED_x<630/2 && ( P[1].key_D_status ==1 || P[1].key_D_status ==2 ) ) { ED_x++; } //d
+if ( ED_y> 50/2 && ( hamoopi_input_status(&TeclasSistema, SIS_W) ==1 || hamoopi_input_status(&TeclasSistema, SIS_W) ==2 ) ) { ED_y--; } //w
+if ( ED_y<470/2 && ( hamoopi_input_status(&TeclasSistema, SIS_S) ==1 || hamoopi_input_status(&TeclasSistema, SIS_S) ==2 ) ) { ED_y++; } //s
+if ( ED_x>180/2 && ( hamoopi_input_status(&TeclasSistema, SIS_A) ==1 || hamoopi_input_status(&TeclasSistema, SIS_A) ==2 ) ) { ED_x--; } //a
+if ( ED_x<630/2 && ( hamoopi_input_status(&TeclasSistema, SIS_D) ==1 || hamoopi_input_status(&TeclasSistema, SIS_D) ==2 ) ) { ED_x++; } //d
 //se segurar o shift, movimenta 1 pixel de cada vez.
 //o codigo abaixo anula o movimento ao manter pressionado,
 //mantendo entao apenas o deslocamento do key_pressed (key_status==1)
-if ( ED_y> 50/2 && P[1].key_W_status ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_y++; } //w+shift
-if ( ED_y<470/2 && P[1].key_S_status ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_y--; } //s+shift
-if ( ED_x>180/2 && P[1].key_A_status ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_x++; } //a+shift
-if ( ED_x<630/2 && P[1].key_D_status ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_x--; } //d+shift
+if ( ED_y> 50/2 && hamoopi_input_status(&TeclasSistema, SIS_W) ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_y++; } //w+shift
+if ( ED_y<470/2 && hamoopi_input_status(&TeclasSistema, SIS_S) ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_y--; } //s+shift
+if ( ED_x>180/2 && hamoopi_input_status(&TeclasSistema, SIS_A) ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_x++; } //a+shift
+if ( ED_x<630/2 && hamoopi_input_status(&TeclasSistema, SIS_D) ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_x--; } //d+shift
 //movimenta o eixo
-if (ED_MovimentaPivot==1 && P[1].key_START_status==1) { ED_alertsave2=1; ED_MovimentaPivot=0; }
+if (ED_MovimentaPivot==1 && hamoopi_input_status(&P[1].Teclas, TECLA_START)==1) { ED_alertsave2=1; ED_MovimentaPivot=0; }
 if (ED_MovimentaPivot==1)
 {
 int AuxEixoX=0; int AuxEixoY=0;
-if ( ED_y> 50/2 && ( P[1].key_UP_status    ==1 || P[1].key_UP_status    ==2 ) ) { ED_YAlign++; AuxEixoY=-1; }
-if ( ED_y<470/2 && ( P[1].key_DOWN_status  ==1 || P[1].key_DOWN_status  ==2 ) ) { ED_YAlign--; AuxEixoY=+1; }
-if ( ED_x>180/2 && ( P[1].key_LEFT_status  ==1 || P[1].key_LEFT_status  ==2 ) ) { ED_XAlign++; AuxEixoX=-1; }
-if ( ED_x<630/2 && ( P[1].key_RIGHT_status ==1 || P[1].key_RIGHT_status ==2 ) ) { ED_XAlign--; AuxEixoX=+1; }
+if ( ED_y> 50/2 && ( hamoopi_input_status(&P[1].Teclas, TECLA_UP)    ==1 || hamoopi_input_status(&P[1].Teclas, TECLA_UP)    ==2 ) ) { ED_YAlign++; AuxEixoY=-1; }
+if ( ED_y<470/2 && ( hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)  ==1 || hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)  ==2 ) ) { ED_YAlign--; AuxEixoY=+1; }
+if ( ED_x>180/2 && ( hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)  ==1 || hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)  ==2 ) ) { ED_XAlign++; AuxEixoX=-1; }
+if ( ED_x<630/2 && ( hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT) ==1 || hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT) ==2 ) ) { ED_XAlign--; AuxEixoX=+1; }
 //se segurar o shift, movimenta 1 pixel de cada vez.
 //o codigo abaixo anula o movimento ao manter pressionado,
 //mantendo entao apenas o deslocamento do key_pressed (key_status==1)
-if ( ED_y> 50/2 && P[1].key_UP_status    ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_YAlign--; AuxEixoY=+1; }
-if ( ED_y<470/2 && P[1].key_DOWN_status  ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_YAlign++; AuxEixoY=-1; }
-if ( ED_x>180/2 && P[1].key_LEFT_status  ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_XAlign--; AuxEixoX=+1; }
-if ( ED_x<630/2 && P[1].key_RIGHT_status ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_XAlign++; AuxEixoX=-1; }
+if ( ED_y> 50/2 && hamoopi_input_status(&P[1].Teclas, TECLA_UP)    ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_YAlign--; AuxEixoY=+1; }
+if ( ED_y<470/2 && hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)  ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_YAlign++; AuxEixoY=-1; }
+if ( ED_x>180/2 && hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)  ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_XAlign--; AuxEixoX=+1; }
+if ( ED_x<630/2 && hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT) ==2 && (key[KEY_LSHIFT] || key[KEY_RSHIFT]) ) { ED_XAlign++; AuxEixoX=-1; }
 }
 
 //Inicializa as variaveis do Editor
@@ -5956,24 +6111,24 @@ if(!ED_Mini){ ED_Mini = load_bitmap("data/system/000_01.pcx", NULL); }
 }
 
 //botoes para alterar os STATES
-if (key_Mouse_L_status==1 && mouse_x>5 && mouse_x<81 && mouse_y>120 && mouse_y<150) //Recuar States L
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>5 && mouse_x<81 && mouse_y>120 && mouse_y<150) //Recuar States L
 { MovPossiveisIndex--; if (MovPossiveisIndex<0) { MovPossiveisIndex=0; } ED_CarregarDados=1; }
-if (key_Mouse_R_status==1 && mouse_x>5 && mouse_x<81 && mouse_y>120 && mouse_y<150) //Recuar States R
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_R)==1 && mouse_x>5 && mouse_x<81 && mouse_y>120 && mouse_y<150) //Recuar States R
 { MovPossiveisIndex-=10; if (MovPossiveisIndex<0) { MovPossiveisIndex=0; } ED_CarregarDados=1; }
 
-if (key_Mouse_L_status==1 && mouse_x>88 && mouse_x<165 && mouse_y>120 && mouse_y<150) //Avançar States L
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>88 && mouse_x<165 && mouse_y>120 && mouse_y<150) //Avançar States L
 { MovPossiveisIndex++; if (MovPossiveis[MovPossiveisIndex]==0) { MovPossiveisIndex--; } ED_CarregarDados=1; }
-if (key_Mouse_R_status==1 && mouse_x>88 && mouse_x<165 && mouse_y>120 && mouse_y<150) //Avançar States R
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_R)==1 && mouse_x>88 && mouse_x<165 && mouse_y>120 && mouse_y<150) //Avançar States R
 { MovPossiveisIndex+=10; if (MovPossiveis[MovPossiveisIndex]==0) { MovPossiveisIndex-=10; } ED_CarregarDados=1; }
 
 if
 (
 ED_alertsave==1 and
 (
-(key_Mouse_L_status==1 && mouse_x>5 && mouse_x<81 && mouse_y>120 && mouse_y<150) or
-(key_Mouse_R_status==1 && mouse_x>5 && mouse_x<81 && mouse_y>120 && mouse_y<150) ||
-(key_Mouse_L_status==1 && mouse_x>88 && mouse_x<165 && mouse_y>120 && mouse_y<150) ||
-(key_Mouse_R_status==1 && mouse_x>88 && mouse_x<165 && mouse_y>120 && mouse_y<150)
+(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>5 && mouse_x<81 && mouse_y>120 && mouse_y<150) or
+(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_R)==1 && mouse_x>5 && mouse_x<81 && mouse_y>120 && mouse_y<150) ||
+(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>88 && mouse_x<165 && mouse_y>120 && mouse_y<150) ||
+(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_R)==1 && mouse_x>88 && mouse_x<165 && mouse_y>120 && mouse_y<150)
 )
 )
 {
@@ -6014,15 +6169,15 @@ ED_CarregarDados=0;
 }
 
 if(ED_MODE==1){
-if (key_Mouse_L_status==1 && mouse_x>5 && mouse_x<55 && mouse_y>60 && mouse_y<110) //Draw Hurt Box
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>5 && mouse_x<55 && mouse_y>60 && mouse_y<110) //Draw Hurt Box
 { ED_Pause=1; ED_MovimentaPivot=0; ED_DrawBlueMode=1; ED_DrawRedMode=0; ED_bt_Null=1; Draw_CHBoxes_ED(); }
-if (key_Mouse_L_status==1 && mouse_x>60 && mouse_x<110 && mouse_y>60 && mouse_y<110) //Draw Hit Box
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>60 && mouse_x<110 && mouse_y>60 && mouse_y<110) //Draw Hit Box
 { ED_Pause=1; ED_MovimentaPivot=0; ED_DrawRedMode=1; ED_DrawBlueMode=0; ED_bt_Null=1; Draw_CHBoxes_ED(); }
-if (key_Mouse_L_status==1 && mouse_x>115 && mouse_x<165 && mouse_y>60 && mouse_y<110) //Bt Null
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>115 && mouse_x<165 && mouse_y>60 && mouse_y<110) //Bt Null
 { ED_Pause=0; ED_MovimentaPivot=0; ED_DrawBlueMode=0; ED_DrawRedMode=0; ED_bt_Null=0; }
 }
 
-if (key_Mouse_R_status==1 && mouse_x>170 && mouse_y>40) {
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_R)==1 && mouse_x>170 && mouse_y>40) {
 
 if (ED_DrawRedMode==1)
 {
@@ -6132,28 +6287,28 @@ ED_HurtBox_tot--; } if (ED_HurtBox_tot<0) { ED_HurtBox_tot=0;
 }
 }
 
-if ( (ED_DrawRedMode==1 || ED_DrawBlueMode==1) && key_Mouse_L_status==1 && mouse_x>170 && mouse_y>40 ) //inicia desenho Red/Blue
+if ( (ED_DrawRedMode==1 || ED_DrawBlueMode==1) && hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>170 && mouse_y>40 ) //inicia desenho Red/Blue
 { ED_Mx1=mouse_x; ED_My1=mouse_y; }
 
 int atualiza=0;
 
-if (key_Mouse_L_status==1 && mouse_x>5 && mouse_x<34 && mouse_y>172 && mouse_y<202) //Prev+
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>5 && mouse_x<34 && mouse_y>172 && mouse_y<202) //Prev+
 { ED_Pause=1; ED_IndexAnim=0; ED_StartFrame=Edtimer; atualiza=1; Draw_CHBoxes_ED(); }
 
-if (key_Mouse_L_status==1 && mouse_x>37 && mouse_x<66 && mouse_y>172 && mouse_y<202) //Prev L
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>37 && mouse_x<66 && mouse_y>172 && mouse_y<202) //Prev L
 { ED_Pause=1; ED_IndexAnim--; if (ED_IndexAnim<0) { ED_IndexAnim=ED_TotalFrames; } ED_StartFrame=Edtimer; atualiza=1; Draw_CHBoxes_ED(); }
-if (key_Mouse_R_status==1 && mouse_x>37 && mouse_x<66 && mouse_y>172 && mouse_y<202) //Prev R
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_R)==1 && mouse_x>37 && mouse_x<66 && mouse_y>172 && mouse_y<202) //Prev R
 { ED_Pause=1; ED_IndexAnim-=3; if (ED_IndexAnim<0) { ED_IndexAnim=0; } ED_StartFrame=Edtimer; atualiza=1; Draw_CHBoxes_ED(); }
 
-if (key_Mouse_L_status==1 && mouse_x>70 && mouse_x<100 && mouse_y>168 && mouse_y<198) //Pause/Play
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>70 && mouse_x<100 && mouse_y>168 && mouse_y<198) //Pause/Play
 { if (ED_Pause==0) { ED_Pause=1; } else { ED_Pause=0; } }
 
-if (key_Mouse_L_status==1 && mouse_x>103 && mouse_x<133 && mouse_y>172 && mouse_y<202) //Next L
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>103 && mouse_x<133 && mouse_y>172 && mouse_y<202) //Next L
 { ED_Pause=1; ED_IndexAnim++; if (ED_IndexAnim>ED_TotalFrames) { ED_IndexAnim=0; } ED_StartFrame=Edtimer; atualiza=1; Draw_CHBoxes_ED(); }
-if (key_Mouse_R_status==1 && mouse_x>103 && mouse_x<133 && mouse_y>172 && mouse_y<202) //Next R
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_R)==1 && mouse_x>103 && mouse_x<133 && mouse_y>172 && mouse_y<202) //Next R
 { ED_Pause=1; ED_IndexAnim+=3; if (ED_IndexAnim>ED_TotalFrames) { ED_IndexAnim=ED_TotalFrames; } ED_StartFrame=Edtimer; atualiza=1; Draw_CHBoxes_ED(); }
 
-if (key_Mouse_L_status==1 && mouse_x>135 && mouse_x<165 && mouse_y>172 && mouse_y<202) //Next+
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>135 && mouse_x<165 && mouse_y>172 && mouse_y<202) //Next+
 { ED_Pause=1; ED_IndexAnim=ED_TotalFrames; ED_StartFrame=Edtimer; atualiza=1; Draw_CHBoxes_ED(); }
 
 if (atualiza==1) {
@@ -6190,29 +6345,29 @@ if (ED_IndexAnim==29) { ED_FrameTime=ED_FrameTime_29; }
 }
 atualiza=0;
 
-if (key_Mouse_L_status==1 && mouse_x>6 && mouse_x<34 && mouse_y>211 && mouse_y<238) //Minus Time L
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>6 && mouse_x<34 && mouse_y>211 && mouse_y<238) //Minus Time L
 {
 ED_Pause=1; ED_FrameTime--; if (ED_FrameTime<0) { ED_FrameTime=0; }
 ED_alertsave=1; atualiza=1;
 }
-if (key_Mouse_R_status==1 && mouse_x>6 && mouse_x<34 && mouse_y>211 && mouse_y<238) //Minus Time R
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_R)==1 && mouse_x>6 && mouse_x<34 && mouse_y>211 && mouse_y<238) //Minus Time R
 {
 ED_Pause=1; ED_FrameTime-=10; if (ED_FrameTime<0) { ED_FrameTime=0; }
 ED_alertsave=1; atualiza=1;
 }
 
-if (key_Mouse_L_status==1 && mouse_x>136 && mouse_x<164 && mouse_y>211 && mouse_y<238) //Plus Time L
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>136 && mouse_x<164 && mouse_y>211 && mouse_y<238) //Plus Time L
 {
 ED_Pause=1; ED_FrameTime++; if (ED_FrameTime>998) { ED_FrameTime=998; }
 ED_alertsave=1; atualiza=1;
 }
-if (key_Mouse_R_status==1 && mouse_x>136 && mouse_x<164 && mouse_y>211 && mouse_y<238) //Plus Time R
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_R)==1 && mouse_x>136 && mouse_x<164 && mouse_y>211 && mouse_y<238) //Plus Time R
 {
 ED_Pause=1; ED_FrameTime+=10; if (ED_FrameTime>998) { ED_FrameTime=998; }
 ED_alertsave=1; atualiza=1;
 }
 
-if (key_Mouse_L_status==1 && mouse_x>5 && mouse_x<164 && mouse_y>420 && mouse_y<450) //Movimenta Pivot
+if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>5 && mouse_x<164 && mouse_y>420 && mouse_y<450) //Movimenta Pivot
 {
 if (ED_MovimentaPivot==0) { ED_MovimentaPivot=1; ED_DrawBlueMode=0; ED_DrawRedMode=0; ED_bt_Null=0; }
 else
@@ -6469,8 +6624,8 @@ rect    (bufferx, 5,152,163,150+19,makecol(100,100,100));
 	*/
 
 //botoes ED_MODE
-if(key_Mouse_L_status==1 && mouse_x>550 && mouse_x<590 && mouse_y>0 && mouse_y<40){ ED_MODE=1; }
-if(key_Mouse_L_status==1 && mouse_x>595 && mouse_x<635 && mouse_y>0 && mouse_y<40){
+if(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>550 && mouse_x<590 && mouse_y>0 && mouse_y<40){ ED_MODE=1; }
+if(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>595 && mouse_x<635 && mouse_y>0 && mouse_y<40){
 ED_MODE=2;
 //ED_Pause=1;
 ED_MovimentaPivot=0;
@@ -6648,7 +6803,7 @@ draw_sprite(bufferx, spr_input_13, 10+20*6, 90);
 
 //add comand input list
 int add_command=0;
-if(key_Mouse_L_status==1){
+if(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1){
 if(mouse_x>19+20*0-9 && mouse_x<19+20*0+9 && mouse_y>59-9 && mouse_y<59+9) add_command=7;
 if(mouse_x>19+20*1-9 && mouse_x<19+20*1+9 && mouse_y>59-9 && mouse_y<59+9) add_command=8;
 if(mouse_x>19+20*2-9 && mouse_x<19+20*2+9 && mouse_y>59-9 && mouse_y<59+9) add_command=9;
@@ -6708,7 +6863,7 @@ P[1].Special_Inputs[indx][0]=P[1].Special_Inputs_c[indx][0]+P[1].Special_Inputs_
 }
 
 //botao reset input list
-if(key_Mouse_L_status==1 && ED_State>=700){
+if(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && ED_State>=700){
 if(mouse_x>609 && mouse_x<609+20 && mouse_y>51 && mouse_y<51+20) {
 int addcmd=0;
 if(ED_State==700) { addcmd=0; }
@@ -6731,9 +6886,9 @@ P[1].Special_Inputs[addcmd][ind]=0;
 }
 
 //botoes special variation
-if(key_Mouse_L_status==1 && mouse_x>185 && mouse_x<210 && mouse_y>75 && mouse_y<95){ ED_Special_Version=1; ED_load_charini(); }
-if(key_Mouse_L_status==1 && mouse_x>210 && mouse_x<235 && mouse_y>75 && mouse_y<95){ ED_Special_Version=2; ED_load_charini(); }
-if(key_Mouse_L_status==1 && mouse_x>235 && mouse_x<260 && mouse_y>75 && mouse_y<95){ ED_Special_Version=3; ED_load_charini(); }
+if(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>185 && mouse_x<210 && mouse_y>75 && mouse_y<95){ ED_Special_Version=1; ED_load_charini(); }
+if(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>210 && mouse_x<235 && mouse_y>75 && mouse_y<95){ ED_Special_Version=2; ED_load_charini(); }
+if(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>235 && mouse_x<260 && mouse_y>75 && mouse_y<95){ ED_Special_Version=3; ED_load_charini(); }
 
 //botoes de config e caixas
 for(int ind=4; ind<=18; ind++){
@@ -6844,10 +6999,10 @@ if ( ED_TotalFrames>=27 && ED_FrameTime_27!=-1 ) { textprintf_centre_ex(bufferx,
 if ( ED_TotalFrames>=28 && ED_FrameTime_28!=-1 ) { textprintf_centre_ex(bufferx, font_debug, 30+2*55, 242+8*15, makecol(255,255,255), -1, "28. %i", ED_FrameTime_28+1); }
 if ( ED_TotalFrames>=29 && ED_FrameTime_29!=-1 ) { textprintf_centre_ex(bufferx, font_debug, 30+2*55, 242+9*15, makecol(255,255,255), -1, "29. %i", ED_FrameTime_29+1); }
 
-if ( key_Mouse_L_status>0 && ED_Mx1>-1 && ED_My1>-1 ) { //efeito ao desenhar hboxes
+if ( hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)>0 && ED_Mx1>-1 && ED_My1>-1 ) { //efeito ao desenhar hboxes
 if ( ED_DrawRedMode ==1 ) { if (ED_io>=0 && ED_io<=1) { rect(bufferx, ED_Mx1,ED_My1,mouse_x,mouse_y,makecol(255,255,255)); } if (ED_io>=2 && ED_io<=3) { rect(bufferx, ED_Mx1,ED_My1,mouse_x,mouse_y,makecol(255,000,000)); } }
 if ( ED_DrawBlueMode==1 ) { if (ED_io>=0 && ED_io<=1) { rect(bufferx, ED_Mx1,ED_My1,mouse_x,mouse_y,makecol(255,255,255)); } if (ED_io>=2 && ED_io<=3) { rect(bufferx, ED_Mx1,ED_My1,mouse_x,mouse_y,makecol(000,000,255)); } } }
-if ( key_Mouse_L_status==3 && ED_Mx1>-1 && ED_My1>-1 )
+if ( hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==3 && ED_Mx1>-1 && ED_My1>-1 )
 { ED_Mx2=mouse_x; ED_My2=mouse_y; }
 
 if ( ED_Mx1>-1 && ED_My1>-1 && ED_Mx2>-1 && ED_My2>-1 )
@@ -7004,7 +7159,7 @@ if (ED_HitBox09x1 !=-5555) { rect(bufferx, (((ED_x-ED_XAlign)*2)+ED_XAlign*2)+ED
 
 /*
 				//debug do EDITOR
-				//if (key_Mouse_L_status>0 && mouse_x>170 && mouse_y>40) { textprintf_ex(bufferx, font_debug, 190, 50+ 0*15, makecol(255,255,255), -1, "x1[%i] y1[%i] x2:%i y2:%i", ED_Mx1, ED_My1, mouse_x, mouse_y); }
+				//if (hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)>0 && mouse_x>170 && mouse_y>40) { textprintf_ex(bufferx, font_debug, 190, 50+ 0*15, makecol(255,255,255), -1, "x1[%i] y1[%i] x2:%i y2:%i", ED_Mx1, ED_My1, mouse_x, mouse_y); }
 				if (ED_DrawRedMode ==1) { textprintf_right_ex(bufferx, font_10, 630, 50+ 0*10, makecol(255,255,255), -1, "Modo de Desenho: HitBox"); }
 				if (ED_DrawBlueMode==1) { textprintf_right_ex(bufferx, font_10, 630, 50+ 0*10, makecol(255,255,255), -1, "Modo de Desenho: HurtBox"); }
 				{ textprintf_right_ex(bufferx, font_10, 630, 50+ 1*10, makecol(255,255,255), -1, "HurtBox Total: %i", ED_HurtBox_tot); }
@@ -7069,28 +7224,28 @@ rect    (bufferx,228, 20+1, 228+15, 5+30+1, 0xffffff);
 int deveinicializar=0;
 
 // botao CharID--
-if(key_Mouse_L_status==1 && mouse_x>172 && mouse_x<187 && mouse_y>5 && mouse_y<20){
+if(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>172 && mouse_x<187 && mouse_y>5 && mouse_y<20){
 ED_CharID--; if(ED_CharID<1) {ED_CharID=1;}
 strcpy(P[1].Name, Lista_de_Personagens_Instalados[ED_CharID]);
 deveinicializar=1;
 }
 
 // botao CharID++
-if(key_Mouse_L_status==1 && mouse_x>228 && mouse_x<243 && mouse_y>5 && mouse_y<20){
+if(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>228 && mouse_x<243 && mouse_y>5 && mouse_y<20){
 ED_CharID++; if(ED_CharID>Qtde_Personagens_Instalados) {ED_CharID=Qtde_Personagens_Instalados;}
 strcpy(P[1].Name, Lista_de_Personagens_Instalados[ED_CharID]);
 deveinicializar=1;
 }
 
 // botao CharID=1
-if(key_Mouse_L_status==1 && mouse_x>172 && mouse_x<187 && mouse_y>21 && mouse_y<36){
+if(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>172 && mouse_x<187 && mouse_y>21 && mouse_y<36){
 ED_CharID=1;
 strcpy(P[1].Name, Lista_de_Personagens_Instalados[ED_CharID]);
 deveinicializar=1;
 }
 
 // botao CharID=Qtde_Personagens_Instalados
-if(key_Mouse_L_status==1 && mouse_x>228 && mouse_x<243 && mouse_y>21 && mouse_y<36){
+if(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>228 && mouse_x<243 && mouse_y>21 && mouse_y<36){
 ED_CharID=Qtde_Personagens_Instalados;
 strcpy(P[1].Name, Lista_de_Personagens_Instalados[ED_CharID]);
 deveinicializar=1;
@@ -7100,7 +7255,7 @@ deveinicializar=1;
 rect(bufferx, 260, 5, 260+15, 5+15, 0xffffff);
 if(ED_Tipo==2) rectfill(bufferx, 260, 5, 260+15, 5+15, 0x00ff00);
 textprintf_ex(bufferx, font_debug, 280,  5-2, makecol(255,255,255), -1, "HD Sprite");
-if(key_Mouse_L_status==1 && mouse_x>260 && mouse_x<275 && mouse_y>5 && mouse_y<20){
+if(hamoopi_input_status(&TeclasSistema, SIS_MOUSE_L)==1 && mouse_x>260 && mouse_x<275 && mouse_y>5 && mouse_y<20){
 //	int a=1;
 //	if(ED_Tipo==2 && a==1) { ED_Tipo=1; a=0; deveinicializar=1; }
 //	if(ED_Tipo==1 && a==1) { ED_Tipo=2; a=0; deveinicializar=1; }
@@ -7159,16 +7314,13 @@ ED_io++; if (ED_io>3) { ED_io=0; } //usado para animacoes
 if(FadeIN ==1){ FadeOUT=0; FadeCtr+=FadeVelocidade; if(FadeCtr>255){ FadeCtr=255; } }
 if(FadeOUT==1){ FadeIN=0;  FadeCtr-=FadeVelocidade; if(FadeCtr<0  ){ FadeCtr=  0; } }
 if(FadeCtr!=0){
-set_trans_blender(0, 0, 0, FadeCtr);
-drawing_mode(DRAW_MODE_TRANS, 0, 0, 0);
 int fx_w;
 int fx_h;
 fx_w=WindowResX;
 fx_h=WindowResY;
 if(fx_w==320) { fx_w=640; fx_h=480; }
-rectfill(bufferx, 0, 0, fx_w, fx_h, makecol(0, 0, 0));
-if(CtrlAnimTrans[16]==0){ rectfill(LayerHUDa, 0, 0, fx_w, fx_h, makecol(0, 0, 0)); }
-drawing_mode(DRAW_MODE_SOLID, 0, 0, 0);
+Tela_Escurece(bufferx, fx_w, fx_h, FadeCtr);
+if(CtrlAnimTrans[16]==0){ Tela_Escurece(LayerHUDa, fx_w, fx_h, FadeCtr); }
 }
 
 //efeito animação de Introducao (AnimIntro)
@@ -7214,25 +7366,30 @@ AnimTransTimer=-1;
 }
 }
 
+//passo fixo: cada volta do loop e um quadro de logica. Atrasado em relacao ao relogio,
+//roda os quadros devidos sem apresentar; em dia, apresenta e espera o proximo tick
+LogicTick++; LogicAcc--;
+TurboMode=key[KEY_TAB] ? 1 : 0;
+Relogio_Acumula();
+if (LogicAcc<=0) {
 //////////////////////////////
 //BLIT de BUFFERX em SCREEN!//
 //////////////////////////////
-if (GamePlayMode==0) { stretch_blit(bufferx, screen, 0, 0, 640, 480, 0, 0, screen->w, screen->h); }
-if (GamePlayMode==1) {
-masked_stretch_blit(LayerHUDa, LayerHUDb, 0, 0, LayerHUDa->w, LayerHUDa->h, 0, 0, LayerHUDb->w, LayerHUDb->h);
-stretch_blit(LayerHUDb, screen, 0, 0, LayerHUDb->w, LayerHUDb->h, 0, 0, screen->w, screen->h); //resolucao adaptativa
-//draw_sprite(screen, LayerHUDb, 0, 0); //PS: desativado, resolucao fixa em 640x480, stretch_blit funciona melhor
-}
+if (GamePlayMode==0) { Apresenta_Tela(bufferx); }
+if (GamePlayMode==1) { Apresenta_Tela(LayerHUDa); } //LayerHUDa ja traz cenario, personagens e HUD compostos
 //show_mouse(screen);
-while(timer==delay){}
-clear(LayerHUD);
-clear_to_color(LayerHUD, makecol(255, 0, 255));
-clear_to_color(LayerHUDa, makecol(255, 0, 255));
-clear_to_color(LayerHUDb, makecol(255, 0, 255));
-clear(bufferx);
+while(timer==LogicTimerLido){}
+Relogio_Acumula();
+}
+//PS: LayerHUDa e LayerHUD nao precisam ser limpos, sao sobrescritos por inteiro a cada frame (cenario / editor)
+if (GamePlayMode==0) { Tela_Limpa(bufferx); } //na gameplay o bufferx nao e utilizado
 
 } //(while sair==0)
 
+if (Carregando==1) { hamoopi_loader_finish(&Carga); } //saiu durante a intro
+hamoopi_stage_release(bg_test);
+hamoopi_stages_clear();
+
 //limpa a memoria, destroi imagens e audios utilizados no jogo
 destroy_bitmap(donation);
 for(int ind=0;ind<=500;ind++){
@@ -7243,7 +7400,17 @@ for(int ind=0;ind<10;ind++){ destroy_bitmap(spr_num[ind]); }
 for(int ind=0;ind<30;ind++){ destroy_bitmap(AnimTrans[ind]); }
 destroy_bitmap(LayerHUD);
 destroy_bitmap(LayerHUDa);
-destroy_bitmap(LayerHUDb);
+if (HUD_Energia.Cache) { destroy_bitmap(HUD_Energia.Cache); }
+if (HUD_Relogio.Cache) { destroy_bitmap(HUD_Relogio.Cache); }
+if (HUD_Special.Cache) { destroy_bitmap(HUD_Special.Cache); }
+if (TelaSaida) { destroy_bitmap(TelaSaida); }
+hamoopi_scaler_free(&Escalador);
+hamoopi_bands_free(&Bandas);
+free(Cam_Colunas);
+free(Cam_Mapa);
+free(Cam_Linhas);
+hamoopi_pool_free(&HitSparks);
+hamoopi_text_cache_clear();
 destroy_bitmap(ed_mode1_on);
 destroy_bitmap(ed_mode2_on);
 destroy_bitmap(ed_mode1_off);
@@ -7353,254 +7520,37 @@ END_OF_MAIN();
 
 void check_keys_P1()
 {
-if (mouse_b & 1) {
-if (key_Mouse_L_pressed==1 && key_Mouse_L_hold==0) { key_Mouse_L_hold=1; key_Mouse_L_pressed=0; }
-if (key_Mouse_L_pressed==0 && key_Mouse_L_hold==0) { key_Mouse_L_pressed=1; }}
-if (!(mouse_b & 1)) {
-if (key_Mouse_L_released==1) { key_Mouse_L_released=0; key_Mouse_L_pressed=0; key_Mouse_L_hold=0; }
-if (key_Mouse_L_pressed>0 || key_Mouse_L_hold>0) { key_Mouse_L_released=1; }}
-if ( key_Mouse_L_pressed==0 && key_Mouse_L_hold==0 && key_Mouse_L_released==0 ) { key_Mouse_L_status=0; }
-if ( key_Mouse_L_pressed==1  ) { key_Mouse_L_status=1; }
-if ( key_Mouse_L_hold==1     ) { key_Mouse_L_status=2; }
-if ( key_Mouse_L_released==1 ) { key_Mouse_L_status=3; }
-if (mouse_b & 2) {
-if (key_Mouse_R_pressed==1 && key_Mouse_R_hold==0) { key_Mouse_R_hold=1; key_Mouse_R_pressed=0; }
-if (key_Mouse_R_pressed==0 && key_Mouse_R_hold==0) { key_Mouse_R_pressed=1; }}
-if (!(mouse_b & 2)) {
-if (key_Mouse_R_released==1) { key_Mouse_R_released=0; key_Mouse_R_pressed=0; key_Mouse_R_hold=0; }
-if (key_Mouse_R_pressed>0 || key_Mouse_R_hold>0) { key_Mouse_R_released=1; }}
-if ( key_Mouse_R_pressed==0 && key_Mouse_R_hold==0 && key_Mouse_R_released==0 ) { key_Mouse_R_status=0; }
-if ( key_Mouse_R_pressed==1  ) { key_Mouse_R_status=1; }
-if ( key_Mouse_R_hold==1     ) { key_Mouse_R_status=2; }
-if ( key_Mouse_R_released==1 ) { key_Mouse_R_status=3; }
-if (key[KEY_F1]) {
-if (key_F1_pressed==1 && key_F1_hold==0) { key_F1_hold=1; key_F1_pressed=0; }
-if (key_F1_pressed==0 && key_F1_hold==0) { key_F1_pressed=1; }}
-if (!key[KEY_F1]) {
-if (key_F1_released==1) { key_F1_released=0; key_F1_pressed=0; key_F1_hold=0; }
-if (key_F1_pressed>0 || key_F1_hold>0) { key_F1_released=1; }}
-if ( key_F1_pressed==0 && key_F1_hold==0 && key_F1_released==0 ) { key_F1_status=0; }
-if ( key_F1_pressed==1  ) { key_F1_status=1; }
-if ( key_F1_hold==1     ) { key_F1_status=2; }
-if ( key_F1_released==1 ) { key_F1_status=3; }
-if (key[KEY_F2]) {
-if (key_F2_pressed==1 && key_F2_hold==0) { key_F2_hold=1; key_F2_pressed=0; }
-if (key_F2_pressed==0 && key_F2_hold==0) { key_F2_pressed=1; }}
-if (!key[KEY_F2]) {
-if (key_F2_released==1) { key_F2_released=0; key_F2_pressed=0; key_F2_hold=0; }
-if (key_F2_pressed>0 || key_F2_hold>0) { key_F2_released=1; }}
-if ( key_F2_pressed==0 && key_F2_hold==0 && key_F2_released==0 ) { key_F2_status=0; }
-if ( key_F2_pressed==1  ) { key_F2_status=1; }
-if ( key_F2_hold==1     ) { key_F2_status=2; }
-if ( key_F2_released==1 ) { key_F2_status=3; }
-if (key[KEY_F3]) {
-if (key_F3_pressed==1 && key_F3_hold==0) { key_F3_hold=1; key_F3_pressed=0; }
-if (key_F3_pressed==0 && key_F3_hold==0) { key_F3_pressed=1; }}
-if (!key[KEY_F3]) {
-if (key_F3_released==1) { key_F3_released=0; key_F3_pressed=0; key_F3_hold=0; }
-if (key_F3_pressed>0 || key_F3_hold>0) { key_F3_released=1; }}
-if ( key_F3_pressed==0 && key_F3_hold==0 && key_F3_released==0 ) { key_F3_status=0; }
-if ( key_F3_pressed==1  ) { key_F3_status=1; }
-if ( key_F3_hold==1     ) { key_F3_status=2; }
-if ( key_F3_released==1 ) { key_F3_status=3; }
-if (key[KEY_F4]) {
-if (key_F4_pressed==1 && key_F4_hold==0) { key_F4_hold=1; key_F4_pressed=0; }
-if (key_F4_pressed==0 && key_F4_hold==0) { key_F4_pressed=1; }}
-if (!key[KEY_F4]) {
-if (key_F4_released==1) { key_F4_released=0; key_F4_pressed=0; key_F4_hold=0; }
-if (key_F4_pressed>0 || key_F4_hold>0) { key_F4_released=1; }}
-if ( key_F4_pressed==0 && key_F4_hold==0 && key_F4_released==0 ) { key_F4_status=0; }
-if ( key_F4_pressed==1  ) { key_F4_status=1; }
-if ( key_F4_hold==1     ) { key_F4_status=2; }
-if ( key_F4_released==1 ) { key_F4_status=3; }
-//WASD sao utilizados no editor
-if (key[KEY_W]) {
-if (P[1].key_W_pressed==1 && P[1].key_W_hold==0) { P[1].key_W_hold=1; P[1].key_W_pressed=0; }
-if (P[1].key_W_pressed==0 && P[1].key_W_hold==0) { P[1].key_W_pressed=1; }}
-if (!key[KEY_W]) {
-if (P[1].key_W_released==1) { P[1].key_W_released=0; P[1].key_W_pressed=0; P[1].key_W_hold=0; }
-if (P[1].key_W_pressed>0 || P[1].key_W_hold>0) { P[1].key_W_released=1; }}
-if ( P[1].key_W_pressed==0 && P[1].key_W_hold==0 && P[1].key_W_released==0 ) { P[1].key_W_status=0; }
-if ( P[1].key_W_pressed==1  ) { P[1].key_W_status=1; }
-if ( P[1].key_W_hold==1     ) { P[1].key_W_status=2; }
-if ( P[1].key_W_released==1 ) { P[1].key_W_status=3; }
-if (key[KEY_S]) {
-if (P[1].key_S_pressed==1 && P[1].key_S_hold==0) { P[1].key_S_hold=1; P[1].key_S_pressed=0; }
-if (P[1].key_S_pressed==0 && P[1].key_S_hold==0) { P[1].key_S_pressed=1; }}
-if (!key[KEY_S]) {
-if (P[1].key_S_released==1) { P[1].key_S_released=0; P[1].key_S_pressed=0; P[1].key_S_hold=0; }
-if (P[1].key_S_pressed>0 || P[1].key_S_hold>0) { P[1].key_S_released=1; }}
-if ( P[1].key_S_pressed==0 && P[1].key_S_hold==0 && P[1].key_S_released==0 ) { P[1].key_S_status=0; }
-if ( P[1].key_S_pressed==1  ) { P[1].key_S_status=1; }
-if ( P[1].key_S_hold==1     ) { P[1].key_S_status=2; }
-if ( P[1].key_S_released==1 ) { P[1].key_S_status=3; }
-if (key[KEY_A]) {
-if (P[1].key_A_pressed==1 && P[1].key_A_hold==0) { P[1].key_A_hold=1; P[1].key_A_pressed=0; }
-if (P[1].key_A_pressed==0 && P[1].key_A_hold==0) { P[1].key_A_pressed=1; }}
-if (!key[KEY_A]) {
-if (P[1].key_A_released==1) { P[1].key_A_released=0; P[1].key_A_pressed=0; P[1].key_A_hold=0; }
-if (P[1].key_A_pressed>0 || P[1].key_A_hold>0) { P[1].key_A_released=1; }}
-if ( P[1].key_A_pressed==0 && P[1].key_A_hold==0 && P[1].key_A_released==0 ) { P[1].key_A_status=0; }
-if ( P[1].key_A_pressed==1  ) { P[1].key_A_status=1; }
-if ( P[1].key_A_hold==1     ) { P[1].key_A_status=2; }
-if ( P[1].key_A_released==1 ) { P[1].key_A_status=3; }
-if (key[KEY_D]) {
-if (P[1].key_D_pressed==1 && P[1].key_D_hold==0) { P[1].key_D_hold=1; P[1].key_D_pressed=0; }
-if (P[1].key_D_pressed==0 && P[1].key_D_hold==0) { P[1].key_D_pressed=1; }}
-if (!key[KEY_D]) {
-if (P[1].key_D_released==1) { P[1].key_D_released=0; P[1].key_D_pressed=0; P[1].key_D_hold=0; }
-if (P[1].key_D_pressed>0 || P[1].key_D_hold>0) { P[1].key_D_released=1; }}
-if ( P[1].key_D_pressed==0 && P[1].key_D_hold==0 && P[1].key_D_released==0 ) { P[1].key_D_status=0; }
-if ( P[1].key_D_pressed==1  ) { P[1].key_D_status=1; }
-if ( P[1].key_D_hold==1     ) { P[1].key_D_status=2; }
-if ( P[1].key_D_released==1 ) { P[1].key_D_status=3; }
+//teclas do sistema e mouse
+hamoopi_input_update(&TeclasSistema,
+(key[KEY_F1] ? 1u<<SIS_F1 : 0) | (key[KEY_F2] ? 1u<<SIS_F2 : 0) |
+(key[KEY_F3] ? 1u<<SIS_F3 : 0) | (key[KEY_F4] ? 1u<<SIS_F4 : 0) |
+(key[KEY_W]  ? 1u<<SIS_W  : 0) | (key[KEY_A]  ? 1u<<SIS_A  : 0) | //WASD sao utilizados no editor
+(key[KEY_S]  ? 1u<<SIS_S  : 0) | (key[KEY_D]  ? 1u<<SIS_D  : 0) |
+((mouse_b & 1) ? 1u<<SIS_MOUSE_L : 0) | ((mouse_b & 2) ? 1u<<SIS_MOUSE_R : 0));
 
 if(desabilita_players==0 && P[1].Pode_Mexer==1){
-if (P1_UP) {
-if (P[1].key_UP_pressed==1 && P[1].key_UP_hold==0) { P[1].key_UP_hold=1; P[1].key_UP_pressed=0; }
-if (P[1].key_UP_pressed==0 && P[1].key_UP_hold==0) { P[1].key_UP_pressed=1; }}
-if (!P1_UP) {
-if (P[1].key_UP_released==1) { P[1].key_UP_released=0; P[1].key_UP_pressed=0; P[1].key_UP_hold=0; }
-if (P[1].key_UP_pressed>0 || P[1].key_UP_hold>0) { P[1].key_UP_released=1; }}
-if ( P[1].key_UP_pressed==0 && P[1].key_UP_hold==0 && P[1].key_UP_released==0 ) { P[1].key_UP_status=0; }
-if ( P[1].key_UP_pressed==1  ) { P[1].key_UP_status=1; }
-if ( P[1].key_UP_hold==1     ) { P[1].key_UP_status=2; }
-if ( P[1].key_UP_released==1 ) { P[1].key_UP_status=3; }
-if (P1_DOWN) {
-if (P[1].key_DOWN_pressed==1 && P[1].key_DOWN_hold==0) { P[1].key_DOWN_hold=1; P[1].key_DOWN_pressed=0; }
-if (P[1].key_DOWN_pressed==0 && P[1].key_DOWN_hold==0) { P[1].key_DOWN_pressed=1; }}
-if (!P1_DOWN) {
-if (P[1].key_DOWN_released==1) { P[1].key_DOWN_released=0; P[1].key_DOWN_pressed=0; P[1].key_DOWN_hold=0; }
-if (P[1].key_DOWN_pressed>0 || P[1].key_DOWN_hold>0) { P[1].key_DOWN_released=1; }}
-if ( P[1].key_DOWN_pressed==0 && P[1].key_DOWN_hold==0 && P[1].key_DOWN_released==0 ) { P[1].key_DOWN_status=0; }
-if ( P[1].key_DOWN_pressed==1  ) { P[1].key_DOWN_status=1; }
-if ( P[1].key_DOWN_hold==1     ) { P[1].key_DOWN_status=2; }
-if ( P[1].key_DOWN_released==1 ) { P[1].key_DOWN_status=3; }
-if (P1_LEFT) {
-if (P[1].key_LEFT_pressed==1 && P[1].key_LEFT_hold==0) { P[1].key_LEFT_hold=1; P[1].key_LEFT_pressed=0; }
-if (P[1].key_LEFT_pressed==0 && P[1].key_LEFT_hold==0) { P[1].key_LEFT_pressed=1; }}
-if (!P1_LEFT) {
-if (P[1].key_LEFT_released==1) { P[1].key_LEFT_released=0; P[1].key_LEFT_pressed=0; P[1].key_LEFT_hold=0; }
-if (P[1].key_LEFT_pressed>0 || P[1].key_LEFT_hold>0) { P[1].key_LEFT_released=1; }}
-if ( P[1].key_LEFT_pressed==0 && P[1].key_LEFT_hold==0 && P[1].key_LEFT_released==0 ) { P[1].key_LEFT_status=0; }
-if ( P[1].key_LEFT_pressed==1  ) { P[1].key_LEFT_status=1; }
-if ( P[1].key_LEFT_hold==1     ) { P[1].key_LEFT_status=2; }
-if ( P[1].key_LEFT_released==1 ) { P[1].key_LEFT_status=3; }
-if (P1_RIGHT) {
-if (P[1].key_RIGHT_pressed==1 && P[1].key_RIGHT_hold==0) { P[1].key_RIGHT_hold=1; P[1].key_RIGHT_pressed=0; }
-if (P[1].key_RIGHT_pressed==0 && P[1].key_RIGHT_hold==0) { P[1].key_RIGHT_pressed=1; }}
-if (!P1_RIGHT) {
-if (P[1].key_RIGHT_released==1) { P[1].key_RIGHT_released=0; P[1].key_RIGHT_pressed=0; P[1].key_RIGHT_hold=0; }
-if (P[1].key_RIGHT_pressed>0 || P[1].key_RIGHT_hold>0) { P[1].key_RIGHT_released=1; }}
-if ( P[1].key_RIGHT_pressed==0 && P[1].key_RIGHT_hold==0 && P[1].key_RIGHT_released==0 ) { P[1].key_RIGHT_status=0; }
-if ( P[1].key_RIGHT_pressed==1  ) { P[1].key_RIGHT_status=1; }
-if ( P[1].key_RIGHT_hold==1     ) { P[1].key_RIGHT_status=2; }
-if ( P[1].key_RIGHT_released==1 ) { P[1].key_RIGHT_status=3; }
-if (P1_BT1) {
-if (P[1].key_BT1_pressed==1 && P[1].key_BT1_hold==0) { P[1].key_BT1_hold=1; P[1].key_BT1_pressed=0; }
-if (P[1].key_BT1_pressed==0 && P[1].key_BT1_hold==0) { P[1].key_BT1_pressed=1; }}
-if (!P1_BT1) {
-if (P[1].key_BT1_released==1) { P[1].key_BT1_released=0; P[1].key_BT1_pressed=0; P[1].key_BT1_hold=0; }
-if (P[1].key_BT1_pressed>0 || P[1].key_BT1_hold>0) { P[1].key_BT1_released=1; }}
-if ( P[1].key_BT1_pressed==0 && P[1].key_BT1_hold==0 && P[1].key_BT1_released==0 ) { P[1].key_BT1_status=0; }
-if ( P[1].key_BT1_pressed==1  ) { P[1].key_BT1_status=1; }
-if ( P[1].key_BT1_hold==1     ) { P[1].key_BT1_status=2; }
-if ( P[1].key_BT1_released==1 ) { P[1].key_BT1_status=3; }
-if (P1_BT2) {
-if (P[1].key_BT2_pressed==1 && P[1].key_BT2_hold==0) { P[1].key_BT2_hold=1; P[1].key_BT2_pressed=0; }
-if (P[1].key_BT2_pressed==0 && P[1].key_BT2_hold==0) { P[1].key_BT2_pressed=1; }}
-if (!P1_BT2) {
-if (P[1].key_BT2_released==1) { P[1].key_BT2_released=0; P[1].key_BT2_pressed=0; P[1].key_BT2_hold=0; }
-if (P[1].key_BT2_pressed>0 || P[1].key_BT2_hold>0) { P[1].key_BT2_released=1; }}
-if ( P[1].key_BT2_pressed==0 && P[1].key_BT2_hold==0 && P[1].key_BT2_released==0 ) { P[1].key_BT2_status=0; }
-if ( P[1].key_BT2_pressed==1  ) { P[1].key_BT2_status=1; }
-if ( P[1].key_BT2_hold==1     ) { P[1].key_BT2_status=2; }
-if ( P[1].key_BT2_released==1 ) { P[1].key_BT2_status=3; }
-if (P1_BT3) {
-if (P[1].key_BT3_pressed==1 && P[1].key_BT3_hold==0) { P[1].key_BT3_hold=1; P[1].key_BT3_pressed=0; }
-if (P[1].key_BT3_pressed==0 && P[1].key_BT3_hold==0) { P[1].key_BT3_pressed=1; }}
-if (!P1_BT3) {
-if (P[1].key_BT3_released==1) { P[1].key_BT3_released=0; P[1].key_BT3_pressed=0; P[1].key_BT3_hold=0; }
-if (P[1].key_BT3_pressed>0 || P[1].key_BT3_hold>0) { P[1].key_BT3_released=1; }}
-if ( P[1].key_BT3_pressed==0 && P[1].key_BT3_hold==0 && P[1].key_BT3_released==0 ) { P[1].key_BT3_status=0; }
-if ( P[1].key_BT3_pressed==1  ) { P[1].key_BT3_status=1; }
-if ( P[1].key_BT3_hold==1     ) { P[1].key_BT3_status=2; }
-if ( P[1].key_BT3_released==1 ) { P[1].key_BT3_status=3; }
-if (P1_BT4) {
-if (P[1].key_BT4_pressed==1 && P[1].key_BT4_hold==0) { P[1].key_BT4_hold=1; P[1].key_BT4_pressed=0; }
-if (P[1].key_BT4_pressed==0 && P[1].key_BT4_hold==0) { P[1].key_BT4_pressed=1; }}
-if (!P1_BT4) {
-if (P[1].key_BT4_released==1) { P[1].key_BT4_released=0; P[1].key_BT4_pressed=0; P[1].key_BT4_hold=0; }
-if (P[1].key_BT4_pressed>0 || P[1].key_BT4_hold>0) { P[1].key_BT4_released=1; }}
-if ( P[1].key_BT4_pressed==0 && P[1].key_BT4_hold==0 && P[1].key_BT4_released==0 ) { P[1].key_BT4_status=0; }
-if ( P[1].key_BT4_pressed==1  ) { P[1].key_BT4_status=1; }
-if ( P[1].key_BT4_hold==1     ) { P[1].key_BT4_status=2; }
-if ( P[1].key_BT4_released==1 ) { P[1].key_BT4_status=3; }
-if (P1_BT5) {
-if (P[1].key_BT5_pressed==1 && P[1].key_BT5_hold==0) { P[1].key_BT5_hold=1; P[1].key_BT5_pressed=0; }
-if (P[1].key_BT5_pressed==0 && P[1].key_BT5_hold==0) { P[1].key_BT5_pressed=1; }}
-if (!P1_BT5) {
-if (P[1].key_BT5_released==1) { P[1].key_BT5_released=0; P[1].key_BT5_pressed=0; P[1].key_BT5_hold=0; }
-if (P[1].key_BT5_pressed>0 || P[1].key_BT5_hold>0) { P[1].key_BT5_released=1; }}
-if ( P[1].key_BT5_pressed==0 && P[1].key_BT5_hold==0 && P[1].key_BT5_released==0 ) { P[1].key_BT5_status=0; }
-if ( P[1].key_BT5_pressed==1  ) { P[1].key_BT5_status=1; }
-if ( P[1].key_BT5_hold==1     ) { P[1].key_BT5_status=2; }
-if ( P[1].key_BT5_released==1 ) { P[1].key_BT5_status=3; }
-if (P1_BT6) {
-if (P[1].key_BT6_pressed==1 && P[1].key_BT6_hold==0) { P[1].key_BT6_hold=1; P[1].key_BT6_pressed=0; }
-if (P[1].key_BT6_pressed==0 && P[1].key_BT6_hold==0) { P[1].key_BT6_pressed=1; }}
-if (!P1_BT6) {
-if (P[1].key_BT6_released==1) { P[1].key_BT6_released=0; P[1].key_BT6_pressed=0; P[1].key_BT6_hold=0; }
-if (P[1].key_BT6_pressed>0 || P[1].key_BT6_hold>0) { P[1].key_BT6_released=1; }}
-if ( P[1].key_BT6_pressed==0 && P[1].key_BT6_hold==0 && P[1].key_BT6_released==0 ) { P[1].key_BT6_status=0; }
-if ( P[1].key_BT6_pressed==1  ) { P[1].key_BT6_status=1; }
-if ( P[1].key_BT6_hold==1     ) { P[1].key_BT6_status=2; }
-if ( P[1].key_BT6_released==1 ) { P[1].key_BT6_status=3; }
-if (P1_SELECT) {
-if (P[1].key_SELECT_pressed==1 && P[1].key_SELECT_hold==0) { P[1].key_SELECT_hold=1; P[1].key_SELECT_pressed=0; }
-if (P[1].key_SELECT_pressed==0 && P[1].key_SELECT_hold==0) { P[1].key_SELECT_pressed=1; }}
-if (!P1_SELECT) {
-if (P[1].key_SELECT_released==1) { P[1].key_SELECT_released=0; P[1].key_SELECT_pressed=0; P[1].key_SELECT_hold=0; }
-if (P[1].key_SELECT_pressed>0 || P[1].key_SELECT_hold>0) { P[1].key_SELECT_released=1; }}
-if ( P[1].key_SELECT_pressed==0 && P[1].key_SELECT_hold==0 && P[1].key_SELECT_released==0 ) { P[1].key_SELECT_status=0; }
-if ( P[1].key_SELECT_pressed==1  ) { P[1].key_SELECT_status=1; }
-if ( P[1].key_SELECT_hold==1     ) { P[1].key_SELECT_status=2; }
-if ( P[1].key_SELECT_released==1 ) { P[1].key_SELECT_status=3; }
-if (P1_START) {
-if (P[1].key_START_pressed==1 && P[1].key_START_hold==0) { P[1].key_START_hold=1; P[1].key_START_pressed=0; }
-if (P[1].key_START_pressed==0 && P[1].key_START_hold==0) { P[1].key_START_pressed=1; }}
-if (!P1_START) {
-if (P[1].key_START_released==1) { P[1].key_START_released=0; P[1].key_START_pressed=0; P[1].key_START_hold=0; }
-if (P[1].key_START_pressed>0 || P[1].key_START_hold>0) { P[1].key_START_released=1; }}
-if ( P[1].key_START_pressed==0 && P[1].key_START_hold==0 && P[1].key_START_released==0 ) { P[1].key_START_status=0; }
-if ( P[1].key_START_pressed==1  ) { P[1].key_START_status=1; }
-if ( P[1].key_START_hold==1     ) { P[1].key_START_status=2; }
-if ( P[1].key_START_released==1 ) { P[1].key_START_status=3; }
+hamoopi_input_update(&P[1].Teclas, hamoopi_input_from_keys(key, TeclasP1, TOTAL_TECLAS));
 
 /*ABASTECE SLOTS*/
-if (P[1].key_UP_status==1 || P[1].key_DOWN_status==1 || P[1].key_LEFT_status==1 || P[1].key_RIGHT_status==1
-or P[1].key_BT1_status==1 || P[1].key_BT2_status==1 || P[1].key_BT3_status==1
-or P[1].key_BT4_status==1 || P[1].key_BT5_status==1 || P[1].key_BT6_status==1
-or P[1].key_SELECT_status==1 || P[1].key_START_status==1)
+if (hamoopi_input_pressed_mask(&P[1].Teclas)!=0)
 {
 char StrBotoes[8]="";
 int a=0; int b=0; int c=0; int d=0;
 int e=0; int f=0; int g=0; int h=0;
 MovSlots_P1();
-if (P[1].key_UP_status     ==1 && P[1].key_LEFT_status==0 && P[1].key_RIGHT_status==0) { P[1].slot[1]= 8; }
-if (P[1].key_DOWN_status   ==1 && P[1].key_LEFT_status==0 && P[1].key_RIGHT_status==0) { P[1].slot[1]= 2; }
-if (P[1].key_LEFT_status   ==1 && P[1].key_DOWN_status==0 && P[1].key_UP_status   ==0) { P[1].slot[1]= 4; }
-if (P[1].key_RIGHT_status  ==1 && P[1].key_DOWN_status==0 && P[1].key_UP_status   ==0) { P[1].slot[1]= 6; }
-if (P[1].key_BT1_status    ==1) { P[1].bt_slot[1]=1; a=1; }
-if (P[1].key_BT2_status    ==1) { P[1].bt_slot[1]=2; b=1; }
-if (P[1].key_BT3_status    ==1) { P[1].bt_slot[1]=3; c=1; }
-if (P[1].key_BT4_status    ==1) { P[1].bt_slot[1]=4; d=1; }
-if (P[1].key_BT5_status    ==1) { P[1].bt_slot[1]=5; e=1; }
-if (P[1].key_BT6_status    ==1) { P[1].bt_slot[1]=6; f=1; }
-if (P[1].key_SELECT_status ==1) { P[1].bt_slot[1]=7; g=1; }
-if (P[1].key_START_status  ==1) { P[1].bt_slot[1]=8; h=1; }
-if (P[1].key_BT1_status==1 || P[1].key_BT2_status==1 || P[1].key_BT3_status==1 || P[1].key_BT4_status==1
-or P[1].key_BT5_status==1 || P[1].key_BT6_status==1 || P[1].key_SELECT_status==1 || P[1].key_START_status==1)
+if (hamoopi_input_status(&P[1].Teclas, TECLA_UP)     ==1 && hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)==0 && hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT)==0) { P[1].slot[1]= 8; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)   ==1 && hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)==0 && hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT)==0) { P[1].slot[1]= 2; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)   ==1 && hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)==0 && hamoopi_input_status(&P[1].Teclas, TECLA_UP)   ==0) { P[1].slot[1]= 4; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT)  ==1 && hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)==0 && hamoopi_input_status(&P[1].Teclas, TECLA_UP)   ==0) { P[1].slot[1]= 6; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_BT1)    ==1) { P[1].bt_slot[1]=1; a=1; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_BT2)    ==1) { P[1].bt_slot[1]=2; b=1; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_BT3)    ==1) { P[1].bt_slot[1]=3; c=1; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_BT4)    ==1) { P[1].bt_slot[1]=4; d=1; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_BT5)    ==1) { P[1].bt_slot[1]=5; e=1; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_BT6)    ==1) { P[1].bt_slot[1]=6; f=1; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_SELECT) ==1) { P[1].bt_slot[1]=7; g=1; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_START)  ==1) { P[1].bt_slot[1]=8; h=1; }
+if ((hamoopi_input_pressed_mask(&P[1].Teclas) >> TECLA_BT1)!=0) //algum botao (BT1..START) pressionado
 {
 if (a==1) { strcat(StrBotoes, "1"); } P[1].bt_slot[1] = atoi(StrBotoes);
 if (b==1) { strcat(StrBotoes, "2"); } P[1].bt_slot[1] = atoi(StrBotoes);
@@ -7611,28 +7561,28 @@ if (f==1) { strcat(StrBotoes, "6"); } P[1].bt_slot[1] = atoi(StrBotoes);
 if (g==1) { strcat(StrBotoes, "7"); } P[1].bt_slot[1] = atoi(StrBotoes);
 if (h==1) { strcat(StrBotoes, "8"); } P[1].bt_slot[1] = atoi(StrBotoes);
 }
-if (P[1].key_LEFT_status  ==1 && P[1].key_UP_status    ==1) { P[1].slot[1]=7; }
-if (P[1].key_UP_status    ==1 && P[1].key_RIGHT_status ==1) { P[1].slot[1]=9; }
-if (P[1].key_RIGHT_status ==1 && P[1].key_DOWN_status  ==1) { P[1].slot[1]=3; }
-if (P[1].key_DOWN_status  ==1 && P[1].key_LEFT_status  ==1) { P[1].slot[1]=1; }
-if (P[1].key_DOWN_status   >1 && P[1].key_RIGHT_status ==1) { P[1].slot[1]=3; }
-if (P[1].key_RIGHT_status  >1 && P[1].key_DOWN_status  ==1) { P[1].slot[1]=3; }
-if (P[1].key_DOWN_status   >1 && P[1].key_LEFT_status  ==1) { P[1].slot[1]=1; }
-if (P[1].key_LEFT_status   >1 && P[1].key_DOWN_status  ==1) { P[1].slot[1]=1; }
-if (P[1].key_UP_status     >1 && P[1].key_RIGHT_status ==1) { P[1].slot[1]=9; }
-if (P[1].key_RIGHT_status  >1 && P[1].key_UP_status    ==1) { P[1].slot[1]=9; }
-if (P[1].key_UP_status     >1 && P[1].key_LEFT_status  ==1) { P[1].slot[1]=7; }
-if (P[1].key_LEFT_status   >1 && P[1].key_UP_status    ==1) { P[1].slot[1]=7; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)  ==1 && hamoopi_input_status(&P[1].Teclas, TECLA_UP)    ==1) { P[1].slot[1]=7; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_UP)    ==1 && hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT) ==1) { P[1].slot[1]=9; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT) ==1 && hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)  ==1) { P[1].slot[1]=3; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)  ==1 && hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)  ==1) { P[1].slot[1]=1; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)   >1 && hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT) ==1) { P[1].slot[1]=3; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT)  >1 && hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)  ==1) { P[1].slot[1]=3; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)   >1 && hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)  ==1) { P[1].slot[1]=1; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)   >1 && hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)  ==1) { P[1].slot[1]=1; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_UP)     >1 && hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT) ==1) { P[1].slot[1]=9; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT)  >1 && hamoopi_input_status(&P[1].Teclas, TECLA_UP)    ==1) { P[1].slot[1]=9; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_UP)     >1 && hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)  ==1) { P[1].slot[1]=7; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)   >1 && hamoopi_input_status(&P[1].Teclas, TECLA_UP)    ==1) { P[1].slot[1]=7; }
 P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0;
 }
-if (P[1].key_DOWN_status  ==3 && P[1].key_RIGHT_status>1) { MovSlots_P1(); P[1].slot[1]=6; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
-if (P[1].key_DOWN_status  ==3 && P[1].key_LEFT_status >1) { MovSlots_P1(); P[1].slot[1]=4; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
-if (P[1].key_RIGHT_status ==3 && P[1].key_DOWN_status >1) { MovSlots_P1(); P[1].slot[1]=2; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
-if (P[1].key_LEFT_status  ==3 && P[1].key_DOWN_status >1) { MovSlots_P1(); P[1].slot[1]=2; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
-if (P[1].key_UP_status    ==3 && P[1].key_RIGHT_status>1) { MovSlots_P1(); P[1].slot[1]=6; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
-if (P[1].key_UP_status    ==3 && P[1].key_LEFT_status >1) { MovSlots_P1(); P[1].slot[1]=4; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
-if (P[1].key_RIGHT_status ==3 && P[1].key_UP_status   >1) { MovSlots_P1(); P[1].slot[1]=8; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
-if (P[1].key_LEFT_status  ==3 && P[1].key_UP_status   >1) { MovSlots_P1(); P[1].slot[1]=8; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)  ==3 && hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT)>1) { MovSlots_P1(); P[1].slot[1]=6; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_DOWN)  ==3 && hamoopi_input_status(&P[1].Teclas, TECLA_LEFT) >1) { MovSlots_P1(); P[1].slot[1]=4; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT) ==3 && hamoopi_input_status(&P[1].Teclas, TECLA_DOWN) >1) { MovSlots_P1(); P[1].slot[1]=2; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)  ==3 && hamoopi_input_status(&P[1].Teclas, TECLA_DOWN) >1) { MovSlots_P1(); P[1].slot[1]=2; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_UP)    ==3 && hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT)>1) { MovSlots_P1(); P[1].slot[1]=6; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_UP)    ==3 && hamoopi_input_status(&P[1].Teclas, TECLA_LEFT) >1) { MovSlots_P1(); P[1].slot[1]=4; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_RIGHT) ==3 && hamoopi_input_status(&P[1].Teclas, TECLA_UP)   >1) { MovSlots_P1(); P[1].slot[1]=8; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
+if (hamoopi_input_status(&P[1].Teclas, TECLA_LEFT)  ==3 && hamoopi_input_status(&P[1].Teclas, TECLA_UP)   >1) { MovSlots_P1(); P[1].slot[1]=8; P[1].t_slot[1]=P[1].ticks_4slot; P[1].ticks_4slot=0; }
 if (P[1].t_slot[1]>999) { P[1].t_slot[1]=999; }
 }
 }
@@ -7640,151 +7590,28 @@ if (P[1].t_slot[1]>999) { P[1].t_slot[1]=999; }
 void check_keys_P2()
 {
 if(desabilita_players==0 && P[2].Pode_Mexer==1){
-if (P2_UP) {
-if (P[2].key_UP_pressed==1 && P[2].key_UP_hold==0) { P[2].key_UP_hold=1; P[2].key_UP_pressed=0; }
-if (P[2].key_UP_pressed==0 && P[2].key_UP_hold==0) { P[2].key_UP_pressed=1; }}
-if (!P2_UP) {
-if (P[2].key_UP_released==1) { P[2].key_UP_released=0; P[2].key_UP_pressed=0; P[2].key_UP_hold=0; }
-if (P[2].key_UP_pressed>0 || P[2].key_UP_hold>0) { P[2].key_UP_released=1; }}
-if ( P[2].key_UP_pressed==0 && P[2].key_UP_hold==0 && P[2].key_UP_released==0 ) { P[2].key_UP_status=0; }
-if ( P[2].key_UP_pressed==1  ) { P[2].key_UP_status=1; }
-if ( P[2].key_UP_hold==1     ) { P[2].key_UP_status=2; }
-if ( P[2].key_UP_released==1 ) { P[2].key_UP_status=3; }
-if (P2_DOWN) {
-if (P[2].key_DOWN_pressed==1 && P[2].key_DOWN_hold==0) { P[2].key_DOWN_hold=1; P[2].key_DOWN_pressed=0; }
-if (P[2].key_DOWN_pressed==0 && P[2].key_DOWN_hold==0) { P[2].key_DOWN_pressed=1; }}
-if (!P2_DOWN) {
-if (P[2].key_DOWN_released==1) { P[2].key_DOWN_released=0; P[2].key_DOWN_pressed=0; P[2].key_DOWN_hold=0; }
-if (P[2].key_DOWN_pressed>0 || P[2].key_DOWN_hold>0) { P[2].key_DOWN_released=1; }}
-if ( P[2].key_DOWN_pressed==0 && P[2].key_DOWN_hold==0 && P[2].key_DOWN_released==0 ) { P[2].key_DOWN_status=0; }
-if ( P[2].key_DOWN_pressed==1  ) { P[2].key_DOWN_status=1; }
-if ( P[2].key_DOWN_hold==1     ) { P[2].key_DOWN_status=2; }
-if ( P[2].key_DOWN_released==1 ) { P[2].key_DOWN_status=3; }
-if (P2_LEFT) {
-if (P[2].key_LEFT_pressed==1 && P[2].key_LEFT_hold==0) { P[2].key_LEFT_hold=1; P[2].key_LEFT_pressed=0; }
-if (P[2].key_LEFT_pressed==0 && P[2].key_LEFT_hold==0) { P[2].key_LEFT_pressed=1; }}
-if (!P2_LEFT) {
-if (P[2].key_LEFT_released==1) { P[2].key_LEFT_released=0; P[2].key_LEFT_pressed=0; P[2].key_LEFT_hold=0; }
-if (P[2].key_LEFT_pressed>0 || P[2].key_LEFT_hold>0) { P[2].key_LEFT_released=1; }}
-if ( P[2].key_LEFT_pressed==0 && P[2].key_LEFT_hold==0 && P[2].key_LEFT_released==0 ) { P[2].key_LEFT_status=0; }
-if ( P[2].key_LEFT_pressed==1  ) { P[2].key_LEFT_status=1; }
-if ( P[2].key_LEFT_hold==1     ) { P[2].key_LEFT_status=2; }
-if ( P[2].key_LEFT_released==1 ) { P[2].key_LEFT_status=3; }
-if (P2_RIGHT) {
-if (P[2].key_RIGHT_pressed==1 && P[2].key_RIGHT_hold==0) { P[2].key_RIGHT_hold=1; P[2].key_RIGHT_pressed=0; }
-if (P[2].key_RIGHT_pressed==0 && P[2].key_RIGHT_hold==0) { P[2].key_RIGHT_pressed=1; }}
-if (!P2_RIGHT) {
-if (P[2].key_RIGHT_released==1) { P[2].key_RIGHT_released=0; P[2].key_RIGHT_pressed=0; P[2].key_RIGHT_hold=0; }
-if (P[2].key_RIGHT_pressed>0 || P[2].key_RIGHT_hold>0) { P[2].key_RIGHT_released=1; }}
-if ( P[2].key_RIGHT_pressed==0 && P[2].key_RIGHT_hold==0 && P[2].key_RIGHT_released==0 ) { P[2].key_RIGHT_status=0; }
-if ( P[2].key_RIGHT_pressed==1  ) { P[2].key_RIGHT_status=1; }
-if ( P[2].key_RIGHT_hold==1     ) { P[2].key_RIGHT_status=2; }
-if ( P[2].key_RIGHT_released==1 ) { P[2].key_RIGHT_status=3; }
-if (P2_BT1) {
-if (P[2].key_BT1_pressed==1 && P[2].key_BT1_hold==0) { P[2].key_BT1_hold=1; P[2].key_BT1_pressed=0; }
-if (P[2].key_BT1_pressed==0 && P[2].key_BT1_hold==0) { P[2].key_BT1_pressed=1; }}
-if (!P2_BT1) {
-if (P[2].key_BT1_released==1) { P[2].key_BT1_released=0; P[2].key_BT1_pressed=0; P[2].key_BT1_hold=0; }
-if (P[2].key_BT1_pressed>0 || P[2].key_BT1_hold>0) { P[2].key_BT1_released=1; }}
-if ( P[2].key_BT1_pressed==0 && P[2].key_BT1_hold==0 && P[2].key_BT1_released==0 ) { P[2].key_BT1_status=0; }
-if ( P[2].key_BT1_pressed==1  ) { P[2].key_BT1_status=1; }
-if ( P[2].key_BT1_hold==1     ) { P[2].key_BT1_status=2; }
-if ( P[2].key_BT1_released==1 ) { P[2].key_BT1_status=3; }
-if (P2_BT2) {
-if (P[2].key_BT2_pressed==1 && P[2].key_BT2_hold==0) { P[2].key_BT2_hold=1; P[2].key_BT2_pressed=0; }
-if (P[2].key_BT2_pressed==0 && P[2].key_BT2_hold==0) { P[2].key_BT2_pressed=1; }}
-if (!P2_BT2) {
-if (P[2].key_BT2_released==1) { P[2].key_BT2_released=0; P[2].key_BT2_pressed=0; P[2].key_BT2_hold=0; }
-if (P[2].key_BT2_pressed>0 || P[2].key_BT2_hold>0) { P[2].key_BT2_released=1; }}
-if ( P[2].key_BT2_pressed==0 && P[2].key_BT2_hold==0 && P[2].key_BT2_released==0 ) { P[2].key_BT2_status=0; }
-if ( P[2].key_BT2_pressed==1  ) { P[2].key_BT2_status=1; }
-if ( P[2].key_BT2_hold==1     ) { P[2].key_BT2_status=2; }
-if ( P[2].key_BT2_released==1 ) { P[2].key_BT2_status=3; }
-if (P2_BT3) {
-if (P[2].key_BT3_pressed==1 && P[2].key_BT3_hold==0) { P[2].key_BT3_hold=1; P[2].key_BT3_pressed=0; }
-if (P[2].key_BT3_pressed==0 && P[2].key_BT3_hold==0) { P[2].key_BT3_pressed=1; }}
-if (!P2_BT3) {
-if (P[2].key_BT3_released==1) { P[2].key_BT3_released=0; P[2].key_BT3_pressed=0; P[2].key_BT3_hold=0; }
-if (P[2].key_BT3_pressed>0 || P[2].key_BT3_hold>0) { P[2].key_BT3_released=1; }}
-if ( P[2].key_BT3_pressed==0 && P[2].key_BT3_hold==0 && P[2].key_BT3_released==0 ) { P[2].key_BT3_status=0; }
-if ( P[2].key_BT3_pressed==1  ) { P[2].key_BT3_status=1; }
-if ( P[2].key_BT3_hold==1     ) { P[2].key_BT3_status=2; }
-if ( P[2].key_BT3_released==1 ) { P[2].key_BT3_status=3; }
-if (P2_BT4) {
-if (P[2].key_BT4_pressed==1 && P[2].key_BT4_hold==0) { P[2].key_BT4_hold=1; P[2].key_BT4_pressed=0; }
-if (P[2].key_BT4_pressed==0 && P[2].key_BT4_hold==0) { P[2].key_BT4_pressed=1; }}
-if (!P2_BT4) {
-if (P[2].key_BT4_released==1) { P[2].key_BT4_released=0; P[2].key_BT4_pressed=0; P[2].key_BT4_hold=0; }
-if (P[2].key_BT4_pressed>0 || P[2].key_BT4_hold>0) { P[2].key_BT4_released=1; }}
-if ( P[2].key_BT4_pressed==0 && P[2].key_BT4_hold==0 && P[2].key_BT4_released==0 ) { P[2].key_BT4_status=0; }
-if ( P[2].key_BT4_pressed==1  ) { P[2].key_BT4_status=1; }
-if ( P[2].key_BT4_hold==1     ) { P[2].key_BT4_status=2; }
-if ( P[2].key_BT4_released==1 ) { P[2].key_BT4_status=3; }
-if (P2_BT5) {
-if (P[2].key_BT5_pressed==1 && P[2].key_BT5_hold==0) { P[2].key_BT5_hold=1; P[2].key_BT5_pressed=0; }
-if (P[2].key_BT5_pressed==0 && P[2].key_BT5_hold==0) { P[2].key_BT5_pressed=1; }}
-if (!P2_BT5) {
-if (P[2].key_BT5_released==1) { P[2].key_BT5_released=0; P[2].key_BT5_pressed=0; P[2].key_BT5_hold=0; }
-if (P[2].key_BT5_pressed>0 || P[2].key_BT5_hold>0) { P[2].key_BT5_released=1; }}
-if ( P[2].key_BT5_pressed==0 && P[2].key_BT5_hold==0 && P[2].key_BT5_released==0 ) { P[2].key_BT5_status=0; }
-if ( P[2].key_BT5_pressed==1  ) { P[2].key_BT5_status=1; }
-if ( P[2].key_BT5_hold==1     ) { P[2].key_BT5_status=2; }
-if ( P[2].key_BT5_released==1 ) { P[2].key_BT5_status=3; }
-if (P2_BT6) {
-if (P[2].key_BT6_pressed==1 && P[2].key_BT6_hold==0) { P[2].key_BT6_hold=1; P[2].key_BT6_pressed=0; }
-if (P[2].key_BT6_pressed==0 && P[2].key_BT6_hold==0) { P[2].key_BT6_pressed=1; }}
-if (!P2_BT6) {
-if (P[2].key_BT6_released==1) { P[2].key_BT6_released=0; P[2].key_BT6_pressed=0; P[2].key_BT6_hold=0; }
-if (P[2].key_BT6_pressed>0 || P[2].key_BT6_hold>0) { P[2].key_BT6_released=1; }}
-if ( P[2].key_BT6_pressed==0 && P[2].key_BT6_hold==0 && P[2].key_BT6_released==0 ) { P[2].key_BT6_status=0; }
-if ( P[2].key_BT6_pressed==1  ) { P[2].key_BT6_status=1; }
-if ( P[2].key_BT6_hold==1     ) { P[2].key_BT6_status=2; }
-if ( P[2].key_BT6_released==1 ) { P[2].key_BT6_status=3; }
-if (P2_SELECT) {
-if (P[2].key_SELECT_pressed==1 && P[2].key_SELECT_hold==0) { P[2].key_SELECT_hold=1; P[2].key_SELECT_pressed=0; }
-if (P[2].key_SELECT_pressed==0 && P[2].key_SELECT_hold==0) { P[2].key_SELECT_pressed=1; }}
-if (!P2_SELECT) {
-if (P[2].key_SELECT_released==1) { P[2].key_SELECT_released=0; P[2].key_SELECT_pressed=0; P[2].key_SELECT_hold=0; }
-if (P[2].key_SELECT_pressed>0 || P[2].key_SELECT_hold>0) { P[2].key_SELECT_released=1; }}
-if ( P[2].key_SELECT_pressed==0 && P[2].key_SELECT_hold==0 && P[2].key_SELECT_released==0 ) { P[2].key_SELECT_status=0; }
-if ( P[2].key_SELECT_pressed==1  ) { P[2].key_SELECT_status=1; }
-if ( P[2].key_SELECT_hold==1     ) { P[2].key_SELECT_status=2; }
-if ( P[2].key_SELECT_released==1 ) { P[2].key_SELECT_status=3; }
-if (P2_START) {
-if (P[2].key_START_pressed==1 && P[2].key_START_hold==0) { P[2].key_START_hold=1; P[2].key_START_pressed=0; }
-if (P[2].key_START_pressed==0 && P[2].key_START_hold==0) { P[2].key_START_pressed=1; }}
-if (!P2_START) {
-if (P[2].key_START_released==1) { P[2].key_START_released=0; P[2].key_START_pressed=0; P[2].key_START_hold=0; }
-if (P[2].key_START_pressed>0 || P[2].key_START_hold>0) { P[2].key_START_released=1; }}
-if ( P[2].key_START_pressed==0 && P[2].key_START_hold==0 && P[2].key_START_released==0 ) { P[2].key_START_status=0; }
-if ( P[2].key_START_pressed==1  ) { P[2].key_START_status=1; }
-if ( P[2].key_START_hold==1     ) { P[2].key_START_status=2; }
-if ( P[2].key_START_released==1 ) { P[2].key_START_status=3; }
+hamoopi_input_update(&P[2].Teclas, hamoopi_input_from_keys(key, TeclasP2, TOTAL_TECLAS));
 
 /*ABASTECE SLOTS*/
-if (P[2].key_UP_status==1 || P[2].key_DOWN_status==1 || P[2].key_LEFT_status==1 || P[2].key_RIGHT_status==1
-or P[2].key_BT1_status==1 || P[2].key_BT2_status==1 || P[2].key_BT3_status==1
-or P[2].key_BT4_status==1 || P[2].key_BT5_status==1 || P[2].key_BT6_status==1
-or P[2].key_SELECT_status==1 || P[2].key_START_status==1)
+if (hamoopi_input_pressed_mask(&P[2].Teclas)!=0)
 {
 char StrBotoes[8]="";
 int a=0; int b=0; int c=0; int d=0;
 int e=0; int f=0; int g=0; int h=0;
 MovSlots_P2();
-if (P[2].key_UP_status     ==1 && P[2].key_LEFT_status==0 && P[2].key_RIGHT_status==0) { P[2].slot[1]= 8; }
-if (P[2].key_DOWN_status   ==1 && P[2].key_LEFT_status==0 && P[2].key_RIGHT_status==0) { P[2].slot[1]= 2; }
-if (P[2].key_LEFT_status   ==1 && P[2].key_DOWN_status==0 && P[2].key_UP_status   ==0) { P[2].slot[1]= 4; }
-if (P[2].key_RIGHT_status  ==1 && P[2].key_DOWN_status==0 && P[2].key_UP_status   ==0) { P[2].slot[1]= 6; }
-if (P[2].key_BT1_status    ==1) { P[2].bt_slot[1]=1; a=1; }
-if (P[2].key_BT2_status    ==1) { P[2].bt_slot[1]=2; b=1; }
-if (P[2].key_BT3_status    ==1) { P[2].bt_slot[1]=3; c=1; }
-if (P[2].key_BT4_status    ==1) { P[2].bt_slot[1]=4; d=1; }
-if (P[2].key_BT5_status    ==1) { P[2].bt_slot[1]=5; e=1; }
-if (P[2].key_BT6_status    ==1) { P[2].bt_slot[1]=6; f=1; }
-if (P[2].key_SELECT_status ==1) { P[2].bt_slot[1]=7; g=1; }
-if (P[2].key_START_status  ==1) { P[2].bt_slot[1]=8; h=1; }
-if (P[2].key_BT1_status==1 || P[2].key_BT2_status==1 || P[2].key_BT3_status==1 || P[2].key_BT4_status==1
-or P[2].key_BT5_status==1 || P[2].key_BT6_status==1 || P[2].key_SELECT_status==1 || P[2].key_START_status==1)
+if (hamoopi_input_status(&P[2].Teclas, TECLA_UP)     ==1 && hamoopi_input_status(&P[2].Teclas, TECLA_LEFT)==0 && hamoopi_input_status(&P[2].Teclas, TECLA_RIGHT)==0) { P[2].slot[1]= 8; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_DOWN)   ==1 && hamoopi_input_status(&P[2].Teclas, TECLA_LEFT)==0 && hamoopi_input_status(&P[2].Teclas, TECLA_RIGHT)==0) { P[2].slot[1]= 2; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_LEFT)   ==1 && hamoopi_input_status(&P[2].Teclas, TECLA_DOWN)==0 && hamoopi_input_status(&P[2].Teclas, TECLA_UP)   ==0) { P[2].slot[1]= 4; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_RIGHT)  ==1 && hamoopi_input_status(&P[2].Teclas, TECLA_DOWN)==0 && hamoopi_input_status(&P[2].Teclas, TECLA_UP)   ==0) { P[2].slot[1]= 6; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_BT1)    ==1) { P[2].bt_slot[1]=1; a=1; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_BT2)    ==1) { P[2].bt_slot[1]=2; b=1; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_BT3)    ==1) { P[2].bt_slot[1]=3; c=1; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_BT4)    ==1) { P[2].bt_slot[1]=4; d=1; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_BT5)    ==1) { P[2].bt_slot[1]=5; e=1; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_BT6)    ==1) { P[2].bt_slot[1]=6; f=1; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_SELECT) ==1) { P[2].bt_slot[1]=7; g=1; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_START)  ==1) { P[2].bt_slot[1]=8; h=1; }
+if ((hamoopi_input_pressed_mask(&P[2].Teclas) >> TECLA_BT1)!=0) //algum botao (BT1..START) pressionado
 {
 if (a==1) { strcat(StrBotoes, "1"); } P[2].bt_slot[1] = atoi(StrBotoes);
 if (b==1) { strcat(StrBotoes, "2"); } P[2].bt_slot[1] = atoi(StrBotoes);
@@ -7795,28 +7622,28 @@ if (f==1) { strcat(StrBotoes, "6"); } P[2].bt_slot[1] = atoi(StrBotoes);
 if (g==1) { strcat(StrBotoes, "7"); } P[2].bt_slot[1] = atoi(StrBotoes);
 if (h==1) { strcat(StrBotoes, "8"); } P[2].bt_slot[1] = atoi(StrBotoes);
 }
-if (P[2].key_LEFT_status  ==1 && P[2].key_UP_status    ==1) { P[2].slot[1]=7; }
-if (P[2].key_UP_status    ==1 && P[2].key_RIGHT_status ==1) { P[2].slot[1]=9; }
-if (P[2].key_RIGHT_status ==1 && P[2].key_DOWN_status  ==1) { P[2].slot[1]=3; }
-if (P[2].key_DOWN_status  ==1 && P[2].key_LEFT_status  ==1) { P[2].slot[1]=1; }
-if (P[2].key_DOWN_status  >1 && P[2].key_RIGHT_status ==1) { P[2].slot[1]=3; }
-if (P[2].key_RIGHT_status >1 && P[2].key_DOWN_status  ==1) { P[2].slot[1]=3; }
-if (P[2].key_DOWN_status  >1 && P[2].key_LEFT_status  ==1) { P[2].slot[1]=1; }
-if (P[2].key_LEFT_status  >1 && P[2].key_DOWN_status  ==1) { P[2].slot[1]=1; }
-if (P[2].key_UP_status    >1 && P[2].key_RIGHT_status ==1) { P[2].slot[1]=9; }
-if (P[2].key_RIGHT_status >1 && P[2].key_UP_status    ==1) { P[2].slot[1]=9; }
-if (P[2].key_UP_status    >1 && P[2].key_LEFT_status  ==1) { P[2].slot[1]=7; }
-if (P[2].key_LEFT_status  >1 && P[2].key_UP_status    ==1) { P[2].slot[1]=7; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_LEFT)  ==1 && hamoopi_input_status(&P[2].Teclas, TECLA_UP)    ==1) { P[2].slot[1]=7; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_UP)    ==1 && hamoopi_input_status(&P[2].Teclas, TECLA_RIGHT) ==1) { P[2].slot[1]=9; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_RIGHT) ==1 && hamoopi_input_status(&P[2].Teclas, TECLA_DOWN)  ==1) { P[2].slot[1]=3; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_DOWN)  ==1 && hamoopi_input_status(&P[2].Teclas, TECLA_LEFT)  ==1) { P[2].slot[1]=1; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_DOWN)  >1 && hamoopi_input_status(&P[2].Teclas, TECLA_RIGHT) ==1) { P[2].slot[1]=3; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_RIGHT) >1 && hamoopi_input_status(&P[2].Teclas, TECLA_DOWN)  ==1) { P[2].slot[1]=3; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_DOWN)  >1 && hamoopi_input_status(&P[2].Teclas, TECLA_LEFT)  ==1) { P[2].slot[1]=1; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_LEFT)  >1 && hamoopi_input_status(&P[2].Teclas, TECLA_DOWN)  ==1) { P[2].slot[1]=1; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_UP)    >1 && hamoopi_input_status(&P[2].Teclas, TECLA_RIGHT) ==1) { P[2].slot[1]=9; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_RIGHT) >1 && hamoopi_input_status(&P[2].Teclas, TECLA_UP)    ==1) { P[2].slot[1]=9; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_UP)    >1 && hamoopi_input_status(&P[2].Teclas, TECLA_LEFT)  ==1) { P[2].slot[1]=7; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_LEFT)  >1 && hamoopi_input_status(&P[2].Teclas, TECLA_UP)    ==1) { P[2].slot[1]=7; }
 P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0;
 }
-if (P[2].key_DOWN_status  ==3 && P[2].key_RIGHT_status>1) { MovSlots_P2(); P[2].slot[1]=6; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
-if (P[2].key_DOWN_status  ==3 && P[2].key_LEFT_status >1) { MovSlots_P2(); P[2].slot[1]=4; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
-if (P[2].key_RIGHT_status ==3 && P[2].key_DOWN_status >1) { MovSlots_P2(); P[2].slot[1]=2; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
-if (P[2].key_LEFT_status  ==3 && P[2].key_DOWN_status >1) { MovSlots_P2(); P[2].slot[1]=2; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
-if (P[2].key_UP_status    ==3 && P[2].key_RIGHT_status>1) { MovSlots_P2(); P[2].slot[1]=6; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
-if (P[2].key_UP_status    ==3 && P[2].key_LEFT_status >1) { MovSlots_P2(); P[2].slot[1]=4; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
-if (P[2].key_RIGHT_status ==3 && P[2].key_UP_status   >1) { MovSlots_P2(); P[2].slot[1]=8; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
-if (P[2].key_LEFT_status  ==3 && P[2].key_UP_status   >1) { MovSlots_P2(); P[2].slot[1]=8; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_DOWN)  ==3 && hamoopi_input_status(&P[2].Teclas, TECLA_RIGHT)>1) { MovSlots_P2(); P[2].slot[1]=6; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_DOWN)  ==3 && hamoopi_input_status(&P[2].Teclas, TECLA_LEFT) >1) { MovSlots_P2(); P[2].slot[1]=4; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_RIGHT) ==3 && hamoopi_input_status(&P[2].Teclas, TECLA_DOWN) >1) { MovSlots_P2(); P[2].slot[1]=2; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_LEFT)  ==3 && hamoopi_input_status(&P[2].Teclas, TECLA_DOWN) >1) { MovSlots_P2(); P[2].slot[1]=2; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_UP)    ==3 && hamoopi_input_status(&P[2].Teclas, TECLA_RIGHT)>1) { MovSlots_P2(); P[2].slot[1]=6; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_UP)    ==3 && hamoopi_input_status(&P[2].Teclas, TECLA_LEFT) >1) { MovSlots_P2(); P[2].slot[1]=4; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_RIGHT) ==3 && hamoopi_input_status(&P[2].Teclas, TECLA_UP)   >1) { MovSlots_P2(); P[2].slot[1]=8; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
+if (hamoopi_input_status(&P[2].Teclas, TECLA_LEFT)  ==3 && hamoopi_input_status(&P[2].Teclas, TECLA_UP)   >1) { MovSlots_P2(); P[2].slot[1]=8; P[2].t_slot[1]=P[2].ticks_4slot; P[2].ticks_4slot=0; }
 if (P[2].t_slot[1]>999) { P[2].t_slot[1]=999; }
 }
 }
@@ -7943,6 +7770,7 @@ void LOAD_PLAYERS(){
 char txt[50]="";
 for (int indPlayer=1;indPlayer<=2;indPlayer++){
 P[indPlayer].TotalDeImagensUtilizadas=-1;
+memset(P[indPlayer].LinhaAtlas, 0, sizeof(P[indPlayer].LinhaAtlas));
 for(int indState=100; indState<=999; indState++){
 P[indPlayer].TotalDeFramesMov[indState]=-1;
 for(int indAnim=0; indAnim<=29; indAnim++){
@@ -8052,6 +7880,7 @@ destroy_bitmap(Spr_Aux);
 P[indPlayer].TableAtlas[P[indPlayer].TotalDeImagensUtilizadas][0]=indState;
 P[indPlayer].TableAtlas[P[indPlayer].TotalDeImagensUtilizadas][1]=indAnim;
 P[indPlayer].TableAtlas[P[indPlayer].TotalDeImagensUtilizadas][2]=P[indPlayer].TotalDeImagensUtilizadas;
+P[indPlayer].LinhaAtlas[indState][indAnim]=P[indPlayer].TotalDeImagensUtilizadas;
 
 AddTableAtlas(indPlayer, indState, indAnim, P[indPlayer].TotalDeImagensUtilizadas);
 
@@ -8075,6 +7904,8 @@ P[indPlayer].TotalDeFramesMov[316]=P[indPlayer].TotalDeFramesMov[326]; //movimen
 P[indPlayer].TotalDeFramesMov[603]=P[indPlayer].TotalDeFramesMov[604]; //movimentos 603 e 605 ignorados
 P[indPlayer].TotalDeFramesMov[605]=P[indPlayer].TotalDeFramesMov[604]; //movimentos 603 e 605 ignorados
 
+MontaTabelaDeGolpes(indPlayer);
+
 if (indPlayer==1) { PLAYER_STATE(1, 100, 0, P[indPlayer].QtdeFrames); }
 if (indPlayer==2) { PLAYER_STATE(2, 100, 0, P[indPlayer].QtdeFrames); }
 }
@@ -8560,6 +8391,371 @@ if(ForcaDoGolpeP2==3){ P[2].ChangeDamage = get_config_int (P[2].State_s, "V3_Dam
 
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// CAMERA - DESENHA O MUNDO DIRETO NA TELA DE APRESENTACAO --------------------
+///////////////////////////////////////////////////////////////////////////////
+
+//O mundo continua em coordenadas 2X (cenario*2), mas nada e renderizado nessa
+//resolucao: a janela VScreen e mapeada direto para o bitmap de destino.
+
+void Cam_Update(BITMAP *dst)
+{
+Cam_EscalaX=1; Cam_EscalaY=1;
+if(VScreen_x2>0) { Cam_EscalaX=dst->w/VScreen_x2; }
+if(VScreen_y2>0) { Cam_EscalaY=dst->h/VScreen_y2; }
+}
+
+int Cam_X(float x) { return (int)floor((x-VScreen_x)*Cam_EscalaX); }
+int Cam_Y(float y) { return (int)floor((y-VScreen_y)*Cam_EscalaY); }
+
+void Cam_Draw_BG(BITMAP *dst, BITMAP *bg)
+{
+//janela visivel em coordenadas do cenario (1X)
+int sx1=(int)floor(VScreen_x/2);
+int sy1=(int)floor(VScreen_y/2);
+int sx2=(int)ceil((VScreen_x+VScreen_x2)/2);
+int sy2=(int)ceil((VScreen_y+VScreen_y2)/2);
+
+//so limpa quando a janela sai dos limites do cenario
+int limpa=0;
+if(sx1<0 || sy1<0 || sx2>bg->w || sy2>bg->h){
+limpa=1;
+if(sx1<0) { sx1=0; }
+if(sy1<0) { sy1=0; }
+if(sx2>bg->w) { sx2=bg->w; }
+if(sy2>bg->h) { sy2=bg->h; }
+}
+
+int dx1=Cam_X(sx1*2); int dx2=Cam_X(sx2*2);
+int dy1=Cam_Y(sy1*2); int dy2=Cam_Y(sy2*2);
+
+//32bpp: vai para a lista da camera
+if(Cam_Lista(dst, bg)==1){
+if(limpa==1) { Cam_Grava(dst, CAM_LIMPA, NULL, 0, 0, 0, 0, 0, 0, dst->w, dst->h, 0, -1); }
+if(sx2>sx1 && sy2>sy1) { Cam_Grava(dst, CAM_FUNDO, bg, sx1, sy1, sx2-sx1, sy2-sy1, dx1, dy1, dx2-dx1, dy2-dy1, 0, -1); }
+return;
+}
+
+Cam_Executa();
+if(limpa==1) { clear_to_color(dst, makecol(0,0,0)); }
+if(sx2<=sx1 || sy2<=sy1) { return; }
+if(dx2-dx1==sx2-sx1 && dy2-dy1==sy2-sy1) { blit(bg, dst, sx1, sy1, dx1, dy1, sx2-sx1, sy2-sy1); return; }
+stretch_blit(bg, dst, sx1, sy1, sx2-sx1, sy2-sy1, dx1, dy1, dx2-dx1, dy2-dy1);
+}
+
+//desenha um sprite posicionado no mundo, escalonado pela camera
+//zoom: tamanho do sprite no mundo (1=sprite ja em 2X, 2=sprite em 1X)
+//alpha: -1 desenho solido, 0..255 desenho transparente
+void Cam_Draw_Sprite_Ex(BITMAP *dst, BITMAP *spr, float x, float y, float zoom, int flip, int alpha)
+{
+int dx1=Cam_X(x); int dx2=Cam_X(x+spr->w*zoom);
+int dy1=Cam_Y(y); int dy2=Cam_Y(y+spr->h*zoom);
+int dw=dx2-dx1; int dh=dy2-dy1;
+if(dw<=0 || dh<=0) { return; }
+
+//32bpp: vai para a lista da camera
+if(Cam_Lista(dst, spr)==1){
+Cam_Grava(dst, CAM_SPRITE, spr, 0, 0, spr->w, spr->h, dx1, dy1, dw, dh, flip, alpha);
+return;
+}
+Cam_Executa();
+
+//escala 1:1, usa as rotinas do Allegro
+if(dw==spr->w && dh==spr->h && (alpha<0 || flip==0)){
+if(alpha>=0) { set_trans_blender(0,0,0,alpha); draw_trans_sprite(dst, spr, dx1, dy1); return; }
+if(flip==0) { draw_sprite(dst, spr, dx1, dy1); } else { draw_sprite_h_flip(dst, spr, dx1, dy1); }
+return;
+}
+
+//recorta contra a area de clip do destino
+int cx1=dx1; int cx2=dx2; int cy1=dy1; int cy2=dy2;
+if(cx1<dst->cl) { cx1=dst->cl; }
+if(cx2>dst->cr) { cx2=dst->cr; }
+if(cy1<dst->ct) { cy1=dst->ct; }
+if(cy2>dst->cb) { cy2=dst->cb; }
+if(cx2<=cx1 || cy2<=cy1) { return; }
+
+//mapa de colunas, calculado uma vez por sprite
+if(Cam_Mapa_Tam<cx2-cx1){
+Cam_Mapa_Tam=cx2-cx1;
+Cam_Mapa=(int *)realloc(Cam_Mapa, Cam_Mapa_Tam*sizeof(int));
+}
+for(int ind=cx1;ind<cx2;ind++){
+int sx=(ind-dx1)*spr->w/dw;
+if(flip==1) { sx=spr->w-1-sx; }
+Cam_Mapa[ind-cx1]=sx;
+}
+
+int mask=bitmap_mask_color(spr);
+if(alpha>=0) { set_trans_blender(0,0,0,alpha); drawing_mode(DRAW_MODE_TRANS,NULL,0,0); }
+
+for(int py=cy1;py<cy2;py++){
+int sy=(py-dy1)*spr->h/dh;
+for(int ind=0;ind<cx2-cx1;ind++){
+int c=getpixel(spr, Cam_Mapa[ind], sy);
+if(c==mask) { continue; }
+putpixel(dst, cx1+ind, py, c);
+}
+}
+if(alpha>=0) { solid_mode(); }
+}
+
+void Cam_Draw_Sprite(BITMAP *dst, BITMAP *spr, float x, float y, float zoom, int flip)
+{
+Cam_Draw_Sprite_Ex(dst, spr, x, y, zoom, flip, -1);
+}
+
+void Cam_Draw_Trans_Sprite(BITMAP *dst, BITMAP *spr, float x, float y, int alpha)
+{
+Cam_Draw_Sprite_Ex(dst, spr, x, y, 1, 0, alpha);
+}
+
+//a lista so e usada quando origem e destino sao 32bpp (acesso direto as linhas)
+int Cam_Lista(BITMAP *dst, BITMAP *spr)
+{
+if(bitmap_color_depth(dst)!=32 || !is_memory_bitmap(dst)) { return 0; }
+if(spr!=NULL && bitmap_color_depth(spr)!=32) { return 0; }
+return 1;
+}
+
+//grava um comando: recorta o destino e monta o mapa de colunas (uma vez, todas as faixas usam)
+void Cam_Grava(BITMAP *dst, int Tipo, BITMAP *spr, int sx, int sy, int sw, int sh, int dx, int dy, int dw, int dh, int flip, int alpha)
+{
+if(Cam_Destino!=dst || Cam_Qtde>=CAM_MAX_CMDS) { Cam_Executa(); Cam_Destino=dst; }
+if(Cam_Linhas_Larg<dst->w){
+uint32_t *novo=(uint32_t *)realloc(Cam_Linhas, Bandas.count*dst->w*sizeof(uint32_t));
+if(novo!=NULL) { Cam_Linhas=novo; Cam_Linhas_Larg=dst->w; }
+}
+if(dw<=0 || dh<=0) { return; }
+
+int cx1=dx; int cx2=dx+dw; int cy1=dy; int cy2=dy+dh;
+if(cx1<dst->cl) { cx1=dst->cl; }
+if(cx2>dst->cr) { cx2=dst->cr; }
+if(cy1<dst->ct) { cy1=dst->ct; }
+if(cy2>dst->cb) { cy2=dst->cb; }
+if(cx2<=cx1 || cy2<=cy1) { return; }
+
+struct CamCmdDEF *C=&Cam_Cmd[Cam_Qtde];
+C->Tipo=Tipo; C->Spr=spr;
+C->sx=sx; C->sy=sy; C->sw=sw; C->sh=sh;
+C->dx=dx; C->dy=dy; C->dw=dw; C->dh=dh;
+C->cx1=cx1; C->cx2=cx2; C->cy1=cy1; C->cy2=cy2;
+C->Mascara=(Tipo==CAM_SPRITE) ? bitmap_mask_color(spr) : -1;
+C->Alpha=alpha;
+C->Direto=(dw==sw && flip==0);
+C->Mapa=Cam_Colunas_Qtde;
+if(Tipo!=CAM_LIMPA){
+if(Cam_Colunas_Tam<Cam_Colunas_Qtde+(cx2-cx1)){
+Cam_Colunas_Tam=(Cam_Colunas_Qtde+(cx2-cx1))*2;
+Cam_Colunas=(int *)realloc(Cam_Colunas, Cam_Colunas_Tam*sizeof(int));
+}
+for(int ind=cx1;ind<cx2;ind++){
+int col=(ind-dx)*sw/dw;
+if(flip==1) { col=sw-1-col; }
+Cam_Colunas[Cam_Colunas_Qtde++]=sx+col;
+}
+}
+Cam_Qtde++;
+}
+
+//desenha as linhas [y0, y1) de todos os comandos; cada thread escreve so na sua faixa
+void Cam_Faixa(void *, int y0, int y1)
+{
+if(Cam_Linhas_Larg<Cam_Destino->w) { return; }
+uint32_t *linha=Cam_Linhas+hamoopi_bands_stripe(&Bandas, Cam_Destino->h, y0)*Cam_Linhas_Larg; //colunas de origem reunidas, quando escalonado
+for(int i=0;i<Cam_Qtde;i++){
+struct CamCmdDEF *C=&Cam_Cmd[i];
+int py1=C->cy1>y0 ? C->cy1 : y0;
+int py2=C->cy2<y1 ? C->cy2 : y1;
+int w=C->cx2-C->cx1;
+const int *mapa=Cam_Colunas+C->Mapa;
+
+for(int py=py1;py<py2;py++){
+uint32_t *des=(uint32_t *)Cam_Destino->line[py]+C->cx1;
+if(C->Tipo==CAM_LIMPA) { memset(des, 0, w*sizeof(uint32_t)); continue; }
+int sy=C->sy+(py-C->dy)*C->sh/C->dh;
+const uint32_t *src=(const uint32_t *)C->Spr->line[sy];
+if(C->Direto==1) { src+=mapa[0]; }
+else {
+for(int ind=0;ind<w;ind++) { linha[ind]=src[mapa[ind]]; }
+src=linha;
+}
+if(C->Mascara<0) { memcpy(des, src, w*sizeof(uint32_t)); continue; }
+//solido = alpha 255 (copia com mascara)
+hamoopi_blend_sprite(des, src, w, (uint32_t)C->Mascara, C->Alpha<0 ? 255 : C->Alpha);
+}
+}
+}
+
+//desenha a lista gravada, dividida em faixas pelas threads de Bandas
+void Cam_Executa()
+{
+if(Cam_Qtde>0) { hamoopi_bands_run(&Bandas, Cam_Destino->h, Cam_Faixa, NULL); }
+Cam_Qtde=0; Cam_Colunas_Qtde=0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// HUD EM CACHE ---------------------------------------------------------------
+///////////////////////////////////////////////////////////////////////////////
+
+//prepara o widget e compara a Chave atual com a ultima desenhada
+//retorna 1 quando o cache foi limpo e precisa ser redesenhado
+int HUD_Checa(struct HUDWidgetDEF *W, int x, int y, int w, int h, int *Chave, int Qtde)
+{
+W->x=x; W->y=y;
+if (W->Cache==NULL || W->Cache->w!=w || W->Cache->h!=h) {
+if (W->Cache!=NULL) { destroy_bitmap(W->Cache); }
+W->Cache=create_bitmap(w,h);
+W->Sujo=1;
+}
+if (Qtde>8) { Qtde=8; }
+for(int ind=0;ind<Qtde;ind++){
+if (W->Chave[ind]!=Chave[ind]) { W->Chave[ind]=Chave[ind]; W->Sujo=1; }
+}
+if (W->Sujo==0) { return 0; }
+W->Sujo=0;
+clear_to_color(W->Cache, makecol(255, 0, 255));
+return 1;
+}
+
+void HUD_Desenha(BITMAP *dst, struct HUDWidgetDEF *W)
+{
+if (W->Cache!=NULL) { draw_sprite(dst, W->Cache, W->x, W->y); }
+}
+
+void HUD_Invalida()
+{
+HUD_Energia.Sujo=1;
+HUD_Relogio.Sujo=1;
+HUD_Special.Sujo=1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// OPERACOES DE TELA INTEIRA EM FAIXAS ----------------------------------------
+///////////////////////////////////////////////////////////////////////////////
+
+//contexto das faixas: cada thread recebe o mesmo, e um intervalo de linhas diferente
+struct FaixaDEF {
+BITMAP *Src;
+BITMAP *Dst;
+int w;
+int Alpha;
+};
+
+void Faixa_Limpa(void *ctx, int y0, int y1)
+{
+struct FaixaDEF *F=(struct FaixaDEF *)ctx;
+for(int y=y0;y<y1;y++) { memset(F->Dst->line[y], 0, F->Dst->w*sizeof(uint32_t)); }
+}
+
+void Faixa_Escurece(void *ctx, int y0, int y1)
+{
+struct FaixaDEF *F=(struct FaixaDEF *)ctx;
+for(int y=y0;y<y1;y++) { hamoopi_blend_darken((uint32_t *)F->Dst->line[y], F->w, F->Alpha); }
+}
+
+void Faixa_Escala(void *ctx, int y0, int y1)
+{
+struct FaixaDEF *F=(struct FaixaDEF *)ctx;
+hamoopi_scale_rows(&Escalador, FiltroSaida,
+(const uint32_t*)F->Src->line[0], F->Src->w, F->Src->h, (size_t)(F->Src->line[1]-F->Src->line[0]),
+(uint32_t*)F->Dst->line[0], F->Dst->w, F->Dst->h, (size_t)(F->Dst->line[1]-F->Dst->line[0]), y0, y1);
+}
+
+//draw_trans_sprite com os kernels de hamoopi_blend (32bpp em memoria)
+void Tela_Sprite_Trans(BITMAP *dst, BITMAP *spr, int x, int y, int alpha)
+{
+if(bitmap_color_depth(dst)!=32 || bitmap_color_depth(spr)!=32 || !is_memory_bitmap(dst)) {
+set_trans_blender(0, 0, 0, alpha);
+draw_trans_sprite(dst, spr, x, y);
+return;
+}
+int x1=x; int y1=y; int x2=x+spr->w; int y2=y+spr->h;
+if(x1<dst->cl) { x1=dst->cl; }
+if(y1<dst->ct) { y1=dst->ct; }
+if(x2>dst->cr) { x2=dst->cr; }
+if(y2>dst->cb) { y2=dst->cb; }
+if(x2<=x1 || y2<=y1) { return; }
+for(int py=y1;py<y2;py++){
+hamoopi_blend_sprite((uint32_t *)dst->line[py]+x1, (const uint32_t *)spr->line[py-y]+(x1-x), x2-x1, (uint32_t)bitmap_mask_color(spr), alpha);
+}
+}
+
+//clear() dividido em faixas (32bpp em memoria)
+void Tela_Limpa(BITMAP *dst)
+{
+if(bitmap_color_depth(dst)!=32 || !is_memory_bitmap(dst)) { clear(dst); return; }
+struct FaixaDEF F; F.Src=NULL; F.Dst=dst; F.w=dst->w; F.Alpha=0;
+hamoopi_bands_run(&Bandas, dst->h, Faixa_Limpa, &F);
+}
+
+//escurece de (0,0) ate (w,h), como um rectfill preto com set_trans_blender(0,0,0,alpha)
+void Tela_Escurece(BITMAP *dst, int w, int h, int alpha)
+{
+if(bitmap_color_depth(dst)!=32 || !is_memory_bitmap(dst)) {
+set_trans_blender(0, 0, 0, alpha);
+drawing_mode(DRAW_MODE_TRANS, 0, 0, 0);
+rectfill(dst, 0, 0, w, h, makecol(0, 0, 0));
+drawing_mode(DRAW_MODE_SOLID, 0, 0, 0);
+return;
+}
+w++; h++; //rectfill inclui a ultima linha e coluna
+if(w>dst->w) { w=dst->w; }
+if(h>dst->h) { h=dst->h; }
+struct FaixaDEF F; F.Src=NULL; F.Dst=dst; F.w=w; F.Alpha=alpha;
+hamoopi_bands_run(&Bandas, h, Faixa_Escurece, &F);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// APRESENTACAO NA TELA -------------------------------------------------------
+///////////////////////////////////////////////////////////////////////////////
+
+//escala o quadro (640x480) para a resolucao da janela e envia para a tela
+//em 32bpp usa o Escalador (multiplos inteiros, mapas de colunas, SIMD), em faixas,
+//nas outras profundidades de cor continua no stretch_blit do Allegro
+void Apresenta_Tela(BITMAP *src)
+{
+if (src->w==screen->w && src->h==screen->h) { blit(src, screen, 0, 0, 0, 0, src->w, src->h); return; }
+if (bitmap_color_depth(src)!=32 || bitmap_color_depth(screen)!=32 || src->h<2) {
+stretch_blit(src, screen, 0, 0, src->w, src->h, 0, 0, screen->w, screen->h);
+return;
+}
+if (TelaSaida==NULL || TelaSaida->w!=screen->w || TelaSaida->h!=screen->h) {
+if (TelaSaida!=NULL) { destroy_bitmap(TelaSaida); }
+TelaSaida=create_bitmap_ex(32, screen->w, screen->h);
+}
+if (TelaSaida==NULL || TelaSaida->h<2) {
+stretch_blit(src, screen, 0, 0, src->w, src->h, 0, 0, screen->w, screen->h);
+return;
+}
+if (!hamoopi_scale_prepare(&Escalador, FiltroSaida, src->w, src->h, TelaSaida->w, TelaSaida->h)) {
+stretch_blit(src, screen, 0, 0, src->w, src->h, 0, 0, screen->w, screen->h);
+return;
+}
+struct FaixaDEF F; F.Src=src; F.Dst=TelaSaida; F.w=TelaSaida->w; F.Alpha=0;
+hamoopi_bands_run(&Bandas, TelaSaida->h, Faixa_Escala, &F);
+blit(TelaSaida, screen, 0, 0, 0, 0, TelaSaida->w, TelaSaida->h);
+}
+
+//avisa uma unica vez que faltam arquivos do manifesto (HamoopiError)
+void Avisa_Arquivos_Faltando(int Erro)
+{
+static int avisado=0;
+if (Erro!=1 || avisado==1) { return; }
+avisado=1;
+if (strcmp (IDIOMA,"BR")==0){ allegro_message("ARQUIVOS OU DIRETORIOS NAO ENCONTRADOS."); };
+if (strcmp (IDIOMA,"US")==0){ allegro_message("FILES OR DIRECTORIES NOT FOUND."); };
+}
+
+//soma ao acumulador os ticks do relogio desde a ultima leitura (x LOGIC_TURBO no modo turbo)
+void Relogio_Acumula()
+{
+int agora=timer;
+LogicAcc+=(agora-LogicTimerLido)*(TurboMode==1 ? LOGIC_TURBO : 1);
+LogicTimerLido=agora;
+if (LogicAcc>LOGIC_MAX_ATRASO) { LogicAcc=LOGIC_MAX_ATRASO; }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // DESENHA HIT e COLISION BOXES -----------------------------------------------
 ///////////////////////////////////////////////////////////////////////////////
@@ -10233,179 +10429,20 @@ P1_Hit_y=((y1-y2)/2)+y2;
 void Aplicar_HIT(){
 ///HIT!!!
 
-MomentoDoP1=0;
-MomentoDoP2=0;
-
-//ForcaDoGolpeP1=0;
-//ForcaDoGolpeP2=0;
-//Ao nao zerar a ForcaDoGolpe, essa variavel acaba guardando a forca do ultimo golpe dado
-
-if (
-P[1].State==101 || P[1].State==104 or
-P[1].State==111 || P[1].State==114 or
-P[1].State==151 || P[1].State==154 or
-P[1].State==201 || P[1].State==204 or
-P[1].State==211 || P[1].State==214 or
-P[1].State==221 || P[1].State==224 or
-P[1].State==301 || P[1].State==304 or
-P[1].State==311 || P[1].State==314 or
-P[1].State==321 || P[1].State==324 ||
-P[1].State==411 || P[1].State==414 ||
-P[1].State==421 || P[1].State==424 )
-{ ForcaDoGolpeP1=1; }
-
-if (
-P[1].State==102 || P[1].State==105 or
-P[1].State==112 || P[1].State==115 or
-P[1].State==152 || P[1].State==155 or
-P[1].State==202 || P[1].State==205 or
-P[1].State==212 || P[1].State==215 or
-P[1].State==222 || P[1].State==225 or
-P[1].State==302 || P[1].State==305 or
-P[1].State==312 || P[1].State==315 or
-P[1].State==322 || P[1].State==325 ||
-P[1].State==412 || P[1].State==415 ||
-P[1].State==422 || P[1].State==425 )
-{ ForcaDoGolpeP1=2; }
-
-if (
-P[1].State==103 || P[1].State==106 or
-P[1].State==113 || P[1].State==116 or
-P[1].State==153 || P[1].State==156 or
-P[1].State==203 || P[1].State==206 or
-P[1].State==213 || P[1].State==216 or
-P[1].State==223 || P[1].State==226 or
-P[1].State==303 || P[1].State==306 or
-P[1].State==313 || P[1].State==316 or
-P[1].State==323 || P[1].State==326 ||
-P[1].State==413 || P[1].State==416 ||
-P[1].State==423 || P[1].State==426 )
-{ ForcaDoGolpeP1=3; }
-
-if (colisaoxP2==1 && AHitP1==1)New_HitBox(Qtde_HitBox+1);
-if (colisaoxP1==1 && AHitP2==1)New_HitBox(Qtde_HitBox+1);
-
-if (
-P[1].State==100 ||
-P[1].State==101 || P[1].State==102 || P[1].State==103 || P[1].State==104 || P[1].State==105 || P[1].State==106 ||
-P[1].State==151 || P[1].State==152 || P[1].State==153 || P[1].State==154 || P[1].State==155 || P[1].State==156 ||
-P[1].State==111 || P[1].State==112 || P[1].State==113 || P[1].State==114 || P[1].State==115 || P[1].State==116 ||
-P[1].State==411 || P[1].State==412 || P[1].State==413 || P[1].State==414 || P[1].State==415 || P[1].State==416 ||
-P[1].State==421 || P[1].State==422 || P[1].State==423 || P[1].State==424 || P[1].State==425 || P[1].State==426 ||
-P[1].State==410 || P[1].State==420 || P[1].State==602 || P[1].State==603 || P[1].State==604 || P[1].State==605 ||
-P[1].State==606 || P[1].State==607 )
-{ MomentoDoP1=1; } //De pe
-
-if (
-P[1].State==200 ||
-P[1].State==201 || P[1].State==202 || P[1].State==203 || P[1].State==204 || P[1].State==205 || P[1].State==206 ||
-P[1].State==211 || P[1].State==212 || P[1].State==213 || P[1].State==214 || P[1].State==215 || P[1].State==216 or
-P[1].State==221 || P[1].State==222 || P[1].State==223 || P[1].State==224 || P[1].State==225 || P[1].State==226 ||
-P[1].State==601 || P[1].State==608 )
-{ MomentoDoP1=2; } //Abaixado
-
-if (
-P[1].State==300 || P[1].State==310 || P[1].State==320 ||
-P[1].State==301 || P[1].State==302 || P[1].State==303 || P[1].State==304 || P[1].State==305 || P[1].State==306 ||
-P[1].State==311 || P[1].State==312 || P[1].State==313 || P[1].State==314 || P[1].State==315 || P[1].State==316 or
-P[1].State==321 || P[1].State==322 || P[1].State==323 || P[1].State==324 || P[1].State==325 || P[1].State==326 )
-{ MomentoDoP1=3; } //Pulando
-
-if (P[1].State==501 || P[1].State==502 || P[1].State==503 )
-{ MomentoDoP1=51; } //Hurt em pe
-if (P[1].State==511 || P[1].State==512 || P[1].State==513 )
-{ MomentoDoP1=51; } //Hurt em pe
-if ( P[1].State==504 || P[1].State==505 || P[1].State==506  )
-{ MomentoDoP1=52; } //Hurt abaixado
-if ( P[1].State==507 || P[1].State==508 || P[1].State==509  )
-{ MomentoDoP1=53; } //Hurt em pe
-
-if ( P[1].State==250 )
-{ MomentoDoP1=9; } //Defesa Abaixado
-if ( P[1].State==450 )
-{ MomentoDoP1=9; } //Defesa em Pe
-
-if (
-P[2].State==101 || P[2].State==104 or
-P[2].State==111 || P[2].State==114 or
-P[2].State==151 || P[2].State==154 or
-P[2].State==201 || P[2].State==204 or
-P[2].State==211 || P[2].State==214 or
-P[2].State==221 || P[2].State==224 or
-P[2].State==301 || P[2].State==304 or
-P[2].State==311 || P[2].State==314 or
-P[2].State==321 || P[2].State==324 ||
-P[2].State==411 || P[2].State==414 ||
-P[2].State==421 || P[2].State==424 )
-{ ForcaDoGolpeP2=1; }
+//Forca e Momento vem da tabela montada em MontaTabelaDeGolpes() na carga dos chars
+//ForcaDoState==0 nao altera a ForcaDoGolpe, que acaba guardando a forca do ultimo golpe dado
+if(P[1].State>=0 && P[1].State<=999){
+if(P[1].ForcaDoState[P[1].State]!=0) { ForcaDoGolpeP1=P[1].ForcaDoState[P[1].State]; }
+MomentoDoP1=P[1].MomentoDoState[P[1].State];
+}else{ MomentoDoP1=0; }
 
-if (
-P[2].State==102 || P[2].State==105 or
-P[2].State==112 || P[2].State==115 or
-P[2].State==152 || P[2].State==155 or
-P[2].State==202 || P[2].State==205 or
-P[2].State==212 || P[2].State==215 or
-P[2].State==222 || P[2].State==225 or
-P[2].State==302 || P[2].State==305 or
-P[2].State==312 || P[2].State==315 or
-P[2].State==322 || P[2].State==325 ||
-P[2].State==412 || P[2].State==415 ||
-P[2].State==422 || P[2].State==425 )
-{ ForcaDoGolpeP2=2; }
-
-if (
-P[2].State==103 || P[2].State==106 or
-P[2].State==113 || P[2].State==116 or
-P[2].State==153 || P[2].State==156 or
-P[2].State==203 || P[2].State==206 or
-P[2].State==213 || P[2].State==216 or
-P[2].State==223 || P[2].State==226 or
-P[2].State==303 || P[2].State==306 or
-P[2].State==313 || P[2].State==316 or
-P[2].State==323 || P[2].State==326 ||
-P[2].State==413 || P[2].State==416 ||
-P[2].State==423 || P[2].State==426 )
-{ ForcaDoGolpeP2=3; }
+if (colisaoxP2==1 && AHitP1==1)New_HitBox();
+if (colisaoxP1==1 && AHitP2==1)New_HitBox();
 
-if (
-P[2].State==100 ||
-P[2].State==101 || P[2].State==102 || P[2].State==103 || P[2].State==104 || P[2].State==105 || P[2].State==106 ||
-P[2].State==151 || P[2].State==152 || P[2].State==153 || P[2].State==154 || P[2].State==155 || P[2].State==156 ||
-P[2].State==111 || P[2].State==112 || P[2].State==113 || P[2].State==114 || P[2].State==115 || P[2].State==116 ||
-P[2].State==411 || P[2].State==412 || P[2].State==413 || P[2].State==414 || P[2].State==415 || P[2].State==416 ||
-P[2].State==421 || P[2].State==422 || P[2].State==423 || P[2].State==424 || P[2].State==425 || P[2].State==426 ||
-P[2].State==410 || P[2].State==420 || P[2].State==602 || P[2].State==603 || P[2].State==604 || P[2].State==605 ||
-P[2].State==606 || P[2].State==607 )
-{ MomentoDoP2=1; } //De Pe
-
-if (
-P[2].State==200 ||
-P[2].State==201 || P[2].State==202 || P[2].State==203 || P[2].State==204 || P[2].State==205 || P[2].State==206 ||
-P[2].State==211 || P[2].State==212 || P[2].State==213 || P[2].State==214 || P[2].State==215 || P[2].State==216 or
-P[2].State==221 || P[2].State==222 || P[2].State==223 || P[2].State==224 || P[2].State==225 || P[2].State==226 ||
-P[2].State==601 || P[2].State==608 )
-{ MomentoDoP2=2; } //Abaixado
-
-if (
-P[2].State==300 || P[2].State==310 || P[2].State==320 ||
-P[2].State==301 || P[2].State==302 || P[2].State==303 || P[2].State==304 || P[2].State==305 || P[2].State==306 ||
-P[2].State==311 || P[2].State==312 || P[2].State==313 || P[2].State==314 || P[2].State==315 || P[2].State==316 or
-P[2].State==321 || P[2].State==322 || P[2].State==323 || P[2].State==324 || P[2].State==325 || P[2].State==326 )
-{ MomentoDoP2=3; } //Pulando
-
-if ( P[2].State==501 || P[2].State==502 || P[2].State==503  )
-{ MomentoDoP2=51; } //Hurt em pe
-if ( P[2].State==511 || P[2].State==512 || P[2].State==513  )
-{ MomentoDoP2=51; } //Hurt em pe
-if ( P[2].State==504 || P[2].State==505 || P[2].State==506  )
-{ MomentoDoP2=52; } //Hurt abaixado
-if ( P[2].State==507 || P[2].State==508 || P[2].State==509  )
-{ MomentoDoP2=53; } //Hurt no ar
-
-if ( P[2].State==250 )
-{ MomentoDoP2=9; } //Defesa Abaixado
-if ( P[2].State==450 )
-{ MomentoDoP2=9; } //Defesa em Pe
+if(P[2].State>=0 && P[2].State<=999){
+if(P[2].ForcaDoState[P[2].State]!=0) { ForcaDoGolpeP2=P[2].ForcaDoState[P[2].State]; }
+MomentoDoP2=P[2].MomentoDoState[P[2].State];
+}else{ MomentoDoP2=0; }
 
 //importante!
 //HitPause Padrao
@@ -10434,14 +10471,7 @@ char P1_Caminho[99];
 char P2_Caminho[99];
 
 //P2 HitType
-int line=0;
-for(int indx=0;indx<=500;indx++){
-if( P[2].State==P[2].TableAtlas[indx][0]
-and P[2].IndexAnim==P[2].TableAtlas[indx][1]){
-line=P[2].TableAtlas[indx][2];
-}
-if(line!=0) break;
-}
+int line=LinhaDoAtlas(2, P[2].State, P[2].IndexAnim);
 if(P[2].TableAtlas[line][16] == 1) { strcpy(P[2].HitType_string, "Normal"); }
 if(P[2].TableAtlas[line][16] == 2) { strcpy(P[2].HitType_string, "Fall"); }
 if(P[2].TableAtlas[line][20] == 1) { strcpy(P[2].HitStack_string, "Single"); }
@@ -10481,7 +10511,7 @@ P[2].QtdeMagias=0;
 //FSM
 if ( strcmp( P[2].HitType_string,"Fall") ==0 && AHitP2==1 ) {
 AHitP2=0;
-P[1].StartFrame=timer;
+P[1].StartFrame=LogicTick;
 PLAYER_STATE(1, 550, 0, P[1].TotalDeFramesMov[550]);
 P1HitPause=HitPause3; //teste
 P2HitPause=HitPause3;
@@ -10490,52 +10520,45 @@ if (ForcaDoGolpeP2==2) {P[1].Energy-=P2_DMG2;}
 if (ForcaDoGolpeP2==3) {P[1].Energy-=P2_DMG3;}
 P2HitOn=P[2].IndexAnim;
 }
-if ( ForcaDoGolpeP2== 1 && MomentoDoP1== 1 && MomentoDoP2== 3 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 511, 0, P[1].TotalDeFramesMov[511]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 2 && MomentoDoP1== 1 && MomentoDoP2== 3 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 512, 0, P[1].TotalDeFramesMov[512]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 3 && MomentoDoP1== 1 && MomentoDoP2== 3 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 513, 0, P[1].TotalDeFramesMov[513]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 1 && MomentoDoP1== 1 && MomentoDoP2== 2 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 511, 0, P[1].TotalDeFramesMov[511]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 2 && MomentoDoP1== 1 && MomentoDoP2== 2 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 512, 0, P[1].TotalDeFramesMov[512]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 3 && MomentoDoP1== 1 && MomentoDoP2== 2 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 513, 0, P[1].TotalDeFramesMov[513]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 1 && MomentoDoP1== 1 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 501, 0, P[1].TotalDeFramesMov[501]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 2 && MomentoDoP1== 1 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 502, 0, P[1].TotalDeFramesMov[502]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 3 && MomentoDoP1== 1 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 503, 0, P[1].TotalDeFramesMov[503]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 1 && MomentoDoP1== 2 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 504, 0, P[1].TotalDeFramesMov[504]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 2 && MomentoDoP1== 2 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 505, 0, P[1].TotalDeFramesMov[505]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 3 && MomentoDoP1== 2 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 506, 0, P[1].TotalDeFramesMov[506]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 1 && MomentoDoP1== 1 && MomentoDoP2== 3 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 511, 0, P[1].TotalDeFramesMov[511]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 2 && MomentoDoP1== 1 && MomentoDoP2== 3 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 512, 0, P[1].TotalDeFramesMov[512]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 3 && MomentoDoP1== 1 && MomentoDoP2== 3 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 513, 0, P[1].TotalDeFramesMov[513]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 1 && MomentoDoP1== 1 && MomentoDoP2== 2 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 511, 0, P[1].TotalDeFramesMov[511]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 2 && MomentoDoP1== 1 && MomentoDoP2== 2 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 512, 0, P[1].TotalDeFramesMov[512]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 3 && MomentoDoP1== 1 && MomentoDoP2== 2 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 513, 0, P[1].TotalDeFramesMov[513]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 1 && MomentoDoP1== 1 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 501, 0, P[1].TotalDeFramesMov[501]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 2 && MomentoDoP1== 1 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 502, 0, P[1].TotalDeFramesMov[502]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 3 && MomentoDoP1== 1 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 503, 0, P[1].TotalDeFramesMov[503]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 1 && MomentoDoP1== 2 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 504, 0, P[1].TotalDeFramesMov[504]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 2 && MomentoDoP1== 2 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 505, 0, P[1].TotalDeFramesMov[505]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 3 && MomentoDoP1== 2 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 506, 0, P[1].TotalDeFramesMov[506]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
 //reversao aerea do P1 Mov 507
-if ( ForcaDoGolpeP2== 1 && MomentoDoP1== 3 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 507, 0, P[1].TotalDeFramesMov[507]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 2 && MomentoDoP1== 3 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 507, 0, P[1].TotalDeFramesMov[507]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 3 && MomentoDoP1== 3 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 507, 0, P[1].TotalDeFramesMov[507]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 1 && MomentoDoP1== 3 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 507, 0, P[1].TotalDeFramesMov[507]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 2 && MomentoDoP1== 3 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 507, 0, P[1].TotalDeFramesMov[507]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 3 && MomentoDoP1== 3 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 507, 0, P[1].TotalDeFramesMov[507]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
 //fim das reversoes
-if ( ForcaDoGolpeP2==51 && MomentoDoP1== 1 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 501, 0, P[1].TotalDeFramesMov[501]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2==51 && MomentoDoP1== 1 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 502, 0, P[1].TotalDeFramesMov[502]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2==51 && MomentoDoP1== 1 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 503, 0, P[1].TotalDeFramesMov[503]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 1 && MomentoDoP1==51 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 501, 0, P[1].TotalDeFramesMov[501]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 2 && MomentoDoP1==51 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 502, 0, P[1].TotalDeFramesMov[502]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 3 && MomentoDoP1==51 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 503, 0, P[1].TotalDeFramesMov[503]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 1 && MomentoDoP1==52 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 504, 0, P[1].TotalDeFramesMov[504]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 2 && MomentoDoP1==52 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 505, 0, P[1].TotalDeFramesMov[505]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 3 && MomentoDoP1==52 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 506, 0, P[1].TotalDeFramesMov[506]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 1 && MomentoDoP1==53 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 550, 0, P[1].TotalDeFramesMov[550]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 2 && MomentoDoP1==53 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 550, 0, P[1].TotalDeFramesMov[550]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP2== 3 && MomentoDoP1==53 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 550, 0, P[1].TotalDeFramesMov[550]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2==51 && MomentoDoP1== 1 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 501, 0, P[1].TotalDeFramesMov[501]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2==51 && MomentoDoP1== 1 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 502, 0, P[1].TotalDeFramesMov[502]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2==51 && MomentoDoP1== 1 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 503, 0, P[1].TotalDeFramesMov[503]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 1 && MomentoDoP1==51 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 501, 0, P[1].TotalDeFramesMov[501]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 2 && MomentoDoP1==51 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 502, 0, P[1].TotalDeFramesMov[502]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 3 && MomentoDoP1==51 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 503, 0, P[1].TotalDeFramesMov[503]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 1 && MomentoDoP1==52 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 504, 0, P[1].TotalDeFramesMov[504]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 2 && MomentoDoP1==52 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 505, 0, P[1].TotalDeFramesMov[505]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 3 && MomentoDoP1==52 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 506, 0, P[1].TotalDeFramesMov[506]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 1 && MomentoDoP1==53 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 550, 0, P[1].TotalDeFramesMov[550]); P2HitPause=HitPause1; P[1].Energy-=P2_DMG1; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 2 && MomentoDoP1==53 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 550, 0, P[1].TotalDeFramesMov[550]); P2HitPause=HitPause2; P[1].Energy-=P2_DMG2; P2HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP2== 3 && MomentoDoP1==53 && AHitP2==1 ) { AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 550, 0, P[1].TotalDeFramesMov[550]); P2HitPause=HitPause3; P[1].Energy-=P2_DMG3; P2HitOn=P[2].IndexAnim; }
 //defesa
 if ( ForcaDoGolpeP2== 1 && MomentoDoP1== 9 && AHitP2==1 ) { AHitP2=0; P2HitPause=HitPause1; P[1].Energy-=0; P2HitOn=P[2].IndexAnim; }
 if ( ForcaDoGolpeP2== 2 && MomentoDoP1== 9 && AHitP2==1 ) { AHitP2=0; P2HitPause=HitPause2; P[1].Energy-=0; P2HitOn=P[2].IndexAnim; }
 if ( ForcaDoGolpeP2== 3 && MomentoDoP1== 9 && AHitP2==1 ) { AHitP2=0; P2HitPause=HitPause3; P[1].Energy-=0; P2HitOn=P[2].IndexAnim; }
 //derrota por KO
-if (P[1].Energy<=0) { rest(HitPauseKO); EndRoundSlowDown=1; AHitP2=0; P[1].StartFrame=timer; PLAYER_STATE(1, 570, 0, P[1].TotalDeFramesMov[570]); P2HitPause=HitPause3; P[1].Energy=0; P2HitOn=P[2].IndexAnim; }
+if (P[1].Energy<=0) { PausaKO=HitPauseKO*Ctrl_FPS/1000; EndRoundSlowDown=1; AHitP2=0; P[1].StartFrame=LogicTick; PLAYER_STATE(1, 570, 0, P[1].TotalDeFramesMov[570]); P2HitPause=HitPause3; P[1].Energy=0; P2HitOn=P[2].IndexAnim; }
 }
 
 //P1 HitType
-line=0;
-for(int indx=0;indx<=500;indx++){
-if( P[1].State==P[1].TableAtlas[indx][0]
-and P[1].IndexAnim==P[1].TableAtlas[indx][1]){
-line=P[1].TableAtlas[indx][2];
-}
-if(line!=0) break;
-}
+line=LinhaDoAtlas(1, P[1].State, P[1].IndexAnim);
 if(P[1].TableAtlas[line][16] == 1) { strcpy(P[1].HitType_string, "Normal"); }
 if(P[1].TableAtlas[line][16] == 2) { strcpy(P[1].HitType_string, "Fall"); }
 if(P[1].TableAtlas[line][20] == 1) { strcpy(P[1].HitStack_string, "Single"); }
@@ -10575,7 +10598,7 @@ P[1].QtdeMagias=0;
 //FSM
 if ( strcmp( P[1].HitType_string,"Fall") ==0 && AHitP1==1 ) {
 AHitP1=0;
-P[2].StartFrame=timer;
+P[2].StartFrame=LogicTick;
 PLAYER_STATE(2, 550, 0, P[2].TotalDeFramesMov[550]);
 P2HitPause=HitPause3; //teste
 P1HitPause=HitPause3;
@@ -10584,41 +10607,41 @@ if (ForcaDoGolpeP1==2) {P[2].Energy-=P1_DMG2;}
 if (ForcaDoGolpeP1==3) {P[2].Energy-=P1_DMG3;}
 P1HitOn=P[2].IndexAnim;
 }
-if ( ForcaDoGolpeP1== 1 && MomentoDoP2== 1 && MomentoDoP1== 3 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 511, 0, P[2].TotalDeFramesMov[511]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 2 && MomentoDoP2== 1 && MomentoDoP1== 3 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 512, 0, P[2].TotalDeFramesMov[512]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 3 && MomentoDoP2== 1 && MomentoDoP1== 3 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 513, 0, P[2].TotalDeFramesMov[513]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 1 && MomentoDoP2== 1 && MomentoDoP1== 2 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 511, 0, P[2].TotalDeFramesMov[511]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 2 && MomentoDoP2== 1 && MomentoDoP1== 2 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 512, 0, P[2].TotalDeFramesMov[512]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 3 && MomentoDoP2== 1 && MomentoDoP1== 2 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 513, 0, P[2].TotalDeFramesMov[513]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 1 && MomentoDoP2== 1 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 501, 0, P[2].TotalDeFramesMov[501]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 2 && MomentoDoP2== 1 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 502, 0, P[2].TotalDeFramesMov[502]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 3 && MomentoDoP2== 1 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 503, 0, P[2].TotalDeFramesMov[503]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 1 && MomentoDoP2== 2 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 504, 0, P[2].TotalDeFramesMov[504]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 2 && MomentoDoP2== 2 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 505, 0, P[2].TotalDeFramesMov[505]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 3 && MomentoDoP2== 2 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 506, 0, P[2].TotalDeFramesMov[506]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 1 && MomentoDoP2== 1 && MomentoDoP1== 3 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 511, 0, P[2].TotalDeFramesMov[511]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 2 && MomentoDoP2== 1 && MomentoDoP1== 3 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 512, 0, P[2].TotalDeFramesMov[512]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 3 && MomentoDoP2== 1 && MomentoDoP1== 3 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 513, 0, P[2].TotalDeFramesMov[513]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 1 && MomentoDoP2== 1 && MomentoDoP1== 2 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 511, 0, P[2].TotalDeFramesMov[511]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 2 && MomentoDoP2== 1 && MomentoDoP1== 2 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 512, 0, P[2].TotalDeFramesMov[512]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 3 && MomentoDoP2== 1 && MomentoDoP1== 2 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 513, 0, P[2].TotalDeFramesMov[513]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 1 && MomentoDoP2== 1 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 501, 0, P[2].TotalDeFramesMov[501]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 2 && MomentoDoP2== 1 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 502, 0, P[2].TotalDeFramesMov[502]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 3 && MomentoDoP2== 1 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 503, 0, P[2].TotalDeFramesMov[503]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 1 && MomentoDoP2== 2 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 504, 0, P[2].TotalDeFramesMov[504]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 2 && MomentoDoP2== 2 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 505, 0, P[2].TotalDeFramesMov[505]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 3 && MomentoDoP2== 2 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 506, 0, P[2].TotalDeFramesMov[506]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
 //reversao aerea do P2 Mov 507
-if ( ForcaDoGolpeP1== 1 && MomentoDoP2== 3 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 507, 0, P[2].TotalDeFramesMov[507]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 2 && MomentoDoP2== 3 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 507, 0, P[2].TotalDeFramesMov[507]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 3 && MomentoDoP2== 3 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 507, 0, P[2].TotalDeFramesMov[507]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 1 && MomentoDoP2== 3 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 507, 0, P[2].TotalDeFramesMov[507]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 2 && MomentoDoP2== 3 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 507, 0, P[2].TotalDeFramesMov[507]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 3 && MomentoDoP2== 3 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 507, 0, P[2].TotalDeFramesMov[507]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
 //fim das reversoes
-if ( ForcaDoGolpeP1==51 && MomentoDoP2== 1 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 501, 0, P[2].TotalDeFramesMov[501]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1==51 && MomentoDoP2== 1 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 502, 0, P[2].TotalDeFramesMov[502]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1==51 && MomentoDoP2== 1 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 503, 0, P[2].TotalDeFramesMov[503]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 1 && MomentoDoP2==51 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 501, 0, P[2].TotalDeFramesMov[501]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 2 && MomentoDoP2==51 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 502, 0, P[2].TotalDeFramesMov[502]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 3 && MomentoDoP2==51 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 503, 0, P[2].TotalDeFramesMov[503]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 1 && MomentoDoP2==52 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 504, 0, P[2].TotalDeFramesMov[504]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 2 && MomentoDoP2==52 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 505, 0, P[2].TotalDeFramesMov[505]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 3 && MomentoDoP2==52 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 506, 0, P[2].TotalDeFramesMov[506]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 1 && MomentoDoP2==53 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 550, 0, P[2].TotalDeFramesMov[550]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 2 && MomentoDoP2==53 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 550, 0, P[2].TotalDeFramesMov[550]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
-if ( ForcaDoGolpeP1== 3 && MomentoDoP2==53 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 550, 0, P[2].TotalDeFramesMov[550]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1==51 && MomentoDoP2== 1 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 501, 0, P[2].TotalDeFramesMov[501]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1==51 && MomentoDoP2== 1 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 502, 0, P[2].TotalDeFramesMov[502]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1==51 && MomentoDoP2== 1 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 503, 0, P[2].TotalDeFramesMov[503]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 1 && MomentoDoP2==51 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 501, 0, P[2].TotalDeFramesMov[501]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 2 && MomentoDoP2==51 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 502, 0, P[2].TotalDeFramesMov[502]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 3 && MomentoDoP2==51 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 503, 0, P[2].TotalDeFramesMov[503]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 1 && MomentoDoP2==52 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 504, 0, P[2].TotalDeFramesMov[504]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 2 && MomentoDoP2==52 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 505, 0, P[2].TotalDeFramesMov[505]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 3 && MomentoDoP2==52 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 506, 0, P[2].TotalDeFramesMov[506]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 1 && MomentoDoP2==53 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 550, 0, P[2].TotalDeFramesMov[550]); P1HitPause=HitPause1; P[2].Energy-=P1_DMG1; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 2 && MomentoDoP2==53 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 550, 0, P[2].TotalDeFramesMov[550]); P1HitPause=HitPause2; P[2].Energy-=P1_DMG2; P1HitOn=P[2].IndexAnim; }
+if ( ForcaDoGolpeP1== 3 && MomentoDoP2==53 && AHitP1==1 ) { AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 550, 0, P[2].TotalDeFramesMov[550]); P1HitPause=HitPause3; P[2].Energy-=P1_DMG3; P1HitOn=P[2].IndexAnim; }
 //defesa
 if ( ForcaDoGolpeP1== 1 && MomentoDoP2== 9 && AHitP1==1 ) { AHitP1=0; P1HitPause=HitPause1; P[2].Energy-=0; P1HitOn=P[2].IndexAnim; }
 if ( ForcaDoGolpeP1== 2 && MomentoDoP2== 9 && AHitP1==1 ) { AHitP1=0; P1HitPause=HitPause2; P[2].Energy-=0; P1HitOn=P[2].IndexAnim; }
 if ( ForcaDoGolpeP1== 3 && MomentoDoP2== 9 && AHitP1==1 ) { AHitP1=0; P1HitPause=HitPause3; P[2].Energy-=0; P1HitOn=P[2].IndexAnim; }
 //derrota por KO
-if (P[2].Energy<=0) { rest(HitPauseKO); EndRoundSlowDown=1; AHitP1=0; P[2].StartFrame=timer; PLAYER_STATE(2, 570, 0, P[2].TotalDeFramesMov[570]); P1HitPause=HitPause3; P[2].Energy=0; P1HitOn=P[2].IndexAnim; }
+if (P[2].Energy<=0) { PausaKO=HitPauseKO*Ctrl_FPS/1000; EndRoundSlowDown=1; AHitP1=0; P[2].StartFrame=LogicTick; PLAYER_STATE(2, 570, 0, P[2].TotalDeFramesMov[570]); P1HitPause=HitPause3; P[2].Energy=0; P1HitOn=P[2].IndexAnim; }
 }
 
 //Chacoalha os personagens após o Hit, e os desloca
@@ -10669,18 +10692,7 @@ P[2].t_slot[i]=0;
 P[2].ticks_4slot=0;
 }
 for(i=1; i<=2;i++){
-P[i].key_UP_pressed=0; P[i].key_UP_released=0; P[i].key_UP_hold=0; P[i].key_UP_status=0;
-P[i].key_DOWN_pressed=0; P[i].key_DOWN_released=0; P[i].key_DOWN_hold=0; P[i].key_DOWN_status=0;
-P[i].key_LEFT_pressed=0; P[i].key_LEFT_released=0; P[i].key_LEFT_hold=0; P[i].key_LEFT_status=0;
-P[i].key_RIGHT_pressed=0; P[i].key_RIGHT_released=0; P[i].key_RIGHT_hold=0; P[i].key_RIGHT_status=0;
-P[i].key_BT1_pressed=0; P[i].key_BT1_released=0; P[i].key_BT1_hold=0; P[i].key_BT1_status=0;
-P[i].key_BT2_pressed=0; P[i].key_BT2_released=0; P[i].key_BT2_hold=0; P[i].key_BT2_status=0;
-P[i].key_BT3_pressed=0; P[i].key_BT3_released=0; P[i].key_BT3_hold=0; P[i].key_BT3_status=0;
-P[i].key_BT4_pressed=0; P[i].key_BT4_released=0; P[i].key_BT4_hold=0; P[i].key_BT4_status=0;
-P[i].key_BT5_pressed=0; P[i].key_BT5_released=0; P[i].key_BT5_hold=0; P[i].key_BT5_status=0;
-P[i].key_BT6_pressed=0; P[i].key_BT6_released=0; P[i].key_BT6_hold=0; P[i].key_BT6_status=0;
-P[i].key_SELECT_pressed=0; P[i].key_SELECT_released=0; P[i].key_SELECT_hold=0; P[i].key_SELECT_status=0;
-P[i].key_START_pressed=0; P[i].key_START_released=0; P[i].key_START_hold=0; P[i].key_START_status=0;
+hamoopi_input_clear(&P[i].Teclas);
 }
 }
 
@@ -10864,10 +10876,7 @@ Fireball[Player].y = -9999;
 // CRIA NOVO HITSPARK ---------------------------------------------------------------------------------------------------------------------------
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void New_HitBox(int Qtde_HitBoxes){
-//if ( colisaoxP2==1 ){
-Qtde_HitBox++;
-
+void New_HitBox(){
 //SONS DE HIT
 if(colisaoxP1==1){
 if(ForcaDoGolpeP2==1){ PlaySoundHitLvl1=1; }
@@ -10880,27 +10889,80 @@ if(ForcaDoGolpeP1==2){ PlaySoundHitLvl2=1; }
 if(ForcaDoGolpeP1==3){ PlaySoundHitLvl3=1; }
 }
 
+//pool cheio: o spark e descartado, o som continua
+int ind=hamoopi_pool_spawn(&HitSparks);
+if (ind<0) return;
+
 if ( colisaoxP2==1 ){
-HitSpark[Qtde_HitBoxes].x = P1_Hit_x;
-HitSpark[Qtde_HitBoxes].y = P1_Hit_y;
-if ( ForcaDoGolpeP1==1 ) { HitSpark[Qtde_HitBoxes].Type = 991; HitSpark[Qtde_HitBox].XAlign=-30; }
-if ( ForcaDoGolpeP1==2 ) { HitSpark[Qtde_HitBoxes].Type = 992; HitSpark[Qtde_HitBox].XAlign=-50; }
-if ( ForcaDoGolpeP1==3 ) { HitSpark[Qtde_HitBoxes].Type = 993; HitSpark[Qtde_HitBox].XAlign=-65; }
+HitSparks.x[ind] = P1_Hit_x;
+HitSparks.y[ind] = P1_Hit_y;
+if ( ForcaDoGolpeP1==1 ) { HitSparks.type[ind] = 991; HitSparks.param[ind]=-30; }
+if ( ForcaDoGolpeP1==2 ) { HitSparks.type[ind] = 992; HitSparks.param[ind]=-50; }
+if ( ForcaDoGolpeP1==3 ) { HitSparks.type[ind] = 993; HitSparks.param[ind]=-65; }
 }
 if ( colisaoxP1==1 ){
-HitSpark[Qtde_HitBoxes].x = P2_Hit_x;
-HitSpark[Qtde_HitBoxes].y = P2_Hit_y;
-if ( ForcaDoGolpeP2==1 ) { HitSpark[Qtde_HitBoxes].Type = 991; HitSpark[Qtde_HitBox].XAlign=-30; }
-if ( ForcaDoGolpeP2==2 ) { HitSpark[Qtde_HitBoxes].Type = 992; HitSpark[Qtde_HitBox].XAlign=-50; }
-if ( ForcaDoGolpeP2==3 ) { HitSpark[Qtde_HitBoxes].Type = 993; HitSpark[Qtde_HitBox].XAlign=-65; }
-}
-
-HitSpark[Qtde_HitBoxes].StartFrame=timer;
-HitSpark[Qtde_HitBoxes].FrameTime=1;
-HitSpark[Qtde_HitBoxes].TotalFrames=5;
-HitSpark[Qtde_HitBoxes].IndexAnim=0;
-HitSpark[Qtde_HitBoxes].YAlign=HitSpark[Qtde_HitBoxes].XAlign;
-//}
+HitSparks.x[ind] = P2_Hit_x;
+HitSparks.y[ind] = P2_Hit_y;
+if ( ForcaDoGolpeP2==1 ) { HitSparks.type[ind] = 991; HitSparks.param[ind]=-30; }
+if ( ForcaDoGolpeP2==2 ) { HitSparks.type[ind] = 992; HitSparks.param[ind]=-50; }
+if ( ForcaDoGolpeP2==3 ) { HitSparks.type[ind] = 993; HitSparks.param[ind]=-65; }
+}
+
+HitSparks.timer[ind]=LogicTick;
+HitSparks.frame_time[ind]=1;
+HitSparks.frames[ind]=5;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TABELA DE GOLPES -----------------------------------------------------------------------------------------------------------------------------
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//linha do TableAtlas correspondente ao State/Anim, sem varrer a tabela
+int LinhaDoAtlas(int PlayerInd, int State, int AnimIndex){
+if(State<0 || State>999 || AnimIndex<0 || AnimIndex>29) { return 0; }
+return P[PlayerInd].LinhaAtlas[State][AnimIndex];
+}
+
+//pre-calcula a forca do golpe e o momento (em pe, abaixado, pulando...) de cada State,
+//para o Aplicar_HIT() apenas consultar a tabela.
+//A forca pode ser redefinida no char.ini com HitLevel=1,2 ou 3 na secao do State.
+void MontaTabelaDeGolpes(int PlayerInd){
+
+int ind = PlayerInd;
+char Caminho[99];
+sprintf(Caminho, "data/chars/%s/char.ini", P[ind].Name); set_config_file(Caminho);
+
+for(int State=0; State<=999; State++){
+int grupo = State/10;
+int d = State%10;
+int Forca = 0;
+int Momento = 0;
+
+//golpes: X01/X04 fraco, X02/X05 medio, X03/X06 forte
+int golpe = (d>=1 && d<=6);
+if (golpe && ( grupo==10 || grupo==11 || grupo==15 || grupo==20 || grupo==21 || grupo==22 ||
+grupo==30 || grupo==31 || grupo==32 || grupo==41 || grupo==42 )) { Forca = (d-1)%3+1; }
+
+if (State==100 || State==410 || State==420 || (State>=602 && State<=607)) { Momento=1; } //De pe
+if (golpe && ( grupo==10 || grupo==11 || grupo==15 || grupo==41 || grupo==42 )) { Momento=1; }
+if (State==200 || State==601 || State==608) { Momento=2; } //Abaixado
+if (golpe && ( grupo==20 || grupo==21 || grupo==22 )) { Momento=2; }
+if (State==300 || State==310 || State==320) { Momento=3; } //Pulando
+if (golpe && ( grupo==30 || grupo==31 || grupo==32 )) { Momento=3; }
+if ((State>=501 && State<=503) || (State>=511 && State<=513)) { Momento=51; } //Hurt em pe
+if (State>=504 && State<=506) { Momento=52; } //Hurt abaixado
+if (State>=507 && State<=509) { Momento=53; } //Hurt no ar
+if (State==250 || State==450) { Momento=9; } //Defesa
+
+if (State>=100 && State<999 && P[ind].TotalDeFramesMov[State]>-1) {
+char State_s[5]; sprintf(State_s, "%i", State);
+Forca = get_config_int(State_s, "HitLevel", Forca);
+}
+
+P[ind].ForcaDoState[State]=Forca;
+P[ind].MomentoDoState[State]=Momento;
+}
+
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////